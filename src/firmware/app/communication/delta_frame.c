@@ -0,0 +1,277 @@
+#include "firmware/app/communication/delta_frame.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Gets the key of a map entry. nanopb generates map entries as structs with the key as
+ * the first member, so the key is at the start of the entry.
+ *
+ * @param entry The map entry
+ *
+ * @return the key of the map entry
+ */
+static uint32_t app_delta_frame_getEntryKey(const uint8_t* entry)
+{
+    uint32_t key;
+    memcpy(&key, entry, sizeof(key));
+    return key;
+}
+
+/**
+ * Finds the entry with the given key in an array of map entries
+ *
+ * @param entries The map entries
+ * @param entries_count The number of entries
+ * @param entry_size The size of an entry in bytes
+ * @param key The key to look for
+ *
+ * @return the index of the entry with the given key, or entries_count if there is no
+ * entry with the key
+ */
+static pb_size_t app_delta_frame_findEntry(const uint8_t* entries,
+                                           pb_size_t entries_count, size_t entry_size,
+                                           uint32_t key)
+{
+    for (pb_size_t i = 0; i < entries_count; i++)
+    {
+        if (app_delta_frame_getEntryKey(entries + i * entry_size) == key)
+        {
+            return i;
+        }
+    }
+    return entries_count;
+}
+
+/**
+ * Removes the entry at the given index from an array of map entries by moving the last
+ * entry into its place
+ *
+ * @param entries The map entries
+ * @param entries_count [in/out] The number of entries
+ * @param entry_size The size of an entry in bytes
+ * @param index The index of the entry to remove
+ */
+static void app_delta_frame_removeEntry(uint8_t* entries, pb_size_t* entries_count,
+                                        size_t entry_size, pb_size_t index)
+{
+    (*entries_count)--;
+    if (index != *entries_count)
+    {
+        memcpy(entries + index * entry_size, entries + *entries_count * entry_size,
+               entry_size);
+    }
+}
+
+/**
+ * Finds the version of a robot's entry in the given delta frame info
+ *
+ * @param delta_frame_info The delta frame info
+ * @param robot_id The id of the robot
+ * @param version [out] Set to the version of the robot's entry if it is found
+ *
+ * @return true if the version was found, false otherwise
+ */
+static bool app_delta_frame_findVersion(const TbotsProto_DeltaFrameInfo* delta_frame_info,
+                                        uint32_t robot_id, uint32_t* version)
+{
+    for (pb_size_t i = 0; i < delta_frame_info->robot_entry_versions_count; i++)
+    {
+        if (delta_frame_info->robot_entry_versions[i].key == robot_id)
+        {
+            *version = delta_frame_info->robot_entry_versions[i].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Sets or removes the version of a robot's entry in the given delta frame info
+ *
+ * @param delta_frame_info [in/out] The delta frame info
+ * @param robot_id The id of the robot
+ * @param has_version Whether the robot's entry has a version, the version is removed if
+ * it doesn't
+ * @param version The version of the robot's entry
+ */
+static void app_delta_frame_setVersion(TbotsProto_DeltaFrameInfo* delta_frame_info,
+                                       uint32_t robot_id, bool has_version,
+                                       uint32_t version)
+{
+    const size_t max_versions_count = sizeof(delta_frame_info->robot_entry_versions) /
+                                      sizeof(delta_frame_info->robot_entry_versions[0]);
+
+    pb_size_t index = app_delta_frame_findEntry(
+        (const uint8_t*)delta_frame_info->robot_entry_versions,
+        delta_frame_info->robot_entry_versions_count,
+        sizeof(delta_frame_info->robot_entry_versions[0]), robot_id);
+    bool found = index < delta_frame_info->robot_entry_versions_count;
+
+    if (!has_version)
+    {
+        if (found)
+        {
+            app_delta_frame_removeEntry((uint8_t*)delta_frame_info->robot_entry_versions,
+                                        &delta_frame_info->robot_entry_versions_count,
+                                        sizeof(delta_frame_info->robot_entry_versions[0]),
+                                        index);
+        }
+        return;
+    }
+
+    if (!found)
+    {
+        if (delta_frame_info->robot_entry_versions_count >= max_versions_count)
+        {
+            return;
+        }
+        delta_frame_info->robot_entry_versions_count++;
+    }
+    delta_frame_info->robot_entry_versions[index].key   = robot_id;
+    delta_frame_info->robot_entry_versions[index].value = version;
+}
+
+/**
+ * Merges the map entries of a received frame into the map entries that have been merged
+ * so far. The delta frame info of the merged frame holds the sequence number of the
+ * last frame merged and the version of every merged entry.
+ *
+ * @param merged_entries [in/out] The merged map entries
+ * @param merged_entries_count [in/out] The number of merged entries
+ * @param merged_info [in/out] The delta frame info of the merged frame
+ * @param received_entries [in] The map entries of the received frame
+ * @param received_entries_count The number of received entries
+ * @param received_info [in] The delta frame info of the received frame
+ * @param entry_size The size of a map entry in bytes
+ * @param max_entries_count The most entries the merged entries can hold
+ *
+ * @return the result of merging the frame
+ */
+static DeltaFrameMergeResult_t app_delta_frame_mergeEntries(
+    uint8_t* merged_entries, pb_size_t* merged_entries_count,
+    TbotsProto_DeltaFrameInfo* merged_info, const uint8_t* received_entries,
+    pb_size_t received_entries_count, const TbotsProto_DeltaFrameInfo* received_info,
+    size_t entry_size, size_t max_entries_count)
+{
+    // Senders that don't use delta frames always send sequence number 0, and the
+    // merged sequence number is 0 until a frame from a sender that does is merged.
+    // Comparing the difference as a signed number handles the sequence number wrapping
+    // around.
+    const uint32_t sequence_number = received_info->sequence_number;
+    if (sequence_number != 0 && merged_info->sequence_number != 0 &&
+        (int32_t)(sequence_number - merged_info->sequence_number) <= 0)
+    {
+        return DELTA_FRAME_IGNORED;
+    }
+    if (sequence_number != 0)
+    {
+        merged_info->sequence_number = sequence_number;
+    }
+
+    uint32_t version;
+    if (!received_info->is_delta)
+    {
+        *merged_entries_count                   = 0;
+        merged_info->robot_entry_versions_count = 0;
+    }
+    else
+    {
+        // Robots the sender no longer has an entry for are left out of the versions
+        pb_size_t i = 0;
+        while (i < *merged_entries_count)
+        {
+            uint32_t robot_id =
+                app_delta_frame_getEntryKey(merged_entries + i * entry_size);
+            if (!app_delta_frame_findVersion(received_info, robot_id, &version))
+            {
+                app_delta_frame_removeEntry(merged_entries, merged_entries_count,
+                                            entry_size, i);
+                app_delta_frame_setVersion(merged_info, robot_id, false, 0);
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    for (pb_size_t i = 0; i < received_entries_count; i++)
+    {
+        const uint8_t* received_entry = received_entries + i * entry_size;
+        uint32_t robot_id             = app_delta_frame_getEntryKey(received_entry);
+
+        pb_size_t index = app_delta_frame_findEntry(merged_entries, *merged_entries_count,
+                                                    entry_size, robot_id);
+        if (index == *merged_entries_count)
+        {
+            if (*merged_entries_count >= max_entries_count)
+            {
+                continue;
+            }
+            (*merged_entries_count)++;
+        }
+        memcpy(merged_entries + index * entry_size, received_entry, entry_size);
+
+        bool has_version = app_delta_frame_findVersion(received_info, robot_id, &version);
+        app_delta_frame_setVersion(merged_info, robot_id, has_version, version);
+    }
+
+    for (pb_size_t i = 0; i < received_info->robot_entry_versions_count; i++)
+    {
+        uint32_t merged_version;
+        if (!app_delta_frame_findVersion(merged_info,
+                                         received_info->robot_entry_versions[i].key,
+                                         &merged_version) ||
+            merged_version != received_info->robot_entry_versions[i].value)
+        {
+            return DELTA_FRAME_OUT_OF_DATE;
+        }
+    }
+    return DELTA_FRAME_UP_TO_DATE;
+}
+
+DeltaFrameMergeResult_t app_delta_frame_mergePrimitiveSet(
+    TbotsProto_PrimitiveSet* merged_primitive_set,
+    const TbotsProto_PrimitiveSet* received_primitive_set)
+{
+    DeltaFrameMergeResult_t result = app_delta_frame_mergeEntries(
+        (uint8_t*)merged_primitive_set->robot_primitives,
+        &merged_primitive_set->robot_primitives_count,
+        &merged_primitive_set->delta_frame_info,
+        (const uint8_t*)received_primitive_set->robot_primitives,
+        received_primitive_set->robot_primitives_count,
+        &received_primitive_set->delta_frame_info,
+        sizeof(merged_primitive_set->robot_primitives[0]),
+        sizeof(merged_primitive_set->robot_primitives) /
+            sizeof(merged_primitive_set->robot_primitives[0]));
+
+    if (result != DELTA_FRAME_IGNORED)
+    {
+        merged_primitive_set->has_time_sent = received_primitive_set->has_time_sent;
+        merged_primitive_set->time_sent     = received_primitive_set->time_sent;
+        merged_primitive_set->has_delta_frame_info = true;
+    }
+    return result;
+}
+
+DeltaFrameMergeResult_t app_delta_frame_mergeVision(
+    TbotsProto_Vision* merged_vision, const TbotsProto_Vision* received_vision)
+{
+    DeltaFrameMergeResult_t result = app_delta_frame_mergeEntries(
+        (uint8_t*)merged_vision->robot_states, &merged_vision->robot_states_count,
+        &merged_vision->delta_frame_info, (const uint8_t*)received_vision->robot_states,
+        received_vision->robot_states_count, &received_vision->delta_frame_info,
+        sizeof(merged_vision->robot_states[0]),
+        sizeof(merged_vision->robot_states) / sizeof(merged_vision->robot_states[0]));
+
+    if (result != DELTA_FRAME_IGNORED)
+    {
+        merged_vision->has_time_sent        = received_vision->has_time_sent;
+        merged_vision->time_sent            = received_vision->time_sent;
+        merged_vision->has_ball_state       = received_vision->has_ball_state;
+        merged_vision->ball_state           = received_vision->ball_state;
+        merged_vision->has_delta_frame_info = true;
+    }
+    return result;
+}
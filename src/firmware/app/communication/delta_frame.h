@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "shared/proto/tbots_software_msgs.nanopb.h"
+
+typedef enum
+{
+    // The frame is older than the last frame merged, so it was ignored
+    DELTA_FRAME_IGNORED,
+    // The frame was merged, and the entry of every robot is up to date
+    DELTA_FRAME_UP_TO_DATE,
+    // The frame was merged, but some robots have entries that are out of date because
+    // the frame they were last sent in was missed. They are brought up to date by the
+    // next keyframe.
+    DELTA_FRAME_OUT_OF_DATE,
+} DeltaFrameMergeResult_t;
+
+/**
+ * Merges a received PrimitiveSet, which may be a delta frame that only has the
+ * primitives that have changed since the last keyframe, into a PrimitiveSet that has
+ * the latest primitive for every robot. See DeltaFrameInfo in tbots_software_msgs.proto
+ * for how the frames are described.
+ *
+ * The delta frame info of the merged PrimitiveSet is used to keep track of the frames
+ * that have been merged, so the merged PrimitiveSet must start zero initialized and
+ * must only be modified by this function.
+ *
+ * @param merged_primitive_set [in/out] The PrimitiveSet to merge the received
+ * PrimitiveSet into
+ * @param received_primitive_set [in] The PrimitiveSet that was received
+ *
+ * @return whether the received PrimitiveSet was merged, and if the merged PrimitiveSet
+ * is up to date
+ */
+DeltaFrameMergeResult_t app_delta_frame_mergePrimitiveSet(
+    TbotsProto_PrimitiveSet* merged_primitive_set,
+    const TbotsProto_PrimitiveSet* received_primitive_set);
+
+/**
+ * Merges a received Vision, which may be a delta frame that only has the robot states
+ * that have changed since the last keyframe, into a Vision that has the latest state of
+ * every robot. The time sent and ball state are always taken from the received Vision.
+ *
+ * The delta frame info of the merged Vision is used to keep track of the frames that
+ * have been merged, so the merged Vision must start zero initialized and must only be
+ * modified by this function.
+ *
+ * @param merged_vision [in/out] The Vision to merge the received Vision into
+ * @param received_vision [in] The Vision that was received
+ *
+ * @return whether the received Vision was merged, and if the merged Vision is up to
+ * date
+ */
+DeltaFrameMergeResult_t app_delta_frame_mergeVision(
+    TbotsProto_Vision* merged_vision, const TbotsProto_Vision* received_vision);
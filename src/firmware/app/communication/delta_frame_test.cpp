@@ -0,0 +1,256 @@
+extern "C"
+{
+#include "firmware/app/communication/delta_frame.h"
+
+#include "shared/proto/tbots_software_msgs.nanopb.h"
+}
+
+#include <gtest/gtest.h>
+
+class DeltaFrameMergeTest : public testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        merged   = TbotsProto_PrimitiveSet_init_zero;
+        received = TbotsProto_PrimitiveSet_init_zero;
+    }
+
+    /**
+     * Starts a new received frame
+     *
+     * @param sequence_number The sequence number of the frame
+     * @param is_delta Whether the frame is a delta frame
+     */
+    void startFrame(uint32_t sequence_number, bool is_delta)
+    {
+        received                                  = TbotsProto_PrimitiveSet_init_zero;
+        received.delta_frame_info.sequence_number = sequence_number;
+        received.delta_frame_info.is_delta        = is_delta;
+    }
+
+    /**
+     * Adds a primitive for the given robot to the received frame, that stops the
+     * robot's wheels if coast is true and brakes them otherwise
+     *
+     * @param robot_id The id of the robot
+     * @param coast Whether the robot should coast
+     */
+    void addPrimitive(uint32_t robot_id, bool coast)
+    {
+        TbotsProto_PrimitiveSet_RobotPrimitivesEntry& entry =
+            received.robot_primitives[received.robot_primitives_count++];
+        entry.key                   = robot_id;
+        entry.value.which_primitive = TbotsProto_Primitive_stop_tag;
+        entry.value.primitive.stop.stop_type =
+            coast ? TbotsProto_StopPrimitive_StopType_COAST
+                  : TbotsProto_StopPrimitive_StopType_BRAKE;
+    }
+
+    /**
+     * Adds the version of the given robot's primitive to the received frame
+     *
+     * @param robot_id The id of the robot
+     * @param version The version of the robot's primitive
+     */
+    void addVersion(uint32_t robot_id, uint32_t version)
+    {
+        TbotsProto_DeltaFrameInfo_RobotEntryVersionsEntry& entry =
+            received.delta_frame_info.robot_entry_versions
+                [received.delta_frame_info.robot_entry_versions_count++];
+        entry.key   = robot_id;
+        entry.value = version;
+    }
+
+    /**
+     * Finds the merged primitive for the given robot
+     *
+     * @param robot_id The id of the robot
+     *
+     * @return the merged primitive for the robot, or nullptr if there isn't one
+     */
+    const TbotsProto_Primitive* findMergedPrimitive(uint32_t robot_id)
+    {
+        for (pb_size_t i = 0; i < merged.robot_primitives_count; i++)
+        {
+            if (merged.robot_primitives[i].key == robot_id)
+            {
+                return &merged.robot_primitives[i].value;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Checks whether the merged primitive for the given robot is a stop primitive that
+     * coasts or brakes
+     *
+     * @param robot_id The id of the robot
+     * @param coast Whether the stop primitive should coast
+     *
+     * @return true if the merged primitive matches, false otherwise
+     */
+    bool mergedPrimitiveIs(uint32_t robot_id, bool coast)
+    {
+        const TbotsProto_Primitive* primitive = findMergedPrimitive(robot_id);
+        return primitive != nullptr &&
+               primitive->which_primitive == TbotsProto_Primitive_stop_tag &&
+               primitive->primitive.stop.stop_type ==
+                   (coast ? TbotsProto_StopPrimitive_StopType_COAST
+                          : TbotsProto_StopPrimitive_StopType_BRAKE);
+    }
+
+    TbotsProto_PrimitiveSet merged;
+    TbotsProto_PrimitiveSet received;
+};
+
+TEST_F(DeltaFrameMergeTest, keyframe_replaces_every_primitive)
+{
+    startFrame(1, false);
+    addPrimitive(1, true);
+    addPrimitive(2, true);
+    addVersion(1, 1);
+    addVersion(2, 1);
+    EXPECT_EQ(DELTA_FRAME_UP_TO_DATE,
+              app_delta_frame_mergePrimitiveSet(&merged, &received));
+
+    startFrame(2, false);
+    addPrimitive(3, false);
+    addVersion(3, 1);
+    EXPECT_EQ(DELTA_FRAME_UP_TO_DATE,
+              app_delta_frame_mergePrimitiveSet(&merged, &received));
+
+    EXPECT_EQ(1, merged.robot_primitives_count);
+    EXPECT_TRUE(mergedPrimitiveIs(3, false));
+}
+
+TEST_F(DeltaFrameMergeTest, delta_frame_keeps_primitives_left_out)
+{
+    startFrame(1, false);
+    addPrimitive(1, true);
+    addPrimitive(2, true);
+    addVersion(1, 1);
+    addVersion(2, 1);
+    app_delta_frame_mergePrimitiveSet(&merged, &received);
+
+    startFrame(2, true);
+    addPrimitive(2, false);
+    addVersion(1, 1);
+    addVersion(2, 2);
+    EXPECT_EQ(DELTA_FRAME_UP_TO_DATE,
+              app_delta_frame_mergePrimitiveSet(&merged, &received));
+
+    EXPECT_EQ(2, merged.robot_primitives_count);
+    EXPECT_TRUE(mergedPrimitiveIs(1, true));
+    EXPECT_TRUE(mergedPrimitiveIs(2, false));
+}
+
+TEST_F(DeltaFrameMergeTest, delta_frame_removes_robots_without_version)
+{
+    startFrame(1, false);
+    addPrimitive(1, true);
+    addPrimitive(2, true);
+    addVersion(1, 1);
+    addVersion(2, 1);
+    app_delta_frame_mergePrimitiveSet(&merged, &received);
+
+    startFrame(2, true);
+    addVersion(2, 1);
+    EXPECT_EQ(DELTA_FRAME_UP_TO_DATE,
+              app_delta_frame_mergePrimitiveSet(&merged, &received));
+
+    EXPECT_EQ(1, merged.robot_primitives_count);
+    EXPECT_EQ(nullptr, findMergedPrimitive(1));
+    EXPECT_TRUE(mergedPrimitiveIs(2, true));
+}
+
+TEST_F(DeltaFrameMergeTest, out_of_date_when_keyframe_missed)
+{
+    // The keyframe with robot 1's primitive was missed
+    startFrame(2, true);
+    addPrimitive(2, true);
+    addVersion(1, 1);
+    addVersion(2, 1);
+    EXPECT_EQ(DELTA_FRAME_OUT_OF_DATE,
+              app_delta_frame_mergePrimitiveSet(&merged, &received));
+    EXPECT_TRUE(mergedPrimitiveIs(2, true));
+
+    startFrame(3, false);
+    addPrimitive(1, true);
+    addPrimitive(2, true);
+    addVersion(1, 1);
+    addVersion(2, 1);
+    EXPECT_EQ(DELTA_FRAME_UP_TO_DATE,
+              app_delta_frame_mergePrimitiveSet(&merged, &received));
+}
+
+TEST_F(DeltaFrameMergeTest, old_frames_ignored)
+{
+    startFrame(5, false);
+    addPrimitive(1, true);
+    addVersion(1, 2);
+    app_delta_frame_mergePrimitiveSet(&merged, &received);
+
+    startFrame(4, false);
+    addPrimitive(1, false);
+    addVersion(1, 1);
+    EXPECT_EQ(DELTA_FRAME_IGNORED, app_delta_frame_mergePrimitiveSet(&merged, &received));
+    EXPECT_TRUE(mergedPrimitiveIs(1, true));
+
+    startFrame(5, false);
+    EXPECT_EQ(DELTA_FRAME_IGNORED, app_delta_frame_mergePrimitiveSet(&merged, &received));
+}
+
+TEST_F(DeltaFrameMergeTest, sequence_number_wraps_around)
+{
+    startFrame(UINT32_MAX, false);
+    addPrimitive(1, true);
+    app_delta_frame_mergePrimitiveSet(&merged, &received);
+
+    startFrame(1, false);
+    addPrimitive(1, false);
+    EXPECT_EQ(DELTA_FRAME_UP_TO_DATE,
+              app_delta_frame_mergePrimitiveSet(&merged, &received));
+    EXPECT_TRUE(mergedPrimitiveIs(1, false));
+}
+
+TEST_F(DeltaFrameMergeTest, frames_from_sender_without_delta_frames_always_merged)
+{
+    for (bool coast : {true, false, true})
+    {
+        startFrame(0, false);
+        addPrimitive(1, coast);
+        EXPECT_EQ(DELTA_FRAME_UP_TO_DATE,
+                  app_delta_frame_mergePrimitiveSet(&merged, &received));
+        EXPECT_TRUE(mergedPrimitiveIs(1, coast));
+    }
+}
+
+TEST(DeltaFrameMergeVisionTest, ball_state_taken_from_received_vision)
+{
+    TbotsProto_Vision merged   = TbotsProto_Vision_init_zero;
+    TbotsProto_Vision received = TbotsProto_Vision_init_zero;
+
+    received.delta_frame_info.sequence_number               = 1;
+    received.delta_frame_info.robot_entry_versions_count    = 1;
+    received.delta_frame_info.robot_entry_versions[0].key   = 3;
+    received.delta_frame_info.robot_entry_versions[0].value = 1;
+    received.robot_states_count                             = 1;
+    received.robot_states[0].key                            = 3;
+    received.robot_states[0].value.global_position.x_meters = 1.0f;
+    received.has_ball_state                                 = true;
+    received.ball_state.global_position.x_meters            = 2.0f;
+    EXPECT_EQ(DELTA_FRAME_UP_TO_DATE, app_delta_frame_mergeVision(&merged, &received));
+    EXPECT_TRUE(merged.has_ball_state);
+
+    // Robot 3's state hasn't changed, so it is left out of the delta frame
+    received.delta_frame_info.sequence_number    = 2;
+    received.delta_frame_info.is_delta           = true;
+    received.robot_states_count                  = 0;
+    received.ball_state.global_position.x_meters = 3.0f;
+    EXPECT_EQ(DELTA_FRAME_UP_TO_DATE, app_delta_frame_mergeVision(&merged, &received));
+
+    EXPECT_EQ(1, merged.robot_states_count);
+    EXPECT_FLOAT_EQ(1.0f, merged.robot_states[0].value.global_position.x_meters);
+    EXPECT_FLOAT_EQ(3.0f, merged.ball_state.global_position.x_meters);
+}
@@ -0,0 +1,200 @@
+#include "firmware/app/communication/primitive_set_decoder.h"
+
+/**
+ * Finds the key of an entry of the map of primitives in a PrimitiveSet
+ *
+ * @param entry_stream The stream of the serialized entry. It is passed by value, so
+ * the caller's stream is left at the start of the entry
+ * @param key [out] Set to the key of the entry, which is 0 if the entry leaves it out
+ *
+ * @return true if the key was found, false if the entry is malformed
+ */
+static bool app_primitive_set_decoder_findEntryKey(pb_istream_t entry_stream,
+                                                   uint32_t* key)
+{
+    pb_wire_type_t wire_type;
+    uint32_t tag;
+    bool eof;
+
+    *key = 0;
+    while (pb_decode_tag(&entry_stream, &wire_type, &tag, &eof))
+    {
+        if (tag == TbotsProto_PrimitiveSet_RobotPrimitivesEntry_key_tag &&
+            wire_type == PB_WT_VARINT)
+        {
+            uint64_t value;
+            if (!pb_decode_varint(&entry_stream, &value))
+            {
+                return false;
+            }
+            *key = (uint32_t)value;
+        }
+        else if (!pb_skip_field(&entry_stream, wire_type))
+        {
+            return false;
+        }
+    }
+    return eof;
+}
+
+/**
+ * Decodes the primitive in an entry of the map of primitives in a PrimitiveSet
+ *
+ * @param entry_stream [in/out] The stream of the serialized entry
+ * @param has_primitive [out] Set to whether the entry has a primitive
+ * @param primitive [out] The primitive to decode into, which is zero initialized if the
+ * entry leaves it out
+ *
+ * @return true if the entry was decoded, false if it is malformed
+ */
+static bool app_primitive_set_decoder_decodeEntryValue(pb_istream_t* entry_stream,
+                                                       bool* has_primitive,
+                                                       TbotsProto_Primitive* primitive)
+{
+    pb_wire_type_t wire_type;
+    uint32_t tag;
+    bool eof;
+
+    *has_primitive = false;
+    *primitive     = (TbotsProto_Primitive)TbotsProto_Primitive_init_zero;
+    while (pb_decode_tag(entry_stream, &wire_type, &tag, &eof))
+    {
+        if (tag == TbotsProto_PrimitiveSet_RobotPrimitivesEntry_value_tag &&
+            wire_type == PB_WT_STRING)
+        {
+            pb_istream_t value_stream;
+            if (!pb_make_string_substream(entry_stream, &value_stream))
+            {
+                return false;
+            }
+            bool decoded =
+                pb_decode(&value_stream, TbotsProto_Primitive_fields, primitive);
+            pb_close_string_substream(entry_stream, &value_stream);
+            if (!decoded)
+            {
+                return false;
+            }
+            *has_primitive = true;
+        }
+        else if (!pb_skip_field(entry_stream, wire_type))
+        {
+            return false;
+        }
+    }
+    return eof;
+}
+
+/**
+ * Removes every version from the given delta frame info except the version of the
+ * given robot's entry
+ *
+ * @param delta_frame_info [in/out] The delta frame info
+ * @param robot_id The id of the robot to keep the version of
+ */
+static void app_primitive_set_decoder_keepOnlyRobotVersion(
+    TbotsProto_DeltaFrameInfo* delta_frame_info, uint32_t robot_id)
+{
+    for (pb_size_t i = 0; i < delta_frame_info->robot_entry_versions_count; i++)
+    {
+        if (delta_frame_info->robot_entry_versions[i].key == robot_id)
+        {
+            delta_frame_info->robot_entry_versions[0] =
+                delta_frame_info->robot_entry_versions[i];
+            delta_frame_info->robot_entry_versions_count = 1;
+            return;
+        }
+    }
+    delta_frame_info->robot_entry_versions_count = 0;
+}
+
+bool app_primitive_set_decoder_decodeForRobot(pb_istream_t* stream, uint32_t robot_id,
+                                              TbotsProto_PrimitiveSet* primitive_set)
+{
+    // Like pb_decode, the has_ flags of the submessages are only set if they are present
+    primitive_set->has_time_sent = false;
+    primitive_set->time_sent     = (TbotsProto_Timestamp)TbotsProto_Timestamp_init_zero;
+    primitive_set->robot_primitives_count = 0;
+    primitive_set->has_delta_frame_info   = false;
+    primitive_set->delta_frame_info =
+        (TbotsProto_DeltaFrameInfo)TbotsProto_DeltaFrameInfo_init_zero;
+
+    pb_wire_type_t wire_type;
+    uint32_t tag;
+    bool eof;
+    while (pb_decode_tag(stream, &wire_type, &tag, &eof))
+    {
+        if (wire_type != PB_WT_STRING)
+        {
+            if (!pb_skip_field(stream, wire_type))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        pb_istream_t field_stream;
+        if (!pb_make_string_substream(stream, &field_stream))
+        {
+            return false;
+        }
+
+        bool decoded = true;
+        switch (tag)
+        {
+            case TbotsProto_PrimitiveSet_time_sent_tag:
+            {
+                decoded = pb_decode(&field_stream, TbotsProto_Timestamp_fields,
+                                    &primitive_set->time_sent);
+                primitive_set->has_time_sent = true;
+                break;
+            }
+            case TbotsProto_PrimitiveSet_robot_primitives_tag:
+            {
+                // The entries of other robots are left unread, and skipped below
+                uint32_t key;
+                decoded = app_primitive_set_decoder_findEntryKey(field_stream, &key);
+                if (decoded && key == robot_id)
+                {
+                    TbotsProto_PrimitiveSet_RobotPrimitivesEntry* entry =
+                        &primitive_set->robot_primitives[0];
+                    entry->key = key;
+                    decoded    = app_primitive_set_decoder_decodeEntryValue(
+                        &field_stream, &entry->has_value, &entry->value);
+                    primitive_set->robot_primitives_count = 1;
+                }
+                break;
+            }
+            case TbotsProto_PrimitiveSet_delta_frame_info_tag:
+            {
+                decoded = pb_decode(&field_stream, TbotsProto_DeltaFrameInfo_fields,
+                                    &primitive_set->delta_frame_info);
+                primitive_set->has_delta_frame_info = true;
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        // Closing a substream doesn't skip the part of it that wasn't read, so we skip
+        // it first
+        if (decoded)
+        {
+            decoded = pb_read(&field_stream, NULL, field_stream.bytes_left);
+        }
+        pb_close_string_substream(stream, &field_stream);
+        if (!decoded)
+        {
+            return false;
+        }
+    }
+    if (!eof)
+    {
+        return false;
+    }
+
+    app_primitive_set_decoder_keepOnlyRobotVersion(&primitive_set->delta_frame_info,
+                                                   robot_id);
+    return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <pb_decode.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "shared/proto/tbots_software_msgs.nanopb.h"
+
+/**
+ * Decodes a serialized PrimitiveSet, keeping only the primitive for the given robot.
+ * The primitives of the other robots are skipped over without being decoded, and the
+ * primitive for the given robot is decoded directly into the given PrimitiveSet, so
+ * decoding takes about as long as decoding a single primitive and doesn't use any
+ * memory besides the given PrimitiveSet.
+ *
+ * The decoded PrimitiveSet is what a sender that only had the given robot would have
+ * sent: it has the robot's primitive if the serialized PrimitiveSet does, and its delta
+ * frame info only has the version of the robot's primitive. This means it can be
+ * merged with app_delta_frame_mergePrimitiveSet the same way as a PrimitiveSet that was
+ * fully decoded.
+ *
+ * @pre stream was created with pb_istream_from_buffer, since the entries of the map of
+ * primitives are read twice, once to find their robot id and once to decode them
+ *
+ * @param stream [in/out] The stream to decode the PrimitiveSet from
+ * @param robot_id The id of the robot to keep the primitive for
+ * @param primitive_set [out] The PrimitiveSet to decode into. Only the members that are
+ * decoded are written, so the entries after the first are left as they were
+ *
+ * @return true if the PrimitiveSet was decoded, false if it is malformed
+ */
+bool app_primitive_set_decoder_decodeForRobot(pb_istream_t* stream, uint32_t robot_id,
+                                              TbotsProto_PrimitiveSet* primitive_set);
@@ -0,0 +1,231 @@
+extern "C"
+{
+#include "firmware/app/communication/primitive_set_decoder.h"
+
+#include "firmware/app/communication/delta_frame.h"
+#include "shared/proto/tbots_software_msgs.nanopb.h"
+}
+
+#include <gtest/gtest.h>
+#include <pb_encode.h>
+
+#include <vector>
+
+class PrimitiveSetDecoderTest : public testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        primitive_set = TbotsProto_PrimitiveSet_init_zero;
+        decoded       = TbotsProto_PrimitiveSet_init_zero;
+    }
+
+    /**
+     * Adds a move primitive for the given robot to the PrimitiveSet, to a destination
+     * that depends on the robot id
+     *
+     * @param robot_id The id of the robot
+     */
+    void addPrimitive(uint32_t robot_id)
+    {
+        TbotsProto_PrimitiveSet_RobotPrimitivesEntry& entry =
+            primitive_set.robot_primitives[primitive_set.robot_primitives_count++];
+        entry.key                                      = robot_id;
+        entry.has_value                                = true;
+        entry.value.which_primitive                    = TbotsProto_Primitive_move_tag;
+        entry.value.primitive.move.has_position_params = true;
+        entry.value.primitive.move.position_params.has_destination = true;
+        entry.value.primitive.move.position_params.destination.x_meters =
+            static_cast<float>(robot_id);
+        entry.value.primitive.move.position_params.destination.y_meters = -1.0f;
+    }
+
+    /**
+     * Adds the version of the given robot's primitive to the PrimitiveSet
+     *
+     * @param robot_id The id of the robot
+     * @param version The version of the robot's primitive
+     */
+    void addVersion(uint32_t robot_id, uint32_t version)
+    {
+        primitive_set.has_delta_frame_info = true;
+        TbotsProto_DeltaFrameInfo_RobotEntryVersionsEntry& entry =
+            primitive_set.delta_frame_info.robot_entry_versions
+                [primitive_set.delta_frame_info.robot_entry_versions_count++];
+        entry.key   = robot_id;
+        entry.value = version;
+    }
+
+    /**
+     * Encodes the PrimitiveSet
+     *
+     * @return the encoded PrimitiveSet
+     */
+    std::vector<uint8_t> encode()
+    {
+        std::vector<uint8_t> buffer(4096);
+        pb_ostream_t stream = pb_ostream_from_buffer(buffer.data(), buffer.size());
+        EXPECT_TRUE(pb_encode(&stream, TbotsProto_PrimitiveSet_fields, &primitive_set));
+        buffer.resize(stream.bytes_written);
+        return buffer;
+    }
+
+    /**
+     * Decodes the given encoded PrimitiveSet for the given robot into decoded
+     *
+     * @param buffer The encoded PrimitiveSet
+     * @param robot_id The id of the robot to decode the primitive for
+     *
+     * @return whether the PrimitiveSet was decoded
+     */
+    bool decodeForRobot(const std::vector<uint8_t>& buffer, uint32_t robot_id)
+    {
+        pb_istream_t stream = pb_istream_from_buffer(buffer.data(), buffer.size());
+        return app_primitive_set_decoder_decodeForRobot(&stream, robot_id, &decoded);
+    }
+
+    TbotsProto_PrimitiveSet primitive_set;
+    TbotsProto_PrimitiveSet decoded;
+};
+
+TEST_F(PrimitiveSetDecoderTest, decodes_only_primitive_for_robot)
+{
+    primitive_set.has_time_sent                     = true;
+    primitive_set.time_sent.epoch_timestamp_seconds = 12.5;
+    for (uint32_t robot_id = 0; robot_id < 6; robot_id++)
+    {
+        addPrimitive(robot_id);
+    }
+
+    ASSERT_TRUE(decodeForRobot(encode(), 4));
+
+    EXPECT_TRUE(decoded.has_time_sent);
+    EXPECT_EQ(12.5, decoded.time_sent.epoch_timestamp_seconds);
+    EXPECT_FALSE(decoded.has_delta_frame_info);
+    ASSERT_EQ(1, decoded.robot_primitives_count);
+    EXPECT_EQ(4u, decoded.robot_primitives[0].key);
+    EXPECT_TRUE(decoded.robot_primitives[0].has_value);
+    const TbotsProto_Primitive& primitive = decoded.robot_primitives[0].value;
+    ASSERT_EQ(TbotsProto_Primitive_move_tag, primitive.which_primitive);
+    EXPECT_EQ(4.0f, primitive.primitive.move.position_params.destination.x_meters);
+    EXPECT_EQ(-1.0f, primitive.primitive.move.position_params.destination.y_meters);
+}
+
+TEST_F(PrimitiveSetDecoderTest, no_primitive_when_robot_has_no_entry)
+{
+    addPrimitive(1);
+    addPrimitive(2);
+    primitive_set.has_delta_frame_info             = true;
+    primitive_set.delta_frame_info.sequence_number = 7;
+
+    ASSERT_TRUE(decodeForRobot(encode(), 3));
+
+    EXPECT_EQ(0, decoded.robot_primitives_count);
+    EXPECT_TRUE(decoded.has_delta_frame_info);
+    EXPECT_EQ(7u, decoded.delta_frame_info.sequence_number);
+}
+
+TEST_F(PrimitiveSetDecoderTest, keeps_only_version_of_robot)
+{
+    addPrimitive(1);
+    addVersion(1, 3);
+    addVersion(2, 5);
+    addVersion(3, 8);
+    primitive_set.delta_frame_info.is_delta = true;
+
+    ASSERT_TRUE(decodeForRobot(encode(), 2));
+
+    EXPECT_EQ(0, decoded.robot_primitives_count);
+    EXPECT_TRUE(decoded.delta_frame_info.is_delta);
+    ASSERT_EQ(1, decoded.delta_frame_info.robot_entry_versions_count);
+    EXPECT_EQ(2u, decoded.delta_frame_info.robot_entry_versions[0].key);
+    EXPECT_EQ(5u, decoded.delta_frame_info.robot_entry_versions[0].value);
+}
+
+TEST_F(PrimitiveSetDecoderTest, malformed_primitive_set_not_decoded)
+{
+    addPrimitive(1);
+    addPrimitive(2);
+    std::vector<uint8_t> buffer = encode();
+    buffer.resize(buffer.size() - 3);
+
+    EXPECT_FALSE(decodeForRobot(buffer, 2));
+}
+
+TEST_F(PrimitiveSetDecoderTest, merges_the_same_as_fully_decoded_primitive_set)
+{
+    // A keyframe with primitives for robots 1 and 2, then a delta frame that only
+    // changes robot 2's primitive, then a delta frame that removes robot 2
+    std::vector<std::vector<uint8_t>> frames;
+    primitive_set.has_delta_frame_info             = true;
+    primitive_set.delta_frame_info.sequence_number = 1;
+    addPrimitive(1);
+    addPrimitive(2);
+    addVersion(1, 1);
+    addVersion(2, 1);
+    frames.emplace_back(encode());
+
+    SetUp();
+    primitive_set.has_delta_frame_info             = true;
+    primitive_set.delta_frame_info.sequence_number = 2;
+    primitive_set.delta_frame_info.is_delta        = true;
+    addPrimitive(2);
+    primitive_set.robot_primitives[0]
+        .value.primitive.move.position_params.destination.y_meters = 3.0f;
+    addVersion(1, 1);
+    addVersion(2, 2);
+    frames.emplace_back(encode());
+
+    SetUp();
+    primitive_set.has_delta_frame_info             = true;
+    primitive_set.delta_frame_info.sequence_number = 3;
+    primitive_set.delta_frame_info.is_delta        = true;
+    addVersion(1, 1);
+    frames.emplace_back(encode());
+
+    static TbotsProto_PrimitiveSet fully_merged;
+    static TbotsProto_PrimitiveSet fully_decoded;
+    static TbotsProto_PrimitiveSet merged;
+    fully_merged = TbotsProto_PrimitiveSet_init_zero;
+    merged       = TbotsProto_PrimitiveSet_init_zero;
+
+    const uint32_t robot_id                    = 2;
+    const std::vector<float> expected_y_meters = {-1.0f, 3.0f};
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        pb_istream_t stream = pb_istream_from_buffer(frames[i].data(), frames[i].size());
+        fully_decoded       = TbotsProto_PrimitiveSet_init_zero;
+        ASSERT_TRUE(pb_decode(&stream, TbotsProto_PrimitiveSet_fields, &fully_decoded));
+        EXPECT_NE(DELTA_FRAME_IGNORED,
+                  app_delta_frame_mergePrimitiveSet(&fully_merged, &fully_decoded));
+
+        ASSERT_TRUE(decodeForRobot(frames[i], robot_id));
+        EXPECT_EQ(DELTA_FRAME_UP_TO_DATE,
+                  app_delta_frame_mergePrimitiveSet(&merged, &decoded));
+
+        const TbotsProto_Primitive* fully_merged_primitive = nullptr;
+        for (pb_size_t j = 0; j < fully_merged.robot_primitives_count; j++)
+        {
+            if (fully_merged.robot_primitives[j].key == robot_id)
+            {
+                fully_merged_primitive = &fully_merged.robot_primitives[j].value;
+            }
+        }
+
+        if (i < expected_y_meters.size())
+        {
+            ASSERT_NE(nullptr, fully_merged_primitive);
+            ASSERT_EQ(1, merged.robot_primitives_count);
+            EXPECT_EQ(expected_y_meters[i], fully_merged_primitive->primitive.move
+                                                .position_params.destination.y_meters);
+            EXPECT_EQ(expected_y_meters[i],
+                      merged.robot_primitives[0]
+                          .value.primitive.move.position_params.destination.y_meters);
+        }
+        else
+        {
+            EXPECT_EQ(nullptr, fully_merged_primitive);
+            EXPECT_EQ(0, merged.robot_primitives_count);
+        }
+    }
+}
@@ -0,0 +1,329 @@
+#include "firmware/app/control/mpc_controller.h"
+
+#include <assert.h>
+#include <math.h>
+
+#include "firmware/shared/physics.h"
+
+// The number of axes the robot is modelled along: x, y and orientation
+#define NUM_AXES 3
+
+// The number of wheels on the robot
+#define NUM_WHEELS 4
+
+// The number of iterations of the solver to run every tick. The plan from the previous
+// tick is a good starting point, so only a few iterations are needed
+#define NUM_SOLVER_ITERATIONS 20
+
+// The weights of the squared position and velocity errors in the cost, for the x, y and
+// orientation axes
+static const float POSITION_ERROR_WEIGHTS[NUM_AXES] = {400.0f, 400.0f, 40.0f};
+static const float VELOCITY_ERROR_WEIGHTS[NUM_AXES] = {4.0f, 4.0f, 0.4f};
+
+// The weight of the squared wheel accelerations in the cost, which keeps the plan
+// smooth when the robot is already on the reference
+static const float WHEEL_ACCELERATION_WEIGHT = 1e-4f;
+
+/**
+ * Gets the matrix that converts wheel accelerations into accelerations along the axes
+ * of the global frame, for a robot at the given orientation
+ *
+ * @param orientation The orientation of the robot [rad]
+ * @param wheel_to_axis_acceleration [out] The matrix, where element [i][j] is the
+ * acceleration along axis i caused by a unit acceleration of wheel j
+ */
+static void getWheelToAxisAccelerationMatrix(
+    float orientation, float wheel_to_axis_acceleration[NUM_AXES][NUM_WHEELS])
+{
+    const float cos_orientation = cosf(orientation);
+    const float sin_orientation = sinf(orientation);
+    for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+    {
+        // The wheel forces are converted to robot forces the same way they are in
+        // app_control_applyAccel, where the rotational force is divided by the
+        // rotational mass of the robot instead of its point mass
+        float wheel_acceleration[NUM_WHEELS] = {0.0f, 0.0f, 0.0f, 0.0f};
+        wheel_acceleration[wheel]            = 1.0f;
+        float robot_acceleration[3];
+        speed4_to_speed3(wheel_acceleration, robot_acceleration);
+
+        wheel_to_axis_acceleration[0][wheel] = cos_orientation * robot_acceleration[0] -
+                                               sin_orientation * robot_acceleration[1];
+        wheel_to_axis_acceleration[1][wheel] = sin_orientation * robot_acceleration[0] +
+                                               cos_orientation * robot_acceleration[1];
+        wheel_to_axis_acceleration[2][wheel] =
+            robot_acceleration[2] / (INERTIAL_FACTOR * ROBOT_RADIUS);
+    }
+}
+
+/**
+ * Gets an upper bound on the largest eigenvalue of the Hessian of the cost with respect
+ * to the wheel accelerations, which limits how large the solver's steps can be
+ *
+ * @param wheel_to_axis_acceleration [in] The wheel to axis acceleration matrix
+ *
+ * @return The upper bound on the largest eigenvalue of the Hessian
+ */
+static float getHessianEigenvalueBound(
+    const float wheel_to_axis_acceleration[NUM_AXES][NUM_WHEELS])
+{
+    const float dt = MPC_CONTROLLER_HORIZON_STEP_SECONDS;
+
+    // Bound the norms of the matrices that map the accelerations along an axis to the
+    // positions and velocities along it by their Frobenius norms
+    float position_norm_squared = 0.0f;
+    for (unsigned int i = 1; i <= MPC_CONTROLLER_HORIZON_LENGTH; i++)
+    {
+        for (unsigned int k = 0; k < i; k++)
+        {
+            const float sensitivity = dt * dt * ((float)(i - k) - 0.5f);
+            position_norm_squared += sensitivity * sensitivity;
+        }
+    }
+    const float velocity_norm_squared = dt * dt * MPC_CONTROLLER_HORIZON_LENGTH *
+                                        (MPC_CONTROLLER_HORIZON_LENGTH + 1) / 2.0f;
+
+    // The Hessian is the sum over the axes of the outer product of the row of the wheel
+    // to axis acceleration matrix for the axis with the Hessian for the axis, so its
+    // largest eigenvalue is at most the sum of their largest eigenvalues
+    float bound = 0.0f;
+    for (unsigned int axis = 0; axis < NUM_AXES; axis++)
+    {
+        float row_norm_squared = 0.0f;
+        for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+        {
+            row_norm_squared += wheel_to_axis_acceleration[axis][wheel] *
+                                wheel_to_axis_acceleration[axis][wheel];
+        }
+        const float axis_bound =
+            2.0f * (POSITION_ERROR_WEIGHTS[axis] * position_norm_squared +
+                    VELOCITY_ERROR_WEIGHTS[axis] * velocity_norm_squared);
+        bound += row_norm_squared * axis_bound;
+    }
+
+    return bound + 2.0f * WHEEL_ACCELERATION_WEIGHT;
+}
+
+/**
+ * Computes the gradient of the cost with respect to the wheel accelerations, by
+ * simulating the robot forward over the horizon and then propagating the errors back
+ *
+ * @param wheel_accelerations [in] The wheel accelerations to compute the gradient at
+ * @param wheel_to_axis_acceleration [in] The wheel to axis acceleration matrix
+ * @param initial_positions [in] The current position along each axis
+ * @param initial_velocities [in] The current velocity along each axis
+ * @param reference_positions [in] The reference position along each axis at each step
+ * @param reference_velocities [in] The reference velocity along each axis at each step
+ * @param gradient [out] The gradient of the cost with respect to the wheel
+ * accelerations
+ */
+static void computeGradient(
+    const float wheel_accelerations[MPC_CONTROLLER_HORIZON_LENGTH][NUM_WHEELS],
+    const float wheel_to_axis_acceleration[NUM_AXES][NUM_WHEELS],
+    const float initial_positions[NUM_AXES], const float initial_velocities[NUM_AXES],
+    const float reference_positions[MPC_CONTROLLER_HORIZON_LENGTH + 1][NUM_AXES],
+    const float reference_velocities[MPC_CONTROLLER_HORIZON_LENGTH + 1][NUM_AXES],
+    float gradient[MPC_CONTROLLER_HORIZON_LENGTH][NUM_WHEELS])
+{
+    const float dt = MPC_CONTROLLER_HORIZON_STEP_SECONDS;
+
+    // Simulate forward, storing the derivative of the cost with respect to the
+    // position and velocity at every step
+    float position_error_gradients[MPC_CONTROLLER_HORIZON_LENGTH + 1][NUM_AXES];
+    float velocity_error_gradients[MPC_CONTROLLER_HORIZON_LENGTH + 1][NUM_AXES];
+    for (unsigned int axis = 0; axis < NUM_AXES; axis++)
+    {
+        float position = initial_positions[axis];
+        float velocity = initial_velocities[axis];
+        for (unsigned int k = 0; k < MPC_CONTROLLER_HORIZON_LENGTH; k++)
+        {
+            float acceleration = 0.0f;
+            for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+            {
+                acceleration += wheel_to_axis_acceleration[axis][wheel] *
+                                wheel_accelerations[k][wheel];
+            }
+            position += velocity * dt + 0.5f * acceleration * dt * dt;
+            velocity += acceleration * dt;
+
+            position_error_gradients[k + 1][axis] =
+                2.0f * POSITION_ERROR_WEIGHTS[axis] *
+                (position - reference_positions[k + 1][axis]);
+            velocity_error_gradients[k + 1][axis] =
+                2.0f * VELOCITY_ERROR_WEIGHTS[axis] *
+                (velocity - reference_velocities[k + 1][axis]);
+        }
+    }
+
+    // Propagate backwards. The acceleration at step k changes the position at every
+    // later step i by dt^2 * (i - k - 0.5) and the velocity by dt, so we accumulate
+    // the sums of the later errors, and of the later position errors weighted by how
+    // many steps later they are
+    float position_error_sums[NUM_AXES]          = {0.0f, 0.0f, 0.0f};
+    float weighted_position_error_sums[NUM_AXES] = {0.0f, 0.0f, 0.0f};
+    float velocity_error_sums[NUM_AXES]          = {0.0f, 0.0f, 0.0f};
+    for (int k = MPC_CONTROLLER_HORIZON_LENGTH - 1; k >= 0; k--)
+    {
+        float axis_gradient[NUM_AXES];
+        for (unsigned int axis = 0; axis < NUM_AXES; axis++)
+        {
+            position_error_sums[axis] += position_error_gradients[k + 1][axis];
+            velocity_error_sums[axis] += velocity_error_gradients[k + 1][axis];
+            weighted_position_error_sums[axis] += position_error_sums[axis];
+            axis_gradient[axis] = dt * dt *
+                                      (weighted_position_error_sums[axis] -
+                                       0.5f * position_error_sums[axis]) +
+                                  dt * velocity_error_sums[axis];
+        }
+
+        for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+        {
+            float wheel_gradient =
+                2.0f * WHEEL_ACCELERATION_WEIGHT * wheel_accelerations[k][wheel];
+            for (unsigned int axis = 0; axis < NUM_AXES; axis++)
+            {
+                wheel_gradient +=
+                    wheel_to_axis_acceleration[axis][wheel] * axis_gradient[axis];
+            }
+            gradient[k][wheel] = wheel_gradient;
+        }
+    }
+}
+
+void app_mpc_controller_init(MpcController_t* controller)
+{
+    for (unsigned int k = 0; k < MPC_CONTROLLER_HORIZON_LENGTH; k++)
+    {
+        for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+        {
+            controller->wheel_accelerations[k][wheel] = 0.0f;
+        }
+    }
+}
+
+void app_mpc_controller_computeAcceleration(MpcController_t* controller,
+                                            MpcRobotState_t state,
+                                            const MpcReference_t* reference,
+                                            float max_wheel_acceleration,
+                                            float robot_acceleration[3])
+{
+    assert(max_wheel_acceleration > 0.0f);
+
+    const float dt = MPC_CONTROLLER_HORIZON_STEP_SECONDS;
+
+    float wheel_to_axis_acceleration[NUM_AXES][NUM_WHEELS];
+    getWheelToAxisAccelerationMatrix(state.orientation, wheel_to_axis_acceleration);
+    const float step_size = 1.0f / getHessianEigenvalueBound(wheel_to_axis_acceleration);
+
+    // The reference orientations are made relative to the current orientation, so the
+    // robot always turns the shortest way to them
+    const float initial_positions[NUM_AXES]  = {state.position_x, state.position_y,
+                                               state.orientation};
+    const float initial_velocities[NUM_AXES] = {state.velocity_x, state.velocity_y,
+                                                state.angular_velocity};
+    float reference_positions[MPC_CONTROLLER_HORIZON_LENGTH + 1][NUM_AXES];
+    float reference_velocities[MPC_CONTROLLER_HORIZON_LENGTH + 1][NUM_AXES];
+    for (unsigned int k = 0; k <= MPC_CONTROLLER_HORIZON_LENGTH; k++)
+    {
+        reference_positions[k][0] = reference->position_x[k];
+        reference_positions[k][1] = reference->position_y[k];
+        reference_positions[k][2] =
+            state.orientation +
+            min_angle_delta(state.orientation, reference->orientation[k]);
+    }
+    for (unsigned int axis = 0; axis < NUM_AXES; axis++)
+    {
+        reference_velocities[0][axis] = initial_velocities[axis];
+        for (unsigned int k = 1; k <= MPC_CONTROLLER_HORIZON_LENGTH; k++)
+        {
+            reference_velocities[k][axis] =
+                (reference_positions[k][axis] - reference_positions[k - 1][axis]) / dt;
+        }
+    }
+
+    // Warm start from the plan from the previous tick, shifted forward by a step
+    float wheel_accelerations[MPC_CONTROLLER_HORIZON_LENGTH][NUM_WHEELS];
+    for (unsigned int k = 0; k < MPC_CONTROLLER_HORIZON_LENGTH; k++)
+    {
+        const unsigned int previous_k =
+            (k + 1 < MPC_CONTROLLER_HORIZON_LENGTH) ? k + 1 : k;
+        for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+        {
+            wheel_accelerations[k][wheel] =
+                controller->wheel_accelerations[previous_k][wheel];
+        }
+    }
+
+    // Accelerated projected gradient descent (FISTA), where the projection clamps each
+    // wheel acceleration to its limit
+    float extrapolated[MPC_CONTROLLER_HORIZON_LENGTH][NUM_WHEELS];
+    float gradient[MPC_CONTROLLER_HORIZON_LENGTH][NUM_WHEELS];
+    for (unsigned int k = 0; k < MPC_CONTROLLER_HORIZON_LENGTH; k++)
+    {
+        for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+        {
+            extrapolated[k][wheel] = wheel_accelerations[k][wheel];
+        }
+    }
+    float momentum = 1.0f;
+    for (unsigned int iteration = 0; iteration < NUM_SOLVER_ITERATIONS; iteration++)
+    {
+        computeGradient((const float(*)[NUM_WHEELS])extrapolated,
+                        (const float(*)[NUM_WHEELS])wheel_to_axis_acceleration,
+                        initial_positions, initial_velocities,
+                        (const float(*)[NUM_AXES])reference_positions,
+                        (const float(*)[NUM_AXES])reference_velocities, gradient);
+
+        const float next_momentum =
+            0.5f * (1.0f + sqrtf(1.0f + 4.0f * momentum * momentum));
+        const float extrapolation = (momentum - 1.0f) / next_momentum;
+        momentum                  = next_momentum;
+
+        for (unsigned int k = 0; k < MPC_CONTROLLER_HORIZON_LENGTH; k++)
+        {
+            for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+            {
+                float next = extrapolated[k][wheel] - step_size * gradient[k][wheel];
+                next =
+                    fminf(fmaxf(next, -max_wheel_acceleration), max_wheel_acceleration);
+
+                extrapolated[k][wheel] =
+                    next + extrapolation * (next - wheel_accelerations[k][wheel]);
+                wheel_accelerations[k][wheel] = next;
+            }
+        }
+    }
+
+    for (unsigned int k = 0; k < MPC_CONTROLLER_HORIZON_LENGTH; k++)
+    {
+        for (unsigned int wheel = 0; wheel < NUM_WHEELS; wheel++)
+        {
+            controller->wheel_accelerations[k][wheel] = wheel_accelerations[k][wheel];
+        }
+    }
+
+    // Apply the first step of the plan
+    float first_robot_acceleration[3];
+    speed4_to_speed3(wheel_accelerations[0], first_robot_acceleration);
+    robot_acceleration[0] = first_robot_acceleration[0];
+    robot_acceleration[1] = first_robot_acceleration[1];
+    robot_acceleration[2] =
+        first_robot_acceleration[2] / (INERTIAL_FACTOR * ROBOT_RADIUS);
+}
+
+float app_mpc_controller_getMaxWheelAcceleration(const FirmwareRobot_t* robot)
+{
+    // The same limit app_control_applyAccel scales the wheel forces down to, where the
+    // voltage lost to the motor's phase resistance reaches the voltage the wheel slips
+    // at
+    const WheelConstants_t wheel_constants =
+        app_wheel_getWheelConstants(app_firmware_robot_getFrontLeftWheel(robot));
+    const RobotConstants_t robot_constants = app_firmware_robot_getRobotConstants(robot);
+
+    const float max_wheel_force =
+        wheel_constants.motor_max_voltage_before_wheel_slip /
+        (wheel_constants.motor_current_per_unit_torque *
+         wheel_constants.motor_phase_resistance * wheel_constants.wheel_radius *
+         wheel_constants.wheel_rotations_per_motor_rotation);
+    return max_wheel_force / robot_constants.mass;
+}
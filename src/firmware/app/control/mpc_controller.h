@@ -0,0 +1,88 @@
+#pragma once
+
+#include "firmware/app/world/firmware_robot.h"
+
+/**
+ * A model-predictive controller that tracks a reference trajectory. Every control tick
+ * it plans the acceleration of each wheel over a short horizon, by minimizing the
+ * error between the predicted and reference positions and velocities, subject to a
+ * limit on the acceleration of each wheel. Only the first planned acceleration is
+ * applied, and the rest of the plan is used as the starting point for the next tick.
+ *
+ * The robot is modelled as a double integrator in x, y and orientation, with the
+ * orientation of the robot held constant over the horizon, which keeps the problem a
+ * small quadratic program. It is solved with a fixed number of iterations of
+ * accelerated projected gradient descent, so the time it takes is bounded, and all
+ * the memory it needs is in MpcController_t.
+ */
+
+// The number of steps in the horizon the controller plans over
+#define MPC_CONTROLLER_HORIZON_LENGTH 10
+
+// The duration of each step in the horizon [s]
+#define MPC_CONTROLLER_HORIZON_STEP_SECONDS 0.04f
+
+typedef struct MpcRobotState
+{
+    float position_x;
+    float position_y;
+    float orientation;
+    float velocity_x;
+    float velocity_y;
+    float angular_velocity;
+} MpcRobotState_t;
+
+/**
+ * The reference trajectory over the horizon, in the global frame. Element k is the
+ * reference k * MPC_CONTROLLER_HORIZON_STEP_SECONDS from now, so element 0 is where the
+ * robot should be now.
+ */
+typedef struct MpcReference
+{
+    float position_x[MPC_CONTROLLER_HORIZON_LENGTH + 1];
+    float position_y[MPC_CONTROLLER_HORIZON_LENGTH + 1];
+    float orientation[MPC_CONTROLLER_HORIZON_LENGTH + 1];
+} MpcReference_t;
+
+typedef struct MpcController
+{
+    // The acceleration planned for each wheel at each step of the horizon [m/s^2]. This
+    // is the force on the wheel divided by the mass of the robot.
+    float wheel_accelerations[MPC_CONTROLLER_HORIZON_LENGTH][4];
+} MpcController_t;
+
+/**
+ * Initializes the given controller with a plan of no acceleration
+ *
+ * @param controller [out] The controller to initialize
+ */
+void app_mpc_controller_init(MpcController_t* controller);
+
+/**
+ * Plans the acceleration of the robot over the horizon and gets the acceleration to
+ * apply now
+ *
+ * @pre max_wheel_acceleration > 0
+ *
+ * @param controller [in/out] The controller, which stores the plan between ticks
+ * @param state The current state of the robot, in the global frame
+ * @param reference [in] The reference trajectory to track over the horizon
+ * @param max_wheel_acceleration The maximum acceleration of each wheel [m/s^2]
+ * @param robot_acceleration [out] The acceleration to apply now, as
+ * {x [m/s^2], y [m/s^2], angular [rad/s^2]} in the robot frame
+ */
+void app_mpc_controller_computeAcceleration(MpcController_t* controller,
+                                            MpcRobotState_t state,
+                                            const MpcReference_t* reference,
+                                            float max_wheel_acceleration,
+                                            float robot_acceleration[3]);
+
+/**
+ * Gets the maximum acceleration of each wheel of the given robot before it slips
+ *
+ * @param robot [in] The robot
+ *
+ * @return The maximum force each wheel can apply before slipping, divided by the mass
+ * of the robot [m/s^2]
+ */
+float app_mpc_controller_getMaxWheelAcceleration(const FirmwareRobot_t* robot);
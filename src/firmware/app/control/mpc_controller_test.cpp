@@ -0,0 +1,185 @@
+extern "C"
+{
+#include "firmware/app/control/mpc_controller.h"
+
+#include "firmware/shared/bang_bang_trajectory.h"
+#include "firmware/shared/physics.h"
+}
+
+#include <gtest/gtest.h>
+#include <math.h>
+
+class MpcControllerTest : public testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        app_mpc_controller_init(&controller);
+    }
+
+    /**
+     * Sets the reference to be stationary at the given pose for the whole horizon
+     */
+    void setStationaryReference(float x, float y, float orientation)
+    {
+        for (unsigned int k = 0; k <= MPC_CONTROLLER_HORIZON_LENGTH; k++)
+        {
+            reference.position_x[k]  = x;
+            reference.position_y[k]  = y;
+            reference.orientation[k] = orientation;
+        }
+    }
+
+    /**
+     * Sets the reference to follow the given trajectory from the given time, holding
+     * the given orientation
+     */
+    void setTrajectoryReference(const BangBangTrajectory2d_t& trajectory, float time,
+                                float orientation)
+    {
+        for (unsigned int k = 0; k <= MPC_CONTROLLER_HORIZON_LENGTH; k++)
+        {
+            Vector2d_t position = shared_bang_bang_trajectory_getPosition2d(
+                &trajectory, time + (float)k * MPC_CONTROLLER_HORIZON_STEP_SECONDS);
+            reference.position_x[k]  = position.x;
+            reference.position_y[k]  = position.y;
+            reference.orientation[k] = orientation;
+        }
+    }
+
+    MpcController_t controller;
+    MpcReference_t reference;
+
+    static constexpr float MAX_WHEEL_ACCELERATION = 3.0f;
+};
+
+TEST_F(MpcControllerTest, no_acceleration_when_on_stationary_reference)
+{
+    MpcRobotState_t state = {1.0f, -2.0f, 0.5f, 0.0f, 0.0f, 0.0f};
+    setStationaryReference(1.0f, -2.0f, 0.5f);
+
+    float acceleration[3];
+    app_mpc_controller_computeAcceleration(&controller, state, &reference,
+                                           MAX_WHEEL_ACCELERATION, acceleration);
+
+    EXPECT_NEAR(0.0f, acceleration[0], 1e-4f);
+    EXPECT_NEAR(0.0f, acceleration[1], 1e-4f);
+    EXPECT_NEAR(0.0f, acceleration[2], 1e-4f);
+}
+
+TEST_F(MpcControllerTest, accelerates_towards_reference_ahead_of_robot)
+{
+    MpcRobotState_t state = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    setStationaryReference(1.0f, 0.0f, 0.0f);
+
+    float acceleration[3];
+    app_mpc_controller_computeAcceleration(&controller, state, &reference,
+                                           MAX_WHEEL_ACCELERATION, acceleration);
+
+    EXPECT_GT(acceleration[0], 1.0f);
+    EXPECT_NEAR(0.0f, acceleration[1], 1e-3f);
+    EXPECT_NEAR(0.0f, acceleration[2], 1e-3f);
+}
+
+TEST_F(MpcControllerTest, acceleration_is_in_robot_frame)
+{
+    // The robot faces +y, so a reference in +y is straight ahead of it
+    MpcRobotState_t state = {0.0f, 0.0f, (float)M_PI / 2.0f, 0.0f, 0.0f, 0.0f};
+    setStationaryReference(0.0f, 1.0f, (float)M_PI / 2.0f);
+
+    float acceleration[3];
+    app_mpc_controller_computeAcceleration(&controller, state, &reference,
+                                           MAX_WHEEL_ACCELERATION, acceleration);
+
+    EXPECT_GT(acceleration[0], 1.0f);
+    EXPECT_NEAR(0.0f, acceleration[1], 1e-3f);
+    EXPECT_NEAR(0.0f, acceleration[2], 1e-3f);
+}
+
+TEST_F(MpcControllerTest, turns_the_shortest_way_to_reference_orientation)
+{
+    // The shortest way from just below pi to just above -pi is counterclockwise
+    MpcRobotState_t state = {0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f};
+    setStationaryReference(0.0f, 0.0f, -3.0f);
+
+    float acceleration[3];
+    app_mpc_controller_computeAcceleration(&controller, state, &reference,
+                                           MAX_WHEEL_ACCELERATION, acceleration);
+
+    EXPECT_GT(acceleration[2], 0.0f);
+}
+
+TEST_F(MpcControllerTest, planned_wheel_accelerations_are_within_limit)
+{
+    MpcRobotState_t state = {0.0f, 0.0f, 0.3f, -1.0f, 0.5f, 2.0f};
+    setStationaryReference(5.0f, -3.0f, -2.0f);
+
+    for (unsigned int tick = 0; tick < 10; tick++)
+    {
+        float acceleration[3];
+        app_mpc_controller_computeAcceleration(&controller, state, &reference,
+                                               MAX_WHEEL_ACCELERATION, acceleration);
+
+        for (unsigned int k = 0; k < MPC_CONTROLLER_HORIZON_LENGTH; k++)
+        {
+            for (unsigned int wheel = 0; wheel < 4; wheel++)
+            {
+                EXPECT_LE(fabsf(controller.wheel_accelerations[k][wheel]),
+                          MAX_WHEEL_ACCELERATION);
+            }
+        }
+    }
+}
+
+TEST_F(MpcControllerTest, closed_loop_tracks_trajectory_to_target)
+{
+    const Vector2d_t initial_position = {.x = 0.0f, .y = 0.0f};
+    const Vector2d_t final_position   = {.x = 2.0f, .y = 1.0f};
+    const Vector2d_t initial_velocity = {.x = 0.0f, .y = 0.0f};
+    const float orientation           = 1.0f;
+    BangBangTrajectory2d_t trajectory;
+    shared_bang_bang_trajectory_generate2d(&trajectory, initial_position, final_position,
+                                           initial_velocity, 1.5f, 1.5f);
+
+    // Simulate the robot as a double integrator, with the acceleration applied in the
+    // robot frame at the current orientation
+    MpcRobotState_t state          = {0.0f, 0.0f, orientation, 0.0f, 0.0f, 0.0f};
+    float max_distance_past_target = 0.0f;
+    const float total_time = shared_bang_bang_trajectory_getTotalTime2d(&trajectory);
+    const unsigned int num_ticks = (unsigned int)((total_time + 1.0f) / TICK_TIME);
+    for (unsigned int tick = 0; tick < num_ticks; tick++)
+    {
+        setTrajectoryReference(trajectory, (float)tick * TICK_TIME, orientation);
+
+        float acceleration[3];
+        app_mpc_controller_computeAcceleration(&controller, state, &reference,
+                                               MAX_WHEEL_ACCELERATION, acceleration);
+
+        const float cos_orientation = cosf(state.orientation);
+        const float sin_orientation = sinf(state.orientation);
+        const float acceleration_x =
+            cos_orientation * acceleration[0] - sin_orientation * acceleration[1];
+        const float acceleration_y =
+            sin_orientation * acceleration[0] + cos_orientation * acceleration[1];
+        state.position_x += state.velocity_x * TICK_TIME;
+        state.position_y += state.velocity_y * TICK_TIME;
+        state.orientation += state.angular_velocity * TICK_TIME;
+        state.velocity_x += acceleration_x * TICK_TIME;
+        state.velocity_y += acceleration_y * TICK_TIME;
+        state.angular_velocity += acceleration[2] * TICK_TIME;
+
+        // Project onto the direction of travel to find how far past the target we are
+        const float distance_past_target =
+            ((state.position_x - final_position.x) * 2.0f +
+             (state.position_y - final_position.y) * 1.0f) /
+            sqrtf(5.0f);
+        max_distance_past_target = fmaxf(max_distance_past_target, distance_past_target);
+    }
+
+    EXPECT_NEAR(final_position.x, state.position_x, 0.01f);
+    EXPECT_NEAR(final_position.y, state.position_y, 0.01f);
+    EXPECT_NEAR(orientation, state.orientation, 0.01f);
+    EXPECT_NEAR(0.0f, state.velocity_x, 0.05f);
+    EXPECT_NEAR(0.0f, state.velocity_y, 0.05f);
+    EXPECT_LT(max_distance_past_target, 0.03f);
+}
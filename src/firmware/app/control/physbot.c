@@ -1,6 +1,6 @@
 #include "firmware/app/control/physbot.h"
 
-#include "firmware/app/control/bangbang.h"
+#include "firmware/shared/bang_bang_trajectory.h"
 #include "firmware/shared/physics.h"
 
 #define TIME_HORIZON 0.05f  // s
@@ -30,11 +30,22 @@ PhysBot app_physbot_create(const FirmwareRobot_t *robot, float *destination,
 
 void app_physbot_planMove(Component *c, float *p)
 {
-    BBProfile profile;
-    app_bangbang_prepareTrajectoryMaxV(&profile, c->disp, c->vel, p[0], p[1], p[2]);
-    app_bangbang_planTrajectory(&profile);
-    c->accel = app_bangbang_computeAvgAccel(&profile, TIME_HORIZON);
-    c->time  = app_bangbang_computeProfileDuration(&profile);
+    // The trajectory ends at rest, so to pass the destination at the final speed we plan
+    // to stop past it, as far past it as it takes to stop from the final speed. We can
+    // only pass the destination moving towards it
+    const float final_speed = (p[0] * c->disp < 0.0f) ? 0.0f : p[0];
+    const float distance    = c->disp + final_speed * final_speed / (2.0f * p[1]);
+
+    BangBangTrajectory1d_t trajectory;
+    shared_bang_bang_trajectory_generate1d(&trajectory, 0.0f, distance, c->vel, p[2],
+                                           p[1]);
+
+    // Apply the average acceleration needed to reach the velocity on the trajectory at
+    // the time horizon
+    c->accel =
+        (shared_bang_bang_trajectory_getVelocity1d(&trajectory, TIME_HORIZON) - c->vel) /
+        TIME_HORIZON;
+    c->time = shared_bang_bang_trajectory_getTotalTime1d(&trajectory);
 }
 
 void app_physbot_computeAccelInLocalCoordinates(float *accel, PhysBot pb, float angle,
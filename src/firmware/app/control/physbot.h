@@ -58,7 +58,8 @@ PhysBot app_physbot_create(const FirmwareRobot_t *robot, float *destination,
                            float *major_vec, float *minor_vec);
 
 /**
- * Creates the BBProfile for a component. It is assumed that the displacement,
+ * Plans the bang-bang trajectory for a component, and stores the acceleration to apply
+ * now and the duration of the trajectory in it. It is assumed that the displacement,
  * velocity, and acceleration lie along the major or minor axis (i.e. the
  * Component given is a major or minor axis component).
  *
@@ -9,20 +9,39 @@
 #include "firmware/shared/math/polynomial_2d.h"
 #include "firmware/shared/math/tbots_math.h"
 
-TrajectoryPlannerGenerationStatus_t
-app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
-    FirmwareRobotPathParameters_t path_parameters,
-    PositionTrajectory_t* position_trajectory)
+/**
+ * Generates a constant parameterization position trajectory into the given arrays. All
+ * arrays must be able to hold at least path_parameters.num_elements elements, so that
+ * trajectories can be generated into arrays that are smaller than
+ * TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS
+ *
+ * @param path_parameters The path parameters that define the physical limitations
+ * and profile of the trajectory
+ * @param x_profile [out] The x position of each element
+ * @param y_profile [out] The y position of each element
+ * @param orientation_profile [out] The orientation of each element
+ * @param linear_speed [out] The linear speed at each element
+ * @param angular_speed [out] The angular speed at each element
+ * @param time_profile [out] The time each element is reached
+ * @param linear_segment_lengths [out] Working space for the length of each segment
+ * @param angular_segment_lengths [out] Working space for the angle of each segment
+ * @param max_allowable_speed_profile [out] Working space for the speed limits
+ * @param linear_time_profile [out] Working space for the linear segment durations
+ * @param angular_time_profile [out] Working space for the angular segment durations
+ *
+ * @return A status indicating whether or not generation was successful
+ */
+static TrajectoryPlannerGenerationStatus_t generatePositionTrajectory(
+    FirmwareRobotPathParameters_t path_parameters, float* x_profile, float* y_profile,
+    float* orientation_profile, float* linear_speed, float* angular_speed,
+    float* time_profile, float* linear_segment_lengths, float* angular_segment_lengths,
+    float* max_allowable_speed_profile, float* linear_time_profile,
+    float* angular_time_profile)
 {
     // Assign all of the path parameter data to local variables
     const unsigned int num_elements = path_parameters.num_elements;
     const float t_end               = path_parameters.t_end;
     const float t_start             = path_parameters.t_start;
-    float* x_profile                = position_trajectory->x_position;
-    float* y_profile                = position_trajectory->y_position;
-    float* orientation_profile      = position_trajectory->orientation;
-    float* angular_speed            = position_trajectory->angular_speed;
-    float* linear_speed             = position_trajectory->linear_speed;
     const float max_linear_acceleration =
         path_parameters.max_allowable_linear_acceleration;
     const float max_angular_acceleration =
@@ -34,9 +53,6 @@ app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
 
     Polynomial1dOrder3_t theta_poly = path_parameters.orientation_profile;
 
-    float linear_segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
-    float angular_segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
-
     // Generate the states and segment lengths for each dimension
     app_trajectory_planner_impl_generate2dSegmentNodesAndLengths(
         t_start, t_end, path_parameters.path, num_elements, x_profile, y_profile,
@@ -47,8 +63,6 @@ app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
         angular_segment_lengths);
 
     // Generate the max allowable speed profile for linear and angular profile
-    float max_allowable_speed_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
-
     app_trajectory_planner_impl_getMaximumSpeedProfile(
         path_parameters.path, num_elements, t_start, t_end, max_linear_acceleration,
         max_linear_speed, max_allowable_speed_profile);
@@ -97,9 +111,6 @@ app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
         return status;
     }
 
-    float linear_time_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
-    float angular_time_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
-
     // Generate the segment-based duration of each trajectory
     app_trajectory_planner_impl_generatePositionTrajectoryTimeProfile(
         linear_segment_lengths, linear_speed, num_elements, linear_time_profile);
@@ -110,11 +121,53 @@ app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
     app_trajectory_planner_impl_modifySpeedsToMatchLongestSegmentDuration(
         linear_segment_lengths, angular_segment_lengths, linear_time_profile,
         angular_time_profile, (float)num_elements, linear_speed, angular_speed,
-        position_trajectory->time_profile);
+        time_profile);
 
     return OK;
 }
 
+TrajectoryPlannerGenerationStatus_t
+app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
+    FirmwareRobotPathParameters_t path_parameters,
+    PositionTrajectory_t* position_trajectory)
+{
+    float linear_segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
+    float angular_segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
+    float max_allowable_speed_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
+    float linear_time_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
+    float angular_time_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
+
+    return generatePositionTrajectory(
+        path_parameters, position_trajectory->x_position, position_trajectory->y_position,
+        position_trajectory->orientation, position_trajectory->linear_speed,
+        position_trajectory->angular_speed, position_trajectory->time_profile,
+        linear_segment_lengths, angular_segment_lengths, max_allowable_speed_profile,
+        linear_time_profile, angular_time_profile);
+}
+
+TrajectoryPlannerGenerationStatus_t
+app_trajectory_planner_generateSegmentedPositionTrajectory(
+    FirmwareRobotPathParameters_t path_parameters,
+    SegmentedPositionTrajectory_t* segmented_trajectory)
+{
+    assert(path_parameters.num_elements <= TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS);
+
+    float linear_segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    float angular_segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    float max_allowable_speed_profile[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    float linear_time_profile[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    float angular_time_profile[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+
+    segmented_trajectory->num_elements = path_parameters.num_elements;
+    return generatePositionTrajectory(
+        path_parameters, segmented_trajectory->x_position,
+        segmented_trajectory->y_position, segmented_trajectory->orientation,
+        segmented_trajectory->linear_speed, segmented_trajectory->angular_speed,
+        segmented_trajectory->time_profile, linear_segment_lengths,
+        angular_segment_lengths, max_allowable_speed_profile, linear_time_profile,
+        angular_time_profile);
+}
+
 TrajectoryPlannerGenerationStatus_t
 app_trajectory_planner_generateConstantPeriodPositionTrajectory(
     float interpolation_period, FirmwareRobotPathParameters_t* path_parameters,
@@ -320,3 +373,65 @@ void app_trajectory_planner_generateVelocityTrajectory(
         0.0;  // Final angular velocity is always assumed to be zero
     velocity_time_profile[last_element_index] = position_time_profile[last_element_index];
 }
+
+PositionTrajectoryElement_t app_trajectory_planner_evaluateSegmentedPositionTrajectory(
+    const SegmentedPositionTrajectory_t* segmented_trajectory, float time)
+{
+    const float* time_profile             = segmented_trajectory->time_profile;
+    const unsigned int last_element_index = segmented_trajectory->num_elements - 1;
+
+    if (time <= time_profile[0])
+    {
+        return (PositionTrajectoryElement_t){
+            .x_position    = segmented_trajectory->x_position[0],
+            .y_position    = segmented_trajectory->y_position[0],
+            .orientation   = segmented_trajectory->orientation[0],
+            .linear_speed  = segmented_trajectory->linear_speed[0],
+            .angular_speed = segmented_trajectory->angular_speed[0]};
+    }
+    if (time >= time_profile[last_element_index])
+    {
+        return (PositionTrajectoryElement_t){
+            .x_position    = segmented_trajectory->x_position[last_element_index],
+            .y_position    = segmented_trajectory->y_position[last_element_index],
+            .orientation   = segmented_trajectory->orientation[last_element_index],
+            .linear_speed  = segmented_trajectory->linear_speed[last_element_index],
+            .angular_speed = segmented_trajectory->angular_speed[last_element_index]};
+    }
+
+    // Binary search for the segment containing the time, keeping
+    // time_profile[lower] <= time < time_profile[upper]
+    unsigned int lower = 0;
+    unsigned int upper = last_element_index;
+    while (upper - lower > 1)
+    {
+        const unsigned int middle = lower + (upper - lower) / 2;
+        if (time_profile[middle] <= time)
+        {
+            lower = middle;
+        }
+        else
+        {
+            upper = middle;
+        }
+    }
+
+    const float lower_time = time_profile[lower];
+    const float upper_time = time_profile[upper];
+    return (PositionTrajectoryElement_t){
+        .x_position = shared_tbots_math_linearInterpolation(
+            lower_time, segmented_trajectory->x_position[lower], upper_time,
+            segmented_trajectory->x_position[upper], time),
+        .y_position = shared_tbots_math_linearInterpolation(
+            lower_time, segmented_trajectory->y_position[lower], upper_time,
+            segmented_trajectory->y_position[upper], time),
+        .orientation = shared_tbots_math_linearInterpolation(
+            lower_time, segmented_trajectory->orientation[lower], upper_time,
+            segmented_trajectory->orientation[upper], time),
+        .linear_speed = shared_tbots_math_linearInterpolation(
+            lower_time, segmented_trajectory->linear_speed[lower], upper_time,
+            segmented_trajectory->linear_speed[upper], time),
+        .angular_speed = shared_tbots_math_linearInterpolation(
+            lower_time, segmented_trajectory->angular_speed[lower], upper_time,
+            segmented_trajectory->angular_speed[upper], time)};
+}
@@ -9,6 +9,11 @@
 // longest possible path is 9 meters with 1mm segments
 #define TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS 9000
 
+// The maximum number of elements in a segmented trajectory. Segmented trajectories are
+// evaluated between their elements when they are followed, so they only need enough
+// elements to capture the shape of the speed profile
+#define TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS 100
+
 typedef enum TrajectoryPlannerGenerationStatus
 {
     OK,
@@ -90,6 +95,38 @@ typedef struct VelocityTrajectory
     float time_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
 } VelocityTrajectory_t;
 
+/*
+ * A segmented trajectory is a compact alternative to a constant period trajectory. It
+ * stores the elements of a constant parameterization trajectory, and the time profile of
+ * the elements breaks the trajectory up into segments. The trajectory is evaluated at a
+ * time by finding the segment containing that time and interpolating between the
+ * elements at either end, which gives the same result as the element at that time in the
+ * constant period trajectory. This means only the part of the trajectory that is actually
+ * used is ever calculated.
+ */
+typedef struct SegmentedPositionTrajectory
+{
+    // The number of elements in the trajectory, which is one more than the number of
+    // segments
+    unsigned int num_elements;
+    float x_position[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    float y_position[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    float orientation[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    float linear_speed[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    float angular_speed[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+    // The time each element is reached, relative to the start of the trajectory
+    float time_profile[TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS];
+} SegmentedPositionTrajectory_t;
+
+typedef struct PositionTrajectoryElement
+{
+    float x_position;
+    float y_position;
+    float orientation;
+    float linear_speed;
+    float angular_speed;
+} PositionTrajectoryElement_t;
+
 /**
  * Function generates a constant parameterization position trajectory (each node is
  * defined by X,Y,Theta coordinates. Returns a planned trajectory with the list of
@@ -209,3 +246,40 @@ app_trajectory_planner_generateConstantPeriodPositionTrajectory(
 void app_trajectory_planner_generateVelocityTrajectory(
     PositionTrajectory_t *position_trajectory, unsigned int num_elements,
     VelocityTrajectory_t *velocity_trajectory);
+
+/**
+ * Function generates a segmented position trajectory from the path parameters. The
+ * elements of the segmented trajectory are the same as the elements of the constant
+ * parameterization trajectory generated from the same path parameters.
+ *
+ * @pre path_parameters.num_elements is at most
+ * TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS
+ *
+ * @param path_parameters The path parameters that define the physical limitations
+ * and profile of the trajectory.
+ *
+ * @param segmented_trajectory [out] The trajectory data struct to be modified to contain
+ * the segmented position trajectory
+ *
+ * @return A status indicating whether or not generation was successful
+ */
+TrajectoryPlannerGenerationStatus_t
+app_trajectory_planner_generateSegmentedPositionTrajectory(
+    FirmwareRobotPathParameters_t path_parameters,
+    SegmentedPositionTrajectory_t *segmented_trajectory);
+
+/**
+ * Function evaluates a segmented position trajectory at the given time by linearly
+ * interpolating between the elements at either end of the segment containing that time.
+ * The segment is found with a binary search, so this takes O(log(num_elements)) time.
+ *
+ * @param segmented_trajectory [in] A completely defined segmented position trajectory
+ *
+ * @param time The time to evaluate the trajectory at, relative to the start of the
+ * trajectory. Times before the start or after the end of the trajectory evaluate to the
+ * first or last element respectively. In seconds.
+ *
+ * @return The position trajectory element at the given time
+ */
+PositionTrajectoryElement_t app_trajectory_planner_evaluateSegmentedPositionTrajectory(
+    const SegmentedPositionTrajectory_t *segmented_trajectory, float time);
@@ -11,7 +11,7 @@
 void app_trajectory_planner_impl_getMaximumSpeedProfile(
     Polynomial2dOrder3_t path, unsigned int num_elements, float t_start, float t_end,
     float max_allowable_acceleration, float speed_cap,
-    float max_allowable_speed_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS])
+    float max_allowable_speed_profile[])
 {
     const float t_increment = (t_end - t_start) / (float)(num_elements - 1);
 
@@ -30,8 +30,7 @@ void app_trajectory_planner_impl_getMaximumSpeedProfile(
 
 void app_trajectory_planner_impl_generate1dSegmentNodesAndLengths(
     float t_start, float t_end, Polynomial1dOrder3_t path_1d, unsigned int num_elements,
-    float node_values[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS])
+    float node_values[], float segment_lengths[])
 {
     // Check that the pre conditions are met
     assert(num_elements > 2);
@@ -58,34 +57,29 @@ void app_trajectory_planner_impl_generate1dSegmentNodesAndLengths(
 
 void app_trajectory_planner_impl_generate2dSegmentNodesAndLengths(
     float t_start, float t_end, Polynomial2dOrder3_t path_2d, unsigned int num_elements,
-    float x_values[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float y_values[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS])
+    float x_values[], float y_values[], float segment_lengths[])
 {
-    // Hold into the x and y segment lengths to calculate the combined segment length
-    float x_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
-    float y_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS];
-
     app_trajectory_planner_impl_generate1dSegmentNodesAndLengths(
-        t_start, t_end, path_2d.x, num_elements, x_values, x_lengths);
+        t_start, t_end, path_2d.x, num_elements, x_values, segment_lengths);
     app_trajectory_planner_impl_generate1dSegmentNodesAndLengths(
-        t_start, t_end, path_2d.y, num_elements, y_values, y_lengths);
+        t_start, t_end, path_2d.y, num_elements, y_values, segment_lengths);
 
-    // total length is the root sum-squared of the individual values
-    for (unsigned int i = 0; i < num_elements; i++)
+    // total length is the root sum-squared of the individual values, which are
+    // recalculated from the nodes so that no temporary arrays are needed
+    for (unsigned int i = 0; i < num_elements - 1; i++)
     {
-        segment_lengths[i] = sqrtf(powf(x_lengths[i], 2) + powf(y_lengths[i], 2));
+        segment_lengths[i] = sqrtf(powf(x_values[i + 1] - x_values[i], 2) +
+                                   powf(y_values[i + 1] - y_values[i], 2));
     }
 }
 
 void app_trajectory_planner_impl_generatePositionTrajectoryTimeProfile(
-    float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float speeds[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS], unsigned int num_elements,
-    float trajectory_durations[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS])
+    float segment_lengths[], float speeds[], unsigned int num_elements,
+    float trajectory_durations[])
 {
     // Calculate the time required to move between the first and last nodes of a
     // trajectory segment
-    for (unsigned int i = 0; i < num_elements; i++)
+    for (unsigned int i = 0; i < num_elements - 1; i++)
     {
         // Delta-time over the length of the segment
         float delta_time = 0;
@@ -127,13 +121,8 @@ float app_trajectory_planner_impl_calculateSpeedToMatchDuration(float initial_sp
 
 
 void app_trajectory_planner_impl_modifySpeedsToMatchLongestSegmentDuration(
-    float displacement1[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float displacement2[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float durations1[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float durations2[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS], float num_elements,
-    float speeds1[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float speeds2[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float complete_time_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS])
+    float displacement1[], float displacement2[], float durations1[], float durations2[],
+    float num_elements, float speeds1[], float speeds2[], float complete_time_profile[])
 {
     // The time profile is relative to the first element, thus is starts at zero
     complete_time_profile[0] = 0.0f;
@@ -176,10 +165,9 @@ void app_trajectory_planner_impl_modifySpeedsToMatchLongestSegmentDuration(
 
 TrajectoryPlannerGenerationStatus_t
 app_trajectory_planner_impl_createForwardsContinuousSpeedProfile(
-    float final_speed, float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float max_allowable_speed_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
+    float final_speed, float segment_lengths[], float max_allowable_speed_profile[],
     float max_allowable_acceleration, float initial_speed, unsigned int num_elements,
-    float speeds[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS])
+    float speeds[])
 {
     // Set the initial speed
     speeds[0] = initial_speed;
@@ -211,9 +199,8 @@ app_trajectory_planner_impl_createForwardsContinuousSpeedProfile(
 
 TrajectoryPlannerGenerationStatus_t
 app_trajectory_planner_impl_modifySpeedsToBeBackwardsContinuous(
-    float initial_speed, float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float max_allowable_acceleration, unsigned int num_segments,
-    float speeds[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS])
+    float initial_speed, float segment_lengths[], float max_allowable_acceleration,
+    unsigned int num_segments, float speeds[])
 {
     for (unsigned int i = num_segments - 1; i > 0; i--)
     {
@@ -9,7 +9,7 @@
  * constant-parameterization segments. This function works for both the linear and angular
  * parts of a trajectory because the input is a generic polynomial.
  *
- * @pre All arrays must be pre-allocated up to TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS
+ * @pre All arrays must be pre-allocated up to at least num_elements
  *
  * @param t_start The starting parameterization value
  *
@@ -30,16 +30,14 @@
  */
 void app_trajectory_planner_impl_generate1dSegmentNodesAndLengths(
     float t_start, float t_end, Polynomial1dOrder3_t path_1d, unsigned int num_elements,
-    float node_values[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS]);
+    float node_values[], float segment_lengths[]);
 
 
 /**
  * Function generates the length of segments in a 2d polynomial. It works as an wrapper
  * for the euclidean distance and values of 2d polynomials.
  *
- * @pre All arrays must be pre-allocated up to at least
- * TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS
+ * @pre All arrays must be pre-allocated up to at least num_elements
  *
  * @param t_start The starting value of polynomial parameterization
  *
@@ -60,15 +58,13 @@ void app_trajectory_planner_impl_generate1dSegmentNodesAndLengths(
  */
 void app_trajectory_planner_impl_generate2dSegmentNodesAndLengths(
     float t_start, float t_end, Polynomial2dOrder3_t path_2d, unsigned int num_elements,
-    float x_values[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float y_values[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS]);
+    float x_values[], float y_values[], float segment_lengths[]);
 
 /**
  * Function that modifies an existing speed profile to be backwards continuous. This means
  * that it is possible to reach every speed node within the limits of deceleration
  *
- * @pre All arrays are pre-allocated up to at least TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS
+ * @pre All arrays are pre-allocated up to at least num_segments
  *
  * @param initial_speed [in] The initial speed at the beginning of the trajectory.  Units
  * of parameters must be in consistent magnitudes, Ex: distances in mm and acceleration in
@@ -90,17 +86,15 @@ void app_trajectory_planner_impl_generate2dSegmentNodesAndLengths(
  */
 TrajectoryPlannerGenerationStatus_t
 app_trajectory_planner_impl_modifySpeedsToBeBackwardsContinuous(
-    float initial_speed, float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float max_allowable_acceleration, unsigned int num_segments,
-    float speeds[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS]);
+    float initial_speed, float segment_lengths[], float max_allowable_acceleration,
+    unsigned int num_segments, float speeds[]);
 
 /**
  * Function creates a forwards continuous speed profile based on the specified parameters.
  * The profile will never exceed the maximums speeds specified by the
  * max_allowable_speed_profile
  *
- * @pre All arrays must be pre-allocated up to at least
- * TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS
+ * @pre All arrays must be pre-allocated up to at least num_elements
  *
  * @param final_speed  The final speed at the last element of the profile.  Units of
  * parameters must be in consistent magnitudes, Ex: distances in mm and speed in mm/s.
@@ -130,18 +124,16 @@ app_trajectory_planner_impl_modifySpeedsToBeBackwardsContinuous(
  */
 TrajectoryPlannerGenerationStatus_t
 app_trajectory_planner_impl_createForwardsContinuousSpeedProfile(
-    float final_speed, float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float max_allowable_speed_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
+    float final_speed, float segment_lengths[], float max_allowable_speed_profile[],
     float max_allowable_acceleration, float initial_speed, unsigned int num_elements,
-    float speeds[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS]);
+    float speeds[]);
 
 /**
  * Function generates the absolute maximum speed that can occur at any points along the
  * trajectory. This maximum speed is determined by the limit of grip (in acceleration)
  * along any curved path, along with imposed speed limits of the user.
  *
- * @pre All arrays must be pre-allocated up to at least
- * TRAJECTORY_PLANNER_MAX_NUM_SEGMENTS
+ * @pre All arrays must be pre-allocated up to at least num_elements
  *
  * @param path The 2d polynomial that defines the path in 2d space.
  *
@@ -167,15 +159,14 @@ app_trajectory_planner_impl_createForwardsContinuousSpeedProfile(
 void app_trajectory_planner_impl_getMaximumSpeedProfile(
     Polynomial2dOrder3_t path, unsigned int num_elements, float t_start, float t_end,
     float max_allowable_acceleration, float speed_cap,
-    float max_allowable_speed_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS]);
+    float max_allowable_speed_profile[]);
 
 /**
  * Function generates the time profile for a speed profile with given segment lengths and
  * start and end velocities. This is done using a constant acceleration assumption over
  * the total displacement of each segment
  *
- * @pre All arrays must be pre-allocated up to at least
- * TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS
+ * @pre All arrays must be pre-allocated up to at least num_elements
  *
  * @param segment_lengths [in] The length of each segment in meters. The segment length is
  * the distance travelled between successive speed elements.  Units of parameters must be
@@ -190,9 +181,8 @@ void app_trajectory_planner_impl_getMaximumSpeedProfile(
  * profile. In seconds. This array is of length num_elements-1
  */
 void app_trajectory_planner_impl_generatePositionTrajectoryTimeProfile(
-    float segment_lengths[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float speeds[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS], unsigned int num_elements,
-    float trajectory_durations[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS]);
+    float segment_lengths[], float speeds[], unsigned int num_elements,
+    float trajectory_durations[]);
 
 /**
  * Function balances the segment time durations of 2 separate speed profiles. The segment
@@ -205,8 +195,7 @@ void app_trajectory_planner_impl_generatePositionTrajectoryTimeProfile(
  * Note: The magnitude of units have to be consistent. Ie. Distances in mm and speeds in
  * mm/s. The output will be in the same units magnitude.
  *
- * @pre The arrays must be pre-allocated up to at least
- * TRAJECTORY_PLANNER_MAX_NUM_SEGMENTS.
+ * @pre The arrays must be pre-allocated up to at least num_elements.
  *
  * @param displacement1 [in] The displacement corresponding to the distance between
  * successive speed elements in trajectory 1. In meters. This array is of length
@@ -237,13 +226,8 @@ void app_trajectory_planner_impl_generatePositionTrajectoryTimeProfile(
  * zero. In seconds. This array is of length num_elements.
  */
 void app_trajectory_planner_impl_modifySpeedsToMatchLongestSegmentDuration(
-    float displacement1[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float displacement2[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float durations1[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float durations2[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS], float num_elements,
-    float speeds1[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float speeds2[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS],
-    float complete_time_profile[TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS]);
+    float displacement1[], float displacement2[], float durations1[], float durations2[],
+    float num_elements, float speeds1[], float speeds2[], float complete_time_profile[]);
 
 
 /**
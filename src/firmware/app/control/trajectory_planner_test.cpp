@@ -1246,3 +1246,128 @@ TEST_F(TrajectoryPlannerTest,
     EXPECT_NEAR(position_trajectory.angular_speed[0], 0.0f, 0.0001f);
     EXPECT_NEAR(position_trajectory.angular_speed[9], 0.0f, 0.0001f);
 }
+
+TEST_F(TrajectoryPlannerTest,
+       test_segmented_trajectory_elements_match_constant_parameterization_trajectory)
+{
+    FirmwareRobotPathParameters_t path_parameters = {
+        .path                = {.x = {.coefficients = {2, 0, 1, 0}},
+                 .y = {.coefficients = {1, 0, 1, 0}}},
+        .orientation_profile = {.coefficients = {0, 0, 1, 0}},
+        .t_start             = 0,
+        .t_end               = 1,
+        .num_elements        = TRAJECTORY_PLANNER_MAX_NUM_SEGMENTED_ELEMENTS,
+        .max_allowable_linear_acceleration  = 3,
+        .max_allowable_linear_speed         = 3,
+        .max_allowable_angular_acceleration = 5,
+        .max_allowable_angular_speed        = 6.28f,
+        .initial_linear_speed               = 0,
+        .final_linear_speed                 = 0};
+
+    PositionTrajectory_t position_trajectory;
+    auto status =
+        app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
+            path_parameters, &position_trajectory);
+    EXPECT_EQ(status, OK);
+
+    SegmentedPositionTrajectory_t segmented_trajectory;
+    status = app_trajectory_planner_generateSegmentedPositionTrajectory(
+        path_parameters, &segmented_trajectory);
+    EXPECT_EQ(status, OK);
+
+    ASSERT_EQ(segmented_trajectory.num_elements, path_parameters.num_elements);
+    for (unsigned int i = 0; i < path_parameters.num_elements; i++)
+    {
+        EXPECT_FLOAT_EQ(segmented_trajectory.x_position[i],
+                        position_trajectory.x_position[i]);
+        EXPECT_FLOAT_EQ(segmented_trajectory.y_position[i],
+                        position_trajectory.y_position[i]);
+        EXPECT_FLOAT_EQ(segmented_trajectory.orientation[i],
+                        position_trajectory.orientation[i]);
+        EXPECT_FLOAT_EQ(segmented_trajectory.linear_speed[i],
+                        position_trajectory.linear_speed[i]);
+        EXPECT_FLOAT_EQ(segmented_trajectory.angular_speed[i],
+                        position_trajectory.angular_speed[i]);
+        EXPECT_FLOAT_EQ(segmented_trajectory.time_profile[i],
+                        position_trajectory.time_profile[i]);
+    }
+}
+
+TEST_F(TrajectoryPlannerTest,
+       test_evaluate_segmented_trajectory_matches_constant_period_trajectory)
+{
+    FirmwareRobotPathParameters_t path_parameters = {
+        .path                               = {.x = {.coefficients = {2, 0, 1, 0}},
+                 .y = {.coefficients = {1, 0, 1, 0}}},
+        .orientation_profile                = {.coefficients = {0, 0, 1, 0}},
+        .t_start                            = 0,
+        .t_end                              = 1,
+        .num_elements                       = 50,
+        .max_allowable_linear_acceleration  = 3,
+        .max_allowable_linear_speed         = 3,
+        .max_allowable_angular_acceleration = 5,
+        .max_allowable_angular_speed        = 6.28f,
+        .initial_linear_speed               = 0,
+        .final_linear_speed                 = 0};
+
+    SegmentedPositionTrajectory_t segmented_trajectory;
+    auto status = app_trajectory_planner_generateSegmentedPositionTrajectory(
+        path_parameters, &segmented_trajectory);
+    EXPECT_EQ(status, OK);
+
+    const float interpolation_period = 0.001f;
+    PositionTrajectory_t const_interp_trajectory;
+    status = app_trajectory_planner_generateConstantPeriodPositionTrajectory(
+        interpolation_period, &path_parameters, &const_interp_trajectory);
+    EXPECT_EQ(status, OK);
+
+    for (unsigned int i = 0; i < path_parameters.num_elements; i++)
+    {
+        PositionTrajectoryElement_t element =
+            app_trajectory_planner_evaluateSegmentedPositionTrajectory(
+                &segmented_trajectory, const_interp_trajectory.time_profile[i]);
+
+        EXPECT_NEAR(element.x_position, const_interp_trajectory.x_position[i], 0.0001f);
+        EXPECT_NEAR(element.y_position, const_interp_trajectory.y_position[i], 0.0001f);
+        EXPECT_NEAR(element.orientation, const_interp_trajectory.orientation[i], 0.0001f);
+        EXPECT_NEAR(element.linear_speed, const_interp_trajectory.linear_speed[i],
+                    0.0001f);
+    }
+}
+
+TEST_F(TrajectoryPlannerTest, test_evaluate_segmented_trajectory_outside_of_trajectory)
+{
+    FirmwareRobotPathParameters_t path_parameters = {
+        .path                               = {.x = {.coefficients = {0, 0, 1, 0}},
+                 .y = {.coefficients = {0, 0, 2, 1}}},
+        .orientation_profile                = {.coefficients = {0, 0, 0, 0}},
+        .t_start                            = 0,
+        .t_end                              = 1,
+        .num_elements                       = 10,
+        .max_allowable_linear_acceleration  = 3,
+        .max_allowable_linear_speed         = 3,
+        .max_allowable_angular_acceleration = 0,
+        .max_allowable_angular_speed        = 0,
+        .initial_linear_speed               = 0,
+        .final_linear_speed                 = 0};
+
+    SegmentedPositionTrajectory_t segmented_trajectory;
+    auto status = app_trajectory_planner_generateSegmentedPositionTrajectory(
+        path_parameters, &segmented_trajectory);
+    EXPECT_EQ(status, OK);
+
+    PositionTrajectoryElement_t first_element =
+        app_trajectory_planner_evaluateSegmentedPositionTrajectory(&segmented_trajectory,
+                                                                   -1.0f);
+    EXPECT_FLOAT_EQ(first_element.x_position, 0.0f);
+    EXPECT_FLOAT_EQ(first_element.y_position, 1.0f);
+    EXPECT_FLOAT_EQ(first_element.linear_speed, 0.0f);
+
+    const float end_time = segmented_trajectory.time_profile[9];
+    PositionTrajectoryElement_t last_element =
+        app_trajectory_planner_evaluateSegmentedPositionTrajectory(&segmented_trajectory,
+                                                                   end_time + 1.0f);
+    EXPECT_FLOAT_EQ(last_element.x_position, 1.0f);
+    EXPECT_FLOAT_EQ(last_element.y_position, 3.0f);
+    EXPECT_FLOAT_EQ(last_element.linear_speed, 0.0f);
+}
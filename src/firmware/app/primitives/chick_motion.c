@@ -1,6 +1,5 @@
 #include "firmware/app/primitives/chick_motion.h"
 
-#include "firmware/app/control/bangbang.h"
 #include "firmware/app/control/control.h"
 #include "firmware/app/control/physbot.h"
 #include "firmware/app/primitives/primitive.h"
@@ -39,9 +38,9 @@ void scale(PhysBot *pb)
 
 /**
  * Determines the rotation acceleration after setup_bot has been used and
- * plan_move has been done along the minor axis. The minor time from bangbang
- * is used to determine the rotation time, and thus the rotation velocity and
- * acceleration. The rotational acceleration is clamped under the MAX_T_A.
+ * plan_move has been done along the minor axis. The minor time from the
+ * planned trajectory is used to determine the rotation time, and thus the rotation
+ * velocity and acceleration. The rotational acceleration is clamped under the MAX_T_A.
  *
  * @param pb [in/out] The PhysBot data container that should have minor axis time and
  * will store the rotational information
@@ -0,0 +1,557 @@
+extern "C"
+{
+#include "firmware/app/control/control.h"
+#include "firmware/app/control/physbot.h"
+#include "firmware/app/control/wheel_controller.h"
+#include "firmware/app/logger/logger.h"
+#include "firmware/app/primitives/primitive_manager.h"
+#include "firmware/shared/physics.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * This file benchmarks the firmware control loop on a development machine, by running
+ * every primitive, and the control functions they use, on a sequence of robot states
+ * through the same FirmwareWorld_t the robot uses. The budget tests run in CI and fail
+ * if the 99th percentile time of a call exceeds the control tick budget, with a margin
+ * for noisy CI machines. The disabled timing tests print the average and worst-case
+ * time per call.
+ *
+ * The budget can be set with the FIRMWARE_CONTROL_TICK_BUDGET_US environment variable,
+ * e.g. to check for regressions against a previous run.
+ */
+
+// The robot's microcontroller runs the control loop roughly this many times slower
+// than a typical development machine, so the default budget is the control tick
+// period scaled down by this factor
+static const double ESTIMATED_ROBOT_SLOWDOWN_FACTOR = 20.0;
+
+// Timing on shared CI machines is noisy, so the budget tests allow calls to take this
+// many times the budget
+static const double CI_BUDGET_MARGIN = 4.0;
+
+// The percentile of the call times that is checked against the budget, since a call
+// can be preempted on a development machine, which doesn't happen on the robot
+static const double CHECKED_PERCENTILE = 0.99;
+
+// The number of control ticks to run each primitive for
+static const unsigned int NUM_TICKS = 5 * CONTROL_LOOP_HZ;
+
+// The environment variable used to override the control tick budget
+static const char* TICK_BUDGET_ENV_VAR = "FIRMWARE_CONTROL_TICK_BUDGET_US";
+
+/**
+ * The state of the robot and ball at one control tick
+ */
+struct RobotStateSample
+{
+    float time_seconds;
+    float position_x;
+    float position_y;
+    float orientation;
+    float velocity_x;
+    float velocity_y;
+    float velocity_angular;
+    float motor_speed_rpm;
+    float ball_position_x;
+    float ball_position_y;
+};
+
+// The state the world getters below read from, updated before every tick
+static RobotStateSample current_state;
+
+static float getTimeSeconds(void)
+{
+    return current_state.time_seconds;
+}
+static float getPositionX(void)
+{
+    return current_state.position_x;
+}
+static float getPositionY(void)
+{
+    return current_state.position_y;
+}
+static float getOrientation(void)
+{
+    return current_state.orientation;
+}
+static float getVelocityX(void)
+{
+    return current_state.velocity_x;
+}
+static float getVelocityY(void)
+{
+    return current_state.velocity_y;
+}
+static float getVelocityAngular(void)
+{
+    return current_state.velocity_angular;
+}
+static float getBatteryVoltage(void)
+{
+    return 16.0f;
+}
+static float getMotorSpeedRPM(void)
+{
+    return current_state.motor_speed_rpm;
+}
+static float getBallPositionX(void)
+{
+    return current_state.ball_position_x;
+}
+static float getBallPositionY(void)
+{
+    return current_state.ball_position_y;
+}
+static float getBallVelocity(void)
+{
+    return 0.0f;
+}
+static unsigned int getDribblerTemperatureDegC(void)
+{
+    return 25;
+}
+static void doNothing(void) {}
+static void ignoreRobotLog(TbotsProto_RobotLog) {}
+static void doNothingWithFloat(float) {}
+static void doNothingWithUint(uint32_t) {}
+
+/**
+ * Timing statistics for calls to a single function
+ */
+class CallTimer
+{
+   public:
+    explicit CallTimer(const std::string& name) : name(name) {}
+
+    /**
+     * Times a single call to the given function
+     *
+     * @param function The function to call
+     */
+    template <typename Function>
+    void time(Function function)
+    {
+        const unsigned long long start_cycles = readCycleCounter();
+        const auto start_time                 = std::chrono::steady_clock::now();
+        function();
+        const auto duration             = std::chrono::steady_clock::now() - start_time;
+        const unsigned long long cycles = readCycleCounter() - start_cycles;
+
+        durations.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration));
+        max_cycles = std::max(max_cycles, cycles);
+    }
+
+    /**
+     * Prints the average and worst-case time of the calls
+     */
+    void report() const
+    {
+        std::chrono::nanoseconds total_duration{0};
+        for (const std::chrono::nanoseconds& duration : durations)
+        {
+            total_duration += duration;
+        }
+        const double average_us = static_cast<double>(total_duration.count()) /
+                                  static_cast<double>(durations.size()) / 1000.0;
+        const double max_us =
+            static_cast<double>(
+                std::max_element(durations.begin(), durations.end())->count()) /
+            1000.0;
+        std::cout << name << ": average " << average_us << " us, worst " << max_us
+                  << " us, " << CHECKED_PERCENTILE * 100 << "th percentile "
+                  << getPercentileMicroseconds(CHECKED_PERCENTILE) << " us";
+        if (max_cycles > 0)
+        {
+            std::cout << " (" << max_cycles << " host cycles worst)";
+        }
+        std::cout << std::endl;
+    }
+
+    /**
+     * Checks the calls took no longer than the budget, apart from the slowest ones
+     * above CHECKED_PERCENTILE
+     *
+     * @param budget_us The maximum time a single call may take (us)
+     */
+    void checkBudget(double budget_us) const
+    {
+        EXPECT_LE(getPercentileMicroseconds(CHECKED_PERCENTILE), budget_us)
+            << name << " exceeded the control tick budget";
+    }
+
+   private:
+    /**
+     * Gets the time that the given fraction of the calls took no longer than
+     *
+     * @param percentile The fraction of the calls, in [0, 1]
+     *
+     * @return the time that the given fraction of the calls took no longer than (us)
+     */
+    double getPercentileMicroseconds(double percentile) const
+    {
+        std::vector<std::chrono::nanoseconds> sorted_durations = durations;
+        std::sort(sorted_durations.begin(), sorted_durations.end());
+        const size_t index =
+            std::min(sorted_durations.size() - 1,
+                     static_cast<size_t>(percentile *
+                                         static_cast<double>(sorted_durations.size())));
+        return static_cast<double>(sorted_durations[index].count()) / 1000.0;
+    }
+
+    /**
+     * Reads the host's cycle counter, if it has one we can read from user space
+     *
+     * @return the current value of the cycle counter, or 0 if there isn't one
+     */
+    static unsigned long long readCycleCounter()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    std::string name;
+    std::vector<std::chrono::nanoseconds> durations;
+    unsigned long long max_cycles = 0;
+};
+
+class FirmwareControlLoopPerformanceTest : public testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const WheelConstants_t wheel_constants = {
+            .motor_current_per_unit_torque       = CURRENT_PER_TORQUE,
+            .motor_phase_resistance              = 1.2f,
+            .motor_back_emf_per_rpm              = RPM_TO_VOLT,
+            .motor_max_voltage_before_wheel_slip = WHEEL_SLIP_VOLTAGE_LIMIT,
+            .wheel_radius                        = WHEEL_RADIUS,
+            .wheel_rotations_per_motor_rotation  = GEAR_RATIO};
+        const RobotConstants_t robot_constants = {.mass              = ROBOT_POINT_MASS,
+                                                  .moment_of_inertia = INERTIA,
+                                                  .robot_radius      = ROBOT_RADIUS,
+                                                  .jerk_limit        = JERK_LIMIT};
+
+        app_logger_init(0, ignoreRobotLog);
+
+        charger = app_charger_create(doNothing, doNothing, doNothing);
+        chicker =
+            app_chicker_create(doNothingWithFloat, doNothingWithFloat, doNothingWithFloat,
+                               doNothingWithFloat, doNothing, doNothing);
+        dribbler =
+            app_dribbler_create(doNothingWithUint, doNothing, getDribblerTemperatureDegC);
+        for (Wheel_t*& wheel : wheels)
+        {
+            wheel = app_wheel_create(doNothingWithFloat, getMotorSpeedRPM, doNothing,
+                                     doNothing, wheel_constants);
+        }
+        controller_state = {.last_applied_acceleration_x       = 0.0f,
+                            .last_applied_acceleration_y       = 0.0f,
+                            .last_applied_acceleration_angular = 0.0f};
+        robot            = app_firmware_robot_create(
+            charger, chicker, dribbler, getPositionX, getPositionY, getOrientation,
+            getVelocityX, getVelocityY, getVelocityAngular, getBatteryVoltage, wheels[0],
+            wheels[1], wheels[2], wheels[3], &controller_state, robot_constants);
+        ball  = app_firmware_ball_create(getBallPositionX, getBallPositionY,
+                                        getBallVelocity, getBallVelocity);
+        world = app_firmware_world_create(robot, ball, getTimeSeconds);
+
+        states         = createRobotStates();
+        current_state  = states[0];
+        tick_budget_us = getTickBudgetMicroseconds();
+        std::cout << "Control tick budget: " << tick_budget_us << " us" << std::endl;
+    }
+
+    void TearDown() override
+    {
+        app_firmware_world_destroy(world);
+        app_firmware_ball_destroy(ball);
+        app_firmware_robot_destroy(robot);
+        for (Wheel_t* wheel : wheels)
+        {
+            app_wheel_destroy(wheel);
+        }
+        app_dribbler_destroy(dribbler);
+        app_chicker_destroy(chicker);
+        app_charger_destroy(charger);
+    }
+
+    /**
+     * Creates the sequence of robot states to run the control loop on, one per control
+     * tick. The robot drives a figure-eight at up to about 2 m/s, turning to face the
+     * direction it is moving, which covers the speeds and turning rates seen in games.
+     *
+     * @return the robot state at every control tick
+     */
+    static std::vector<RobotStateSample> createRobotStates()
+    {
+        std::vector<RobotStateSample> samples;
+        const float angular_frequency = 0.5f;
+        for (unsigned int i = 0; i < NUM_TICKS; i++)
+        {
+            const float t  = static_cast<float>(i) * TICK_TIME;
+            const float wt = angular_frequency * t;
+            RobotStateSample sample;
+            sample.time_seconds = t;
+            sample.position_x   = 2.0f * std::sin(wt);
+            sample.position_y   = 1.5f * std::sin(2.0f * wt);
+            sample.velocity_x   = 2.0f * angular_frequency * std::cos(wt);
+            sample.velocity_y   = 3.0f * angular_frequency * std::cos(2.0f * wt);
+            sample.orientation  = std::atan2(sample.velocity_y, sample.velocity_x);
+
+            const float acceleration_x =
+                -2.0f * angular_frequency * angular_frequency * std::sin(wt);
+            const float acceleration_y =
+                -6.0f * angular_frequency * angular_frequency * std::sin(2.0f * wt);
+            const float speed_squared = sample.velocity_x * sample.velocity_x +
+                                        sample.velocity_y * sample.velocity_y;
+            sample.velocity_angular = (sample.velocity_x * acceleration_y -
+                                       sample.velocity_y * acceleration_x) /
+                                      speed_squared;
+
+            const float wheel_rpm = std::sqrt(speed_squared) /
+                                    (2.0f * static_cast<float>(M_PI) * WHEEL_RADIUS) *
+                                    60.0f;
+            sample.motor_speed_rpm = wheel_rpm / GEAR_RATIO;
+            sample.ball_position_x = 3.0f;
+            sample.ball_position_y = -1.0f;
+            samples.push_back(sample);
+        }
+        return samples;
+    }
+
+    /**
+     * Gets the maximum time a single call in the control loop may take
+     *
+     * @return the budget from FIRMWARE_CONTROL_TICK_BUDGET_US if it is set, otherwise
+     * the default budget (us)
+     */
+    static double getTickBudgetMicroseconds()
+    {
+        const char* budget_string = std::getenv(TICK_BUDGET_ENV_VAR);
+        if (budget_string != nullptr)
+        {
+            return std::atof(budget_string);
+        }
+        return 1e6 * TICK_TIME / ESTIMATED_ROBOT_SLOWDOWN_FACTOR;
+    }
+
+    /**
+     * Starts every primitive and runs it for every robot state, timing the start and
+     * every tick
+     *
+     * @return a timer for the start and the ticks of every primitive
+     */
+    std::vector<CallTimer> timePrimitives()
+    {
+        std::vector<CallTimer> timers;
+        std::vector<std::pair<std::string, TbotsProto_Primitive>> primitive_msgs;
+        TbotsProto_Primitive primitive_msg;
+
+        primitive_msg                 = TbotsProto_Primitive();
+        primitive_msg.which_primitive = TbotsProto_Primitive_estop_tag;
+        primitive_msgs.emplace_back("estop", primitive_msg);
+
+        primitive_msg                 = TbotsProto_Primitive();
+        primitive_msg.which_primitive = TbotsProto_Primitive_stop_tag;
+        primitive_msgs.emplace_back("stop", primitive_msg);
+
+        primitive_msg                 = TbotsProto_Primitive();
+        primitive_msg.which_primitive = TbotsProto_Primitive_move_tag;
+        primitive_msg.primitive.move.position_params.destination.x_meters = -2.0f;
+        primitive_msg.primitive.move.position_params.destination.y_meters = 1.0f;
+        primitive_msg.primitive.move.final_angle.radians                  = 1.0f;
+        primitive_msgs.emplace_back("move", primitive_msg);
+
+        primitive_msg.primitive.move.position_params.controller_type =
+            TbotsProto_MovePositionParams_ControllerType_MPC;
+        primitive_msgs.emplace_back("move_mpc", primitive_msg);
+
+        primitive_msg                 = TbotsProto_Primitive();
+        primitive_msg.which_primitive = TbotsProto_Primitive_spinning_move_tag;
+        primitive_msg.primitive.spinning_move.position_params.destination.x_meters =
+            -2.0f;
+        primitive_msg.primitive.spinning_move.angular_velocity.radians_per_second = 4.0f;
+        primitive_msgs.emplace_back("spinning_move", primitive_msg);
+
+        primitive_msg                 = TbotsProto_Primitive();
+        primitive_msg.which_primitive = TbotsProto_Primitive_autochip_move_tag;
+        primitive_msg.primitive.autochip_move.position_params.destination.x_meters = 3.0f;
+        primitive_msg.primitive.autochip_move.chip_distance_meters                 = 2.0f;
+        primitive_msgs.emplace_back("autochip_move", primitive_msg);
+
+        primitive_msg                 = TbotsProto_Primitive();
+        primitive_msg.which_primitive = TbotsProto_Primitive_autokick_move_tag;
+        primitive_msg.primitive.autokick_move.position_params.destination.x_meters = 3.0f;
+        primitive_msg.primitive.autokick_move.kick_speed_meters_per_second         = 5.0f;
+        primitive_msgs.emplace_back("autokick_move", primitive_msg);
+
+        primitive_msg                                     = TbotsProto_Primitive();
+        primitive_msg.which_primitive                     = TbotsProto_Primitive_chip_tag;
+        primitive_msg.primitive.chip.chip_origin.x_meters = 3.0f;
+        primitive_msg.primitive.chip.chip_distance_meters = 2.0f;
+        primitive_msgs.emplace_back("chip", primitive_msg);
+
+        primitive_msg                                     = TbotsProto_Primitive();
+        primitive_msg.which_primitive                     = TbotsProto_Primitive_kick_tag;
+        primitive_msg.primitive.kick.kick_origin.x_meters = 3.0f;
+        primitive_msg.primitive.kick.kick_speed_meters_per_second = 5.0f;
+        primitive_msgs.emplace_back("kick", primitive_msg);
+
+        primitive_msg                 = TbotsProto_Primitive();
+        primitive_msg.which_primitive = TbotsProto_Primitive_direct_control_tag;
+        primitive_msg.primitive.direct_control.which_wheel_control =
+            TbotsProto_DirectControlPrimitive_direct_velocity_control_tag;
+        primitive_msg.primitive.direct_control.wheel_control.direct_velocity_control
+            .velocity.x_component_meters = 1.0f;
+        primitive_msg.primitive.direct_control.which_chick_command =
+            TbotsProto_DirectControlPrimitive_autokick_speed_meters_per_second_tag;
+        primitive_msg.primitive.direct_control.chick_command
+            .autokick_speed_meters_per_second = 5.0f;
+        primitive_msgs.emplace_back("direct_control", primitive_msg);
+
+        PrimitiveManager_t* manager = app_primitive_manager_create();
+        for (const auto& name_and_msg : primitive_msgs)
+        {
+            const TbotsProto_Primitive& msg = name_and_msg.second;
+            CallTimer start_timer(name_and_msg.first + " start");
+            CallTimer tick_timer(name_and_msg.first + " tick");
+
+            current_state = states[0];
+            start_timer.time(
+                [&]() { app_primitive_manager_startNewPrimitive(manager, world, msg); });
+            for (const RobotStateSample& state : states)
+            {
+                current_state = state;
+                tick_timer.time(
+                    [&]() { app_primitive_manager_runCurrentPrimitive(manager, world); });
+            }
+
+            timers.push_back(start_timer);
+            timers.push_back(tick_timer);
+        }
+        app_primitive_manager_destroy(manager);
+        return timers;
+    }
+
+    /**
+     * Runs the control functions the primitives use for every robot state, timing
+     * every call
+     *
+     * @return a timer for every control function
+     */
+    std::vector<CallTimer> timeControlFunctions()
+    {
+        CallTimer physbot_timer("app_physbot_planMove");
+        CallTimer track_velocity_timer("app_control_trackVelocityInRobotFrame");
+        CallTimer wheel_controller_timer("app_wheel_controller_getWheelVoltageToApply");
+
+        float command_coefficients[]        = {0.5f, 0.3f, 0.2f};
+        float output_sample_coefficients[]  = {-0.4f, 0.1f};
+        WheelController_t* wheel_controller = app_wheel_controller_create(
+            command_coefficients, 3, output_sample_coefficients, 2);
+
+        float destination[3] = {-2.0f, 1.0f, 1.0f};
+        for (const RobotStateSample& state : states)
+        {
+            current_state = state;
+
+            physbot_timer.time([&]() {
+                // Plan along the axes to the destination, the same way the move primitive
+                // does
+                const float dx       = destination[0] - state.position_x;
+                const float dy       = destination[1] - state.position_y;
+                const float distance = std::sqrt(dx * dx + dy * dy) + 1e-6f;
+                float major_vec[2]   = {dx / distance, dy / distance};
+                float minor_vec[2]   = {-major_vec[1], major_vec[0]};
+                PhysBot pb = app_physbot_create(robot, destination, major_vec, minor_vec);
+
+                float major_params[3] = {0.0f, MAX_X_A, MAX_X_V};
+                float minor_params[3] = {0.0f, MAX_Y_A / 2.0f, MAX_Y_V / 2.0f};
+                app_physbot_planMove(&pb.maj, major_params);
+                app_physbot_planMove(&pb.min, minor_params);
+            });
+
+            track_velocity_timer.time([&]() {
+                app_control_trackVelocityInRobotFrame(
+                    robot, state.velocity_x, state.velocity_y, state.velocity_angular);
+            });
+
+            wheel_controller_timer.time([&]() {
+                app_wheel_controller_pushNewCommand(wheel_controller, state.velocity_x);
+                app_wheel_controller_pushNewSampleOutput(wheel_controller,
+                                                         state.motor_speed_rpm);
+                app_wheel_controller_getWheelVoltageToApply(wheel_controller);
+            });
+        }
+        app_wheel_controller_destroy(wheel_controller);
+
+        return {physbot_timer, track_velocity_timer, wheel_controller_timer};
+    }
+
+    Charger_t* charger;
+    Chicker_t* chicker;
+    Dribbler_t* dribbler;
+    Wheel_t* wheels[4];
+    ControllerState_t controller_state;
+    FirmwareRobot_t* robot;
+    FirmwareBall_t* ball;
+    FirmwareWorld_t* world;
+
+    std::vector<RobotStateSample> states;
+    double tick_budget_us;
+};
+
+TEST_F(FirmwareControlLoopPerformanceTest, primitive_start_and_tick_within_budget)
+{
+    for (const CallTimer& timer : timePrimitives())
+    {
+        timer.checkBudget(tick_budget_us * CI_BUDGET_MARGIN);
+    }
+}
+
+TEST_F(FirmwareControlLoopPerformanceTest, control_functions_within_budget)
+{
+    for (const CallTimer& timer : timeControlFunctions())
+    {
+        timer.checkBudget(tick_budget_us * CI_BUDGET_MARGIN);
+    }
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(FirmwareControlLoopPerformanceTest, DISABLED_primitive_start_and_tick_timing)
+{
+    for (const CallTimer& timer : timePrimitives())
+    {
+        timer.report();
+    }
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(FirmwareControlLoopPerformanceTest, DISABLED_control_functions_timing)
+{
+    for (const CallTimer& timer : timeControlFunctions())
+    {
+        timer.report();
+    }
+}
@@ -5,9 +5,10 @@
 #include <stdio.h>
 
 #include "firmware/app/control/control.h"
-#include "firmware/app/control/physbot.h"
+#include "firmware/app/control/mpc_controller.h"
 #include "firmware/app/control/trajectory_planner.h"
 #include "firmware/app/primitives/primitive.h"
+#include "firmware/shared/bang_bang_trajectory.h"
 #include "firmware/shared/physics.h"
 #include "firmware/shared/util.h"
 #include "shared/constants.h"
@@ -21,38 +22,83 @@
 typedef struct MoveHelperState
 {
     // The trajectory we're tracking
-    PositionTrajectory_t position_trajectory;
-
-    // The number of elements in the trajectory we're tracking
-    size_t num_trajectory_elems;
+    SegmentedPositionTrajectory_t position_trajectory;
 
     // The start time of this primitive, in seconds
     float primitive_start_time_seconds;
 
+    // The controller used to track the trajectory
+    TbotsProto_MovePositionParams_ControllerType controller_type;
+
+    // The state of the model-predictive controller, only used if it is the controller
+    // tracking the trajectory
+    MpcController_t mpc_controller;
 } MoveHelperState_t;
 DEFINE_PRIMITIVE_STATE_CREATE_AND_DESTROY_FUNCTIONS(MoveHelperState_t);
 
 /**
- * Calculates the rotation time, velocity, and acceleration to be stored
- * in a PhysBot data container.
+ * Calculates the rotational acceleration to apply, so that the bot finishes rotating
+ * at about the same time as it finishes moving
  *
- * @param pb The data container that has information about major axis time
- * and will store the rotational information
+ * @param rotation_disp The rotation left until the bot reaches its final orientation
+ * @param linear_move_time The time left until the bot reaches its destination
  * @param avel The current rotational velocity of the bot
+ *
+ * @return The rotational acceleration to apply
  */
-void plan_move_rotation(PhysBot* pb, float avel);
-
-void plan_move_rotation(PhysBot* pb, float avel)
+static float plan_move_rotation(float rotation_disp, float linear_move_time, float avel)
 {
-    float time_target = (pb->maj.time > TIME_HORIZON) ? pb->maj.time : TIME_HORIZON;
+    float time_target =
+        (linear_move_time > TIME_HORIZON) ? linear_move_time : TIME_HORIZON;
     if (time_target > 0.5f)
     {
         time_target = 0.5f;
     }
-    pb->rot.time  = time_target;
-    pb->rot.vel   = pb->rot.disp / pb->rot.time;
-    pb->rot.accel = (pb->rot.vel - avel) / TIME_HORIZON;
-    limit(&pb->rot.accel, MAX_T_A);
+    const float rotation_vel = rotation_disp / time_target;
+    float rotation_accel     = (rotation_vel - avel) / TIME_HORIZON;
+    limit(&rotation_accel, MAX_T_A);
+    return rotation_accel;
+}
+
+/**
+ * Tracks the trajectory with the model-predictive controller, by evaluating the
+ * trajectory over the controller's horizon and applying the acceleration it plans
+ *
+ * @param state [in/out] The state of the move helper
+ * @param world [in] The world the move helper is running in
+ */
+static void trackTrajectoryWithMpc(MoveHelperState_t* state, FirmwareWorld_t* world)
+{
+    const FirmwareRobot_t* robot = app_firmware_world_getRobot(world);
+
+    const float current_trajectory_time =
+        app_firmware_world_getCurrentTime(world) - state->primitive_start_time_seconds;
+    MpcReference_t reference;
+    for (unsigned int k = 0; k <= MPC_CONTROLLER_HORIZON_LENGTH; k++)
+    {
+        const PositionTrajectoryElement_t trajectory_element =
+            app_trajectory_planner_evaluateSegmentedPositionTrajectory(
+                &(state->position_trajectory),
+                current_trajectory_time + (float)k * MPC_CONTROLLER_HORIZON_STEP_SECONDS);
+        reference.position_x[k]  = trajectory_element.x_position;
+        reference.position_y[k]  = trajectory_element.y_position;
+        reference.orientation[k] = trajectory_element.orientation;
+    }
+
+    const MpcRobotState_t robot_state = {
+        .position_x       = app_firmware_robot_getPositionX(robot),
+        .position_y       = app_firmware_robot_getPositionY(robot),
+        .orientation      = app_firmware_robot_getOrientation(robot),
+        .velocity_x       = app_firmware_robot_getVelocityX(robot),
+        .velocity_y       = app_firmware_robot_getVelocityY(robot),
+        .angular_velocity = app_firmware_robot_getVelocityAngular(robot)};
+
+    float accel[3];
+    app_mpc_controller_computeAcceleration(
+        &(state->mpc_controller), robot_state, &reference,
+        app_mpc_controller_getMaxWheelAcceleration(robot), accel);
+
+    app_control_applyAccel(robot, accel[0], accel[1], accel[2]);
 }
 
 void app_move_helper_start(void* void_state_ptr, FirmwareWorld_t* world,
@@ -95,8 +141,7 @@ void app_move_helper_start(void* void_state_ptr, FirmwareWorld_t* world,
         .max_allowable_angular_speed = (float)ROBOT_MAX_ANG_SPEED_RAD_PER_SECOND,
         .initial_linear_speed        = current_speed,
         .final_linear_speed          = speed_at_dest_m_per_s};
-    state->num_trajectory_elems = path_parameters.num_elements;
-    app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
+    app_trajectory_planner_generateSegmentedPositionTrajectory(
         path_parameters, &(state->position_trajectory));
 
     // NOTE: We set this after doing the trajectory generation in case the generation
@@ -104,64 +149,73 @@ void app_move_helper_start(void* void_state_ptr, FirmwareWorld_t* world,
     //       tracking the trajectory, and so what it to be as close as possible to
     //       the time that we actually start _executing_ the trajectory
     state->primitive_start_time_seconds = app_firmware_world_getCurrentTime(world);
+
+    state->controller_type = move_position_params.controller_type;
+    app_mpc_controller_init(&(state->mpc_controller));
 }
 
 void app_move_helper_tick(void* void_state_ptr, FirmwareWorld_t* world)
 {
-    MoveHelperState_t* state     = (MoveHelperState_t*)(void_state_ptr);
-    const FirmwareRobot_t* robot = app_firmware_world_getRobot(world);
-
-    // Figure out the index of the trajectory element we should be executing
-    size_t trajectory_index  = 1;
-    const float current_time = app_firmware_world_getCurrentTime(world);
-    while (trajectory_index < state->num_trajectory_elems - 1 &&
-           state->position_trajectory.time_profile[trajectory_index - 1] < current_time)
+    MoveHelperState_t* state = (MoveHelperState_t*)(void_state_ptr);
+    if (state->controller_type == TbotsProto_MovePositionParams_ControllerType_MPC)
     {
-        trajectory_index++;
+        trackTrajectoryWithMpc(state, world);
+        return;
     }
 
-    const float dest_x = state->position_trajectory.x_position[trajectory_index];
-    const float dest_y = state->position_trajectory.y_position[trajectory_index];
-    const float dest_orientation =
-        state->position_trajectory.orientation[trajectory_index];
-    float dest[3] = {dest_x, dest_y, dest_orientation};
-
-    const float curr_x = app_firmware_robot_getPositionX(robot);
-    const float curr_y = app_firmware_robot_getPositionY(robot);
-
-    const float dx = dest_x - curr_x;
-    const float dy = dest_y - curr_y;
+    const FirmwareRobot_t* robot = app_firmware_world_getRobot(world);
 
-    float total_disp = sqrtf(dx * dx + dy * dy);
+    // Only the point on the trajectory we're moving towards this tick is evaluated,
+    // which is TIME_HORIZON ahead of where we should currently be
+    const float trajectory_time = app_firmware_world_getCurrentTime(world) -
+                                  state->primitive_start_time_seconds + TIME_HORIZON;
+    const PositionTrajectoryElement_t trajectory_element =
+        app_trajectory_planner_evaluateSegmentedPositionTrajectory(
+            &(state->position_trajectory), trajectory_time);
+
+    const float dx =
+        trajectory_element.x_position - app_firmware_robot_getPositionX(robot);
+    const float dy =
+        trajectory_element.y_position - app_firmware_robot_getPositionY(robot);
+    const float total_disp = sqrtf(dx * dx + dy * dy);
+
+    // The bang-bang trajectory ends at rest, so to pass the point on the trajectory at
+    // its speed we plan to stop past it, as far past it as it takes to stop from that
+    // speed. The bang-bang trajectory is planned relative to the bot's position
+    const float max_accel     = (float)ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED;
+    const float dest_speed    = trajectory_element.linear_speed;
+    const float stopping_disp = dest_speed * dest_speed / (2.0f * max_accel);
     // Add a small number to avoid division by zero
-    float major_vec[2] = {dx / (total_disp + 1e-6f), dy / (total_disp + 1e-6f)};
-    float minor_vec[2] = {major_vec[0], major_vec[1]};
-    rotate(minor_vec, P_PI / 2);
-
-    PhysBot pb = app_physbot_create(robot, dest, major_vec, minor_vec);
-
-    const float dest_speed = state->position_trajectory.linear_speed[trajectory_index];
-
-    // plan major axis movement
-    float max_major_a     = (float)ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED;
-    float max_major_v     = (float)ROBOT_MAX_SPEED_METERS_PER_SECOND;
-    float major_params[3] = {dest_speed, max_major_a, max_major_v};
-    app_physbot_planMove(&pb.maj, major_params);
-
-    // plan minor axis movement
-    float max_minor_a = (float)ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED / 2.0f;
-    float max_minor_v = (float)ROBOT_MAX_SPEED_METERS_PER_SECOND / 2.0f;
-    float minor_params[3] = {0, max_minor_a, max_minor_v};
-    app_physbot_planMove(&pb.min, minor_params);
-
-    // plan rotation movement
-    plan_move_rotation(&pb, app_firmware_robot_getVelocityAngular(robot));
-
-    float accel[3] = {0, 0, pb.rot.accel};
-
-    // rotate the accel and apply it
-    app_physbot_computeAccelInLocalCoordinates(
-        accel, pb, app_firmware_robot_getOrientation(robot), major_vec, minor_vec);
-
-    app_control_applyAccel(robot, accel[0], accel[1], accel[2]);
+    const float stopping_disp_scale = 1.0f + stopping_disp / (total_disp + 1e-6f);
+    const Vector2d_t final_disp     = {.x = dx * stopping_disp_scale,
+                                   .y = dy * stopping_disp_scale};
+    const Vector2d_t initial_disp   = {.x = 0.0f, .y = 0.0f};
+    const Vector2d_t velocity       = {.x = app_firmware_robot_getVelocityX(robot),
+                                 .y = app_firmware_robot_getVelocityY(robot)};
+
+    BangBangTrajectory2d_t bang_bang_trajectory;
+    shared_bang_bang_trajectory_generate2d(
+        &bang_bang_trajectory, initial_disp, final_disp, velocity,
+        (float)ROBOT_MAX_SPEED_METERS_PER_SECOND, max_accel);
+
+    // Apply the average acceleration needed to reach the velocity on the bang-bang
+    // trajectory at the time horizon
+    const Vector2d_t horizon_velocity =
+        shared_bang_bang_trajectory_getVelocity2d(&bang_bang_trajectory, TIME_HORIZON);
+    const float global_accel_x = (horizon_velocity.x - velocity.x) / TIME_HORIZON;
+    const float global_accel_y = (horizon_velocity.y - velocity.y) / TIME_HORIZON;
+
+    const float orientation    = app_firmware_robot_getOrientation(robot);
+    const float rotation_accel = plan_move_rotation(
+        min_angle_delta(orientation, trajectory_element.orientation),
+        shared_bang_bang_trajectory_getTotalTime2d(&bang_bang_trajectory),
+        app_firmware_robot_getVelocityAngular(robot));
+
+    // rotate the accel into the bot's coordinates and apply it
+    const float local_accel_x =
+        global_accel_x * cosf(orientation) + global_accel_y * sinf(orientation);
+    const float local_accel_y =
+        -global_accel_x * sinf(orientation) + global_accel_y * cosf(orientation);
+
+    app_control_applyAccel(robot, local_accel_x, local_accel_y, rotation_accel);
 }
@@ -19,5 +19,5 @@ void app_move_helper_start(void *void_state_ptr, FirmwareWorld_t *world,
 
 // The following function definitions mirror those in primitive_t
 void app_move_helper_tick(void *void_state_ptr, FirmwareWorld_t *world);
-void *createMoveHelperState_t(void);
+void *createMoveHelperState_t(void *state_arena);
 void destroyMoveHelperState_t(void *state);
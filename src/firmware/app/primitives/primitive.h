@@ -1,12 +1,24 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "firmware/app/control/mpc_controller.h"
+#include "firmware/app/control/trajectory_planner.h"
 #include "firmware/app/world/firmware_world.h"
 #include "shared/proto/primitive.nanopb.h"
 
+/**
+ * The most memory the state of any primitive can use. The primitives that follow a
+ * trajectory store the whole trajectory in their state, which makes their state far
+ * larger than any other, so this is the size of a trajectory and the controller that
+ * tracks it, with some room for the other members of the state.
+ */
+#define PRIMITIVE_STATE_MAX_SIZE_BYTES                                                   \
+    (sizeof(SegmentedPositionTrajectory_t) + sizeof(MpcController_t) + 64)
+
 /**
  * \brief The definition of a movement primitive.
  *
@@ -35,14 +47,18 @@ typedef struct
     void (*tick)(void* state_void_ptr, FirmwareWorld_t* world);
 
     /**
-     * Allocate a "state" variable that will be passed into all the primitive functions
+     * Create a "state" variable that will be passed into all the primitive functions
+     *
+     * @param state_arena Memory of at least PRIMITIVE_STATE_MAX_SIZE_BYTES bytes, owned
+     *                    by the caller, that the state is created in
      * @return A pointer to a "state" object, ie. whatever this primitive wants to store
      *         in terms of stateful information.
      */
-    void* (*create_state)(void);
+    void* (*create_state)(void* state_arena);
 
     /**
-     * Destroy an instance of the "state" object for this primitive
+     * Destroy an instance of the "state" object for this primitive. This does not free
+     * the memory the state was created in.
      * @param state A void pointer to the state object to destroy
      */
     void (*destroy_state)(void* state);
@@ -53,19 +69,20 @@ typedef struct
  * Implements create and destroy methods for the given state object type
  *
  * This should be used to implement the `create_state` and `destroy_state` functions
- * in each primitive
+ * in each primitive. The state is created in the arena it is given, so starting a
+ * primitive never allocates memory, and it is a compile error for the state to be
+ * larger than PRIMITIVE_STATE_MAX_SIZE_BYTES.
  *
  * @param STATE_TYPE The type of the state object
  */
 #define DEFINE_PRIMITIVE_STATE_CREATE_AND_DESTROY_FUNCTIONS(STATE_TYPE)                  \
-    void* create##STATE_TYPE(void)                                                       \
+    _Static_assert(sizeof(STATE_TYPE) <= PRIMITIVE_STATE_MAX_SIZE_BYTES,                 \
+                   #STATE_TYPE " is larger than PRIMITIVE_STATE_MAX_SIZE_BYTES");        \
+    void* create##STATE_TYPE(void* state_arena)                                          \
     {                                                                                    \
-        return malloc(sizeof(STATE_TYPE));                                               \
+        return (STATE_TYPE*)state_arena;                                                 \
     }                                                                                    \
-    void destroy##STATE_TYPE(void* state)                                                \
-    {                                                                                    \
-        free((STATE_TYPE*)state);                                                        \
-    }
+    void destroy##STATE_TYPE(void* state) {}
 
 /**
  * Stop the robot by disabling all motors and disabling autokicking and autochipping
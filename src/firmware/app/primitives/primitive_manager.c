@@ -13,6 +13,7 @@
 #endif
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 
@@ -40,6 +41,10 @@ struct PrimitiveManager
 
     // A pointer to the state of the current primitive
     void *current_primitive_state;
+
+    // The memory the state of the current primitive is created in. Every primitive's
+    // state is created here, so starting a new primitive doesn't allocate any memory.
+    _Alignas(max_align_t) uint8_t primitive_state_arena[PRIMITIVE_STATE_MAX_SIZE_BYTES];
 };
 
 /**
@@ -132,64 +137,72 @@ void app_primitive_manager_startNewPrimitive(PrimitiveManager_t *manager,
     {
         case TbotsProto_Primitive_stop_tag:
         {
-            manager->current_primitive       = &STOP_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            manager->current_primitive = &STOP_PRIMITIVE;
+            manager->current_primitive_state =
+                manager->current_primitive->create_state(manager->primitive_state_arena);
             app_stop_primitive_start(primitive_msg.primitive.stop,
                                      manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_chip_tag:
         {
-            manager->current_primitive       = &CHIP_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            manager->current_primitive = &CHIP_PRIMITIVE;
+            manager->current_primitive_state =
+                manager->current_primitive->create_state(manager->primitive_state_arena);
             app_chip_primitive_start(primitive_msg.primitive.chip,
                                      manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_kick_tag:
         {
-            manager->current_primitive       = &KICK_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            manager->current_primitive = &KICK_PRIMITIVE;
+            manager->current_primitive_state =
+                manager->current_primitive->create_state(manager->primitive_state_arena);
             app_kick_primitive_start(primitive_msg.primitive.kick,
                                      manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_move_tag:
         {
-            manager->current_primitive       = &MOVE_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            manager->current_primitive = &MOVE_PRIMITIVE;
+            manager->current_primitive_state =
+                manager->current_primitive->create_state(manager->primitive_state_arena);
             app_move_primitive_start(primitive_msg.primitive.move,
                                      manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_spinning_move_tag:
         {
-            manager->current_primitive       = &SPINNING_MOVE_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            manager->current_primitive = &SPINNING_MOVE_PRIMITIVE;
+            manager->current_primitive_state =
+                manager->current_primitive->create_state(manager->primitive_state_arena);
             app_spinning_move_primitive_start(primitive_msg.primitive.spinning_move,
                                               manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_autochip_move_tag:
         {
-            manager->current_primitive       = &AUTOCHIP_MOVE_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            manager->current_primitive = &AUTOCHIP_MOVE_PRIMITIVE;
+            manager->current_primitive_state =
+                manager->current_primitive->create_state(manager->primitive_state_arena);
             app_autochip_move_primitive_start(primitive_msg.primitive.autochip_move,
                                               manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_autokick_move_tag:
         {
-            manager->current_primitive       = &AUTOKICK_MOVE_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            manager->current_primitive = &AUTOKICK_MOVE_PRIMITIVE;
+            manager->current_primitive_state =
+                manager->current_primitive->create_state(manager->primitive_state_arena);
             app_autokick_move_primitive_start(primitive_msg.primitive.autokick_move,
                                               manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_direct_control_tag:
         {
-            manager->current_primitive       = &DIRECT_CONTROL_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            manager->current_primitive = &DIRECT_CONTROL_PRIMITIVE;
+            manager->current_primitive_state =
+                manager->current_primitive->create_state(manager->primitive_state_arena);
             app_direct_control_primitive_start(primitive_msg.primitive.direct_control,
                                                manager->current_primitive_state, world);
             break;
@@ -198,6 +211,7 @@ void app_primitive_manager_startNewPrimitive(PrimitiveManager_t *manager,
         {
             // the estop case is handled here
             app_primitive_makeRobotSafe(world);
+            app_primitive_manager_unlockPrimitiveMutex(manager);
             return;
         }
     }
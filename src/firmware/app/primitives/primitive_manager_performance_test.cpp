@@ -0,0 +1,86 @@
+extern "C"
+{
+#include "firmware/app/primitives/primitive_manager.h"
+}
+#include <malloc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "firmware/app/primitives/test_util_world.h"
+
+/**
+ * Gets the number of bytes currently allocated on the heap
+ *
+ * @return the number of bytes currently allocated on the heap
+ */
+size_t getHeapBytesInUse()
+{
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#else
+    return static_cast<size_t>(mallinfo().uordblks);
+#endif
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST_F(FirmwareTestUtilWorld, DISABLED_start_new_primitive_performance_test)
+{
+    // Each simulated robot has its own primitive manager, which starts a new primitive
+    // every time the AI sends one
+    static constexpr int NUM_ITERATIONS = 1000;
+
+    std::vector<TbotsProto_Primitive> primitive_msgs(4);
+    primitive_msgs[0].which_primitive = TbotsProto_Primitive_move_tag;
+    primitive_msgs[0].primitive.move.position_params.destination.x_meters = 1.0f;
+    primitive_msgs[0].primitive.move.position_params.destination.y_meters = 2.0f;
+    primitive_msgs[1].which_primitive = TbotsProto_Primitive_stop_tag;
+    primitive_msgs[2].which_primitive = TbotsProto_Primitive_autochip_move_tag;
+    primitive_msgs[2].primitive.autochip_move.position_params.destination.x_meters =
+        -1.0f;
+    primitive_msgs[3].which_primitive = TbotsProto_Primitive_direct_control_tag;
+
+    size_t heap_bytes_before_create = getHeapBytesInUse();
+    PrimitiveManager_t* manager     = app_primitive_manager_create();
+    size_t heap_bytes_after_create  = getHeapBytesInUse();
+    size_t peak_heap_bytes          = heap_bytes_after_create;
+
+    std::chrono::nanoseconds total_start_time(0);
+    std::chrono::nanoseconds max_start_time(0);
+    for (int i = 0; i < NUM_ITERATIONS; i++)
+    {
+        for (const auto& primitive_msg : primitive_msgs)
+        {
+            auto start_time = std::chrono::steady_clock::now();
+            app_primitive_manager_startNewPrimitive(manager, firmware_world,
+                                                    primitive_msg);
+            auto start_duration = std::chrono::steady_clock::now() - start_time;
+
+            total_start_time += start_duration;
+            max_start_time  = std::max(max_start_time, start_duration);
+            peak_heap_bytes = std::max(peak_heap_bytes, getHeapBytesInUse());
+        }
+    }
+
+    double num_starts = static_cast<double>(NUM_ITERATIONS * primitive_msgs.size());
+    std::cout << "Average primitive start time: "
+              << static_cast<double>(total_start_time.count()) / num_starts / 1000.0
+              << " us" << std::endl
+              << "Max primitive start time: "
+              << static_cast<double>(max_start_time.count()) / 1000.0 << " us"
+              << std::endl
+              << "Primitive manager memory per robot: "
+              << heap_bytes_after_create - heap_bytes_before_create << " bytes"
+              << std::endl
+              << "Peak heap growth while starting primitives: "
+              << peak_heap_bytes - heap_bytes_after_create << " bytes" << std::endl;
+
+    // Primitive states are stored in the primitive manager, so starting a primitive
+    // should never allocate
+    EXPECT_EQ(peak_heap_bytes, heap_bytes_after_create);
+
+    app_primitive_manager_destroy(manager);
+}
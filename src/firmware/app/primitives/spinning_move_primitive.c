@@ -3,8 +3,8 @@
 #include <math.h>
 #include <stdio.h>
 
-#include "firmware/app/control/bangbang.h"
 #include "firmware/app/control/control.h"
+#include "firmware/shared/bang_bang_trajectory.h"
 #include "firmware/shared/physics.h"
 
 #define TIME_HORIZON 0.5f
@@ -62,43 +62,75 @@ void app_spinning_move_primitive_start(TbotsProto_SpinningMovePrimitive prim_msg
     app_dribbler_setSpeed(dribbler, (uint32_t)prim_msg.dribbler_speed_rpm);
 }
 
+/**
+ * Computes the initial acceleration of the constant jerk motion that starts at the
+ * initial velocity and reaches the final velocity after travelling the given
+ * displacement over the given duration
+ *
+ * @param initial_velocity The velocity at the start of the motion
+ * @param final_velocity The velocity at the end of the motion
+ * @param displacement The displacement over the motion
+ * @param duration The duration of the motion
+ *
+ * @return The acceleration at the start of the motion
+ */
+static float computeInitialAccelerationForConstantJerk(float initial_velocity,
+                                                       float final_velocity,
+                                                       float displacement, float duration)
+{
+    // Solving
+    //   displacement = initial_velocity*t + accel*t^2/2 + jerk*t^3/6
+    //   final_velocity = initial_velocity + accel*t + jerk*t^2/2
+    // for accel gives
+    //   accel = 6*(displacement - initial_velocity*t)/t^2 - 2*(final_velocity -
+    //   initial_velocity)/t
+    const float average_velocity_change = (final_velocity - initial_velocity) / duration;
+    const float average_displacement_change =
+        (displacement - initial_velocity * duration) / (duration * duration);
+    return 6.0f * average_displacement_change - 2.0f * average_velocity_change;
+}
+
 static void app_spinning_move_primitive_tick(void *void_state_ptr, FirmwareWorld_t *world)
 {
     const FirmwareRobot_t *robot = app_firmware_world_getRobot(world);
     const SpinningMovePrimitiveState_t *state =
         (SpinningMovePrimitiveState_t *)void_state_ptr;
 
-    // Trajectories
-    BBProfile major;
-    BBProfile minor;
-
     // current to destination vector
     float x_disp = state->x_final - app_firmware_robot_getPositionX(robot);
     float y_disp = state->y_final - app_firmware_robot_getPositionY(robot);
 
-    // project current to destination vector to major/minor axis
-    float major_disp = x_disp * state->major_vec[0] + y_disp * state->major_vec[1];
-    float minor_disp = x_disp * state->minor_vec[0] + y_disp * state->minor_vec[1];
-
-    // project velocity vector to major/minor axis
-    const float curr_vx = app_firmware_robot_getVelocityX(robot);
-    const float curr_vy = app_firmware_robot_getVelocityY(robot);
-    float major_vel     = curr_vx * state->major_vec[0] + curr_vy * state->major_vec[1];
-    float minor_vel     = curr_vx * state->minor_vec[0] + curr_vy * state->minor_vec[1];
-
-    // Prepare trajectory
-    app_bangbang_prepareTrajectoryMaxV(&major, major_disp, major_vel, state->end_speed,
-                                       MAX_X_A, MAX_X_V);
-    app_bangbang_prepareTrajectoryMaxV(&minor, minor_disp, minor_vel, 0, MAX_Y_A,
-                                       MAX_Y_V);
-
-    // Plan
-    app_bangbang_planTrajectory(&major);
-    app_bangbang_planTrajectory(&minor);
-
-    // Compute acceleration
-    float major_accel = app_bangbang_computeAccel(&major, TIME_HORIZON);
-    float minor_accel = app_bangbang_computeAccel(&minor, TIME_HORIZON);
+    // The trajectory ends at rest, so to pass the destination at the end speed we plan to
+    // stop past it along the major axis, as far past it as it takes to stop from the end
+    // speed. We can only pass the destination moving towards it
+    const float major_disp = x_disp * state->major_vec[0] + y_disp * state->major_vec[1];
+    if (major_disp > 0.0f)
+    {
+        const float stopping_disp =
+            state->end_speed * state->end_speed / (2.0f * MAX_X_A);
+        x_disp += stopping_disp * state->major_vec[0];
+        y_disp += stopping_disp * state->major_vec[1];
+    }
+
+    // Plan the trajectory relative to the bot's position
+    const Vector2d_t initial_disp = {.x = 0.0f, .y = 0.0f};
+    const Vector2d_t final_disp   = {.x = x_disp, .y = y_disp};
+    const Vector2d_t velocity     = {.x = app_firmware_robot_getVelocityX(robot),
+                                 .y = app_firmware_robot_getVelocityY(robot)};
+    BangBangTrajectory2d_t trajectory;
+    shared_bang_bang_trajectory_generate2d(&trajectory, initial_disp, final_disp,
+                                           velocity, MAX_X_V, MAX_X_A);
+
+    // Compute the acceleration that gets us to the state on the trajectory at the time
+    // horizon with constant jerk
+    const Vector2d_t horizon_disp =
+        shared_bang_bang_trajectory_getPosition2d(&trajectory, TIME_HORIZON);
+    const Vector2d_t horizon_velocity =
+        shared_bang_bang_trajectory_getVelocity2d(&trajectory, TIME_HORIZON);
+    const float global_x_accel = computeInitialAccelerationForConstantJerk(
+        velocity.x, horizon_velocity.x, horizon_disp.x, TIME_HORIZON);
+    const float global_y_accel = computeInitialAccelerationForConstantJerk(
+        velocity.y, horizon_velocity.y, horizon_disp.y, TIME_HORIZON);
     float a_accel =
         (state->avel_final - app_firmware_robot_getVelocityAngular(robot)) / 0.05f;
 
@@ -117,20 +149,11 @@ static void app_spinning_move_primitive_tick(void *void_state_ptr, FirmwareWorld
     float local_x_vec[2]         = {cosf(curr_orientation), sinf(curr_orientation)};
     float local_y_vec[2]         = {-sinf(curr_orientation), cosf(curr_orientation)};
 
-    // Get local x acceleration
-    float major_dot_x = dot_product(local_x_vec, state->major_vec, 2);
-    float minor_dot_x = dot_product(local_x_vec, state->minor_vec, 2);
-    float x_accel     = major_accel * major_dot_x + minor_accel * minor_dot_x;
-
-    // Get local y acceleration
-    float major_dot_y = dot_product(local_y_vec, state->major_vec, 2);
-    float minor_dot_y = dot_product(local_y_vec, state->minor_vec, 2);
-    float y_accel     = major_accel * major_dot_y + minor_accel * minor_dot_y;
-
     // Apply acceleration in robot's coordinates
-    float linear_acc[2] = {
-        x_accel,
-        y_accel,
+    float global_accel[2] = {global_x_accel, global_y_accel};
+    float linear_acc[2]   = {
+        dot_product(local_x_vec, global_accel, 2),
+        dot_product(local_y_vec, global_accel, 2),
     };
 
     app_control_applyAccel(robot, linear_acc[0], linear_acc[1], a_accel);
@@ -0,0 +1,247 @@
+#include "firmware/shared/bang_bang_trajectory.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+
+// The 2D trajectory is considered synchronized once the durations of the trajectories
+// along each axis are within this many seconds of each other
+#define TIME_SYNCHRONIZATION_TOLERANCE_SECONDS 1e-4f
+
+// The smallest change to the split of the limits between the axes that the 2D
+// synchronization will try before giving up
+#define MIN_SPLIT_ANGLE_STEP_RADIANS 1e-6f
+
+/**
+ * Gets the position and velocity at the end of a part of a 1D trajectory
+ *
+ * @param part [in] The part of the trajectory
+ * @param duration The duration of the part [s]
+ * @param end_position [out] The position at the end of the part [m]
+ * @param end_velocity [out] The velocity at the end of the part [m/s]
+ */
+static void integratePart(const BangBangTrajectory1dPart_t* part, float duration,
+                          float* end_position, float* end_velocity)
+{
+    *end_position = part->start_position + part->start_velocity * duration +
+                    0.5f * part->acceleration * duration * duration;
+    *end_velocity = part->start_velocity + part->acceleration * duration;
+}
+
+/**
+ * Gets the index of the part of a 1D trajectory that contains the given time
+ *
+ * @param trajectory [in] The trajectory
+ * @param time The time relative to the start of the trajectory [s]
+ * @param part_start_time [out] The time the returned part starts at [s]
+ *
+ * @return The index of the part containing the given time, or
+ * BANG_BANG_TRAJECTORY_1D_NUM_PARTS if the time is after the end of the trajectory
+ */
+static unsigned int getPartIndex(const BangBangTrajectory1d_t* trajectory, float time,
+                                 float* part_start_time)
+{
+    *part_start_time = 0.0f;
+    for (unsigned int i = 0; i < BANG_BANG_TRAJECTORY_1D_NUM_PARTS; i++)
+    {
+        if (time < trajectory->parts[i].end_time)
+        {
+            return i;
+        }
+        *part_start_time = trajectory->parts[i].end_time;
+    }
+    return BANG_BANG_TRAJECTORY_1D_NUM_PARTS;
+}
+
+void shared_bang_bang_trajectory_generate1d(BangBangTrajectory1d_t* trajectory,
+                                            float initial_position, float final_position,
+                                            float initial_velocity, float max_speed,
+                                            float max_acceleration)
+{
+    assert(max_speed > 0.0f);
+    assert(max_acceleration > 0.0f);
+
+    // Find where we would stop if we braked as hard as possible right now. The
+    // trajectory has to travel towards the final position from there, so if we would
+    // overshoot, we brake through zero velocity and come back
+    const float stopping_distance =
+        initial_velocity * fabsf(initial_velocity) / (2.0f * max_acceleration);
+    const float stopping_position = initial_position + stopping_distance;
+    const float direction         = (final_position >= stopping_position) ? 1.0f : -1.0f;
+
+    // Work in the frame where we travel in the positive direction. In this frame the
+    // distance is always at least the stopping distance
+    const float distance = direction * (final_position - initial_position);
+    const float velocity = direction * initial_velocity;
+
+    // The peak speed if we accelerate and then immediately decelerate to the final
+    // position, found by equating the sum of the accelerating and decelerating
+    // distances to the total distance
+    const float peak_speed =
+        sqrtf(fmaxf(0.0f, max_acceleration * distance + 0.5f * velocity * velocity));
+
+    float accelerate_duration;
+    float accelerate_acceleration;
+    float cruise_duration;
+    float cruise_speed;
+    if (peak_speed <= max_speed)
+    {
+        // Triangular profile, we never reach the maximum speed
+        accelerate_duration     = (peak_speed - velocity) / max_acceleration;
+        accelerate_acceleration = max_acceleration;
+        cruise_duration         = 0.0f;
+        cruise_speed            = peak_speed;
+    }
+    else
+    {
+        // Trapezoidal profile, we reach the maximum speed and cruise. If we start
+        // faster than the maximum speed, the first part decelerates to it instead
+        accelerate_duration = fabsf(max_speed - velocity) / max_acceleration;
+        accelerate_acceleration =
+            (velocity <= max_speed) ? max_acceleration : -max_acceleration;
+        const float accelerate_distance = (max_speed * max_speed - velocity * velocity) /
+                                          (2.0f * accelerate_acceleration);
+        const float decelerate_distance =
+            max_speed * max_speed / (2.0f * max_acceleration);
+        cruise_duration =
+            fmaxf(0.0f, distance - accelerate_distance - decelerate_distance) / max_speed;
+        cruise_speed = max_speed;
+    }
+    const float decelerate_duration = cruise_speed / max_acceleration;
+
+    const float durations[BANG_BANG_TRAJECTORY_1D_NUM_PARTS] = {
+        accelerate_duration, cruise_duration, decelerate_duration};
+    const float accelerations[BANG_BANG_TRAJECTORY_1D_NUM_PARTS] = {
+        direction * accelerate_acceleration, 0.0f, -direction * max_acceleration};
+
+    float current_position = initial_position;
+    float current_velocity = initial_velocity;
+    float time             = 0.0f;
+    for (unsigned int i = 0; i < BANG_BANG_TRAJECTORY_1D_NUM_PARTS; i++)
+    {
+        BangBangTrajectory1dPart_t* part = &trajectory->parts[i];
+        part->start_position             = current_position;
+        part->start_velocity             = current_velocity;
+        part->acceleration               = accelerations[i];
+        time += durations[i];
+        part->end_time = time;
+        integratePart(part, durations[i], &current_position, &current_velocity);
+    }
+    trajectory->final_position = final_position;
+}
+
+float shared_bang_bang_trajectory_getTotalTime1d(const BangBangTrajectory1d_t* trajectory)
+{
+    return trajectory->parts[BANG_BANG_TRAJECTORY_1D_NUM_PARTS - 1].end_time;
+}
+
+float shared_bang_bang_trajectory_getPosition1d(const BangBangTrajectory1d_t* trajectory,
+                                                float time)
+{
+    float part_start_time;
+    const unsigned int index = getPartIndex(trajectory, time, &part_start_time);
+    if (index == BANG_BANG_TRAJECTORY_1D_NUM_PARTS)
+    {
+        return trajectory->final_position;
+    }
+
+    float position;
+    float velocity;
+    integratePart(&trajectory->parts[index], fmaxf(0.0f, time - part_start_time),
+                  &position, &velocity);
+    return position;
+}
+
+float shared_bang_bang_trajectory_getVelocity1d(const BangBangTrajectory1d_t* trajectory,
+                                                float time)
+{
+    float part_start_time;
+    const unsigned int index = getPartIndex(trajectory, time, &part_start_time);
+    if (index == BANG_BANG_TRAJECTORY_1D_NUM_PARTS)
+    {
+        return 0.0f;
+    }
+
+    float position;
+    float velocity;
+    integratePart(&trajectory->parts[index], fmaxf(0.0f, time - part_start_time),
+                  &position, &velocity);
+    return velocity;
+}
+
+float shared_bang_bang_trajectory_getAcceleration1d(
+    const BangBangTrajectory1d_t* trajectory, float time)
+{
+    float part_start_time;
+    const unsigned int index = getPartIndex(trajectory, time, &part_start_time);
+    if (index == BANG_BANG_TRAJECTORY_1D_NUM_PARTS)
+    {
+        return 0.0f;
+    }
+    return trajectory->parts[index].acceleration;
+}
+
+void shared_bang_bang_trajectory_generate2d(BangBangTrajectory2d_t* trajectory,
+                                            Vector2d_t initial_position,
+                                            Vector2d_t final_position,
+                                            Vector2d_t initial_velocity, float max_speed,
+                                            float max_acceleration)
+{
+    assert(max_speed > 0.0f);
+    assert(max_acceleration > 0.0f);
+
+    // The limits are split between the axes by an angle, where the x axis gets
+    // cos(angle) of each limit and the y axis gets sin(angle). Giving more of the limits
+    // to an axis makes it faster, so we bisect the angle until both axes take the same
+    // amount of time, which keeps the 2D acceleration and velocity within the limits.
+    // Since the angle never reaches 0 or pi/2, neither axis gets a limit of 0
+    float angle      = (float)M_PI / 4.0f;
+    float angle_step = (float)M_PI / 8.0f;
+    while (true)
+    {
+        const float cos_angle = cosf(angle);
+        const float sin_angle = sinf(angle);
+        shared_bang_bang_trajectory_generate1d(
+            &trajectory->x, initial_position.x, final_position.x, initial_velocity.x,
+            max_speed * cos_angle, max_acceleration * cos_angle);
+        shared_bang_bang_trajectory_generate1d(
+            &trajectory->y, initial_position.y, final_position.y, initial_velocity.y,
+            max_speed * sin_angle, max_acceleration * sin_angle);
+
+        const float x_time = shared_bang_bang_trajectory_getTotalTime1d(&trajectory->x);
+        const float y_time = shared_bang_bang_trajectory_getTotalTime1d(&trajectory->y);
+        if (fabsf(x_time - y_time) < TIME_SYNCHRONIZATION_TOLERANCE_SECONDS ||
+            angle_step < MIN_SPLIT_ANGLE_STEP_RADIANS)
+        {
+            break;
+        }
+
+        // Give more of the limits to whichever axis is slower
+        angle += (x_time > y_time) ? -angle_step : angle_step;
+        angle_step /= 2.0f;
+    }
+}
+
+float shared_bang_bang_trajectory_getTotalTime2d(const BangBangTrajectory2d_t* trajectory)
+{
+    return fmaxf(shared_bang_bang_trajectory_getTotalTime1d(&trajectory->x),
+                 shared_bang_bang_trajectory_getTotalTime1d(&trajectory->y));
+}
+
+Vector2d_t shared_bang_bang_trajectory_getPosition2d(
+    const BangBangTrajectory2d_t* trajectory, float time)
+{
+    Vector2d_t position = {
+        .x = shared_bang_bang_trajectory_getPosition1d(&trajectory->x, time),
+        .y = shared_bang_bang_trajectory_getPosition1d(&trajectory->y, time)};
+    return position;
+}
+
+Vector2d_t shared_bang_bang_trajectory_getVelocity2d(
+    const BangBangTrajectory2d_t* trajectory, float time)
+{
+    Vector2d_t velocity = {
+        .x = shared_bang_bang_trajectory_getVelocity1d(&trajectory->x, time),
+        .y = shared_bang_bang_trajectory_getVelocity1d(&trajectory->y, time)};
+    return velocity;
+}
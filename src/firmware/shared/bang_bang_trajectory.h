@@ -0,0 +1,167 @@
+#pragma once
+
+#include "firmware/shared/math/vector_2d.h"
+
+/**
+ * This file implements time-optimal trajectories for a robot that can accelerate at up
+ * to a maximum acceleration and travel at up to a maximum speed, that ends at rest at its
+ * destination. These are commonly called bang-bang trajectories because the robot is
+ * always either accelerating as hard as possible or coasting at its maximum speed.
+ *
+ * 1D trajectories are calculated in closed form. A 2D trajectory is made of a 1D
+ * trajectory for each axis, where the maximum acceleration and speed are split between
+ * the axes so that both axes reach the destination at the same time.
+ *
+ * Trajectories are generated into caller-allocated structs and never allocate memory, so
+ * they can be used both on the robot and in the AI.
+ */
+
+// The number of parts of a 1D trajectory. The robot accelerates towards the destination,
+// coasts at its maximum speed and then decelerates to a stop. Unused parts have a
+// duration of 0.
+#define BANG_BANG_TRAJECTORY_1D_NUM_PARTS 3
+
+/**
+ * A part of a 1D trajectory with constant acceleration
+ */
+typedef struct BangBangTrajectory1dPart
+{
+    // The time this part ends at, relative to the start of the trajectory [s]
+    float end_time;
+    // The acceleration during this part [m/s^2]
+    float acceleration;
+    // The position at the start of this part [m]
+    float start_position;
+    // The velocity at the start of this part [m/s]
+    float start_velocity;
+} BangBangTrajectory1dPart_t;
+
+typedef struct BangBangTrajectory1d
+{
+    BangBangTrajectory1dPart_t parts[BANG_BANG_TRAJECTORY_1D_NUM_PARTS];
+    // The position the trajectory ends at [m]
+    float final_position;
+} BangBangTrajectory1d_t;
+
+typedef struct BangBangTrajectory2d
+{
+    BangBangTrajectory1d_t x;
+    BangBangTrajectory1d_t y;
+} BangBangTrajectory2d_t;
+
+/**
+ * Generates the time-optimal 1D trajectory from the initial position and velocity to a
+ * stop at the final position
+ *
+ * @pre max_speed > 0 and max_acceleration > 0
+ *
+ * @param trajectory [out] The trajectory to generate
+ * @param initial_position The position the trajectory starts at [m]
+ * @param final_position The position the trajectory ends at [m]
+ * @param initial_velocity The velocity the trajectory starts with [m/s]
+ * @param max_speed The maximum speed along the trajectory [m/s]. If the initial speed
+ * is higher than this, the trajectory will decelerate to it
+ * @param max_acceleration The maximum acceleration along the trajectory [m/s^2]
+ */
+void shared_bang_bang_trajectory_generate1d(BangBangTrajectory1d_t* trajectory,
+                                            float initial_position, float final_position,
+                                            float initial_velocity, float max_speed,
+                                            float max_acceleration);
+
+/**
+ * Gets the time it takes to follow a 1D trajectory
+ *
+ * @param trajectory [in] The trajectory
+ *
+ * @return The duration of the trajectory [s]
+ */
+float shared_bang_bang_trajectory_getTotalTime1d(
+    const BangBangTrajectory1d_t* trajectory);
+
+/**
+ * Gets the position along a 1D trajectory at the given time
+ *
+ * @param trajectory [in] The trajectory
+ * @param time The time relative to the start of the trajectory [s]. Times after the end
+ * of the trajectory give the final position
+ *
+ * @return The position at the given time [m]
+ */
+float shared_bang_bang_trajectory_getPosition1d(const BangBangTrajectory1d_t* trajectory,
+                                                float time);
+
+/**
+ * Gets the velocity along a 1D trajectory at the given time
+ *
+ * @param trajectory [in] The trajectory
+ * @param time The time relative to the start of the trajectory [s]. Times after the end
+ * of the trajectory give a velocity of 0
+ *
+ * @return The velocity at the given time [m/s]
+ */
+float shared_bang_bang_trajectory_getVelocity1d(const BangBangTrajectory1d_t* trajectory,
+                                                float time);
+
+/**
+ * Gets the acceleration along a 1D trajectory at the given time
+ *
+ * @param trajectory [in] The trajectory
+ * @param time The time relative to the start of the trajectory [s]. Times after the end
+ * of the trajectory give an acceleration of 0
+ *
+ * @return The acceleration at the given time [m/s^2]
+ */
+float shared_bang_bang_trajectory_getAcceleration1d(
+    const BangBangTrajectory1d_t* trajectory, float time);
+
+/**
+ * Generates a time-optimal 2D trajectory from the initial position and velocity to a
+ * stop at the final position. The acceleration and speed limits apply to the magnitude
+ * of the 2D acceleration and velocity.
+ *
+ * @pre max_speed > 0 and max_acceleration > 0
+ *
+ * @param trajectory [out] The trajectory to generate
+ * @param initial_position The position the trajectory starts at [m]
+ * @param final_position The position the trajectory ends at [m]
+ * @param initial_velocity The velocity the trajectory starts with [m/s]
+ * @param max_speed The maximum speed along the trajectory [m/s]
+ * @param max_acceleration The maximum acceleration along the trajectory [m/s^2]
+ */
+void shared_bang_bang_trajectory_generate2d(BangBangTrajectory2d_t* trajectory,
+                                            Vector2d_t initial_position,
+                                            Vector2d_t final_position,
+                                            Vector2d_t initial_velocity, float max_speed,
+                                            float max_acceleration);
+
+/**
+ * Gets the time it takes to follow a 2D trajectory
+ *
+ * @param trajectory [in] The trajectory
+ *
+ * @return The duration of the trajectory [s]
+ */
+float shared_bang_bang_trajectory_getTotalTime2d(
+    const BangBangTrajectory2d_t* trajectory);
+
+/**
+ * Gets the position along a 2D trajectory at the given time
+ *
+ * @param trajectory [in] The trajectory
+ * @param time The time relative to the start of the trajectory [s]
+ *
+ * @return The position at the given time [m]
+ */
+Vector2d_t shared_bang_bang_trajectory_getPosition2d(
+    const BangBangTrajectory2d_t* trajectory, float time);
+
+/**
+ * Gets the velocity along a 2D trajectory at the given time
+ *
+ * @param trajectory [in] The trajectory
+ * @param time The time relative to the start of the trajectory [s]
+ *
+ * @return The velocity at the given time [m/s]
+ */
+Vector2d_t shared_bang_bang_trajectory_getVelocity2d(
+    const BangBangTrajectory2d_t* trajectory, float time);
@@ -0,0 +1,42 @@
+extern "C"
+{
+#include "firmware/shared/bang_bang_trajectory.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+static const int NUM_ITERATIONS = 100000;
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(BangBangTrajectoryPerformanceTest, DISABLED_generate_2d_trajectory_performance_test)
+{
+    // Vary the destination so every iteration generates a different trajectory
+    float total_time = 0.0f;
+
+    auto start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_ITERATIONS; i++)
+    {
+        const float offset                = static_cast<float>(i % 100) * 0.01f;
+        const Vector2d_t initial_position = {.x = 0.0f, .y = 0.0f};
+        const Vector2d_t final_position   = {.x = 3.0f + offset, .y = -1.0f - offset};
+        const Vector2d_t initial_velocity = {.x = -0.5f, .y = 1.0f};
+        BangBangTrajectory2d_t trajectory;
+        shared_bang_bang_trajectory_generate2d(
+            &trajectory, initial_position, final_position, initial_velocity, 2.0f, 3.0f);
+        total_time += shared_bang_bang_trajectory_getTotalTime2d(&trajectory);
+    }
+    auto duration = std::chrono::steady_clock::now() - start_time;
+
+    EXPECT_GT(total_time, 0.0f);
+
+    std::cout
+        << "Average time to generate a 2D trajectory: "
+        << static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) /
+               NUM_ITERATIONS
+        << " ns" << std::endl;
+}
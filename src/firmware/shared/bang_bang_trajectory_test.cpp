@@ -0,0 +1,245 @@
+extern "C"
+{
+#include "firmware/shared/bang_bang_trajectory.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+static const float MAX_SPEED        = 2.0f;
+static const float MAX_ACCELERATION = 3.0f;
+
+/**
+ * Checks that a 1D trajectory is continuous, stays within the limits, and ends at rest
+ * at the given final position
+ *
+ * @param trajectory The trajectory to check
+ * @param final_position The position the trajectory should end at
+ * @param max_speed The maximum speed of the trajectory, ignored if the trajectory
+ * starts faster than it
+ * @param max_acceleration The maximum acceleration of the trajectory
+ */
+static void expectValidTrajectory1d(const BangBangTrajectory1d_t& trajectory,
+                                    float final_position, float max_speed,
+                                    float max_acceleration)
+{
+    const float total_time = shared_bang_bang_trajectory_getTotalTime1d(&trajectory);
+    const float dt         = 0.001f;
+
+    float prev_position = shared_bang_bang_trajectory_getPosition1d(&trajectory, 0.0f);
+    float prev_velocity = shared_bang_bang_trajectory_getVelocity1d(&trajectory, 0.0f);
+    for (float t = dt; t < total_time; t += dt)
+    {
+        const float position = shared_bang_bang_trajectory_getPosition1d(&trajectory, t);
+        const float velocity = shared_bang_bang_trajectory_getVelocity1d(&trajectory, t);
+        const float acceleration =
+            shared_bang_bang_trajectory_getAcceleration1d(&trajectory, t);
+
+        EXPECT_LE(std::fabs(acceleration), max_acceleration + 1e-4f);
+        if (std::fabs(prev_velocity) <= max_speed)
+        {
+            EXPECT_LE(std::fabs(velocity), max_speed + 1e-4f);
+        }
+        EXPECT_NEAR(position - prev_position, 0.5f * (velocity + prev_velocity) * dt,
+                    1e-4f);
+        EXPECT_LE(std::fabs(velocity - prev_velocity), max_acceleration * dt + 1e-4f);
+
+        prev_position = position;
+        prev_velocity = velocity;
+    }
+
+    EXPECT_NEAR(shared_bang_bang_trajectory_getPosition1d(&trajectory, total_time),
+                final_position, 1e-4f);
+    EXPECT_NEAR(shared_bang_bang_trajectory_getVelocity1d(&trajectory, total_time), 0.0f,
+                1e-4f);
+    EXPECT_NEAR(prev_position, final_position, 1e-2f);
+}
+
+TEST(BangBangTrajectoryTest, already_at_destination)
+{
+    BangBangTrajectory1d_t trajectory;
+    shared_bang_bang_trajectory_generate1d(&trajectory, 1.0f, 1.0f, 0.0f, MAX_SPEED,
+                                           MAX_ACCELERATION);
+
+    EXPECT_EQ(shared_bang_bang_trajectory_getTotalTime1d(&trajectory), 0.0f);
+    EXPECT_EQ(shared_bang_bang_trajectory_getPosition1d(&trajectory, 0.0f), 1.0f);
+    EXPECT_EQ(shared_bang_bang_trajectory_getVelocity1d(&trajectory, 0.0f), 0.0f);
+    EXPECT_EQ(shared_bang_bang_trajectory_getAcceleration1d(&trajectory, 0.0f), 0.0f);
+}
+
+TEST(BangBangTrajectoryTest, triangular_profile_from_rest)
+{
+    // The robot can't reach its maximum speed over this distance, so it should
+    // accelerate for half the distance and decelerate for the other half
+    const float distance = 1.0f;
+    BangBangTrajectory1d_t trajectory;
+    shared_bang_bang_trajectory_generate1d(&trajectory, 0.0f, distance, 0.0f, MAX_SPEED,
+                                           MAX_ACCELERATION);
+
+    const float half_time = std::sqrt(distance / MAX_ACCELERATION);
+    EXPECT_NEAR(shared_bang_bang_trajectory_getTotalTime1d(&trajectory), 2 * half_time,
+                1e-5f);
+    EXPECT_NEAR(shared_bang_bang_trajectory_getPosition1d(&trajectory, half_time),
+                distance / 2, 1e-5f);
+    EXPECT_NEAR(shared_bang_bang_trajectory_getVelocity1d(&trajectory, half_time),
+                MAX_ACCELERATION * half_time, 1e-5f);
+    expectValidTrajectory1d(trajectory, distance, MAX_SPEED, MAX_ACCELERATION);
+}
+
+TEST(BangBangTrajectoryTest, trapezoidal_profile_from_rest)
+{
+    const float distance = -4.0f;
+    BangBangTrajectory1d_t trajectory;
+    shared_bang_bang_trajectory_generate1d(&trajectory, 0.0f, distance, 0.0f, MAX_SPEED,
+                                           MAX_ACCELERATION);
+
+    // Accelerate to the maximum speed, cruise, then decelerate
+    const float acceleration_time     = MAX_SPEED / MAX_ACCELERATION;
+    const float acceleration_distance = 0.5f * MAX_SPEED * acceleration_time;
+    const float cruise_time =
+        (std::fabs(distance) - 2 * acceleration_distance) / MAX_SPEED;
+    EXPECT_NEAR(shared_bang_bang_trajectory_getTotalTime1d(&trajectory),
+                2 * acceleration_time + cruise_time, 1e-5f);
+    EXPECT_NEAR(
+        shared_bang_bang_trajectory_getVelocity1d(&trajectory, acceleration_time + 0.1f),
+        -MAX_SPEED, 1e-5f);
+    EXPECT_EQ(
+        shared_bang_bang_trajectory_getAcceleration1d(&trajectory, acceleration_time / 2),
+        -MAX_ACCELERATION);
+    expectValidTrajectory1d(trajectory, distance, MAX_SPEED, MAX_ACCELERATION);
+}
+
+TEST(BangBangTrajectoryTest, moving_away_from_destination)
+{
+    // The robot has to brake and turn around before heading to the destination
+    BangBangTrajectory1d_t trajectory;
+    shared_bang_bang_trajectory_generate1d(&trajectory, 0.0f, 1.0f, -1.5f, MAX_SPEED,
+                                           MAX_ACCELERATION);
+
+    EXPECT_EQ(shared_bang_bang_trajectory_getAcceleration1d(&trajectory, 0.0f),
+              MAX_ACCELERATION);
+    EXPECT_LT(shared_bang_bang_trajectory_getPosition1d(&trajectory, 0.1f), 0.0f);
+    expectValidTrajectory1d(trajectory, 1.0f, MAX_SPEED, MAX_ACCELERATION);
+}
+
+TEST(BangBangTrajectoryTest, overshoots_destination_when_too_fast_to_stop)
+{
+    // The robot can't stop before the destination, so it has to brake past it and come
+    // back
+    BangBangTrajectory1d_t trajectory;
+    shared_bang_bang_trajectory_generate1d(&trajectory, 0.0f, 0.1f, 2.0f, MAX_SPEED,
+                                           MAX_ACCELERATION);
+
+    const float stopping_time = 2.0f / MAX_ACCELERATION;
+    EXPECT_GT(shared_bang_bang_trajectory_getPosition1d(&trajectory, stopping_time),
+              0.1f);
+    EXPECT_EQ(shared_bang_bang_trajectory_getAcceleration1d(&trajectory, 0.0f),
+              -MAX_ACCELERATION);
+    expectValidTrajectory1d(trajectory, 0.1f, MAX_SPEED, MAX_ACCELERATION);
+}
+
+TEST(BangBangTrajectoryTest, starting_faster_than_max_speed)
+{
+    BangBangTrajectory1d_t trajectory;
+    shared_bang_bang_trajectory_generate1d(&trajectory, 0.0f, 5.0f, 3.0f, MAX_SPEED,
+                                           MAX_ACCELERATION);
+
+    // The robot should slow down to its maximum speed and then cruise
+    const float slow_down_time = (3.0f - MAX_SPEED) / MAX_ACCELERATION;
+    EXPECT_EQ(shared_bang_bang_trajectory_getAcceleration1d(&trajectory, 0.0f),
+              -MAX_ACCELERATION);
+    EXPECT_NEAR(
+        shared_bang_bang_trajectory_getVelocity1d(&trajectory, slow_down_time + 0.1f),
+        MAX_SPEED, 1e-5f);
+    expectValidTrajectory1d(trajectory, 5.0f, MAX_SPEED, MAX_ACCELERATION);
+}
+
+TEST(BangBangTrajectoryTest, valid_for_range_of_initial_conditions)
+{
+    for (float final_position = -3.0f; final_position <= 3.0f; final_position += 0.75f)
+    {
+        for (float initial_velocity = -3.0f; initial_velocity <= 3.0f;
+             initial_velocity += 0.5f)
+        {
+            BangBangTrajectory1d_t trajectory;
+            shared_bang_bang_trajectory_generate1d(&trajectory, 0.0f, final_position,
+                                                   initial_velocity, MAX_SPEED,
+                                                   MAX_ACCELERATION);
+            expectValidTrajectory1d(trajectory, final_position, MAX_SPEED,
+                                    MAX_ACCELERATION);
+        }
+    }
+}
+
+TEST(BangBangTrajectoryTest, after_end_of_trajectory)
+{
+    BangBangTrajectory1d_t trajectory;
+    shared_bang_bang_trajectory_generate1d(&trajectory, 0.5f, 2.5f, 1.0f, MAX_SPEED,
+                                           MAX_ACCELERATION);
+
+    const float after_end_time =
+        shared_bang_bang_trajectory_getTotalTime1d(&trajectory) + 1.0f;
+    EXPECT_EQ(shared_bang_bang_trajectory_getPosition1d(&trajectory, after_end_time),
+              2.5f);
+    EXPECT_EQ(shared_bang_bang_trajectory_getVelocity1d(&trajectory, after_end_time),
+              0.0f);
+    EXPECT_EQ(shared_bang_bang_trajectory_getAcceleration1d(&trajectory, after_end_time),
+              0.0f);
+}
+
+TEST(BangBangTrajectoryTest, two_dimensional_axes_end_at_the_same_time)
+{
+    const Vector2d_t initial_position = {.x = 0.0f, .y = 0.0f};
+    const Vector2d_t final_position   = {.x = 3.0f, .y = -1.0f};
+    const Vector2d_t initial_velocity = {.x = -0.5f, .y = 1.0f};
+    BangBangTrajectory2d_t trajectory;
+    shared_bang_bang_trajectory_generate2d(&trajectory, initial_position, final_position,
+                                           initial_velocity, MAX_SPEED, MAX_ACCELERATION);
+
+    const float total_time = shared_bang_bang_trajectory_getTotalTime2d(&trajectory);
+    EXPECT_NEAR(shared_bang_bang_trajectory_getTotalTime1d(&trajectory.x), total_time,
+                1e-3f);
+    EXPECT_NEAR(shared_bang_bang_trajectory_getTotalTime1d(&trajectory.y), total_time,
+                1e-3f);
+
+    const Vector2d_t start = shared_bang_bang_trajectory_getPosition2d(&trajectory, 0.0f);
+    EXPECT_NEAR(start.x, initial_position.x, 1e-5f);
+    EXPECT_NEAR(start.y, initial_position.y, 1e-5f);
+    const Vector2d_t end =
+        shared_bang_bang_trajectory_getPosition2d(&trajectory, total_time);
+    EXPECT_NEAR(end.x, final_position.x, 1e-4f);
+    EXPECT_NEAR(end.y, final_position.y, 1e-4f);
+
+    // The 2D acceleration and speed stay within the limits
+    for (float t = 0.0f; t < total_time; t += 0.01f)
+    {
+        const Vector2d_t velocity =
+            shared_bang_bang_trajectory_getVelocity2d(&trajectory, t);
+        EXPECT_LE(std::hypot(velocity.x, velocity.y), MAX_SPEED + 1e-4f);
+        const float acceleration_x =
+            shared_bang_bang_trajectory_getAcceleration1d(&trajectory.x, t);
+        const float acceleration_y =
+            shared_bang_bang_trajectory_getAcceleration1d(&trajectory.y, t);
+        EXPECT_LE(std::hypot(acceleration_x, acceleration_y), MAX_ACCELERATION + 1e-4f);
+    }
+}
+
+TEST(BangBangTrajectoryTest, two_dimensional_along_an_axis_from_rest)
+{
+    // Moving only along the x axis from rest should take as long as the 1D trajectory
+    // with the full limits
+    const Vector2d_t initial_position = {.x = 0.0f, .y = 0.0f};
+    const Vector2d_t final_position   = {.x = 4.0f, .y = 0.0f};
+    const Vector2d_t initial_velocity = {.x = 0.0f, .y = 0.0f};
+    BangBangTrajectory2d_t trajectory_2d;
+    shared_bang_bang_trajectory_generate2d(&trajectory_2d, initial_position,
+                                           final_position, initial_velocity, MAX_SPEED,
+                                           MAX_ACCELERATION);
+    BangBangTrajectory1d_t trajectory_1d;
+    shared_bang_bang_trajectory_generate1d(&trajectory_1d, 0.0f, 4.0f, 0.0f, MAX_SPEED,
+                                           MAX_ACCELERATION);
+
+    EXPECT_NEAR(shared_bang_bang_trajectory_getTotalTime2d(&trajectory_2d),
+                shared_bang_bang_trajectory_getTotalTime1d(&trajectory_1d), 1e-3f);
+}
@@ -0,0 +1,143 @@
+#include "firmware/shared/math/fixed_matrix.h"
+
+#include <assert.h>
+
+float shared_fixed_matrix_getValue(const FixedMatrix_t* matrix, unsigned int row,
+                                   unsigned int column)
+{
+    assert(row < matrix->num_rows);
+    assert(column < matrix->num_cols);
+
+    return matrix->data[row * matrix->num_cols + column];
+}
+
+void shared_fixed_matrix_setValue(FixedMatrix_t* matrix, unsigned int row,
+                                  unsigned int column, float value)
+{
+    assert(row < matrix->num_rows);
+    assert(column < matrix->num_cols);
+
+    matrix->data[row * matrix->num_cols + column] = value;
+}
+
+void shared_fixed_matrix_setValues(FixedMatrix_t* matrix, const float values[])
+{
+    const unsigned int num_values = (unsigned int)matrix->num_rows * matrix->num_cols;
+    for (unsigned int i = 0; i < num_values; i++)
+    {
+        matrix->data[i] = values[i];
+    }
+}
+
+void shared_fixed_matrix_multiply(const FixedMatrix_t* A, const FixedMatrix_t* B,
+                                  FixedMatrix_t* result)
+{
+    assert(A->num_cols == B->num_rows);
+    assert(result->num_rows == A->num_rows);
+    assert(result->num_cols == B->num_cols);
+    assert(result != A && result != B);
+
+    for (unsigned int i = 0; i < A->num_rows; i++)
+    {
+        const float* A_row = &A->data[i * A->num_cols];
+        float* result_row  = &result->data[i * result->num_cols];
+        for (unsigned int j = 0; j < B->num_cols; j++)
+        {
+            float sum = 0.0f;
+            for (unsigned int k = 0; k < A->num_cols; k++)
+            {
+                sum += A_row[k] * B->data[k * B->num_cols + j];
+            }
+            result_row[j] = sum;
+        }
+    }
+}
+
+void shared_fixed_matrix_multiplyVector(const FixedMatrix_t* matrix, const float vector[],
+                                        float result[])
+{
+    const ConstFixedMatrix_t const_matrix = {
+        .num_rows = matrix->num_rows, .num_cols = matrix->num_cols, .data = matrix->data};
+    shared_const_fixed_matrix_multiplyVector(&const_matrix, vector, result);
+}
+
+void shared_fixed_matrix_multiplyTransposeVector(const FixedMatrix_t* matrix,
+                                                 const float vector[], float result[])
+{
+    const ConstFixedMatrix_t const_matrix = {
+        .num_rows = matrix->num_rows, .num_cols = matrix->num_cols, .data = matrix->data};
+    shared_const_fixed_matrix_multiplyTransposeVector(&const_matrix, vector, result);
+}
+
+void shared_const_fixed_matrix_multiplyVector(const ConstFixedMatrix_t* matrix,
+                                              const float vector[], float result[])
+{
+    for (unsigned int i = 0; i < matrix->num_rows; i++)
+    {
+        const float* row = &matrix->data[i * matrix->num_cols];
+        float sum        = 0.0f;
+        for (unsigned int j = 0; j < matrix->num_cols; j++)
+        {
+            sum += row[j] * vector[j];
+        }
+        result[i] = sum;
+    }
+}
+
+void shared_const_fixed_matrix_multiplyTransposeVector(const ConstFixedMatrix_t* matrix,
+                                                       const float vector[],
+                                                       float result[])
+{
+    for (unsigned int j = 0; j < matrix->num_cols; j++)
+    {
+        float sum = 0.0f;
+        for (unsigned int i = 0; i < matrix->num_rows; i++)
+        {
+            sum += matrix->data[i * matrix->num_cols + j] * vector[i];
+        }
+        result[j] = sum;
+    }
+}
+
+void shared_fixed_matrix_transpose(const FixedMatrix_t* in_matrix, FixedMatrix_t* result)
+{
+    assert(result->num_rows == in_matrix->num_cols);
+    assert(result->num_cols == in_matrix->num_rows);
+    assert(result != in_matrix);
+
+    for (unsigned int i = 0; i < in_matrix->num_rows; i++)
+    {
+        for (unsigned int j = 0; j < in_matrix->num_cols; j++)
+        {
+            result->data[j * result->num_cols + i] =
+                in_matrix->data[i * in_matrix->num_cols + j];
+        }
+    }
+}
+
+void shared_fixed_matrix_add(const FixedMatrix_t* A, const FixedMatrix_t* B,
+                             FixedMatrix_t* result)
+{
+    assert(A->num_rows == B->num_rows && A->num_cols == B->num_cols);
+    assert(result->num_rows == A->num_rows && result->num_cols == A->num_cols);
+
+    const unsigned int num_values = (unsigned int)A->num_rows * A->num_cols;
+    for (unsigned int i = 0; i < num_values; i++)
+    {
+        result->data[i] = A->data[i] + B->data[i];
+    }
+}
+
+void shared_fixed_matrix_scale(const FixedMatrix_t* in_matrix, float scalar,
+                               FixedMatrix_t* result)
+{
+    assert(result->num_rows == in_matrix->num_rows);
+    assert(result->num_cols == in_matrix->num_cols);
+
+    const unsigned int num_values =
+        (unsigned int)in_matrix->num_rows * in_matrix->num_cols;
+    for (unsigned int i = 0; i < num_values; i++)
+    {
+        result->data[i] = scalar * in_matrix->data[i];
+    }
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * A matrix with a fixed number of rows and columns, whose values are stored by the caller
+ * in a contiguous row-major array. None of the functions below allocate memory, so
+ * unlike Matrix_t, fixed matrices can be used on every control tick without fragmenting
+ * the heap.
+ *
+ * The layout of this struct is the same as arm_matrix_instance_f32 from CMSIS-DSP, so a
+ * fixed matrix can be passed to the CMSIS-DSP matrix functions by casting a pointer to
+ * it.
+ *
+ * The recommended way to create a fixed matrix is with CREATE_FIXED_MATRIX, which
+ * creates the storage for the values alongside the matrix. Rows and columns are indexed
+ * from 0.
+ */
+typedef struct FixedMatrix
+{
+    uint16_t num_rows;
+    uint16_t num_cols;
+    // The values of the matrix, where the value in row i and column j is at
+    // data[i * num_cols + j]
+    float* data;
+} FixedMatrix_t;
+
+/**
+ * A read-only view of a matrix with a fixed number of rows and columns, for matrices
+ * whose values are constant, such as lookup tables stored in flash. It has the same
+ * layout as FixedMatrix_t, except that the values it points to can't be modified.
+ */
+typedef struct ConstFixedMatrix
+{
+    uint16_t num_rows;
+    uint16_t num_cols;
+    // The values of the matrix, where the value in row i and column j is at
+    // data[i * num_cols + j]
+    const float* data;
+} ConstFixedMatrix_t;
+
+/**
+ * Creates a fixed matrix called NAME with the given dimensions, along with the storage
+ * for its values in the same scope, with all values set to zero
+ *
+ * @param NAME The name of the matrix variable
+ * @param NUM_ROWS The number of rows in the matrix
+ * @param NUM_COLS The number of columns in the matrix
+ */
+#define CREATE_FIXED_MATRIX(NAME, NUM_ROWS, NUM_COLS)                                    \
+    float ___##NAME##_data_storage[(NUM_ROWS) * (NUM_COLS)] = {0};                       \
+                                                                                         \
+    FixedMatrix_t NAME = {.num_rows = (NUM_ROWS),                                        \
+                          .num_cols = (NUM_COLS),                                        \
+                          .data     = ___##NAME##_data_storage}
+
+/**
+ * Gets the value of the matrix element at the given row and column
+ *
+ * @pre row < the number of rows in the matrix
+ * @pre column < the number of columns in the matrix
+ *
+ * @param matrix [in] The matrix
+ * @param row [in] The row of the matrix element
+ * @param column [in] The column of the matrix element
+ *
+ * @return The value of the matrix element at the given row and column
+ */
+float shared_fixed_matrix_getValue(const FixedMatrix_t* matrix, unsigned int row,
+                                   unsigned int column);
+
+/**
+ * Sets the value of the matrix element at the given row and column
+ *
+ * @pre row < the number of rows in the matrix
+ * @pre column < the number of columns in the matrix
+ *
+ * @param matrix [in/out] The matrix
+ * @param row [in] The row of the matrix element
+ * @param column [in] The column of the matrix element
+ * @param value [in] The value to set
+ */
+void shared_fixed_matrix_setValue(FixedMatrix_t* matrix, unsigned int row,
+                                  unsigned int column, float value);
+
+/**
+ * Sets all the values of a matrix
+ *
+ * @param matrix [in/out] The N*M matrix to copy values into
+ * @param values [in] The N*M values to copy, in row-major order
+ */
+void shared_fixed_matrix_setValues(FixedMatrix_t* matrix, const float values[]);
+
+/**
+ * Multiplies two matrices together
+ *
+ * @pre A has as many columns as B has rows
+ * @pre result has as many rows as A and as many columns as B
+ * @pre result is not the same matrix as A or B
+ *
+ * @param A [in] The left matrix
+ * @param B [in] The right matrix
+ * @param result [out] The matrix to store A * B in
+ */
+void shared_fixed_matrix_multiply(const FixedMatrix_t* A, const FixedMatrix_t* B,
+                                  FixedMatrix_t* result);
+
+/**
+ * Multiplies a matrix by a vector
+ *
+ * @param matrix [in] The N*M matrix to multiply
+ * @param vector [in] The vector to multiply, of length M
+ * @param result [out] The vector to store matrix * vector in, of length N
+ */
+void shared_fixed_matrix_multiplyVector(const FixedMatrix_t* matrix, const float vector[],
+                                        float result[]);
+
+/**
+ * Multiplies the transpose of a matrix by a vector, without transposing the matrix
+ *
+ * @param matrix [in] The N*M matrix to transpose and multiply
+ * @param vector [in] The vector to multiply, of length N
+ * @param result [out] The vector to store transpose(matrix) * vector in, of length M
+ */
+void shared_fixed_matrix_multiplyTransposeVector(const FixedMatrix_t* matrix,
+                                                 const float vector[], float result[]);
+
+/**
+ * Multiplies a constant matrix by a vector
+ *
+ * @param matrix [in] The N*M matrix to multiply
+ * @param vector [in] The vector to multiply, of length M
+ * @param result [out] The vector to store matrix * vector in, of length N
+ */
+void shared_const_fixed_matrix_multiplyVector(const ConstFixedMatrix_t* matrix,
+                                              const float vector[], float result[]);
+
+/**
+ * Multiplies the transpose of a constant matrix by a vector, without transposing the
+ * matrix
+ *
+ * @param matrix [in] The N*M matrix to transpose and multiply
+ * @param vector [in] The vector to multiply, of length N
+ * @param result [out] The vector to store transpose(matrix) * vector in, of length M
+ */
+void shared_const_fixed_matrix_multiplyTransposeVector(const ConstFixedMatrix_t* matrix,
+                                                       const float vector[],
+                                                       float result[]);
+
+/**
+ * Transposes a matrix
+ *
+ * @pre result has as many rows as in_matrix has columns and as many columns as
+ * in_matrix has rows
+ * @pre result is not the same matrix as in_matrix
+ *
+ * @param in_matrix [in] The matrix to transpose
+ * @param result [out] The matrix to store the transpose of in_matrix in
+ */
+void shared_fixed_matrix_transpose(const FixedMatrix_t* in_matrix, FixedMatrix_t* result);
+
+/**
+ * Adds two matrices together. The result can be the same matrix as A or B.
+ *
+ * @pre A, B and result all have the same dimensions
+ *
+ * @param A [in] The left matrix
+ * @param B [in] The right matrix
+ * @param result [out] The matrix to store A + B in
+ */
+void shared_fixed_matrix_add(const FixedMatrix_t* A, const FixedMatrix_t* B,
+                             FixedMatrix_t* result);
+
+/**
+ * Multiplies every value of a matrix by a scalar. The result can be the same matrix as
+ * in_matrix.
+ *
+ * @pre in_matrix and result have the same dimensions
+ *
+ * @param in_matrix [in] The matrix to scale
+ * @param scalar [in] The value to multiply every value of the matrix by
+ * @param result [out] The matrix to store scalar * in_matrix in
+ */
+void shared_fixed_matrix_scale(const FixedMatrix_t* in_matrix, float scalar,
+                               FixedMatrix_t* result);
@@ -0,0 +1,80 @@
+extern "C"
+{
+#include "firmware/shared/math/fixed_matrix.h"
+#include "firmware/shared/math/matrix.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+// The matrix used to convert between robot and wheel coordinates, which is the size of
+// the matrices used by the control loop
+static const unsigned int NUM_ROWS             = 3;
+static const unsigned int NUM_COLS             = 4;
+static const float VALUES[NUM_ROWS * NUM_COLS] = {-0.8192f, -0.7071f, 0.7071f,  0.8192f,
+                                                  0.5736f,  -0.7071f, -0.7071f, 0.5736f,
+                                                  1.0000f,  1.0000f,  1.0000f,  1.0000f};
+static const int NUM_ITERATIONS                = 100000;
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(FixedMatrixPerformanceTest, DISABLED_fixed_matrix_vs_matrix_multiply_and_transpose)
+{
+    // Both APIs compute transpose(A) * A for the same A on every iteration, the way a
+    // control tick would
+    float sum = 0.0f;
+
+    auto start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_ITERATIONS; i++)
+    {
+        float* rows[NUM_ROWS];
+        float row_values[NUM_ROWS][NUM_COLS];
+        for (unsigned int row = 0; row < NUM_ROWS; row++)
+        {
+            for (unsigned int col = 0; col < NUM_COLS; col++)
+            {
+                row_values[row][col] = VALUES[row * NUM_COLS + col];
+            }
+            rows[row] = row_values[row];
+        }
+        Matrix_t* A = shared_matrix_createMatrixFromValues(rows, NUM_ROWS, NUM_COLS);
+        Matrix_t* A_transpose = shared_matrix_transpose(A);
+        Matrix_t* result      = shared_matrix_multiply(A_transpose, A);
+        sum += shared_matrix_getValueAtIndex(1, 1, result);
+        shared_matrix_destroy(A);
+        shared_matrix_destroy(A_transpose);
+        shared_matrix_destroy(result);
+    }
+    auto matrix_duration = std::chrono::steady_clock::now() - start_time;
+
+    start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_ITERATIONS; i++)
+    {
+        CREATE_FIXED_MATRIX(A, NUM_ROWS, NUM_COLS);
+        CREATE_FIXED_MATRIX(A_transpose, NUM_COLS, NUM_ROWS);
+        CREATE_FIXED_MATRIX(result, NUM_COLS, NUM_COLS);
+        shared_fixed_matrix_setValues(&A, VALUES);
+        shared_fixed_matrix_transpose(&A, &A_transpose);
+        shared_fixed_matrix_multiply(&A_transpose, &A, &result);
+        sum -= shared_fixed_matrix_getValue(&result, 0, 0);
+    }
+    auto fixed_matrix_duration = std::chrono::steady_clock::now() - start_time;
+
+    // Both APIs should give the same result
+    EXPECT_NEAR(sum, 0.0f, 0.01f);
+
+    std::cout << "Matrix_t average time: "
+              << static_cast<double>(
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(matrix_duration)
+                         .count()) /
+                     NUM_ITERATIONS
+              << " ns" << std::endl
+              << "FixedMatrix_t average time: "
+              << static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         fixed_matrix_duration)
+                                         .count()) /
+                     NUM_ITERATIONS
+              << " ns" << std::endl;
+}
@@ -0,0 +1,175 @@
+extern "C"
+{
+#include "firmware/shared/math/fixed_matrix.h"
+}
+
+#include <gtest/gtest.h>
+
+TEST(FixedMatrixTest, create_fixed_matrix_is_zeroed_with_given_dimensions)
+{
+    CREATE_FIXED_MATRIX(matrix, 3, 4);
+
+    EXPECT_EQ(matrix.num_rows, 3);
+    EXPECT_EQ(matrix.num_cols, 4);
+    for (unsigned int row = 0; row < 3; row++)
+    {
+        for (unsigned int col = 0; col < 4; col++)
+        {
+            EXPECT_EQ(shared_fixed_matrix_getValue(&matrix, row, col), 0.0f);
+        }
+    }
+}
+
+TEST(FixedMatrixTest, get_and_set_values)
+{
+    CREATE_FIXED_MATRIX(matrix, 3, 4);
+
+    shared_fixed_matrix_setValue(&matrix, 2, 1, -2.22f);
+    shared_fixed_matrix_setValue(&matrix, 1, 3, 7.0f);
+
+    EXPECT_EQ(shared_fixed_matrix_getValue(&matrix, 2, 1), -2.22f);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&matrix, 1, 3), 7.0f);
+    // The values are stored contiguously in row-major order
+    EXPECT_EQ(matrix.data[2 * 4 + 1], -2.22f);
+    EXPECT_EQ(matrix.data[1 * 4 + 3], 7.0f);
+}
+
+TEST(FixedMatrixTest, set_values_in_row_major_order)
+{
+    CREATE_FIXED_MATRIX(matrix, 2, 3);
+    const float values[] = {1, 2, 3, 4, 5, 6};
+
+    shared_fixed_matrix_setValues(&matrix, values);
+
+    EXPECT_EQ(shared_fixed_matrix_getValue(&matrix, 0, 0), 1);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&matrix, 0, 2), 3);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&matrix, 1, 0), 4);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&matrix, 1, 2), 6);
+}
+
+TEST(FixedMatrixTest, multiply)
+{
+    CREATE_FIXED_MATRIX(A, 3, 4);
+    CREATE_FIXED_MATRIX(B, 4, 2);
+    CREATE_FIXED_MATRIX(result, 3, 2);
+    const float A_values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    const float B_values[] = {13, 14, 15, 16, 17, 18, 19, 20};
+    shared_fixed_matrix_setValues(&A, A_values);
+    shared_fixed_matrix_setValues(&B, B_values);
+
+    shared_fixed_matrix_multiply(&A, &B, &result);
+
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 0, 0), 170);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 0, 1), 180);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 1, 0), 426);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 1, 1), 452);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 2, 0), 682);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 2, 1), 724);
+}
+
+TEST(FixedMatrixTest, multiply_vector)
+{
+    CREATE_FIXED_MATRIX(matrix, 2, 3);
+    const float values[] = {1, 2, 3, 4, 5, 6};
+    shared_fixed_matrix_setValues(&matrix, values);
+    const float vector[3] = {1, -1, 2};
+    float result[2];
+
+    shared_fixed_matrix_multiplyVector(&matrix, vector, result);
+
+    EXPECT_EQ(result[0], 5);
+    EXPECT_EQ(result[1], 11);
+}
+
+TEST(FixedMatrixTest, multiply_transpose_vector)
+{
+    CREATE_FIXED_MATRIX(matrix, 2, 3);
+    const float values[] = {1, 2, 3, 4, 5, 6};
+    shared_fixed_matrix_setValues(&matrix, values);
+    const float vector[2] = {1, -1};
+    float result[3];
+
+    shared_fixed_matrix_multiplyTransposeVector(&matrix, vector, result);
+
+    EXPECT_EQ(result[0], -3);
+    EXPECT_EQ(result[1], -3);
+    EXPECT_EQ(result[2], -3);
+}
+
+TEST(FixedMatrixTest, multiply_const_vector)
+{
+    static const float values[]            = {1, 2, 3, 4, 5, 6};
+    static const ConstFixedMatrix_t matrix = {2, 3, values};
+    const float vector[3]                  = {1, -1, 2};
+    float result[2];
+
+    shared_const_fixed_matrix_multiplyVector(&matrix, vector, result);
+
+    EXPECT_EQ(result[0], 5);
+    EXPECT_EQ(result[1], 11);
+}
+
+TEST(FixedMatrixTest, multiply_transpose_const_vector)
+{
+    static const float values[]            = {1, 2, 3, 4, 5, 6};
+    static const ConstFixedMatrix_t matrix = {2, 3, values};
+    const float vector[2]                  = {1, -1};
+    float result[3];
+
+    shared_const_fixed_matrix_multiplyTransposeVector(&matrix, vector, result);
+
+    EXPECT_EQ(result[0], -3);
+    EXPECT_EQ(result[1], -3);
+    EXPECT_EQ(result[2], -3);
+}
+
+TEST(FixedMatrixTest, transpose)
+{
+    CREATE_FIXED_MATRIX(matrix, 2, 3);
+    CREATE_FIXED_MATRIX(result, 3, 2);
+    const float values[] = {1, 2, 3, 4, 5, 6};
+    shared_fixed_matrix_setValues(&matrix, values);
+
+    shared_fixed_matrix_transpose(&matrix, &result);
+
+    for (unsigned int row = 0; row < 2; row++)
+    {
+        for (unsigned int col = 0; col < 3; col++)
+        {
+            EXPECT_EQ(shared_fixed_matrix_getValue(&result, col, row),
+                      shared_fixed_matrix_getValue(&matrix, row, col));
+        }
+    }
+}
+
+TEST(FixedMatrixTest, add_in_place)
+{
+    CREATE_FIXED_MATRIX(A, 2, 2);
+    CREATE_FIXED_MATRIX(B, 2, 2);
+    const float A_values[] = {1, 2, 3, 4};
+    const float B_values[] = {10, 20, 30, 40};
+    shared_fixed_matrix_setValues(&A, A_values);
+    shared_fixed_matrix_setValues(&B, B_values);
+
+    shared_fixed_matrix_add(&A, &B, &A);
+
+    EXPECT_EQ(shared_fixed_matrix_getValue(&A, 0, 0), 11);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&A, 0, 1), 22);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&A, 1, 0), 33);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&A, 1, 1), 44);
+}
+
+TEST(FixedMatrixTest, scale)
+{
+    CREATE_FIXED_MATRIX(matrix, 2, 2);
+    CREATE_FIXED_MATRIX(result, 2, 2);
+    const float values[] = {1, -2, 3, 0};
+    shared_fixed_matrix_setValues(&matrix, values);
+
+    shared_fixed_matrix_scale(&matrix, -0.5f, &result);
+
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 0, 0), -0.5f);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 0, 1), 1.0f);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 1, 0), -1.5f);
+    EXPECT_EQ(shared_fixed_matrix_getValue(&result, 1, 1), 0.0f);
+}
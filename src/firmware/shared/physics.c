@@ -3,7 +3,7 @@
 #include <math.h>
 #include <stdint.h>
 
-#include "firmware/shared/physics_linear_algebra.h"
+#include "firmware/shared/math/fixed_matrix.h"
 
 // Wheel angles for these matricies are (55, 135, 225, 305) degrees
 // these matrices may be derived as per omnidrive_kiart paper
@@ -15,16 +15,26 @@
 // torque as the matrix is unitless (multiply by ROBOT_RADIUS to unnormalize)
 // the transpose of this matrix is the velocity coupling matrix and can
 // convert speeds in the robot coordinates into linear wheel speeds
-static const float force4_to_force3_mat[3][4] = {{-0.8192f, -0.7071f, 0.7071f, 0.8192f},
-                                                 {0.5736f, -0.7071f, -0.7071f, 0.5736f},
-                                                 {1.0000f, 1.0000f, 1.0000f, 1.0000f}};
+// clang-format off
+static const float force4_to_force3_values[3 * 4] = {-0.8192f, -0.7071f,  0.7071f,  0.8192f,
+                                                      0.5736f, -0.7071f, -0.7071f,  0.5736f,
+                                                      1.0000f,  1.0000f,  1.0000f,  1.0000f};
+// clang-format on
+
+static const ConstFixedMatrix_t force4_to_force3_mat = {
+    .num_rows = 3, .num_cols = 4, .data = force4_to_force3_values};
 
 // Transformation matricies to convert a 4 velocity to
 // a 3 velocity (derived as pinv(force4_to_force3^t)
 // this is also the transpose of force3_to_force4 mat
-static const float speed4_to_speed3_mat[3][4] = {{-0.3498f, -0.3019f, 0.3019f, 0.3498f},
-                                                 {0.3904f, -0.3904f, -0.3904f, 0.3904f},
-                                                 {0.2761f, 0.2239f, 0.2239f, 0.2761f}};
+// clang-format off
+static const float speed4_to_speed3_values[3 * 4] = {-0.3498f, -0.3019f,  0.3019f,  0.3498f,
+                                                      0.3904f, -0.3904f, -0.3904f,  0.3904f,
+                                                      0.2761f,  0.2239f,  0.2239f,  0.2761f};
+// clang-format on
+
+static const ConstFixedMatrix_t speed4_to_speed3_mat = {
+    .num_rows = 3, .num_cols = 4, .data = speed4_to_speed3_values};
 
 // mass vector (consists linear robot mass and interial mass)
 const float ROBOT_MASS[3] = {ROBOT_POINT_MASS, ROBOT_POINT_MASS, ROT_MASS};
@@ -42,7 +52,7 @@ const float MAX_ACC[3] = {MAX_X_A, MAX_Y_A, MAX_T_A* ROBOT_RADIUS};
  */
 void speed4_to_speed3(const float speed4[4], float speed3[3])
 {
-    matrix_mult(speed3, 3, speed4, 4, speed4_to_speed3_mat);
+    shared_const_fixed_matrix_multiplyVector(&speed4_to_speed3_mat, speed4, speed3);
 }
 
 /**
@@ -55,7 +65,8 @@ void speed4_to_speed3(const float speed4[4], float speed3[3])
  */
 void speed3_to_speed4(const float speed3[3], float speed4[4])
 {
-    matrix_mult_t(speed4, 4, speed3, 3, force4_to_force3_mat);
+    shared_const_fixed_matrix_multiplyTransposeVector(&force4_to_force3_mat, speed3,
+                                                      speed4);
 }
 
 /**
@@ -74,7 +85,8 @@ void speed3_to_speed4(const float speed3[3], float speed4[4])
  */
 void force3_to_force4(float force3[3], float force4[4])
 {
-    matrix_mult_t(force4, 4, force3, 3, speed4_to_speed3_mat);
+    shared_const_fixed_matrix_multiplyTransposeVector(&speed4_to_speed3_mat, force3,
+                                                      force4);
 }
 
 // return the minimum angle from angle1 to angle2
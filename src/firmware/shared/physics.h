@@ -38,7 +38,7 @@
 #define GEAR_RATIO 0.5143f         // define as speed multiplication from motor to wheel
 #define WHEEL_RADIUS 0.0254f
 
-// constants for radial bangbang controller
+// constants for radial bang-bang controller
 #define MAX_R_V 2.0f
 #define MAX_R_A 3.0f
 
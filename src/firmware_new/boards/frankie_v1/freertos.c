@@ -27,6 +27,8 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "firmware/app/communication/delta_frame.h"
+#include "firmware/app/communication/primitive_set_decoder.h"
 #include "firmware/app/logger/logger.h"
 #include "firmware_new/boards/frankie_v1/io/drivetrain.h"
 #include "firmware_new/boards/frankie_v1/io/network_logger.h"
@@ -67,7 +69,21 @@ ProtoMulticastCommunicationProfile_t *primitive_msg_listener_profile;
 static TbotsProto_Vision vision_msg;
 static TbotsProto_RobotStatus robot_status_msg;
 static TbotsProto_RobotLog robot_log_msg;
-static TbotsProto_Primitive primitive_msg;
+static TbotsProto_PrimitiveSet primitive_set_msg;
+
+// Vision and primitive sets may be sent as delta frames, which only contain the
+// entries that changed since the last frame. A delta frame can't be decoded straight
+// into vision_msg and primitive_set_msg, since decoding clears the entries it leaves
+// out, and a frame that turns out to be stale would overwrite newer entries. So frames
+// are received into these, without holding the profile lock, and then merged into
+// vision_msg and primitive_set_msg under the lock.
+static TbotsProto_Vision received_vision_msg;
+static TbotsProto_PrimitiveSet received_primitive_set_msg;
+
+// The robot id is set when building the firmware, with `--define frankie_v1_robot_id=N`,
+// until it can be read from the dials on the robot:
+// https://github.com/UBC-Thunderbots/Software/issues/1517
+static const uint32_t robot_id = FRANKIE_V1_ROBOT_ID;
 
 /* USER CODE END Variables */
 /* Definitions for NetStartTask */
@@ -123,6 +139,9 @@ const osMessageQueueAttr_t RobotLogProtoQ_attributes = {.name = "RobotLogProtoQ"
 
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN FunctionPrototypes */
+static bool mergeVision(void *vision, const void *received_vision);
+static bool mergePrimitiveSet(void *primitive_set, const void *received_primitive_set);
+static bool decodePrimitiveSet(pb_istream_t *stream, void *primitive_set);
 
 /* USER CODE END FunctionPrototypes */
 
@@ -252,7 +271,19 @@ void test_msg_update(void *argument)
     /* Infinite loop */
     for (;;)
     {
+        // The decode stats are copied out first, so that the locks of both profiles are
+        // never held at once
+        io_proto_multicast_communication_profile_acquireLock(
+            primitive_msg_listener_profile);
+        ProtoMulticastDecodeStats_t primitive_decode_stats =
+            io_proto_multicast_communication_profile_getDecodeStats(
+                primitive_msg_listener_profile);
+        io_proto_multicast_communication_profile_releaseLock(
+            primitive_msg_listener_profile);
+
         io_proto_multicast_communication_profile_acquireLock(comm_profile);
+        robot_status_msg.robot_id = robot_id;
+
         // TODO enable SNTP sys_now is currently only time since reset
         // https://github.com/UBC-Thunderbots/Software/issues/1518
         robot_status_msg.time_sent.epoch_timestamp_seconds = sys_now();
@@ -262,6 +293,12 @@ void test_msg_update(void *argument)
         // actual values for RobotStatus
         robot_status_msg.power_status.battery_voltage   = (float)(sys_now() % 100);
         robot_status_msg.power_status.capacitor_voltage = (float)(sys_now() % 100);
+
+        robot_status_msg.has_network_status = true;
+        robot_status_msg.network_status.last_primitive_decode_time_us =
+            primitive_decode_stats.last_decode_time_us;
+        robot_status_msg.network_status.max_primitive_decode_time_us =
+            primitive_decode_stats.max_decode_time_us;
         io_proto_multicast_communication_profile_releaseLock(comm_profile);
         io_proto_multicast_communication_profile_notifyEvents(comm_profile,
                                                               PROTO_UPDATED);
@@ -273,10 +310,32 @@ void test_msg_update(void *argument)
 
 /* Private application code --------------------------------------------------*/
 /* USER CODE BEGIN Application */
+static bool mergeVision(void *vision, const void *received_vision)
+{
+    return app_delta_frame_mergeVision((TbotsProto_Vision *)vision,
+                                       (const TbotsProto_Vision *)received_vision) !=
+           DELTA_FRAME_IGNORED;
+}
+
+static bool mergePrimitiveSet(void *primitive_set, const void *received_primitive_set)
+{
+    return app_delta_frame_mergePrimitiveSet(
+               (TbotsProto_PrimitiveSet *)primitive_set,
+               (const TbotsProto_PrimitiveSet *)received_primitive_set) !=
+           DELTA_FRAME_IGNORED;
+}
+
+static bool decodePrimitiveSet(pb_istream_t *stream, void *primitive_set)
+{
+    // Only this robot's primitive is decoded, the rest are skipped
+    return app_primitive_set_decoder_decodeForRobot(
+        stream, robot_id, (TbotsProto_PrimitiveSet *)primitive_set);
+}
+
 void initIoNetworking()
 {
-    // TODO channel and robot_id need to be hooked up to the dials on the robot, when
-    // available https://github.com/UBC-Thunderbots/Software/issues/1517
+    // TODO channel needs to be hooked up to the dials on the robot, when available
+    // https://github.com/UBC-Thunderbots/Software/issues/1517
     unsigned short int channel = 0;
 
     // initialize multicast communication
@@ -284,11 +343,17 @@ void initIoNetworking()
 
     primitive_msg_listener_profile = io_proto_multicast_communication_profile_create(
         "primitive_msg_listener_profile", MULTICAST_CHANNELS[channel], PRIMITIVE_PORT,
-        &primitive_msg, TbotsProto_Primitive_fields, MAXIMUM_TRANSFER_UNIT_BYTES);
+        &primitive_set_msg, TbotsProto_PrimitiveSet_fields, MAXIMUM_TRANSFER_UNIT_BYTES);
+    io_proto_multicast_communication_profile_setMergeFunction(
+        primitive_msg_listener_profile, &received_primitive_set_msg, mergePrimitiveSet);
+    io_proto_multicast_communication_profile_setDecodeFunction(
+        primitive_msg_listener_profile, decodePrimitiveSet);
 
     vision_msg_listener_profile = io_proto_multicast_communication_profile_create(
         "vision_msg_listener_profile", MULTICAST_CHANNELS[channel], VISION_PORT,
         &vision_msg, TbotsProto_Vision_fields, MAXIMUM_TRANSFER_UNIT_BYTES);
+    io_proto_multicast_communication_profile_setMergeFunction(
+        vision_msg_listener_profile, &received_vision_msg, mergeVision);
 
     robot_status_msg_sender_profile = io_proto_multicast_communication_profile_create(
         "robot_status_msg_sender", MULTICAST_CHANNELS[channel], ROBOT_STATUS_PORT,
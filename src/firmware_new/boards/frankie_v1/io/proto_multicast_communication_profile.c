@@ -27,6 +27,18 @@ typedef struct ProtoMulticastCommunicationProfile
     const pb_field_t* message_fields;
     uint16_t message_max_size;
 
+    // merge info: if the merge function is set, received protobuf is deserialized
+    // into the received protobuf struct and then merged into the protobuf struct,
+    // instead of being deserialized into the protobuf struct directly
+    void* received_protobuf_struct;
+    ProtoMulticastMergeFunction_t merge_function;
+
+    // decode info: if the decode function is set, received protobuf is decoded with it
+    // instead of with the message fields. The time taken to decode every packet is
+    // recorded in the decode stats.
+    ProtoMulticastDecodeFunction_t decode_function;
+    ProtoMulticastDecodeStats_t decode_stats;
+
     // communication_event: these events will be used to control when the networking
     // tasks run. The networking tasks will also signal certain events.
     osEventFlagsId_t communication_event;
@@ -46,13 +58,17 @@ ProtoMulticastCommunicationProfile_t* io_proto_multicast_communication_profile_c
 
     const osMutexAttr_t mutex_attr = {profile_name, osMutexPrioInherit, NULL, 0U};
 
-    profile->profile_name        = profile_name;
-    profile->port                = port;
-    profile->message_fields      = message_fields;
-    profile->message_max_size    = message_max_size;
-    profile->protobuf_struct     = protobuf_struct;
-    profile->profile_mutex       = osMutexNew(&mutex_attr);
-    profile->communication_event = osEventFlagsNew(NULL);
+    profile->profile_name             = profile_name;
+    profile->port                     = port;
+    profile->message_fields           = message_fields;
+    profile->message_max_size         = message_max_size;
+    profile->protobuf_struct          = protobuf_struct;
+    profile->received_protobuf_struct = NULL;
+    profile->merge_function           = NULL;
+    profile->decode_function          = NULL;
+    profile->decode_stats             = (ProtoMulticastDecodeStats_t){0};
+    profile->profile_mutex            = osMutexNew(&mutex_attr);
+    profile->communication_event      = osEventFlagsNew(NULL);
     ip6addr_aton(multicast_address, &profile->multicast_address);
 
     return profile;
@@ -89,6 +105,58 @@ void* io_proto_multicast_communication_profile_getProtoStruct(
     return profile->protobuf_struct;
 }
 
+void io_proto_multicast_communication_profile_setMergeFunction(
+    ProtoMulticastCommunicationProfile_t* profile, void* received_protobuf_struct,
+    ProtoMulticastMergeFunction_t merge_function)
+{
+    profile->received_protobuf_struct = received_protobuf_struct;
+    profile->merge_function           = merge_function;
+}
+
+void* io_proto_multicast_communication_profile_getReceivedProtoStruct(
+    ProtoMulticastCommunicationProfile_t* profile)
+{
+    return profile->received_protobuf_struct;
+}
+
+ProtoMulticastMergeFunction_t io_proto_multicast_communication_profile_getMergeFunction(
+    ProtoMulticastCommunicationProfile_t* profile)
+{
+    return profile->merge_function;
+}
+
+void io_proto_multicast_communication_profile_setDecodeFunction(
+    ProtoMulticastCommunicationProfile_t* profile,
+    ProtoMulticastDecodeFunction_t decode_function)
+{
+    profile->decode_function = decode_function;
+}
+
+ProtoMulticastDecodeFunction_t io_proto_multicast_communication_profile_getDecodeFunction(
+    ProtoMulticastCommunicationProfile_t* profile)
+{
+    return profile->decode_function;
+}
+
+void io_proto_multicast_communication_profile_recordDecodeTime(
+    ProtoMulticastCommunicationProfile_t* profile, uint32_t decode_time_us)
+{
+    ProtoMulticastDecodeStats_t* stats = &profile->decode_stats;
+    stats->num_packets_decoded++;
+    stats->last_decode_time_us = decode_time_us;
+    stats->total_decode_time_us += decode_time_us;
+    if (decode_time_us > stats->max_decode_time_us)
+    {
+        stats->max_decode_time_us = decode_time_us;
+    }
+}
+
+ProtoMulticastDecodeStats_t io_proto_multicast_communication_profile_getDecodeStats(
+    ProtoMulticastCommunicationProfile_t* profile)
+{
+    return profile->decode_stats;
+}
+
 const pb_field_t* io_proto_multicast_communication_profile_getProtoFields(
     ProtoMulticastCommunicationProfile_t* profile)
 {
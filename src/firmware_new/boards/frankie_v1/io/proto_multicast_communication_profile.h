@@ -16,6 +16,40 @@
 
 typedef struct ProtoMulticastCommunicationProfile ProtoMulticastCommunicationProfile_t;
 
+/**
+ * Merges a received protobuf struct into the protobuf struct managed by a profile
+ *
+ * @param protobuf_struct [in/out] The protobuf struct managed by the profile
+ * @param received_protobuf_struct [in] The protobuf struct that was received
+ *
+ * @return true if the received protobuf struct was merged, false if it was ignored
+ */
+typedef bool (*ProtoMulticastMergeFunction_t)(void* protobuf_struct,
+                                              const void* received_protobuf_struct);
+
+/**
+ * Decodes received protobuf into a protobuf struct, in place of decoding it with the
+ * message fields of the profile
+ *
+ * @param stream [in/out] The stream of the received protobuf
+ * @param protobuf_struct [out] The protobuf struct to decode into
+ *
+ * @return true if the protobuf was decoded, false if it is malformed
+ */
+typedef bool (*ProtoMulticastDecodeFunction_t)(pb_istream_t* stream,
+                                               void* protobuf_struct);
+
+/**
+ * How long the listener task has taken to decode the protobuf it has received
+ */
+typedef struct ProtoMulticastDecodeStats
+{
+    uint32_t num_packets_decoded;
+    uint32_t last_decode_time_us;
+    uint32_t max_decode_time_us;
+    uint64_t total_decode_time_us;
+} ProtoMulticastDecodeStats_t;
+
 /**
  * Event Flags: masks used to signal tasks to unblock and run specific actions
  */
@@ -96,6 +130,93 @@ uint16_t io_proto_multicast_communication_profile_getPort(
 void* io_proto_multicast_communication_profile_getProtoStruct(
     ProtoMulticastCommunicationProfile_t* profile);
 
+/**
+ * Makes the listener task merge received protobuf into the protobuf struct managed by
+ * the profile, instead of replacing it. Received protobuf is deserialized into the
+ * given received_protobuf_struct without holding the profile lock, and then merged
+ * into the protobuf struct while holding the lock.
+ *
+ * This is used for protobuf that is sent as delta frames, where each frame only has
+ * what has changed.
+ *
+ * @param profile The profile to set the merge function for
+ * @param received_protobuf_struct [in/out] A protobuf struct of the same type as the
+ *        protobuf struct managed by the profile, that only the listener task uses
+ * @param merge_function The function to merge the received protobuf with
+ */
+void io_proto_multicast_communication_profile_setMergeFunction(
+    ProtoMulticastCommunicationProfile_t* profile, void* received_protobuf_struct,
+    ProtoMulticastMergeFunction_t merge_function);
+
+/**
+ * Get the protobuf struct that received protobuf is deserialized into before it is
+ * merged
+ *
+ * @param profile The profile to get the received protobuf struct from
+ *
+ * @return the void ptr to the received protobuf struct, or NULL if the profile
+ * doesn't have a merge function
+ */
+void* io_proto_multicast_communication_profile_getReceivedProtoStruct(
+    ProtoMulticastCommunicationProfile_t* profile);
+
+/**
+ * Get the function used to merge received protobuf
+ *
+ * @param profile The profile to get the merge function from
+ *
+ * @return the merge function, or NULL if received protobuf replaces the protobuf
+ * struct
+ */
+ProtoMulticastMergeFunction_t io_proto_multicast_communication_profile_getMergeFunction(
+    ProtoMulticastCommunicationProfile_t* profile);
+
+/**
+ * Makes the listener task decode received protobuf with the given function, instead of
+ * with the message fields of the profile. This is used to decode only the parts of the
+ * protobuf that this robot needs.
+ *
+ * @param profile The profile to set the decode function for
+ * @param decode_function The function to decode received protobuf with
+ */
+void io_proto_multicast_communication_profile_setDecodeFunction(
+    ProtoMulticastCommunicationProfile_t* profile,
+    ProtoMulticastDecodeFunction_t decode_function);
+
+/**
+ * Get the function used to decode received protobuf
+ *
+ * @param profile The profile to get the decode function from
+ *
+ * @return the decode function, or NULL if received protobuf is decoded with the message
+ * fields of the profile
+ */
+ProtoMulticastDecodeFunction_t io_proto_multicast_communication_profile_getDecodeFunction(
+    ProtoMulticastCommunicationProfile_t* profile);
+
+/**
+ * Records how long it took to decode a packet of protobuf received on this profile
+ *
+ * @pre the profile lock must be acquired
+ *
+ * @param profile The profile the packet was received on
+ * @param decode_time_us How long it took to decode the packet, in microseconds
+ */
+void io_proto_multicast_communication_profile_recordDecodeTime(
+    ProtoMulticastCommunicationProfile_t* profile, uint32_t decode_time_us);
+
+/**
+ * Get how long it has taken to decode the protobuf received on this profile
+ *
+ * @pre the profile lock must be acquired
+ *
+ * @param profile The profile to get the decode stats from
+ *
+ * @return the decode stats of the profile
+ */
+ProtoMulticastDecodeStats_t io_proto_multicast_communication_profile_getDecodeStats(
+    ProtoMulticastCommunicationProfile_t* profile);
+
 /**
  * Get the protobuf feilds, required for pb_encode and pb_decode to
  * understand the contents of the protobuf_struct
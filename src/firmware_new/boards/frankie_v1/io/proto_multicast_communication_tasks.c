@@ -33,6 +33,51 @@ void io_proto_multicast_communication_init(int net_timeout_ms)
 {
     networking_event   = osEventFlagsNew(NULL);
     network_timeout_ms = net_timeout_ms;
+
+    // Enable the cycle counter, which is used to time how long decoding takes. The
+    // Cortex-M7 debug registers are locked until the key is written to the lock access
+    // register.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR    = 0xC5ACCE55;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * Decodes received protobuf with the decode function of the given profile, or with its
+ * message fields if it doesn't have one
+ *
+ * @param profile The profile the protobuf was received on
+ * @param in_stream [in/out] The stream of the received protobuf
+ * @param proto_struct [out] The protobuf struct to decode into
+ * @param decode_time_us [out] Set to how long decoding took, in microseconds
+ *
+ * @return true if the protobuf was decoded, false if it is malformed
+ */
+static bool io_proto_multicast_decode(ProtoMulticastCommunicationProfile_t* profile,
+                                      pb_istream_t* in_stream, void* proto_struct,
+                                      uint32_t* decode_time_us)
+{
+    const uint32_t start_cycles = DWT->CYCCNT;
+
+    ProtoMulticastDecodeFunction_t decode_function =
+        io_proto_multicast_communication_profile_getDecodeFunction(profile);
+    bool decoded;
+    if (decode_function == NULL)
+    {
+        // nanopb err logic is inverted, false = error
+        decoded = pb_decode(
+            in_stream, io_proto_multicast_communication_profile_getProtoFields(profile),
+            proto_struct);
+    }
+    else
+    {
+        decoded = decode_function(in_stream, proto_struct);
+    }
+
+    // The difference is correct even if the cycle counter wraps around
+    *decode_time_us = (DWT->CYCCNT - start_cycles) / (SystemCoreClock / 1000000U);
+    return decoded;
 }
 
 void io_proto_multicast_sender_task(void* communication_profile)
@@ -136,15 +181,50 @@ void io_proto_multicast_listener_task(void* communication_profile)
                 pb_istream_t in_stream = pb_istream_from_buffer(
                     (uint8_t*)rx_buf->p->payload, rx_buf->p->tot_len);
 
-                io_proto_multicast_communication_profile_acquireLock(profile);
+                ProtoMulticastMergeFunction_t merge_function =
+                    io_proto_multicast_communication_profile_getMergeFunction(profile);
+                uint32_t decode_time_us;
+
+                if (merge_function == NULL)
+                {
+                    io_proto_multicast_communication_profile_acquireLock(profile);
 
-                // deserialize into buffer, nanopb err logic is inverted, false = error
-                no_protobuf_err = pb_decode(
-                    &in_stream,
-                    io_proto_multicast_communication_profile_getProtoFields(profile),
-                    io_proto_multicast_communication_profile_getProtoStruct(profile));
+                    // deserialize into buffer
+                    no_protobuf_err = io_proto_multicast_decode(
+                        profile, &in_stream,
+                        io_proto_multicast_communication_profile_getProtoStruct(profile),
+                        &decode_time_us);
+                    io_proto_multicast_communication_profile_recordDecodeTime(
+                        profile, decode_time_us);
 
-                io_proto_multicast_communication_profile_releaseLock(profile);
+                    io_proto_multicast_communication_profile_releaseLock(profile);
+                }
+                else
+                {
+                    // only this task uses the received proto struct, so we don't need
+                    // to hold the lock while deserializing into it
+                    void* received_proto_struct =
+                        io_proto_multicast_communication_profile_getReceivedProtoStruct(
+                            profile);
+                    no_protobuf_err = io_proto_multicast_decode(
+                        profile, &in_stream, received_proto_struct, &decode_time_us);
+
+                    io_proto_multicast_communication_profile_acquireLock(profile);
+
+                    io_proto_multicast_communication_profile_recordDecodeTime(
+                        profile, decode_time_us);
+                    if (no_protobuf_err)
+                    {
+                        // frames that are older than the last one merged are ignored,
+                        // so we don't signal that a new protobuf has been received
+                        no_protobuf_err = merge_function(
+                            io_proto_multicast_communication_profile_getProtoStruct(
+                                profile),
+                            received_proto_struct);
+                    }
+
+                    io_proto_multicast_communication_profile_releaseLock(profile);
+                }
 
                 if (no_protobuf_err)
                 {
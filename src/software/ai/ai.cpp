@@ -3,6 +3,7 @@
 #include <chrono>
 
 #include "software/ai/hl/stp/play/halt_play.h"
+#include "software/ai/hl/stp/play_rollout/play_rollout_evaluator.h"
 #include "software/ai/hl/stp/stp.h"
 #include "software/ai/navigator/path_manager/velocity_obstacle_path_manager.h"
 #include "software/ai/navigator/path_planner/theta_star_path_planner.h"
@@ -17,11 +18,33 @@ AI::AI(std::shared_ptr<const AiConfig> ai_config,
           RobotNavigationObstacleFactory(
               ai_config->getRobotNavigationObstacleFactoryConfig()),
           ai_config->getNavigatorConfig())),
-      // We use the current time in nanoseconds to initialize STP with a "random" seed
-      high_level(std::make_unique<STP>(
-          []() { return std::make_unique<HaltPlay>(); }, control_config,
-          std::chrono::system_clock::now().time_since_epoch().count()))
+      high_level()
 {
+    // We use the current time in nanoseconds to initialize STP with a "random" seed
+    auto stp = std::make_unique<STP>(
+        []() { return std::make_unique<HaltPlay>(); }, control_config,
+        std::chrono::system_clock::now().time_since_epoch().count());
+    stp->setRobotTacticAssignmentConfig(ai_config->getRobotTacticAssignmentConfig());
+
+    auto play_rollout_config = ai_config->getPlayRolloutConfig();
+    auto play_rollout_evaluator =
+        std::make_shared<PlayRolloutEvaluator>(play_rollout_config, control_config);
+    stp->setPlayScoringFunction([play_rollout_config, play_rollout_evaluator](
+                                    const World &world,
+                                    const std::vector<std::string> &play_names) {
+        std::vector<std::optional<double>> play_scores(play_names.size(), std::nullopt);
+        if (play_rollout_config->getEnableRolloutPlaySelection()->value())
+        {
+            auto results = play_rollout_evaluator->evaluatePlays(world, play_names);
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                play_scores[i] = results[i].score;
+            }
+        }
+        return play_scores;
+    });
+
+    high_level = std::move(stp);
 }
 
 std::unique_ptr<TbotsProto::PrimitiveSet> AI::getPrimitives(const World &world) const
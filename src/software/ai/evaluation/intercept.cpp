@@ -1,92 +1,216 @@
 #include "software/ai/evaluation/intercept.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
 #include "shared/constants.h"
-#include "software/ai/evaluation/pass.h"
 #include "software/geom/algorithms/contains.h"
-#include "software/optimization/gradient_descent_optimizer.h"
 
-std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
-                                                                   const Field &field,
-                                                                   const Robot &robot)
+extern "C"
 {
-    static const double gradient_approx_step_size = 0.000001;
-
-    // We use this to take a smooth absolute value in our objective function
-    static const double smooth_abs_eps = 1000 * gradient_approx_step_size;
-
-    // This is the objective function that we want to minimize, finding the
-    // shortest duration in the future at which we can feasibly intercept the
-    // ball
-    auto objective_function = [&](std::array<double, 1> x) {
-        // We take the absolute value here because a negative time makes no sense
-        double duration = std::abs(x.at(0));
-
-        // If the ball timestamp is less then the robot timestamp, add the difference
-        // here so that we're optimizing to a duration that is after the robot
-        // timestamp
-        if (ball.timestamp() < robot.timestamp())
-        {
-            duration += (robot.timestamp() - ball.timestamp()).toSeconds();
-        }
+#include "firmware/shared/bang_bang_trajectory.h"
+}
 
-        // Estimate the ball position
-        Point new_ball_pos =
-            ball.estimateFutureState(Duration::fromSeconds(duration)).position();
+/**
+ * Gets the time it takes the given robot to move from its current position and velocity
+ * to a stop at the destination, along the same time-optimal trajectory the robots follow
+ *
+ * @param robot The robot to move
+ * @param dest The destination to move the robot to
+ *
+ * @return The time it takes the robot to reach the destination
+ */
+static Duration getTrajectoryTimeToPosition(const Robot &robot, const Point &dest)
+{
+    // The trajectory is generated relative to the robot's position, so the precision of
+    // the floats is spent on the displacement and not on where the robot is on the field
+    const Vector displacement         = dest - robot.position();
+    const Vector2d_t initial_position = {0.0f, 0.0f};
+    const Vector2d_t final_position   = {static_cast<float>(displacement.x()),
+                                       static_cast<float>(displacement.y())};
+    const Vector2d_t initial_velocity = {static_cast<float>(robot.velocity().x()),
+                                         static_cast<float>(robot.velocity().y())};
 
-        // Figure out how long it will take the robot to get to the new ball position
-        Duration time_to_ball_pos = getTimeToPositionForRobot(
-            robot.position(), new_ball_pos, ROBOT_MAX_SPEED_METERS_PER_SECOND,
-            ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
+    BangBangTrajectory2d_t trajectory;
+    shared_bang_bang_trajectory_generate2d(
+        &trajectory, initial_position, final_position, initial_velocity,
+        static_cast<float>(ROBOT_MAX_SPEED_METERS_PER_SECOND),
+        static_cast<float>(ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED));
 
-        // Figure out when the robot will reach the new ball position relative to the
-        // time that the ball will get there (ie. will we get there in time?)
-        double ball_robot_time_diff = duration - time_to_ball_pos.toSeconds();
+    return Duration::fromSeconds(shared_bang_bang_trajectory_getTotalTime2d(&trajectory));
+}
 
-        // We want to get to the ball at the earliest opportunity possible, so
-        // aim for a time diff of zero. We use a smooth approximation of
-        // the maximum here
-        return std::sqrt(std::pow(ball_robot_time_diff, 2) + smooth_abs_eps);
-    };
+/**
+ * Finds the earliest duration at which the time to spare becomes non-negative, given a
+ * duration where it is negative and a later duration where it is not
+ *
+ * @param get_time_to_spare Gets how much earlier the robot can get to where the ball
+ * will be after the given duration than the ball gets there, both in seconds
+ * @param missed_duration A duration where the time to spare is negative [s]
+ * @param intercepted_duration A later duration where the time to spare is not negative
+ * [s]
+ * @param tolerance_seconds How close the returned duration is to the earliest one [s]
+ *
+ * @return The earliest duration where the time to spare is not negative [s]
+ */
+static double findEarliestInterceptDuration(
+    const std::function<double(double)> &get_time_to_spare, double missed_duration,
+    double intercepted_duration, double tolerance_seconds)
+{
+    while (intercepted_duration - missed_duration > tolerance_seconds)
+    {
+        const double middle_duration = (missed_duration + intercepted_duration) / 2;
+        if (get_time_to_spare(middle_duration) >= 0)
+        {
+            intercepted_duration = middle_duration;
+        }
+        else
+        {
+            missed_duration = middle_duration;
+        }
+    }
+    return intercepted_duration;
+}
 
-    // Figure out when/where to intercept the ball. We do this by optimizing over
-    // the ball position as a function of it's travel time
-    // We make the weight here an inverse of the ball speed, so that the gradient
-    // descent takes smaller steps when the ball is moving faster
-    double descent_weight = 1 / (std::exp(ball.currentState().velocity().length() * 0.5));
-    GradientDescentOptimizer<1> optimizer({descent_weight}, gradient_approx_step_size);
-    Duration best_ball_travel_duration = Duration::fromSeconds(
-        std::abs(optimizer.minimize(objective_function, {0}, 50).at(0)));
-
-    // In the objective function above, if the robot timestamp > ball timestamp, we
-    // add on the difference so we get a intercept time after the robot timestamp, so
-    // we need to do the same here to get the duration we actually optimized on
-    if (robot.timestamp() > ball.timestamp())
+/**
+ * Finds the duration with the most time to spare between the given durations, assuming
+ * the time to spare has a single peak between them
+ *
+ * @param get_time_to_spare Gets how much earlier the robot can get to where the ball
+ * will be after the given duration than the ball gets there, both in seconds
+ * @param start_duration The start of the durations to search [s]
+ * @param end_duration The end of the durations to search [s]
+ * @param tolerance_seconds How close the returned duration is to the peak [s]
+ *
+ * @return The duration with the most time to spare [s]
+ */
+static double findMostTimeToSpareDuration(
+    const std::function<double(double)> &get_time_to_spare, double start_duration,
+    double end_duration, double tolerance_seconds)
+{
+    // We use a golden section search, which reuses one of the two durations it checks
+    // each iteration
+    static const double inverse_golden_ratio = (std::sqrt(5.0) - 1) / 2;
+
+    double lower_duration =
+        end_duration - inverse_golden_ratio * (end_duration - start_duration);
+    double upper_duration =
+        start_duration + inverse_golden_ratio * (end_duration - start_duration);
+    double lower_time_to_spare = get_time_to_spare(lower_duration);
+    double upper_time_to_spare = get_time_to_spare(upper_duration);
+    while (end_duration - start_duration > tolerance_seconds)
     {
-        best_ball_travel_duration =
-            best_ball_travel_duration + (robot.timestamp() - ball.timestamp());
+        if (lower_time_to_spare > upper_time_to_spare)
+        {
+            end_duration        = upper_duration;
+            upper_duration      = lower_duration;
+            upper_time_to_spare = lower_time_to_spare;
+            lower_duration =
+                end_duration - inverse_golden_ratio * (end_duration - start_duration);
+            lower_time_to_spare = get_time_to_spare(lower_duration);
+        }
+        else
+        {
+            start_duration      = lower_duration;
+            lower_duration      = upper_duration;
+            lower_time_to_spare = upper_time_to_spare;
+            upper_duration =
+                start_duration + inverse_golden_ratio * (end_duration - start_duration);
+            upper_time_to_spare = get_time_to_spare(upper_duration);
+        }
     }
+    return (lower_time_to_spare > upper_time_to_spare) ? lower_duration : upper_duration;
+}
+
+std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
+                                                                   const Field &field,
+                                                                   const Robot &robot)
+{
+    // How far apart the durations we step through looking for an intercept are. If the
+    // robot gets closer to being able to intercept the ball and then falls behind again
+    // between steps, we search between the steps for an intercept
+    static const double search_step_seconds = 0.1;
+
+    // How far into the future we look for an intercept
+    static const double max_search_duration_seconds = 10.0;
+
+    // How close the returned intercept is to the earliest possible intercept
+    static const double intercept_tolerance_seconds = 0.001;
 
-    Point best_ball_intercept_pos =
-        ball.estimateFutureState(best_ball_travel_duration).position();
-
-    // Check that we can get to the best position in time
-    Duration time_to_ball_pos = getTimeToPositionForRobot(
-        robot.position(), best_ball_intercept_pos, ROBOT_MAX_SPEED_METERS_PER_SECOND,
-        ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
-    Duration ball_robot_time_diff = time_to_ball_pos - best_ball_travel_duration;
-    // NOTE: if ball velocity is 0 then ball travel duration is infinite, so this
-    // check isn't relevant in that case
-    if (ball.currentState().velocity().length() != 0 &&
-        std::abs(ball_robot_time_diff.toSeconds()) > descent_weight)
+    // If the ball timestamp is less then the robot timestamp, add the difference to the
+    // durations we estimate the ball state at, so that all the durations we check are
+    // relative to the robot timestamp
+    Duration ball_timestamp_offset = Duration::fromSeconds(0);
+    if (ball.timestamp() < robot.timestamp())
     {
-        return std::nullopt;
+        ball_timestamp_offset = robot.timestamp() - ball.timestamp();
     }
 
-    // Check that the best intercept position is actually on the field
-    if (!contains(field.fieldLines(), best_ball_intercept_pos))
+    auto get_ball_position = [&](double duration) {
+        return ball
+            .estimateFutureState(ball_timestamp_offset + Duration::fromSeconds(duration))
+            .position();
+    };
+
+    // How much earlier the robot can get to where the ball will be after the given
+    // duration than the ball gets there. The robot can intercept the ball there if this
+    // is not negative. We only want to intercept the ball on the field, so there is no
+    // time to spare where the ball is off the field
+    std::function<double(double)> get_time_to_spare = [&](double duration) {
+        const Point ball_position = get_ball_position(duration);
+        if (!contains(field.fieldLines(), ball_position))
+        {
+            return -std::numeric_limits<double>::infinity();
+        }
+        return duration - getTrajectoryTimeToPosition(robot, ball_position).toSeconds();
+    };
+
+    auto make_intercept = [&](double duration) {
+        const Point intercept_position = get_ball_position(duration);
+        return std::make_pair(intercept_position,
+                              getTrajectoryTimeToPosition(robot, intercept_position));
+    };
+
+    // We want to intercept the ball at the earliest opportunity possible, so we step
+    // forwards in time until the robot can get to the ball before it does
+    double previous_duration           = 0;
+    double previous_time_to_spare      = -std::numeric_limits<double>::infinity();
+    bool previous_time_to_spare_rising = false;
+    for (double duration = 0; duration <= max_search_duration_seconds;
+         duration += search_step_seconds)
     {
-        return std::nullopt;
+        const double time_to_spare = get_time_to_spare(duration);
+        if (time_to_spare >= 0)
+        {
+            return make_intercept(
+                findEarliestInterceptDuration(get_time_to_spare, previous_duration,
+                                              duration, intercept_tolerance_seconds));
+        }
+
+        // If the time to spare peaked since the last two steps, the robot may have been
+        // able to intercept the ball in between them
+        const bool time_to_spare_rising = time_to_spare > previous_time_to_spare;
+        if (previous_time_to_spare_rising && !time_to_spare_rising)
+        {
+            const double peak_start_duration =
+                std::max(0.0, previous_duration - search_step_seconds);
+            const double peak_duration =
+                findMostTimeToSpareDuration(get_time_to_spare, peak_start_duration,
+                                            duration, intercept_tolerance_seconds);
+            if (get_time_to_spare(peak_duration) >= 0)
+            {
+                return make_intercept(findEarliestInterceptDuration(
+                    get_time_to_spare, peak_start_duration, peak_duration,
+                    intercept_tolerance_seconds));
+            }
+        }
+
+        previous_duration             = duration;
+        previous_time_to_spare        = time_to_spare;
+        previous_time_to_spare_rising = time_to_spare_rising;
     }
 
-    return std::make_pair(best_ball_intercept_pos, time_to_ball_pos);
+    return std::nullopt;
 }
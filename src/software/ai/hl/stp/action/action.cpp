@@ -1,9 +1,11 @@
 #include "software/ai/hl/stp/action/action.h"
 
 #include "software/logger/logger.h"
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
 
 Action::Action(bool loop_forever)
-    : intent_sequence(boost::bind(&Action::calculateNextIntentWrapper, this, _1)),
+    : intent_sequence(CoroutineStackAllocator(),
+                      boost::bind(&Action::calculateNextIntentWrapper, this, _1)),
       loop_forever(loop_forever)
 {
 }
@@ -18,6 +20,7 @@ bool Action::done() const
 void Action::restart()
 {
     intent_sequence = IntentCoroutine::pull_type(
+        CoroutineStackAllocator(),
         boost::bind(&Action::calculateNextIntentWrapper, this, _1));
 }
 
@@ -1,6 +1,12 @@
 #include "software/ai/hl/stp/play/play.h"
 
-Play::Play() : tactic_sequence(boost::bind(&Play::getNextTacticsWrapper, this, _1)) {}
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
+
+Play::Play()
+    : tactic_sequence(CoroutineStackAllocator(),
+                      boost::bind(&Play::getNextTacticsWrapper, this, _1))
+{
+}
 
 bool Play::done() const
 {
@@ -43,8 +49,9 @@ std::vector<std::unique_ptr<Intent>> Play::get(
     RobotToTacticAssignmentFunction robot_to_tactic_assignment_algorithm,
     MotionConstraintBuildFunction motion_constraint_builder, const World &new_world)
 {
-    std::vector<std::unique_ptr<Intent>> intents;
     auto tactics = getTactics(new_world);
+    std::vector<std::unique_ptr<Intent>> intents;
+    intents.reserve(tactics.size());
     std::vector<std::shared_ptr<const Tactic>> const_tactics;
     const_tactics.reserve(tactics.size());
     // convert pointers to const pointers
@@ -52,7 +59,7 @@ std::vector<std::unique_ptr<Intent>> Play::get(
                    [](std::shared_ptr<Tactic> tactic) { return tactic; });
     auto robot_tactic_assignment =
         robot_to_tactic_assignment_algorithm(const_tactics, new_world);
-    for (auto tactic : tactics)
+    for (const auto &tactic : tactics)
     {
         auto iter = robot_tactic_assignment.find(tactic);
         if (iter != robot_tactic_assignment.end())
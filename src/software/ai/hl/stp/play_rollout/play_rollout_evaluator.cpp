@@ -0,0 +1,402 @@
+#include "software/ai/hl/stp/play_rollout/play_rollout_evaluator.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "software/ai/hl/stp/play_rollout/rollout_robot_controller.h"
+#include "software/ai/hl/stp/stp.h"
+#include "software/ai/motion_constraint/motion_constraint_set_builder.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/logger/logger.h"
+#include "software/util/design_patterns/generic_factory.h"
+
+PlayRolloutEvaluator::PlayRolloutEvaluator(
+    std::shared_ptr<const PlayRolloutConfig> rollout_config,
+    std::shared_ptr<const AiControlConfig> control_config,
+    std::shared_ptr<const SimulatorConfig> simulator_config, unsigned int random_seed)
+    : rollout_config(rollout_config),
+      control_config(control_config),
+      simulator_config(simulator_config),
+      random_seed(random_seed),
+      rollout_mutex(),
+      rollout_work_available(),
+      rollout_finished(),
+      current_batch(),
+      stopping(false),
+      rollout_threads()
+{
+}
+
+PlayRolloutEvaluator::~PlayRolloutEvaluator()
+{
+    {
+        std::scoped_lock lock(rollout_mutex);
+        stopping = true;
+        if (current_batch)
+        {
+            current_batch->cancelled = true;
+        }
+    }
+    rollout_work_available.notify_all();
+
+    for (auto& rollout_thread : rollout_threads)
+    {
+        rollout_thread.join();
+    }
+}
+
+std::vector<PlayRolloutResult> PlayRolloutEvaluator::evaluatePlays(
+    const World& world, const std::vector<std::string>& play_names)
+{
+    auto registered_play_names = GenericFactory<std::string, Play>::getRegisteredNames();
+    for (const auto& play_name : play_names)
+    {
+        if (std::find(registered_play_names.begin(), registered_play_names.end(),
+                      play_name) == registered_play_names.end())
+        {
+            throw std::invalid_argument("No Play is registered with the name " +
+                                        play_name);
+        }
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    auto wait_until =
+        now + std::chrono::microseconds(static_cast<long>(
+                  rollout_config->getMaxWaitMilliseconds()->value() * 1000.0));
+    size_t num_plays = play_names.size();
+
+    std::vector<std::optional<double>> rollout_scores;
+    {
+        std::unique_lock lock(rollout_mutex);
+        startRolloutThreads();
+        if (!current_batch || current_batch->play_names != play_names ||
+            current_batch->shouldStop())
+        {
+            if (current_batch)
+            {
+                current_batch->cancelled = true;
+            }
+
+            // The rollouts are interleaved between the Plays so that every Play has had
+            // about the same number of rollouts completed if the time budget runs out.
+            // Rollouts with the same index use the same seed for every Play, so the
+            // Plays are compared under the same random conditions
+            size_t num_rollouts =
+                num_plays *
+                static_cast<size_t>(rollout_config->getNumRolloutsPerPlay()->value());
+            current_batch = std::make_shared<RolloutBatch>(
+                world, play_names, num_rollouts,
+                now + std::chrono::microseconds(static_cast<long>(
+                          rollout_config->getRolloutTimeBudgetMilliseconds()->value() *
+                          1000.0)));
+            rollout_work_available.notify_all();
+        }
+
+        std::shared_ptr<RolloutBatch> batch = current_batch;
+        rollout_finished.wait_until(
+            lock, std::min(wait_until, batch->deadline),
+            [&batch]() { return batch->num_finished_rollouts == batch->num_rollouts; });
+        rollout_scores = batch->rollout_scores;
+    }
+
+    std::vector<PlayRolloutResult> results;
+    for (size_t play = 0; play < num_plays; play++)
+    {
+        double total_score                  = 0.0;
+        unsigned int num_completed_rollouts = 0;
+        for (size_t rollout = play; rollout < rollout_scores.size(); rollout += num_plays)
+        {
+            if (rollout_scores[rollout])
+            {
+                total_score += rollout_scores[rollout].value();
+                num_completed_rollouts++;
+            }
+        }
+
+        std::optional<double> score = std::nullopt;
+        if (num_completed_rollouts > 0)
+        {
+            score = total_score / num_completed_rollouts;
+        }
+        results.emplace_back(
+            PlayRolloutResult{.play_name              = play_names[play],
+                              .score                  = score,
+                              .num_completed_rollouts = num_completed_rollouts});
+    }
+
+    return results;
+}
+
+PlayRolloutEvaluator::RolloutBatch::RolloutBatch(
+    const World& world, const std::vector<std::string>& play_names, size_t num_rollouts,
+    std::chrono::steady_clock::time_point deadline)
+    : world(world),
+      play_names(play_names),
+      num_rollouts(num_rollouts),
+      deadline(deadline),
+      cancelled(false),
+      next_rollout(0),
+      num_finished_rollouts(0),
+      rollout_scores(num_rollouts, std::nullopt)
+{
+}
+
+bool PlayRolloutEvaluator::RolloutBatch::shouldStop() const
+{
+    return cancelled || std::chrono::steady_clock::now() > deadline;
+}
+
+void PlayRolloutEvaluator::startRolloutThreads()
+{
+    if (!rollout_threads.empty())
+    {
+        return;
+    }
+
+    for (int i = 0; i < rollout_config->getNumRolloutThreads()->value(); i++)
+    {
+        rollout_threads.emplace_back(&PlayRolloutEvaluator::runRolloutThread, this);
+    }
+}
+
+void PlayRolloutEvaluator::runRolloutThread()
+{
+    std::unique_lock lock(rollout_mutex);
+    while (true)
+    {
+        rollout_work_available.wait(lock, [this]() {
+            return stopping ||
+                   (current_batch &&
+                    current_batch->next_rollout < current_batch->num_rollouts &&
+                    !current_batch->shouldStop());
+        });
+        if (stopping)
+        {
+            return;
+        }
+
+        // Keep the batch alive while the rollout runs, since it may be replaced by a
+        // newer one in the meantime
+        std::shared_ptr<RolloutBatch> batch = current_batch;
+        size_t rollout                      = batch->next_rollout++;
+        size_t num_plays                    = batch->play_names.size();
+
+        lock.unlock();
+        std::optional<double> score = runRollout(
+            batch->world, batch->play_names[rollout % num_plays],
+            random_seed + static_cast<unsigned int>(rollout / num_plays), *batch);
+        lock.lock();
+
+        batch->rollout_scores[rollout] = score;
+        batch->num_finished_rollouts++;
+        rollout_finished.notify_all();
+    }
+}
+
+double PlayRolloutEvaluator::scoreRolloutOutcome(const World& initial_world,
+                                                 const World& final_world)
+{
+    const Field& field  = final_world.field();
+    Point ball_position = final_world.ball().position();
+    if (contains(field.enemyGoal(), ball_position))
+    {
+        return 1.0;
+    }
+    if (contains(field.friendlyGoal(), ball_position))
+    {
+        return -1.0;
+    }
+
+    double score =
+        (ball_position.x() - initial_world.ball().position().x()) / field.xLength();
+
+    auto nearest_friendly_robot =
+        final_world.friendlyTeam().getNearestRobot(ball_position);
+    auto nearest_enemy_robot = final_world.enemyTeam().getNearestRobot(ball_position);
+    if (nearest_friendly_robot &&
+        (!nearest_enemy_robot ||
+         distance(nearest_friendly_robot->position(), ball_position) <
+             distance(nearest_enemy_robot->position(), ball_position)))
+    {
+        score += BALL_POSSESSION_SCORE_BONUS;
+    }
+
+    return std::clamp(score, -1.0, 1.0);
+}
+
+std::optional<double> PlayRolloutEvaluator::runRollout(const World& world,
+                                                       const std::string& play_name,
+                                                       unsigned int seed,
+                                                       const RolloutBatch& batch) const
+{
+    std::mt19937 random_number_generator(seed);
+    auto sample_noise = [&random_number_generator](double std_dev) {
+        if (std_dev <= 0.0)
+        {
+            return 0.0;
+        }
+        return std::normal_distribution<double>(0.0, std_dev)(random_number_generator);
+    };
+
+    double ball_noise  = rollout_config->getBallVelocityNoiseStdDev()->value();
+    double enemy_noise = rollout_config->getEnemyRobotVelocityNoiseStdDev()->value();
+
+    // Note: The PhysicsWorld is set up so friendly robots are yellow, and enemies are
+    // blue, the same as the Simulator
+    PhysicsWorld physics_world(world.field(), simulator_config);
+    physics_world.setBallState(
+        BallState(world.ball().position(),
+                  world.ball().velocity() +
+                      Vector(sample_noise(ball_noise), sample_noise(ball_noise))));
+
+    std::vector<RobotStateWithId> friendly_robot_states;
+    for (const auto& robot : world.friendlyTeam().getAllRobots())
+    {
+        friendly_robot_states.emplace_back(
+            RobotStateWithId{.id = robot.id(), .robot_state = robot.currentState()});
+    }
+    physics_world.addYellowRobots(friendly_robot_states);
+
+    std::vector<RobotStateWithId> enemy_robot_states;
+    for (const auto& robot : world.enemyTeam().getAllRobots())
+    {
+        RobotState state = robot.currentState();
+        enemy_robot_states.emplace_back(RobotStateWithId{
+            .id = robot.id(),
+            .robot_state =
+                RobotState(state.position(),
+                           state.velocity() + Vector(sample_noise(enemy_noise),
+                                                     sample_noise(enemy_noise)),
+                           state.orientation(), state.angularVelocity())});
+    }
+    physics_world.addBlueRobots(enemy_robot_states);
+
+    std::map<RobotId, RolloutRobotController> friendly_controllers;
+    std::map<RobotId, RolloutRobotController> enemy_controllers;
+
+    // The STP instance is only used to assign robots to the Play's tactics the same
+    // way the real AI would
+    STP stp([]() { return std::unique_ptr<Play>(); }, control_config, seed);
+    auto play = GenericFactory<std::string, Play>::create(play_name);
+
+    Duration ai_time_step =
+        Duration::fromSeconds(rollout_config->getRolloutAiTimeStepSeconds()->value());
+    int physics_steps_per_ai_step =
+        rollout_config->getRolloutPhysicsStepsPerAiStep()->value();
+    Duration physics_time_step =
+        Duration::fromSeconds(ai_time_step.toSeconds() / physics_steps_per_ai_step);
+    Duration horizon =
+        Duration::fromSeconds(rollout_config->getRolloutHorizonSeconds()->value());
+
+    World rollout_world = world;
+    try
+    {
+        while (physics_world.getTimestamp().toSeconds() < horizon.toSeconds())
+        {
+            if (batch.shouldStop())
+            {
+                return std::nullopt;
+            }
+
+            rollout_world       = getRolloutWorld(world, physics_world);
+            const Field& field  = rollout_world.field();
+            Point ball_position = rollout_world.ball().position();
+            if (contains(field.enemyGoal(), ball_position) ||
+                contains(field.friendlyGoal(), ball_position))
+            {
+                break;
+            }
+
+            auto intents = play->get(
+                [&stp](const std::vector<std::shared_ptr<const Tactic>>& tactics,
+                       const World& tactic_world) {
+                    return stp.assignRobotsToTactics(tactics, tactic_world);
+                },
+                [&rollout_world](const Tactic& tactic) {
+                    return buildMotionConstraintSet(rollout_world.gameState(), tactic);
+                },
+                rollout_world);
+            for (const auto& intent : intents)
+            {
+                friendly_controllers[intent->getRobotId()].setIntent(*intent);
+            }
+
+            auto enemy_chasing_ball =
+                rollout_world.enemyTeam().getNearestRobot(ball_position);
+            for (const auto& robot : rollout_world.enemyTeam().getAllRobots())
+            {
+                if (enemy_chasing_ball && robot.id() == enemy_chasing_ball->id())
+                {
+                    enemy_controllers[robot.id()].setDestination(ball_position);
+                }
+                else
+                {
+                    enemy_controllers[robot.id()].stop();
+                }
+            }
+
+            for (int i = 0; i < physics_steps_per_ai_step; i++)
+            {
+                auto ball = physics_world.getPhysicsBall().lock();
+                for (const auto& robot : physics_world.getYellowPhysicsRobots())
+                {
+                    auto physics_robot = robot.lock();
+                    friendly_controllers[physics_robot->getRobotId()].applyControl(
+                        *physics_robot, ball);
+                }
+                for (const auto& robot : physics_world.getBluePhysicsRobots())
+                {
+                    auto physics_robot = robot.lock();
+                    enemy_controllers[physics_robot->getRobotId()].applyControl(
+                        *physics_robot, ball);
+                }
+                physics_world.stepSimulation(physics_time_step);
+            }
+        }
+        rollout_world = getRolloutWorld(world, physics_world);
+    }
+    catch (const std::exception& e)
+    {
+        LOG(WARNING) << "Rollout of " << play_name << " failed: " << e.what();
+        return std::nullopt;
+    }
+
+    return scoreRolloutOutcome(world, rollout_world);
+}
+
+World PlayRolloutEvaluator::getRolloutWorld(const World& initial_world,
+                                            const PhysicsWorld& physics_world)
+{
+    Timestamp timestamp = initial_world.getMostRecentTimestamp() +
+                          Duration::fromSeconds(physics_world.getTimestamp().toSeconds());
+
+    World world = initial_world;
+    if (physics_world.getBallState())
+    {
+        world.updateBall(Ball(physics_world.getBallState().value(), timestamp));
+    }
+
+    std::vector<Robot> friendly_robots;
+    for (const auto& robot_state : physics_world.getYellowRobotStates())
+    {
+        friendly_robots.emplace_back(
+            Robot(robot_state.id, robot_state.robot_state, timestamp));
+    }
+    Team friendly_team = initial_world.friendlyTeam();
+    friendly_team.updateRobots(friendly_robots);
+    world.updateFriendlyTeamState(friendly_team);
+
+    std::vector<Robot> enemy_robots;
+    for (const auto& robot_state : physics_world.getBlueRobotStates())
+    {
+        enemy_robots.emplace_back(
+            Robot(robot_state.id, robot_state.robot_state, timestamp));
+    }
+    Team enemy_team = initial_world.enemyTeam();
+    enemy_team.updateRobots(enemy_robots);
+    world.updateEnemyTeamState(enemy_team);
+
+    return world;
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "software/ai/hl/stp/play/play.h"
+#include "software/parameter/dynamic_parameters.h"
+#include "software/simulation/physics/physics_world.h"
+#include "software/world/world.h"
+
+/**
+ * The result of evaluating a single candidate Play with rollouts
+ */
+struct PlayRolloutResult
+{
+    std::string play_name;
+    // The average score of all the rollouts that were completed for the Play, or
+    // std::nullopt if no rollouts could be completed within the time budget
+    std::optional<double> score;
+    unsigned int num_completed_rollouts;
+};
+
+/**
+ * The PlayRolloutEvaluator scores candidate Plays by simulating what would happen if
+ * each of them were run from the current state of the World.
+ *
+ * For each candidate Play, a number of short "rollouts" are simulated in their own
+ * PhysicsWorld. In each rollout the Play is run as it would be by STP, and the friendly
+ * robots follow the resulting Intents using a simplified RolloutRobotController
+ * instead of the navigator and robot firmware. The enemy team is modelled by having the
+ * enemy robot closest to the ball chase it, while the others stay put. Random noise is
+ * added to the initial velocities of the ball and enemy robots in every rollout, so
+ * the average score over all rollouts approximates the expected outcome of the Play.
+ *
+ * The rollouts for all Plays are distributed over a pool of threads that is created
+ * the first time Plays are evaluated, so an evaluator that is never used doesn't start
+ * any threads. Rollouts that can not be completed within the configured time
+ * budget are discarded. The caller only waits for the rollouts for a short time, which
+ * is well below the period of an AI tick by default. Rollouts that are still running
+ * after that carry on in the background until the time budget runs out, and their
+ * results are returned if the same Plays are evaluated again before then.
+ */
+class PlayRolloutEvaluator
+{
+   public:
+    PlayRolloutEvaluator() = delete;
+
+    /**
+     * Creates a new PlayRolloutEvaluator
+     *
+     * @param rollout_config The config for the rollouts
+     * @param control_config The AI control config the Plays are run with in the
+     * rollouts
+     * @param simulator_config The config for the PhysicsWorlds the rollouts are
+     * simulated in
+     * @param random_seed The seed used to generate the noise added to each rollout
+     */
+    explicit PlayRolloutEvaluator(
+        std::shared_ptr<const PlayRolloutConfig> rollout_config,
+        std::shared_ptr<const AiControlConfig> control_config,
+        std::shared_ptr<const SimulatorConfig> simulator_config =
+            std::make_shared<const SimulatorConfig>(),
+        unsigned int random_seed = 0);
+
+    /**
+     * Stops the rollouts that are still running and joins the rollout threads
+     */
+    ~PlayRolloutEvaluator();
+
+    PlayRolloutEvaluator(const PlayRolloutEvaluator&) = delete;
+    PlayRolloutEvaluator& operator=(const PlayRolloutEvaluator&) = delete;
+
+    /**
+     * Scores each of the given Plays by running rollouts of them from the given World.
+     * This blocks until all rollouts have been completed, the time budget has run out,
+     * or the maximum wait time has passed, whichever comes first.
+     *
+     * If the same Plays were evaluated less than the time budget ago, the rollouts of
+     * that evaluation are used instead of starting new ones, so the results may be
+     * from a World up to the time budget old.
+     *
+     * @param world The World to start the rollouts from
+     * @param play_names The names of the Plays to evaluate. These must be the names the
+     * Plays are registered with in the GenericFactory
+     *
+     * @throws std::invalid_argument if any of the play names is not a registered Play
+     *
+     * @return the results of the evaluation, in the same order as the given play names
+     */
+    std::vector<PlayRolloutResult> evaluatePlays(
+        const World& world, const std::vector<std::string>& play_names);
+
+    /**
+     * Scores the outcome of a single rollout, from the perspective of the friendly team.
+     *
+     * Scoring a goal is worth 1 and conceding a goal is worth -1. Otherwise the score is
+     * the distance the ball advanced towards the enemy goal as a fraction of the field
+     * length, plus a bonus if a friendly robot is closer to the ball than any enemy
+     * robot at the end of the rollout. The result is always in the range [-1, 1].
+     *
+     * @param initial_world The World at the start of the rollout
+     * @param final_world The World at the end of the rollout
+     *
+     * @return the score of the rollout
+     */
+    static double scoreRolloutOutcome(const World& initial_world,
+                                      const World& final_world);
+
+    // The score bonus for having the closest robot to the ball at the end of a rollout
+    static constexpr double BALL_POSSESSION_SCORE_BONUS = 0.2;
+
+   private:
+    /**
+     * The rollouts of a single evaluation of a set of Plays
+     */
+    struct RolloutBatch
+    {
+        /**
+         * Creates a batch of rollouts that haven't been started yet
+         *
+         * @param world The World to start the rollouts from
+         * @param play_names The names of the Plays to evaluate
+         * @param num_rollouts The total number of rollouts for all the Plays
+         * @param deadline The time by which the rollouts must be completed
+         */
+        RolloutBatch(const World& world, const std::vector<std::string>& play_names,
+                     size_t num_rollouts, std::chrono::steady_clock::time_point deadline);
+
+        World world;
+        std::vector<std::string> play_names;
+        size_t num_rollouts;
+        std::chrono::steady_clock::time_point deadline;
+        // Set when a newer evaluation replaces this one, so that its rollouts stop
+        // early. This is read by the rollout threads without holding the lock
+        std::atomic<bool> cancelled;
+
+        // The fields below are guarded by the rollout_mutex of the evaluator
+        // The index of the next rollout to hand out to a rollout thread
+        size_t next_rollout;
+        size_t num_finished_rollouts;
+        std::vector<std::optional<double>> rollout_scores;
+
+        /**
+         * Returns whether the rollouts of this batch should stop
+         *
+         * @return true if the batch was cancelled or its deadline has passed
+         */
+        bool shouldStop() const;
+    };
+
+    /**
+     * Starts the rollout threads if they haven't been started yet. The rollout_mutex
+     * must be held when this is called.
+     */
+    void startRolloutThreads();
+
+    /**
+     * The function run by each rollout thread. It runs the rollouts of the current
+     * batch one at a time, until the evaluator is destroyed.
+     */
+    void runRolloutThread();
+
+    /**
+     * Simulates a single rollout of the given Play
+     *
+     * @param world The World to start the rollout from
+     * @param play_name The name of the Play to run
+     * @param seed The seed used to generate the random noise for this rollout
+     * @param batch The batch the rollout is part of, which is checked during the
+     * rollout to find out if it should stop
+     *
+     * @return the score of the rollout, or std::nullopt if the rollout was stopped
+     * before it was completed
+     */
+    std::optional<double> runRollout(const World& world, const std::string& play_name,
+                                     unsigned int seed, const RolloutBatch& batch) const;
+
+    /**
+     * Returns the World that reflects the current state of the given PhysicsWorld,
+     * based on the given World at the start of the rollout
+     *
+     * @param initial_world The World at the start of the rollout
+     * @param physics_world The PhysicsWorld the rollout is simulated in
+     *
+     * @return the current World of the rollout
+     */
+    static World getRolloutWorld(const World& initial_world,
+                                 const PhysicsWorld& physics_world);
+
+    std::shared_ptr<const PlayRolloutConfig> rollout_config;
+    std::shared_ptr<const AiControlConfig> control_config;
+    std::shared_ptr<const SimulatorConfig> simulator_config;
+    unsigned int random_seed;
+
+    std::mutex rollout_mutex;
+    // Notified when a new batch is started, or the evaluator is being destroyed
+    std::condition_variable rollout_work_available;
+    // Notified every time a rollout is finished
+    std::condition_variable rollout_finished;
+    // The batch the rollout threads are working on. A batch is kept alive by the
+    // rollout threads that are still running its rollouts after it has been replaced
+    std::shared_ptr<RolloutBatch> current_batch;
+    bool stopping;
+    // The threads are created on the first evaluation, rather than for every one
+    std::vector<std::thread> rollout_threads;
+};
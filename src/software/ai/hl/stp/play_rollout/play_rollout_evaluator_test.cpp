@@ -0,0 +1,189 @@
+#include "software/ai/hl/stp/play_rollout/play_rollout_evaluator.h"
+
+#include <gtest/gtest.h>
+
+#include "software/ai/hl/stp/play/test_plays/halt_test_play.h"
+#include "software/ai/hl/stp/play/test_plays/move_test_play.h"
+#include "software/test_util/test_util.h"
+#include "software/util/typename/typename.h"
+
+class PlayRolloutEvaluatorTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        rollout_config = std::make_shared<PlayRolloutConfig>();
+        rollout_config->getMutableNumRolloutsPerPlay()->setValue(3);
+        rollout_config->getMutableNumRolloutThreads()->setValue(2);
+        rollout_config->getMutableRolloutHorizonSeconds()->setValue(0.5);
+        // Make sure all the rollouts can be completed, so that the tests are
+        // deterministic
+        rollout_config->getMutableRolloutTimeBudgetMilliseconds()->setValue(5000.0);
+        rollout_config->getMutableMaxWaitMilliseconds()->setValue(5000.0);
+
+        // Both the HaltTestPlay and MoveTestPlay are applicable
+        world = ::TestUtil::createBlankTestingWorld();
+        world =
+            ::TestUtil::setBallPosition(world, Point(1, 1), Timestamp::fromSeconds(0));
+        world = ::TestUtil::setFriendlyRobotPositions(
+            world, {Point(-1, 0), Point(-2, 1), Point(-2, -1)},
+            Timestamp::fromSeconds(0));
+        world = ::TestUtil::setEnemyRobotPositions(
+            world, {Point(3, 0), Point(3, 2), Point(3, -2)}, Timestamp::fromSeconds(0));
+    }
+
+    std::shared_ptr<PlayRolloutConfig> rollout_config;
+    std::shared_ptr<const AiControlConfig> control_config =
+        std::make_shared<const AiControlConfig>();
+    World world = ::TestUtil::createBlankTestingWorld();
+};
+
+TEST_F(PlayRolloutEvaluatorTest, test_all_rollouts_completed_within_time_budget)
+{
+    PlayRolloutEvaluator evaluator(rollout_config, control_config);
+    auto results =
+        evaluator.evaluatePlays(world, {TYPENAME(MoveTestPlay), TYPENAME(HaltTestPlay)});
+
+    ASSERT_EQ(2, results.size());
+    EXPECT_EQ(TYPENAME(MoveTestPlay), results[0].play_name);
+    EXPECT_EQ(TYPENAME(HaltTestPlay), results[1].play_name);
+    for (const auto& result : results)
+    {
+        EXPECT_EQ(3, result.num_completed_rollouts);
+        ASSERT_TRUE(result.score);
+        EXPECT_GE(result.score.value(), -1.0);
+        EXPECT_LE(result.score.value(), 1.0);
+    }
+}
+
+TEST_F(PlayRolloutEvaluatorTest, test_evaluations_with_same_seed_have_same_scores)
+{
+    // Separate evaluators are used, since an evaluator returns the results of its
+    // previous evaluation if the same plays are evaluated again within the time budget
+    PlayRolloutEvaluator evaluator(rollout_config, control_config,
+                                   std::make_shared<const SimulatorConfig>(), 42);
+    PlayRolloutEvaluator repeated_evaluator(
+        rollout_config, control_config, std::make_shared<const SimulatorConfig>(), 42);
+    auto results =
+        evaluator.evaluatePlays(world, {TYPENAME(MoveTestPlay), TYPENAME(HaltTestPlay)});
+    auto repeated_results = repeated_evaluator.evaluatePlays(
+        world, {TYPENAME(MoveTestPlay), TYPENAME(HaltTestPlay)});
+
+    ASSERT_EQ(results.size(), repeated_results.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        ASSERT_TRUE(results[i].score);
+        ASSERT_TRUE(repeated_results[i].score);
+        EXPECT_DOUBLE_EQ(results[i].score.value(), repeated_results[i].score.value());
+    }
+}
+
+TEST_F(PlayRolloutEvaluatorTest, test_play_that_leaves_ball_alone_scores_possession_bonus)
+{
+    // Without any noise or enemy robots, the stationary ball stays where it is and
+    // the friendly team keeps possession
+    rollout_config->getMutableBallVelocityNoiseStdDev()->setValue(0.0);
+    world = ::TestUtil::createBlankTestingWorld();
+    world = ::TestUtil::setBallPosition(world, Point(1, 1), Timestamp::fromSeconds(0));
+    world = ::TestUtil::setFriendlyRobotPositions(
+        world, {Point(-1, 0), Point(-2, 1), Point(-2, -1)}, Timestamp::fromSeconds(0));
+
+    PlayRolloutEvaluator evaluator(rollout_config, control_config);
+    auto results = evaluator.evaluatePlays(world, {TYPENAME(HaltTestPlay)});
+
+    ASSERT_EQ(1, results.size());
+    ASSERT_TRUE(results[0].score);
+    EXPECT_NEAR(PlayRolloutEvaluator::BALL_POSSESSION_SCORE_BONUS,
+                results[0].score.value(), 0.01);
+}
+
+TEST_F(PlayRolloutEvaluatorTest, test_wait_is_capped_and_rollouts_continue_in_background)
+{
+    rollout_config->getMutableMaxWaitMilliseconds()->setValue(1.0);
+
+    PlayRolloutEvaluator evaluator(rollout_config, control_config);
+    auto start_time = std::chrono::steady_clock::now();
+    auto results =
+        evaluator.evaluatePlays(world, {TYPENAME(MoveTestPlay), TYPENAME(HaltTestPlay)});
+    std::chrono::duration<double, std::milli> wait_time =
+        std::chrono::steady_clock::now() - start_time;
+
+    ASSERT_EQ(2, results.size());
+    // Leave plenty of margin for the scheduler, this only checks that the caller doesn't
+    // wait for the whole time budget
+    EXPECT_LT(wait_time.count(), 500.0);
+
+    // Evaluating the same plays again picks up the rollouts that carried on running
+    // in the background
+    rollout_config->getMutableMaxWaitMilliseconds()->setValue(5000.0);
+    auto repeated_results =
+        evaluator.evaluatePlays(world, {TYPENAME(MoveTestPlay), TYPENAME(HaltTestPlay)});
+    ASSERT_EQ(2, repeated_results.size());
+    for (const auto& result : repeated_results)
+    {
+        EXPECT_EQ(3, result.num_completed_rollouts);
+    }
+}
+
+TEST_F(PlayRolloutEvaluatorTest, test_evaluating_unregistered_play_throws_exception)
+{
+    PlayRolloutEvaluator evaluator(rollout_config, control_config);
+    EXPECT_THROW(evaluator.evaluatePlays(world, {"NotARealPlay"}), std::invalid_argument);
+}
+
+TEST(PlayRolloutEvaluatorScoreTest, test_score_of_goal_scored)
+{
+    World initial_world = ::TestUtil::createBlankTestingWorld();
+    World final_world   = ::TestUtil::setBallPosition(
+        initial_world, initial_world.field().enemyGoalCenter() + Vector(0.05, 0),
+        Timestamp::fromSeconds(1));
+
+    EXPECT_DOUBLE_EQ(
+        1.0, PlayRolloutEvaluator::scoreRolloutOutcome(initial_world, final_world));
+}
+
+TEST(PlayRolloutEvaluatorScoreTest, test_score_of_goal_conceded)
+{
+    World initial_world = ::TestUtil::createBlankTestingWorld();
+    World final_world   = ::TestUtil::setBallPosition(
+        initial_world, initial_world.field().friendlyGoalCenter() - Vector(0.05, 0),
+        Timestamp::fromSeconds(1));
+
+    EXPECT_DOUBLE_EQ(
+        -1.0, PlayRolloutEvaluator::scoreRolloutOutcome(initial_world, final_world));
+}
+
+TEST(PlayRolloutEvaluatorScoreTest, test_score_of_ball_advanced_with_friendly_possession)
+{
+    World initial_world = ::TestUtil::createBlankTestingWorld();
+    initial_world       = ::TestUtil::setBallPosition(initial_world, Point(0, 0),
+                                                Timestamp::fromSeconds(0));
+    World final_world   = ::TestUtil::setBallPosition(initial_world, Point(1, 0),
+                                                    Timestamp::fromSeconds(1));
+    final_world = ::TestUtil::setFriendlyRobotPositions(final_world, {Point(1.2, 0)},
+                                                        Timestamp::fromSeconds(1));
+    final_world = ::TestUtil::setEnemyRobotPositions(final_world, {Point(2, 0)},
+                                                     Timestamp::fromSeconds(1));
+
+    EXPECT_DOUBLE_EQ(
+        1.0 / initial_world.field().xLength() +
+            PlayRolloutEvaluator::BALL_POSSESSION_SCORE_BONUS,
+        PlayRolloutEvaluator::scoreRolloutOutcome(initial_world, final_world));
+}
+
+TEST(PlayRolloutEvaluatorScoreTest, test_score_of_ball_pushed_back_with_enemy_possession)
+{
+    World initial_world = ::TestUtil::createBlankTestingWorld();
+    initial_world       = ::TestUtil::setBallPosition(initial_world, Point(0, 0),
+                                                Timestamp::fromSeconds(0));
+    World final_world   = ::TestUtil::setBallPosition(initial_world, Point(-2, 0),
+                                                    Timestamp::fromSeconds(1));
+    final_world = ::TestUtil::setFriendlyRobotPositions(final_world, {Point(1, 0)},
+                                                        Timestamp::fromSeconds(1));
+    final_world = ::TestUtil::setEnemyRobotPositions(final_world, {Point(-2.2, 0)},
+                                                     Timestamp::fromSeconds(1));
+
+    EXPECT_DOUBLE_EQ(
+        -2.0 / initial_world.field().xLength(),
+        PlayRolloutEvaluator::scoreRolloutOutcome(initial_world, final_world));
+}
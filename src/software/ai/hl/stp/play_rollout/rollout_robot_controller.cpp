@@ -0,0 +1,168 @@
+#include "software/ai/hl/stp/play_rollout/rollout_robot_controller.h"
+
+#include <cmath>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/distance.h"
+
+RolloutRobotController::RolloutRobotController()
+    : destination(std::nullopt),
+      chick_direction(Angle::zero()),
+      kick_speed_meters_per_second(std::nullopt),
+      chip_distance_meters(std::nullopt)
+{
+}
+
+void RolloutRobotController::setIntent(const Intent& intent)
+{
+    intent.accept(*this);
+}
+
+void RolloutRobotController::setDestination(const Point& new_destination)
+{
+    destination = new_destination;
+    kick_speed_meters_per_second.reset();
+    chip_distance_meters.reset();
+}
+
+void RolloutRobotController::stop()
+{
+    destination.reset();
+    kick_speed_meters_per_second.reset();
+    chip_distance_meters.reset();
+}
+
+void RolloutRobotController::applyControl(PhysicsRobot& robot,
+                                          std::shared_ptr<PhysicsBall> ball)
+{
+    // How long the robot takes to correct its velocity, if it is not limited by its
+    // maximum acceleration
+    static constexpr double VELOCITY_TIME_CONSTANT_SECONDS = 0.1;
+
+    Vector desired_velocity = Vector(0, 0);
+    if (destination)
+    {
+        Vector to_destination = destination.value() - robot.position();
+        // The fastest speed the robot can travel at while still being able to stop
+        // at the destination
+        double speed =
+            std::min(ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                     std::sqrt(2.0 * ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED *
+                               to_destination.length()));
+        desired_velocity = to_destination.normalize(speed);
+    }
+
+    Vector acceleration =
+        (desired_velocity - robot.velocity()) / VELOCITY_TIME_CONSTANT_SECONDS;
+    if (acceleration.length() > ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED)
+    {
+        acceleration =
+            acceleration.normalize(ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
+    }
+    robot.applyForceToCenterOfMass(acceleration * ROBOT_WITH_BATTERY_MASS_KG);
+
+    if (ball)
+    {
+        kickOrChipBallIfInReach(robot, *ball);
+    }
+}
+
+void RolloutRobotController::kickOrChipBallIfInReach(const PhysicsRobot& robot,
+                                                     PhysicsBall& ball)
+{
+    if (!kick_speed_meters_per_second && !chip_distance_meters)
+    {
+        return;
+    }
+
+    double ball_reach =
+        ROBOT_MAX_RADIUS_METERS + BALL_MAX_RADIUS_METERS + BALL_REACH_DISTANCE_METERS;
+    if (distance(robot.position(), ball.position()) > ball_reach)
+    {
+        return;
+    }
+
+    double ball_speed = 0.0;
+    if (kick_speed_meters_per_second)
+    {
+        ball_speed = kick_speed_meters_per_second.value();
+    }
+    else
+    {
+        Angle chip_angle = Angle::fromDegrees(ROBOT_CHIP_ANGLE_DEGREES);
+        ball.setInFlightForDistance(chip_distance_meters.value(), chip_angle);
+
+        // Use the formula for the range of a parabolic projectile, rearranged to
+        // solve for the initial velocity
+        double initial_speed =
+            std::sqrt(chip_distance_meters.value() *
+                      ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED /
+                      (chip_angle * 2.0).sin());
+        ball_speed = initial_speed * chip_angle.cos();
+    }
+
+    // Replace the momentum of the ball so it travels in the requested direction
+    Vector new_momentum =
+        Vector::createFromAngle(chick_direction).normalize(ball_speed * ball.massKg());
+    ball.applyImpulse(new_momentum - ball.momentum());
+
+    // Each kick or chip only happens once per Intent
+    kick_speed_meters_per_second.reset();
+    chip_distance_meters.reset();
+}
+
+void RolloutRobotController::visit(const MoveIntent& intent)
+{
+    setDestination(intent.getDestination());
+}
+
+void RolloutRobotController::visit(const AutochipMoveIntent& intent)
+{
+    setDestination(intent.getDestination());
+    chick_direction      = intent.getFinalAngle();
+    chip_distance_meters = intent.getChipDistance();
+}
+
+void RolloutRobotController::visit(const AutokickMoveIntent& intent)
+{
+    setDestination(intent.getDestination());
+    chick_direction              = intent.getFinalAngle();
+    kick_speed_meters_per_second = intent.getKickSpeed();
+}
+
+void RolloutRobotController::visit(const DirectPrimitiveIntent& intent)
+{
+    TbotsProto::Primitive primitive = intent.getPrimitive();
+    if (primitive.has_kick())
+    {
+        const auto& kick = primitive.kick();
+        setDestination(
+            Point(kick.kick_origin().x_meters(), kick.kick_origin().y_meters()));
+        chick_direction = Angle::fromRadians(kick.kick_direction().radians());
+        kick_speed_meters_per_second = kick.kick_speed_meters_per_second();
+    }
+    else if (primitive.has_chip())
+    {
+        const auto& chip = primitive.chip();
+        setDestination(
+            Point(chip.chip_origin().x_meters(), chip.chip_origin().y_meters()));
+        chick_direction      = Angle::fromRadians(chip.chip_direction().radians());
+        chip_distance_meters = chip.chip_distance_meters();
+    }
+    else if (primitive.has_move())
+    {
+        const auto& destination_msg = primitive.move().position_params().destination();
+        setDestination(Point(destination_msg.x_meters(), destination_msg.y_meters()));
+    }
+    else if (primitive.has_spinning_move())
+    {
+        const auto& destination_msg =
+            primitive.spinning_move().position_params().destination();
+        setDestination(Point(destination_msg.x_meters(), destination_msg.y_meters()));
+    }
+    else
+    {
+        // Stop, estop, and direct control primitives all just keep the robot still
+        stop();
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <optional>
+
+#include "software/ai/intent/all_intents.h"
+#include "software/ai/intent/intent.h"
+#include "software/ai/intent/intent_visitor.h"
+#include "software/simulation/physics/physics_ball.h"
+#include "software/simulation/physics/physics_robot.h"
+
+/**
+ * A simplified robot controller used to run Intents on PhysicsRobots in play rollouts.
+ *
+ * Rather than simulating the navigator and the robot firmware, the robot is pushed
+ * in a straight line towards the destination of its Intent with a force that respects
+ * the robot's acceleration and speed limits. Kicks and chips are applied to the ball
+ * as soon as it is within reach of the robot, in the direction requested by the Intent.
+ * The orientation of the robot is not controlled.
+ */
+class RolloutRobotController : public IntentVisitor
+{
+   public:
+    /**
+     * Creates a new RolloutRobotController that keeps its robot stopped
+     */
+    explicit RolloutRobotController();
+
+    /**
+     * Sets the Intent this controller makes its robot run
+     *
+     * @param intent The Intent to run
+     */
+    void setIntent(const Intent& intent);
+
+    /**
+     * Makes the robot drive to the given destination, without kicking or chipping
+     *
+     * @param destination The destination to drive to
+     */
+    void setDestination(const Point& destination);
+
+    /**
+     * Makes the robot come to a stop
+     */
+    void stop();
+
+    /**
+     * Applies the forces required to make the given robot run the current Intent for
+     * the next physics step, and kicks or chips the given ball if required
+     *
+     * @param robot The robot to control
+     * @param ball The ball in the physics world, if there is one
+     */
+    void applyControl(PhysicsRobot& robot, std::shared_ptr<PhysicsBall> ball);
+
+    /**
+     * Updates the command of this controller from the given Intent
+     *
+     * @param intent The Intent to visit
+     */
+    void visit(const MoveIntent& intent) override;
+    void visit(const AutochipMoveIntent& intent) override;
+    void visit(const AutokickMoveIntent& intent) override;
+    void visit(const DirectPrimitiveIntent& intent) override;
+
+    // How far the ball can be from the front of the robot and still be kicked or
+    // chipped by it
+    static constexpr double BALL_REACH_DISTANCE_METERS = 0.03;
+
+   private:
+    /**
+     * Kicks or chips the given ball if it is within reach of the given robot and the
+     * current command wants to kick or chip the ball
+     *
+     * @param robot The robot that kicks or chips the ball
+     * @param ball The ball to kick or chip
+     */
+    void kickOrChipBallIfInReach(const PhysicsRobot& robot, PhysicsBall& ball);
+
+    // The destination of the robot, or std::nullopt if the robot should stop
+    std::optional<Point> destination;
+    // The direction to kick or chip the ball in
+    Angle chick_direction;
+    std::optional<double> kick_speed_meters_per_second;
+    std::optional<double> chip_distance_meters;
+};
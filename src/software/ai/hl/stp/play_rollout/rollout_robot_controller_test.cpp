@@ -0,0 +1,99 @@
+#include "software/ai/hl/stp/play_rollout/rollout_robot_controller.h"
+
+#include <gtest/gtest.h>
+
+#include "software/simulation/physics/physics_world.h"
+#include "software/test_util/test_util.h"
+
+class RolloutRobotControllerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        physics_world = std::make_unique<PhysicsWorld>(
+            Field::createSSLDivisionBField(), std::make_shared<const SimulatorConfig>());
+    }
+
+    /**
+     * Runs the given controller on the robot with id 0 for the given duration
+     *
+     * @param controller The controller to run
+     * @param duration How long to run the controller for
+     */
+    void runController(RolloutRobotController& controller, const Duration& duration)
+    {
+        const Duration time_step = Duration::fromSeconds(1.0 / 120.0);
+        for (double t = 0; t < duration.toSeconds(); t += time_step.toSeconds())
+        {
+            auto robot = physics_world->getYellowPhysicsRobots().at(0).lock();
+            controller.applyControl(*robot, physics_world->getPhysicsBall().lock());
+            physics_world->stepSimulation(time_step);
+        }
+    }
+
+    std::unique_ptr<PhysicsWorld> physics_world;
+};
+
+TEST_F(RolloutRobotControllerTest, test_robot_drives_to_destination_of_move_intent)
+{
+    physics_world->setBallState(BallState(Point(0, 2), Vector(0, 0)));
+    physics_world->addYellowRobots(
+        ::TestUtil::createStationaryRobotStatesWithId({Point(0, 0)}));
+
+    RolloutRobotController controller;
+    controller.setIntent(MoveIntent(0, Point(1.5, -0.5), Angle::zero(), 0,
+                                    DribblerMode::OFF, BallCollisionType::AVOID));
+    runController(controller, Duration::fromSeconds(3));
+
+    auto robot_state = physics_world->getYellowRobotStates().at(0).robot_state;
+    EXPECT_LT((robot_state.position() - Point(1.5, -0.5)).length(), 0.05);
+    EXPECT_LT(robot_state.velocity().length(), 0.1);
+}
+
+TEST_F(RolloutRobotControllerTest, test_moving_robot_comes_to_a_stop_when_stopped)
+{
+    physics_world->setBallState(BallState(Point(0, 2), Vector(0, 0)));
+    physics_world->addYellowRobots({RobotStateWithId{
+        .id          = 0,
+        .robot_state = RobotState(Point(0, 0), Vector(1.5, 0), Angle::zero(),
+                                  AngularVelocity::zero())}});
+
+    RolloutRobotController controller;
+    controller.stop();
+    runController(controller, Duration::fromSeconds(1));
+
+    auto robot_state = physics_world->getYellowRobotStates().at(0).robot_state;
+    EXPECT_LT(robot_state.velocity().length(), 0.05);
+}
+
+TEST_F(RolloutRobotControllerTest,
+       test_ball_in_reach_is_kicked_in_direction_of_kick_intent)
+{
+    physics_world->setBallState(BallState(Point(0.12, 0), Vector(0, 0)));
+    physics_world->addYellowRobots(
+        ::TestUtil::createStationaryRobotStatesWithId({Point(0, 0)}));
+
+    RolloutRobotController controller;
+    controller.setIntent(KickIntent(0, Point(0.12, 0), Angle::quarter(), 4.0));
+    runController(controller, Duration::fromSeconds(1.0 / 120.0));
+
+    Vector ball_velocity = physics_world->getBallState()->velocity();
+    EXPECT_NEAR(ball_velocity.length(), 4.0, 0.1);
+    EXPECT_LT(ball_velocity.orientation().minDiff(Angle::quarter()),
+              Angle::fromDegrees(1));
+}
+
+TEST_F(RolloutRobotControllerTest, test_ball_out_of_reach_is_not_kicked)
+{
+    physics_world->setBallState(BallState(Point(1, 0), Vector(0, 0)));
+    physics_world->addYellowRobots(
+        ::TestUtil::createStationaryRobotStatesWithId({Point(0, 0)}));
+
+    RolloutRobotController controller;
+    controller.setIntent(AutokickMoveIntent(0, Point(0, 0), Angle::zero(), 0,
+                                            DribblerMode::OFF, 4.0,
+                                            BallCollisionType::ALLOW));
+    runController(controller, Duration::fromSeconds(1.0 / 120.0));
+
+    EXPECT_LT(physics_world->getBallState()->velocity().length(), 0.01);
+}
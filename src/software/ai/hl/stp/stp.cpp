@@ -1,7 +1,5 @@
 #include "software/ai/hl/stp/stp.h"
 
-#include <munkres/munkres.h>
-
 #include <algorithm>
 #include <boost/bind.hpp>
 #include <chrono>
@@ -15,16 +13,20 @@
 #include "software/ai/intent/stop_intent.h"
 #include "software/ai/motion_constraint/motion_constraint_set_builder.h"
 #include "software/logger/logger.h"
+#include "software/metrics/metrics_registry.h"
 #include "software/parameter/dynamic_parameters.h"
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
 #include "software/util/design_patterns/generic_factory.h"
 #include "software/util/typename/typename.h"
 
 STP::STP(std::function<std::unique_ptr<Play>()> default_play_constructor,
          std::shared_ptr<const AiControlConfig> control_config, long random_seed)
     : default_play_constructor(default_play_constructor),
+      play_scoring_function(),
       current_play(nullptr),
       readable_robot_tactic_assignment(),
       random_number_generator(random_seed),
+      robot_tactic_assigner(),
       control_config(control_config),
       override_play_name(""),
       previous_override_play_name(""),
@@ -103,8 +105,36 @@ std::vector<std::unique_ptr<Intent>> STP::getIntentsFromCurrentPlay(const World&
 
 std::vector<std::unique_ptr<Intent>> STP::getIntents(const World& world)
 {
+    static Histogram& get_intents_time_histogram =
+        MetricsRegistry::getGlobalRegistry().getHistogram("stp.get_intents_time_us");
+    ScopedHistogramTimer timer(get_intents_time_histogram);
+
     updateSTPState(world);
-    return getIntentsFromCurrentPlay(world);
+    auto intents = getIntentsFromCurrentPlay(world);
+
+    // The coroutines of the current Play and its Tactics and Actions each allocate their
+    // own stack, so keep track of how much memory they are using
+    static Gauge& coroutine_stacks_gauge =
+        MetricsRegistry::getGlobalRegistry().getGauge("stp.coroutine_stacks_in_use");
+    static Gauge& coroutine_stack_bytes_gauge =
+        MetricsRegistry::getGlobalRegistry().getGauge("stp.coroutine_stack_bytes_in_use");
+    coroutine_stacks_gauge.set(
+        static_cast<double>(CoroutineStackAllocator::getNumStacksInUse()));
+    coroutine_stack_bytes_gauge.set(
+        static_cast<double>(CoroutineStackAllocator::getNumBytesInUse()));
+
+    return intents;
+}
+
+void STP::setPlayScoringFunction(PlayScoringFunction play_scoring_function)
+{
+    this->play_scoring_function = play_scoring_function;
+}
+
+void STP::setRobotTacticAssignmentConfig(
+    std::shared_ptr<const RobotTacticAssignmentConfig> robot_tactic_assignment_config)
+{
+    robot_tactic_assigner = RobotTacticAssigner(robot_tactic_assignment_config);
 }
 
 std::unique_ptr<Play> STP::calculateNewPlay(const World& world)
@@ -126,6 +156,32 @@ std::unique_ptr<Play> STP::calculateNewPlay(const World& world)
             "No new Play could be calculated because no Plays are applicable");
     }
 
+    if (play_scoring_function && applicable_plays.size() > 1)
+    {
+        std::vector<std::string> play_names;
+        for (const auto& play : applicable_plays)
+        {
+            play_names.emplace_back(TYPENAME(*play));
+        }
+
+        auto play_scores = play_scoring_function(world, play_names);
+        std::optional<size_t> best_play_index;
+        for (size_t i = 0; i < std::min(play_scores.size(), applicable_plays.size()); i++)
+        {
+            if (play_scores[i] &&
+                (!best_play_index ||
+                 play_scores[i].value() > play_scores[best_play_index.value()].value()))
+            {
+                best_play_index = i;
+            }
+        }
+
+        if (best_play_index)
+        {
+            return std::move(applicable_plays[best_play_index.value()]);
+        }
+    }
+
     // Create a uniform distribution over the indices of the applicable_plays
     // https://en.cppreference.com/w/cpp/numeric/random/uniform_int_distribution
     auto uniform_distribution = std::uniform_int_distribution<std::mt19937::result_type>(
@@ -253,14 +309,13 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignNonGoalieRobotsToTacti
     const World& world, const std::vector<Robot>& non_goalie_robots,
     std::vector<std::shared_ptr<const Tactic>>& non_goalie_tactics)
 {
-    std::map<std::shared_ptr<const Tactic>, Robot> non_goalie_robot_tactic_assignment;
     // This functions optimizes the assignment of robots to tactics by minimizing
     // the total cost of assignment using the Hungarian algorithm
     // (also known as the Munkres algorithm)
     // https://en.wikipedia.org/wiki/Hungarian_algorithm
     //
-    // https://github.com/saebyn/munkres-cpp is the implementation of the Hungarian
-    // algorithm that we use here
+    // See RobotTacticAssigner for how the assignment is warm started from the
+    // previous one
 
     if (non_goalie_robots.size() < non_goalie_tactics.size())
     {
@@ -278,77 +333,5 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignNonGoalieRobotsToTacti
         }
     }
 
-    size_t num_rows = non_goalie_robots.size();
-    size_t num_cols = non_goalie_tactics.size();
-
-    // The Matrix constructor will assert if the rows and columns of the matrix are
-    // not >= 1, so we perform that check first and return an empty vector of tactics.
-    // This represents the cases where there are either no tactics or no robots
-    if (num_rows == 0 || num_cols == 0)
-    {
-        return non_goalie_robot_tactic_assignment;
-    }
-
-    // The rows of the matrix are the "workers" (the robots) and the columns are the
-    // "jobs" (the Tactics).
-    Matrix<double> matrix(num_rows, num_cols);
-
-    // Initialize the matrix with the cost of assigning each Robot to each Tactic
-    for (size_t row = 0; row < num_rows; row++)
-    {
-        for (size_t col = 0; col < num_cols; col++)
-        {
-            Robot robot                           = non_goalie_robots.at(row);
-            std::shared_ptr<const Tactic>& tactic = non_goalie_tactics.at(col);
-            double robot_cost_for_tactic = tactic->calculateRobotCost(robot, world);
-
-            std::set<RobotCapability> required_capabilities =
-                tactic->robotCapabilityRequirements();
-            std::set<RobotCapability> robot_capabilities =
-                robot.getAvailableCapabilities();
-            std::set<RobotCapability> missing_capabilities;
-            std::set_difference(
-                required_capabilities.begin(), required_capabilities.end(),
-                robot_capabilities.begin(), robot_capabilities.end(),
-                std::inserter(missing_capabilities, missing_capabilities.begin()));
-
-            if (missing_capabilities.size() > 0)
-            {
-                matrix(row, col) = robot_cost_for_tactic + 10.0f;
-            }
-            else
-            {
-                // capability requirements are satisfied, use real cost
-                matrix(row, col) = robot_cost_for_tactic;
-            }
-        }
-    }
-
-    // Apply the Munkres/Hungarian algorithm to the matrix.
-    Munkres<double> m;
-    m.solve(matrix);
-
-    // The Munkres matrix gets solved such that there will be exactly one 0 in every
-    // row and exactly one 0 in every column. All other values will be -1. The 0's
-    // indicate the "workers" and "jobs" (robots and tactics for us) that are most
-    // optimally paired together
-    //
-    // Example matrices:
-    //        -1, 0,-1,         and            0,-1,
-    //         0,-1,-1,                       -1, 0,
-    //        -1,-1, 0,
-    for (size_t row = 0; row < num_rows; row++)
-    {
-        for (size_t col = 0; col < num_cols; col++)
-        {
-            auto val = matrix(row, col);
-            if (val == 0)
-            {
-                non_goalie_robot_tactic_assignment.emplace(non_goalie_tactics.at(col),
-                                                           non_goalie_robots.at(row));
-                break;
-            }
-        }
-    }
-    return non_goalie_robot_tactic_assignment;
+    return robot_tactic_assigner.assign(world, non_goalie_robots, non_goalie_tactics);
 }
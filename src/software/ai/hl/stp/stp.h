@@ -4,9 +4,16 @@
 
 #include "software/ai/hl/hl.h"
 #include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/tactic_assignment/robot_tactic_assigner.h"
 #include "software/ai/intent/intent.h"
 #include "software/parameter/dynamic_parameters.h"
 
+// A function that scores each of the given candidate Plays in the given World. The Plays
+// are identified by the names they are registered with in the GenericFactory. Higher
+// scores are better, and Plays that could not be scored have a score of std::nullopt
+using PlayScoringFunction = std::function<std::vector<std::optional<double>>(
+    const World &, const std::vector<std::string> &)>;
+
 /**
  * The STP module is an implementation of the high-level logic Abstract class, that
  * uses the STP (Skills, Tactics, Plays) framework for its decision making.
@@ -90,10 +97,28 @@ class STP : public HL
 
     std::vector<std::unique_ptr<Intent>> getIntents(const World &world) override;
 
+    /**
+     * Sets the function used to score the applicable Plays when choosing a new Play
+     *
+     * @param play_scoring_function The function used to score the applicable Plays
+     */
+    void setPlayScoringFunction(PlayScoringFunction play_scoring_function);
+
+    /**
+     * Sets the config used to assign robots to tactics. This resets the previous
+     * assignment that the next assignment is warm started from
+     *
+     * @param robot_tactic_assignment_config The config used to assign robots to tactics
+     */
+    void setRobotTacticAssignmentConfig(std::shared_ptr<const RobotTacticAssignmentConfig>
+                                            robot_tactic_assignment_config);
+
     /**
      * Given the state of the world, returns a unique_ptr to the Play that should be run
      * at this time. If multiple Plays are applicable and could be run at a given time,
-     * one of them is chosen randomly.
+     * the one with the highest score from the play scoring function is chosen. If no
+     * play scoring function has been set or none of the Plays could be scored, one of
+     * them is chosen randomly.
      *
      * @param world The world object containing the current state of the world
      * @throws std::runtime error if there are no plays that can be run (ie. no plays
@@ -171,7 +196,7 @@ class STP : public HL
      *
      * @return The list of tactics that were assigned to the robots
      */
-    static std::map<std::shared_ptr<const Tactic>, Robot> assignNonGoalieRobotsToTactics(
+    std::map<std::shared_ptr<const Tactic>, Robot> assignNonGoalieRobotsToTactics(
         const World &world, const std::vector<Robot> &non_goalie_robots,
         std::vector<std::shared_ptr<const Tactic>> &non_goalie_tactics);
 
@@ -213,11 +238,15 @@ class STP : public HL
     // A function that constructs a Play that will be used if no other Plays are
     // applicable
     std::function<std::unique_ptr<Play>()> default_play_constructor;
+    // A function that scores the applicable Plays when choosing a new Play, if set
+    PlayScoringFunction play_scoring_function;
     // The Play that is currently running
     std::unique_ptr<Play> current_play;
     std::map<RobotId, std::string> readable_robot_tactic_assignment;
     // The random number generator
     std::mt19937 random_number_generator;
+    // Assigns robots to tactics, warm starting from the previous assignment
+    RobotTacticAssigner robot_tactic_assigner;
     std::shared_ptr<const AiControlConfig> control_config;
     std::string override_play_name;
     std::string previous_override_play_name;
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "software/ai/hl/stp/play/play.h"
+#include "software/ai/hl/stp/stp.h"
+#include "software/ai/motion_constraint/motion_constraint_set_builder.h"
+#include "software/test_util/test_util.h"
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
+#include "software/util/design_patterns/generic_factory.h"
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(STPPerformanceTest, DISABLED_time_per_tick_and_coroutine_stacks_of_every_play)
+{
+    const unsigned int num_ticks = 1000;
+
+    World world = ::TestUtil::createBlankTestingWorld();
+    world       = ::TestUtil::setFriendlyRobotPositions(
+        world,
+        {Point(-4, 0), Point(-3, 1), Point(-3, -1), Point(-1, 2), Point(-1, -2),
+         Point(-0.5, 0)},
+        Timestamp::fromSeconds(0));
+    world = ::TestUtil::setEnemyRobotPositions(world,
+                                               {Point(4, 0), Point(3, 1), Point(3, -1),
+                                                Point(1, 2), Point(1, -2), Point(0.5, 0)},
+                                               Timestamp::fromSeconds(0));
+
+    // The STP instance is only used to assign robots to the Play's tactics the same
+    // way the real AI would
+    STP stp([]() { return std::unique_ptr<Play>(); },
+            std::make_shared<const AiControlConfig>(), 0);
+
+    std::cout << std::left << std::setw(28) << "Play" << std::setw(16) << "us per tick"
+              << std::setw(20) << "coroutine stacks"
+              << "coroutine stack KiB" << std::endl;
+    for (const auto& play_name : GenericFactory<std::string, Play>::getRegisteredNames())
+    {
+        size_t initial_num_stacks = CoroutineStackAllocator::getNumStacksInUse();
+        size_t initial_num_bytes  = CoroutineStackAllocator::getNumBytesInUse();
+
+        auto play       = GenericFactory<std::string, Play>::create(play_name);
+        auto start_time = std::chrono::steady_clock::now();
+        for (unsigned int tick = 0; tick < num_ticks; tick++)
+        {
+            play->get(
+                [&stp](const std::vector<std::shared_ptr<const Tactic>>& tactics,
+                       const World& tactic_world) {
+                    return stp.assignRobotsToTactics(tactics, tactic_world);
+                },
+                [&world](const Tactic& tactic) {
+                    return buildMotionConstraintSet(world.gameState(), tactic);
+                },
+                world);
+        }
+        auto duration = std::chrono::steady_clock::now() - start_time;
+
+        // The stacks still in use are the ones held by the Play, and the Tactics and
+        // Actions it has created
+        std::cout << std::left << std::setw(28) << play_name << std::setw(16)
+                  << static_cast<double>(
+                         std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+                             .count()) /
+                         1000.0 / num_ticks
+                  << std::setw(20)
+                  << CoroutineStackAllocator::getNumStacksInUse() - initial_num_stacks
+                  << (CoroutineStackAllocator::getNumBytesInUse() - initial_num_bytes) /
+                         1024
+                  << std::endl;
+    }
+}
@@ -93,6 +93,62 @@ TEST_F(STPTest, test_calculate_new_play_when_multiple_plays_valid)
     EXPECT_EQ(expected_play_names, actual_play_names);
 }
 
+TEST_F(STPTest, test_calculate_new_play_chooses_highest_scoring_play_when_multiple_valid)
+{
+    // Both HaltTestPlay and MoveTestPlay should be applicable
+    world = ::TestUtil::setBallPosition(world, Point(1, 1), Timestamp::fromSeconds(0));
+
+    stp.setPlayScoringFunction(
+        [](const World& world, const std::vector<std::string>& play_names) {
+            std::vector<std::optional<double>> scores;
+            for (const auto& play_name : play_names)
+            {
+                if (play_name == TYPENAME(HaltTestPlay))
+                {
+                    scores.emplace_back(0.5);
+                }
+                else
+                {
+                    scores.emplace_back(-0.5);
+                }
+            }
+            return scores;
+        });
+
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        auto play = stp.calculateNewPlay(world);
+        EXPECT_EQ(TYPENAME(*play), TYPENAME(HaltTestPlay));
+    }
+}
+
+TEST_F(STPTest, test_calculate_new_play_chooses_randomly_when_no_plays_could_be_scored)
+{
+    // Both HaltTestPlay and MoveTestPlay should be applicable
+    world = ::TestUtil::setBallPosition(world, Point(1, 1), Timestamp::fromSeconds(0));
+
+    stp.setPlayScoringFunction(
+        [](const World& world, const std::vector<std::string>& play_names) {
+            return std::vector<std::optional<double>>(play_names.size(), std::nullopt);
+        });
+
+    std::vector<std::string> actual_play_names;
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        auto play = stp.calculateNewPlay(world);
+        actual_play_names.emplace_back(TYPENAME(*play));
+    }
+
+    // The same random selection as when no play scoring function is set
+    std::vector<std::string> expected_play_names = {
+        TYPENAME(MoveTestPlay), TYPENAME(MoveTestPlay), TYPENAME(MoveTestPlay),
+        TYPENAME(MoveTestPlay), TYPENAME(MoveTestPlay), TYPENAME(MoveTestPlay),
+        TYPENAME(MoveTestPlay), TYPENAME(MoveTestPlay), TYPENAME(HaltTestPlay),
+        TYPENAME(MoveTestPlay),
+    };
+    EXPECT_EQ(expected_play_names, actual_play_names);
+}
+
 TEST_F(STPTest, test_current_play_initially_unassigned)
 {
     EXPECT_EQ(stp.getCurrentPlayName(), std::nullopt);
@@ -2,8 +2,6 @@
 
 #include <algorithm>
 
-#include "software/ai/hl/stp/action/chip_action.h"
-
 ChipTactic::ChipTactic(const Ball &ball, bool loop_forever)
     : Tactic(loop_forever, {RobotCapability::Chip, RobotCapability::Move}), ball(ball)
 {
@@ -38,18 +36,6 @@ double ChipTactic::calculateRobotCost(const Robot &robot, const World &world) co
     return std::clamp<double>(cost, 0, 1);
 }
 
-void ChipTactic::calculateNextAction(ActionCoroutine::push_type &yield)
-{
-    auto chip_action = std::make_shared<ChipAction>();
-    do
-    {
-        chip_action->updateControlParams(*robot_, control_params.chip_origin,
-                                         control_params.chip_direction,
-                                         control_params.chip_distance_meters);
-        yield(chip_action);
-    } while (!chip_action->done());
-}
-
 void ChipTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
@@ -63,7 +63,6 @@ class ChipTactic : public Tactic
     bool done() const override;
 
    private:
-    void calculateNextAction(ActionCoroutine::push_type& yield) override;
     void updateIntent(const TacticUpdate& tactic_update) override;
 
     HFSM<ChipFSM> fsm;
@@ -2,20 +2,32 @@
 
 #include <gtest/gtest.h>
 
-#include "software/ai/hl/stp/action/chip_action.h"
 #include "software/test_util/test_util.h"
 
-void compareChipActions(std::shared_ptr<ChipAction> chip_action,
-                        std::shared_ptr<ChipAction> expected_chip_action)
+/**
+ * Checks that the given intent moves the robot to get behind the chip origin, so that
+ * it is ready to chip in the chip direction
+ *
+ * @param intent The intent to check
+ * @param chip_origin The location where the chip will be taken
+ * @param chip_direction The direction the robot will chip in
+ */
+void expectGetBehindChipOriginIntent(const std::unique_ptr<Intent>& intent,
+                                     const Point& chip_origin,
+                                     const Angle& chip_direction)
 {
-    EXPECT_TRUE(TestUtil::equalWithinTolerance(expected_chip_action->getChipOrigin(),
-                                               chip_action->getChipOrigin(), 1e-6));
-    EXPECT_TRUE(TestUtil::equalWithinTolerance(expected_chip_action->getChipDirection(),
-                                               chip_action->getChipDirection(),
-                                               Angle::fromDegrees(1e-6)));
-    EXPECT_TRUE(
-        TestUtil::equalWithinTolerance(expected_chip_action->getChipDistanceMeters(),
-                                       chip_action->getChipDistanceMeters(), 1e-6));
+    ASSERT_TRUE(intent);
+    auto move_intent = dynamic_cast<MoveIntent*>(intent.get());
+    ASSERT_NE(move_intent, nullptr);
+    EXPECT_EQ(0, move_intent->getRobotId());
+
+    Point expected_destination =
+        chip_origin + Vector::createFromAngle(chip_direction + Angle::half())
+                          .normalize(3 * ROBOT_MAX_RADIUS_METERS);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(expected_destination,
+                                               move_intent->getDestination(), 1e-6));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        chip_direction, move_intent->getFinalAngle(), Angle::fromDegrees(1e-6)));
 }
 
 TEST(ChipTacticTest, robot_behind_ball_chipping_towards_positive_x_positive_y)
@@ -23,31 +35,25 @@ TEST(ChipTacticTest, robot_behind_ball_chipping_towards_positive_x_positive_y)
     World world = ::TestUtil::createBlankTestingWorld();
     world = ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
 
-    Robot robot = Robot(0, Point(-0.3, 0), Vector(0, 0), Angle::zero(),
-                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    // The robot is inside the region behind the ball
+    Robot robot = ::TestUtil::createRobotAtPos(
+        Point(0, 0) + Vector::createFromAngle(Angle::fromDegrees(45.0) + Angle::half())
+                          .normalize(0.15));
 
     ChipTactic tactic = ChipTactic(world.ball(), true);
-
-    Ball ball({0, 0}, robot.position().toVector(), Timestamp::fromSeconds(0));
-
-    tactic.updateWorldParams(world);
-    EXPECT_EQ(tactic.getBall().position(), ball.position());
-
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(0, 0), Point(1, 1));
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    ASSERT_TRUE(action_ptr);
-
-    auto chip_action = std::dynamic_pointer_cast<ChipAction>(action_ptr);
-
-    std::shared_ptr<ChipAction> expected_chip_action = std::make_shared<ChipAction>();
-    expected_chip_action->updateControlParams(robot, ball.position(),
-                                              Angle::fromDegrees(45.0), sqrtf(2.0));
 
-    ASSERT_NE(chip_action, nullptr);
-    compareChipActions(chip_action, expected_chip_action);
+    // The robot gets behind the ball first, and is then already behind it
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(45.0));
+    EXPECT_EQ(tactic.getBall().position(), Point(0, 0));
+
+    auto intent = tactic.get(robot, world);
+    ASSERT_TRUE(intent);
+    auto chip_intent = dynamic_cast<ChipIntent*>(intent.get());
+    ASSERT_NE(chip_intent, nullptr);
+    EXPECT_EQ(0, chip_intent->getRobotId());
+    EXPECT_FALSE(tactic.done());
 }
 
 TEST(ChipTacticTest, robot_behind_ball_chipping_towards_negative_x_positive_y)
@@ -55,31 +61,25 @@ TEST(ChipTacticTest, robot_behind_ball_chipping_towards_negative_x_positive_y)
     World world = ::TestUtil::createBlankTestingWorld();
     world = ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
 
-    Robot robot = Robot(0, Point(-1.3, 2), Vector(0, 0), Angle::zero(),
-                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    // The robot is inside the region behind the ball
+    Robot robot = ::TestUtil::createRobotAtPos(
+        Point(0, 0) + Vector::createFromAngle(Angle::fromDegrees(135.0) + Angle::half())
+                          .normalize(0.15));
 
     ChipTactic tactic = ChipTactic(world.ball(), true);
-
-    Ball ball({0, 0}, robot.position().toVector(), Timestamp::fromSeconds(0));
-
-    tactic.updateWorldParams(world);
-    EXPECT_EQ(tactic.getBall().position(), ball.position());
-
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(0, 0), Point(-1, 1));
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    EXPECT_TRUE(action_ptr);
-
-    auto chip_action = std::dynamic_pointer_cast<ChipAction>(action_ptr);
-
-    std::shared_ptr<ChipAction> expected_chip_action = std::make_shared<ChipAction>();
-    expected_chip_action->updateControlParams(robot, ball.position(),
-                                              Angle::fromDegrees(135.0), sqrtf(2.0));
 
-    ASSERT_NE(chip_action, nullptr);
-    compareChipActions(chip_action, expected_chip_action);
+    // The robot gets behind the ball first, and is then already behind it
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(135.0));
+    EXPECT_EQ(tactic.getBall().position(), Point(0, 0));
+
+    auto intent = tactic.get(robot, world);
+    ASSERT_TRUE(intent);
+    auto chip_intent = dynamic_cast<ChipIntent*>(intent.get());
+    ASSERT_NE(chip_intent, nullptr);
+    EXPECT_EQ(0, chip_intent->getRobotId());
+    EXPECT_FALSE(tactic.done());
 }
 
 TEST(ChipTacticTest, robot_behind_ball_chipping_towards_negative_x_negative_y)
@@ -87,31 +87,25 @@ TEST(ChipTacticTest, robot_behind_ball_chipping_towards_negative_x_negative_y)
     World world = ::TestUtil::createBlankTestingWorld();
     world = ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
 
-    Robot robot = Robot(0, Point(-0.5, 1.3), Vector(0, 0), Angle::zero(),
-                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    // The robot is inside the region behind the ball
+    Robot robot = ::TestUtil::createRobotAtPos(
+        Point(0, 0) + Vector::createFromAngle(Angle::fromDegrees(225.0) + Angle::half())
+                          .normalize(0.15));
 
     ChipTactic tactic = ChipTactic(world.ball(), true);
-
-    Ball ball({0, 0}, robot.position().toVector(), Timestamp::fromSeconds(0));
-
-    tactic.updateWorldParams(world);
-    EXPECT_EQ(tactic.getBall().position(), ball.position());
-
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(0, 0), Point(-1, -1));
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    EXPECT_TRUE(action_ptr);
-
-    auto chip_action = std::dynamic_pointer_cast<ChipAction>(action_ptr);
-
-    std::shared_ptr<ChipAction> expected_chip_action = std::make_shared<ChipAction>();
-    expected_chip_action->updateControlParams(robot, ball.position(),
-                                              Angle::fromDegrees(225.0), sqrtf(2.0));
 
-    ASSERT_NE(chip_action, nullptr);
-    compareChipActions(chip_action, expected_chip_action);
+    // The robot gets behind the ball first, and is then already behind it
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(225.0));
+    EXPECT_EQ(tactic.getBall().position(), Point(0, 0));
+
+    auto intent = tactic.get(robot, world);
+    ASSERT_TRUE(intent);
+    auto chip_intent = dynamic_cast<ChipIntent*>(intent.get());
+    ASSERT_NE(chip_intent, nullptr);
+    EXPECT_EQ(0, chip_intent->getRobotId());
+    EXPECT_FALSE(tactic.done());
 }
 
 TEST(ChipTacticTest, robot_behind_ball_chipping_towards_positive_x_negative_y)
@@ -119,31 +113,25 @@ TEST(ChipTacticTest, robot_behind_ball_chipping_towards_positive_x_negative_y)
     World world = ::TestUtil::createBlankTestingWorld();
     world = ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
 
-    Robot robot = Robot(0, Point(-1.2, 2.1), Vector(0, 0), Angle::zero(),
-                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    // The robot is inside the region behind the ball
+    Robot robot = ::TestUtil::createRobotAtPos(
+        Point(0, 0) + Vector::createFromAngle(Angle::fromDegrees(315.0) + Angle::half())
+                          .normalize(0.15));
 
     ChipTactic tactic = ChipTactic(world.ball(), true);
-
-    Ball ball({0, 0}, robot.position().toVector(), Timestamp::fromSeconds(0));
-
-    tactic.updateWorldParams(world);
-    EXPECT_EQ(tactic.getBall().position(), ball.position());
-
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(0, 0), Point(1, -1));
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    EXPECT_TRUE(action_ptr);
-
-    auto chip_action = std::dynamic_pointer_cast<ChipAction>(action_ptr);
-
-    std::shared_ptr<ChipAction> expected_chip_action = std::make_shared<ChipAction>();
-    expected_chip_action->updateControlParams(robot, ball.position(),
-                                              Angle::fromDegrees(315.0), sqrtf(2.0));
 
-    ASSERT_NE(chip_action, nullptr);
-    compareChipActions(chip_action, expected_chip_action);
+    // The robot gets behind the ball first, and is then already behind it
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(315.0));
+    EXPECT_EQ(tactic.getBall().position(), Point(0, 0));
+
+    auto intent = tactic.get(robot, world);
+    ASSERT_TRUE(intent);
+    auto chip_intent = dynamic_cast<ChipIntent*>(intent.get());
+    ASSERT_NE(chip_intent, nullptr);
+    EXPECT_EQ(0, chip_intent->getRobotId());
+    EXPECT_FALSE(tactic.done());
 }
 
 TEST(ChipTacticTest, robot_not_behind_ball_chipping_towards_positive_x_positive_y)
@@ -151,31 +139,18 @@ TEST(ChipTacticTest, robot_not_behind_ball_chipping_towards_positive_x_positive_
     World world = ::TestUtil::createBlankTestingWorld();
     world = ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
 
-    Robot robot = Robot(0, Point(0.3, 0), Vector(0, 0), Angle::zero(),
-                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot robot = ::TestUtil::createRobotAtPos(Point(0.3, 0));
 
     ChipTactic tactic = ChipTactic(world.ball(), true);
-
-    Ball ball({0, 0}, robot.position().toVector(), Timestamp::fromSeconds(0));
-
-    tactic.updateWorldParams(world);
-    EXPECT_EQ(tactic.getBall().position(), ball.position());
-
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(0, 0), Point(1, 1));
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    EXPECT_TRUE(action_ptr);
-
-    auto chip_action = std::dynamic_pointer_cast<ChipAction>(action_ptr);
-
-    std::shared_ptr<ChipAction> expected_chip_action = std::make_shared<ChipAction>();
-    expected_chip_action->updateControlParams(robot, ball.position(),
-                                              Angle::fromDegrees(45.0), sqrtf(2.0));
 
-    ASSERT_NE(chip_action, nullptr);
-    compareChipActions(chip_action, expected_chip_action);
+    // The robot keeps getting behind the ball until it is behind it
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(45.0));
+    EXPECT_EQ(tactic.getBall().position(), Point(0, 0));
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(45.0));
+    EXPECT_FALSE(tactic.done());
 }
 
 TEST(ChipTacticTest, robot_not_behind_ball_chipping_towards_negative_x_positive_y)
@@ -183,31 +158,18 @@ TEST(ChipTacticTest, robot_not_behind_ball_chipping_towards_negative_x_positive_
     World world = ::TestUtil::createBlankTestingWorld();
     world = ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
 
-    Robot robot = Robot(0, Point(1.1, 0.2), Vector(0, 0), Angle::zero(),
-                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot robot = ::TestUtil::createRobotAtPos(Point(1.1, 0.2));
 
     ChipTactic tactic = ChipTactic(world.ball(), true);
-
-    Ball ball({0, 0}, robot.position().toVector(), Timestamp::fromSeconds(0));
-
-    tactic.updateWorldParams(world);
-    EXPECT_EQ(tactic.getBall().position(), ball.position());
-
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(0, 0), Point(-1, 1));
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    EXPECT_TRUE(action_ptr);
-
-    auto chip_action = std::dynamic_pointer_cast<ChipAction>(action_ptr);
-
-    std::shared_ptr<ChipAction> expected_chip_action = std::make_shared<ChipAction>();
-    expected_chip_action->updateControlParams(robot, ball.position(),
-                                              Angle::fromDegrees(135.0), sqrtf(2.0));
 
-    ASSERT_NE(chip_action, nullptr);
-    compareChipActions(chip_action, expected_chip_action);
+    // The robot keeps getting behind the ball until it is behind it
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(135.0));
+    EXPECT_EQ(tactic.getBall().position(), Point(0, 0));
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(135.0));
+    EXPECT_FALSE(tactic.done());
 }
 
 TEST(ChipTacticTest, robot_not_behind_ball_chipping_towards_negative_x_negative_y)
@@ -215,31 +177,18 @@ TEST(ChipTacticTest, robot_not_behind_ball_chipping_towards_negative_x_negative_
     World world = ::TestUtil::createBlankTestingWorld();
     world = ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
 
-    Robot robot = Robot(0, Point(0.7, 2), Vector(0, 0), Angle::zero(),
-                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot robot = ::TestUtil::createRobotAtPos(Point(0.7, 2));
 
     ChipTactic tactic = ChipTactic(world.ball(), true);
-
-    Ball ball({0, 0}, robot.position().toVector(), Timestamp::fromSeconds(0));
-
-    tactic.updateWorldParams(world);
-    EXPECT_EQ(tactic.getBall().position(), ball.position());
-
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(0, 0), Point(-1, -1));
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    EXPECT_TRUE(action_ptr);
-
-    auto chip_action = std::dynamic_pointer_cast<ChipAction>(action_ptr);
-
-    std::shared_ptr<ChipAction> expected_chip_action = std::make_shared<ChipAction>();
-    expected_chip_action->updateControlParams(robot, ball.position(),
-                                              Angle::fromDegrees(225.0), sqrtf(2.0));
 
-    ASSERT_NE(chip_action, nullptr);
-    compareChipActions(chip_action, expected_chip_action);
+    // The robot keeps getting behind the ball until it is behind it
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(225.0));
+    EXPECT_EQ(tactic.getBall().position(), Point(0, 0));
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(225.0));
+    EXPECT_FALSE(tactic.done());
 }
 
 TEST(ChipTacticTest, robot_not_behind_ball_chipping_towards_positive_x_negative_y)
@@ -247,29 +196,16 @@ TEST(ChipTacticTest, robot_not_behind_ball_chipping_towards_positive_x_negative_
     World world = ::TestUtil::createBlankTestingWorld();
     world = ::TestUtil::setBallPosition(world, Point(0, 0), Timestamp::fromSeconds(0));
 
-    Robot robot = Robot(0, Point(1.3, 1.2), Vector(0, 0), Angle::zero(),
-                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    Robot robot = ::TestUtil::createRobotAtPos(Point(1.3, 1.2));
 
     ChipTactic tactic = ChipTactic(world.ball(), true);
-
-    Ball ball({0, 0}, robot.position().toVector(), Timestamp::fromSeconds(0));
-
-    tactic.updateWorldParams(world);
-    EXPECT_EQ(tactic.getBall().position(), ball.position());
-
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(0, 0), Point(1, -1));
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    EXPECT_TRUE(action_ptr);
-
-    auto chip_action = std::dynamic_pointer_cast<ChipAction>(action_ptr);
-
-    std::shared_ptr<ChipAction> expected_chip_action = std::make_shared<ChipAction>();
-    expected_chip_action->updateControlParams(robot, ball.position(),
-                                              Angle::fromDegrees(315.0), sqrtf(2.0));
 
-    ASSERT_NE(chip_action, nullptr);
-    compareChipActions(chip_action, expected_chip_action);
+    // The robot keeps getting behind the ball until it is behind it
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(315.0));
+    EXPECT_EQ(tactic.getBall().position(), Point(0, 0));
+    expectGetBehindChipOriginIntent(tactic.get(robot, world), Point(0, 0),
+                                    Angle::fromDegrees(315.0));
+    EXPECT_FALSE(tactic.done());
 }
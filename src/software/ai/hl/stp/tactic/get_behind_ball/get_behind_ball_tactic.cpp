@@ -29,26 +29,6 @@ double GetBehindBallTactic::calculateRobotCost(const Robot &robot,
     return std::clamp<double>(cost, 0, 1);
 }
 
-void GetBehindBallTactic::calculateNextAction(ActionCoroutine::push_type &yield)
-{
-    double size_of_region_behind_ball = 4 * ROBOT_MAX_RADIUS_METERS;
-    auto move_action =
-        std::make_shared<MoveAction>(false, MoveAction::ROBOT_CLOSE_TO_DEST_THRESHOLD,
-                                     MoveAction::ROBOT_CLOSE_TO_ORIENTATION_THRESHOLD);
-    do
-    {
-        Vector behind_ball =
-            Vector::createFromAngle(control_params.chick_direction + Angle::half());
-        Point point_behind_ball =
-            control_params.ball_location +
-            behind_ball.normalize(size_of_region_behind_ball * 3 / 4);
-        move_action->updateControlParams(*robot_, point_behind_ball,
-                                         control_params.chick_direction, 0.0,
-                                         DribblerMode::OFF, BallCollisionType::AVOID);
-        yield(move_action);
-    } while (!move_action->done());
-}
-
 bool GetBehindBallTactic::done() const
 {
     return fsm.is(boost::sml::X);
@@ -2,8 +2,6 @@
 
 #include <algorithm>
 
-#include "software/ai/hl/stp/action/kick_action.h"
-
 KickTactic::KickTactic(const Ball &ball, bool loop_forever)
     : Tactic(loop_forever, {RobotCapability::Kick, RobotCapability::Move}), ball(ball)
 {
@@ -39,18 +37,6 @@ double KickTactic::calculateRobotCost(const Robot &robot, const World &world) co
     return std::clamp<double>(cost, 0, 1);
 }
 
-void KickTactic::calculateNextAction(ActionCoroutine::push_type &yield)
-{
-    auto kick_action = std::make_shared<KickAction>();
-    do
-    {
-        kick_action->updateControlParams(*robot_, control_params.kick_origin,
-                                         control_params.kick_direction,
-                                         control_params.kick_speed_meters_per_second);
-        yield(kick_action);
-    } while (!kick_action->done());
-}
-
 void KickTactic::accept(TacticVisitor &visitor) const
 {
     visitor.visit(*this);
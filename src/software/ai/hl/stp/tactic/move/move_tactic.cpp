@@ -28,20 +28,6 @@ double MoveTactic::calculateRobotCost(const Robot &robot, const World &world) co
     return std::clamp<double>(cost, 0, 1);
 }
 
-void MoveTactic::calculateNextAction(ActionCoroutine::push_type &yield)
-{
-    auto move_action =
-        std::make_shared<MoveAction>(false, MoveAction::ROBOT_CLOSE_TO_DEST_THRESHOLD,
-                                     MoveAction::ROBOT_CLOSE_TO_ORIENTATION_THRESHOLD);
-    do
-    {
-        move_action->updateControlParams(
-            *robot_, control_params.destination, control_params.final_orientation,
-            control_params.final_speed, DribblerMode::OFF, BallCollisionType::AVOID);
-        yield(move_action);
-    } while (!move_action->done());
-}
-
 bool MoveTactic::done() const
 {
     return fsm.is(boost::sml::X);
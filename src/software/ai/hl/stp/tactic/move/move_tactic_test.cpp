@@ -2,29 +2,28 @@
 
 #include <gtest/gtest.h>
 
-#include "software/ai/hl/stp/action/move_action.h"
 #include "software/test_util/test_util.h"
 
 TEST(MoveTacticTest, robot_far_from_destination)
 {
+    World world = ::TestUtil::createBlankTestingWorld();
     Robot robot = Robot(0, Point(), Vector(), Angle::zero(), AngularVelocity::zero(),
                         Timestamp::fromSeconds(0));
 
     MoveTactic tactic = MoveTactic(false);
-    tactic.updateRobot(robot);
     tactic.updateControlParams(Point(1, 0), Angle::quarter(), 1.0);
-    auto action_ptr = tactic.getNextAction();
-
-    // Check an action was returned (the pointer is not null)
-    EXPECT_TRUE(action_ptr);
-
-    auto move_action = std::dynamic_pointer_cast<MoveAction>(action_ptr);
-    ASSERT_NE(move_action, nullptr);
-    ASSERT_TRUE(move_action->getRobot().has_value());
-    EXPECT_EQ(0, move_action->getRobot()->id());
-    EXPECT_EQ(Point(1, 0), move_action->getDestination());
-    EXPECT_EQ(Angle::quarter(), move_action->getFinalOrientation());
-    EXPECT_EQ(1.0, move_action->getFinalSpeed());
+    auto intent = tactic.get(robot, world);
+
+    // Check an intent was returned (the pointer is not null)
+    ASSERT_TRUE(intent);
+    EXPECT_FALSE(tactic.done());
+
+    auto move_intent = dynamic_cast<MoveIntent*>(intent.get());
+    ASSERT_NE(move_intent, nullptr);
+    EXPECT_EQ(0, move_intent->getRobotId());
+    EXPECT_EQ(Point(1, 0), move_intent->getDestination());
+    EXPECT_EQ(Angle::quarter(), move_intent->getFinalAngle());
+    EXPECT_EQ(1.0, move_intent->getFinalSpeed());
 }
 
 TEST(MoveTacticTest, robot_at_destination)
@@ -2,9 +2,9 @@
 
 #include <gtest/gtest.h>
 
-#include "software/ai/hl/stp/action/stop_action.h"
 #include "software/ai/intent/stop_intent.h"
 #include "software/test_util/test_util.h"
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
 
 TEST(StopTacticTest, robot_stopping_without_coasting_while_already_moving)
 {
@@ -13,19 +13,16 @@ TEST(StopTacticTest, robot_stopping_without_coasting_while_already_moving)
     Robot robot       = Robot(0, Point(0, 0), Vector(2, -1), Angle::zero(),
                         AngularVelocity::zero(), Timestamp::fromSeconds(0));
     StopTactic tactic = StopTactic(false);
-    tactic.updateRobot(robot);
-    tactic.updateWorldParams(world);
 
-    auto action_ptr = tactic.getNextAction();
+    auto intent = tactic.get(robot, world);
 
     // Check an intent was returned (the pointer is not null)
-    ASSERT_TRUE(action_ptr);
+    ASSERT_TRUE(intent);
     EXPECT_FALSE(tactic.done());
 
-    auto stop_action = std::dynamic_pointer_cast<StopAction>(action_ptr);
-    ASSERT_NE(nullptr, stop_action);
-    ASSERT_TRUE(stop_action->getRobot().has_value());
-    EXPECT_EQ(0, stop_action->getRobot()->id());
+    auto stop_intent = dynamic_cast<StopIntent*>(intent.get());
+    ASSERT_NE(nullptr, stop_intent);
+    EXPECT_EQ(0, stop_intent->getRobotId());
 }
 
 TEST(StopTacticTest, robot_stopping_while_already_stopped)
@@ -35,19 +32,32 @@ TEST(StopTacticTest, robot_stopping_while_already_stopped)
     Robot robot       = Robot(0, Point(0, 0), Vector(0, 0), Angle::zero(),
                         AngularVelocity::zero(), Timestamp::fromSeconds(0));
     StopTactic tactic = StopTactic(false);
-    tactic.updateRobot(robot);
-    tactic.updateWorldParams(world);
 
-    auto action_ptr = tactic.getNextAction();
+    auto intent = tactic.get(robot, world);
 
     // Check an intent was returned (the pointer is not null)
-    ASSERT_TRUE(action_ptr);
-    EXPECT_FALSE(tactic.done());
+    ASSERT_TRUE(intent);
+    EXPECT_TRUE(tactic.done());
+
+    auto stop_intent = dynamic_cast<StopIntent*>(intent.get());
+    ASSERT_NE(nullptr, stop_intent);
+    EXPECT_EQ(0, stop_intent->getRobotId());
+}
+
+TEST(StopTacticTest, test_get_does_not_allocate_coroutine_stack)
+{
+    // STP creates a new StopTactic for every unassigned robot on every tick, so getting
+    // its intent must not allocate a coroutine stack
+    World world              = ::TestUtil::createBlankTestingWorld();
+    Robot robot              = Robot(0, Point(0, 0), Vector(2, -1), Angle::zero(),
+                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    size_t num_stacks_in_use = CoroutineStackAllocator::getNumStacksInUse();
+
+    StopTactic tactic = StopTactic(false);
+    EXPECT_TRUE(tactic.get(robot, world));
+    EXPECT_TRUE(tactic.get(robot, world));
 
-    auto stop_action = std::dynamic_pointer_cast<StopAction>(action_ptr);
-    ASSERT_NE(nullptr, stop_action);
-    ASSERT_TRUE(stop_action->getRobot().has_value());
-    EXPECT_EQ(0, stop_action->getRobot()->id());
+    EXPECT_EQ(num_stacks_in_use, CoroutineStackAllocator::getNumStacksInUse());
 }
 
 TEST(StopTacticTest, test_calculate_robot_cost)
@@ -2,10 +2,11 @@
 
 #include "software/ai/intent/stop_intent.h"
 #include "software/logger/logger.h"
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
 #include "software/util/typename/typename.h"
 
 Tactic::Tactic(bool loop_forever, const std::set<RobotCapability> &capability_reqs_)
-    : action_sequence(boost::bind(&Tactic::calculateNextActionWrapper, this, _1)),
+    : action_sequence(std::nullopt),
       done_(false),
       intent(),
       loop_forever(loop_forever),
@@ -51,9 +52,8 @@ std::shared_ptr<Action> Tactic::getNextAction(void)
         if (done_ && loop_forever)
         {
             // Re-start the action sequence by re-creating it
-            action_sequence = ActionCoroutine::pull_type(
-                boost::bind(&Tactic::calculateNextActionWrapper, this, _1));
-            next_action = getNextActionHelper();
+            action_sequence = std::nullopt;
+            next_action     = getNextActionHelper();
         }
     }
 
@@ -73,23 +73,34 @@ void Tactic::calculateNextActionWrapper(ActionCoroutine::push_type &yield)
     calculateNextAction(yield);
 }
 
+void Tactic::calculateNextAction(ActionCoroutine::push_type &yield) {}
+
 std::shared_ptr<Action> Tactic::getNextActionHelper()
 {
+    // The coroutine is only created the first time an Action is requested, so Tactics
+    // that never use it (such as the FSM tactics) never allocate a stack for it
+    if (!action_sequence)
+    {
+        action_sequence.emplace(
+            CoroutineStackAllocator(),
+            boost::bind(&Tactic::calculateNextActionWrapper, this, _1));
+    }
+
     std::shared_ptr<Action> next_action = nullptr;
     // Check the coroutine status to see if it has any more work to do.
-    if (action_sequence)
+    if (*action_sequence)
     {
         // Run the coroutine. This will call the bound calculateNextAction function
-        action_sequence();
+        (*action_sequence)();
 
         // Check if the coroutine is still valid before getting the result. This makes
         // sure we don't try get the result after "running out the bottom" of the
         // coroutine function
-        if (action_sequence)
+        if (*action_sequence)
         {
             // Extract the result from the coroutine. This will be whatever value was
             // yielded by the calculateNextAction function
-            next_action = action_sequence.get();
+            next_action = action_sequence->get();
         }
     }
 
@@ -182,15 +182,19 @@ class Tactic
      * Tactic. If the Tactic is done, a nullptr is returned. This yield happens in place
      * of a return
      *
+     * Tactics that have been ported to an FSM set their intent in updateIntent instead,
+     * so by default no Actions are yielded
+     *
      * @param yield The coroutine push_type for the Tactic
      */
-    virtual void calculateNextAction(ActionCoroutine::push_type &yield) = 0;
+    virtual void calculateNextAction(ActionCoroutine::push_type &yield);
 
     // TODO (#1888): remove this function
     /**
      * A helper function that runs the action_sequence coroutine and returns the result
-     * of the coroutine. The done_ member variable is also updated to reflect whether
-     * or not the Tactic is done. If the Tactic is done, a nullptr is returned.
+     * of the coroutine, creating the coroutine first if it doesn't exist yet. The done_
+     * member variable is also updated to reflect whether or not the Tactic is done. If
+     * the Tactic is done, a nullptr is returned.
      *
      * @return the next Action this Tactic wants to run. If the Tactic is done, a nullptr
      * is returned
@@ -198,8 +202,10 @@ class Tactic
     std::shared_ptr<Action> getNextActionHelper();
 
     // TODO (#1888): remove this field
-    // The coroutine that sequentially returns the Actions the Tactic wants to run
-    ActionCoroutine::pull_type action_sequence;
+    // The coroutine that sequentially returns the Actions the Tactic wants to run. This
+    // is std::nullopt until the first Action is requested, since creating the coroutine
+    // allocates a stack for it
+    std::optional<ActionCoroutine::pull_type> action_sequence;
 
     // TODO (#1888): remove this field
     // Whether or not this Tactic is done
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "software/ai/hl/stp/tactic/test_tactics/move_test_tactic.h"
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
 
 /**
  * This file contains the unit tests for the Tactic class (NOTE: `Tactic` is virtual, so
@@ -131,3 +132,19 @@ TEST(TacticTest, test_tactic_restarts_when_set_to_loop_infinitely)
         EXPECT_FALSE(tactic.done());
     }
 }
+
+TEST(TacticTest, test_coroutine_stack_not_allocated_until_first_action_requested)
+{
+    size_t initial_num_stacks = CoroutineStackAllocator::getNumStacksInUse();
+
+    MoveTestTactic tactic = MoveTestTactic();
+    tactic.updateControlParams(Point(1, 0));
+    EXPECT_EQ(initial_num_stacks, CoroutineStackAllocator::getNumStacksInUse());
+
+    tactic.updateRobot(Robot(1, Point(0, 0), Vector(), Angle::zero(),
+                             AngularVelocity::zero(), Timestamp::fromSeconds(0)));
+    auto action = tactic.getNextAction();
+
+    EXPECT_TRUE(action);
+    EXPECT_GT(CoroutineStackAllocator::getNumStacksInUse(), initial_num_stacks);
+}
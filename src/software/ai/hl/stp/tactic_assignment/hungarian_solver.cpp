@@ -0,0 +1,156 @@
+#include "software/ai/hl/stp/tactic_assignment/hungarian_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    // How far an assigned cell can be from tight (its row and column potentials summing
+    // to its cost) and still be kept from the initial assignment, to allow for floating
+    // point error
+    constexpr double TIGHT_CELL_TOLERANCE = 1e-9;
+
+    // Marks a row or column that is not assigned
+    constexpr size_t UNASSIGNED = std::numeric_limits<size_t>::max();
+}  // namespace
+
+HungarianSolution solveAssignmentProblem(
+    const Eigen::MatrixXd& costs,
+    const std::vector<std::optional<size_t>>& initial_row_to_col,
+    const Eigen::VectorXd& initial_row_potentials)
+{
+    if (costs.rows() != costs.cols())
+    {
+        throw std::invalid_argument(
+            "The cost matrix of an assignment problem must be square, given " +
+            std::to_string(costs.rows()) + "x" + std::to_string(costs.cols()));
+    }
+    const auto n = static_cast<size_t>(costs.rows());
+    if (!initial_row_to_col.empty() && initial_row_to_col.size() != n)
+    {
+        throw std::invalid_argument(
+            "The initial assignment must have one entry per row of the cost matrix");
+    }
+    if (initial_row_potentials.size() != 0 &&
+        static_cast<size_t>(initial_row_potentials.size()) != n)
+    {
+        throw std::invalid_argument(
+            "The initial row potentials must have one entry per row of the cost matrix");
+    }
+
+    Eigen::VectorXd row_potentials = initial_row_potentials.size() == 0
+                                         ? Eigen::VectorXd::Zero(costs.rows())
+                                         : initial_row_potentials;
+    // The columns have an extra entry for a dummy column at index n, which is where
+    // the search for each augmenting path starts from
+    Eigen::VectorXd col_potentials(n + 1);
+    col_potentials(n) = 0;
+
+    // Make the potentials feasible for the current costs by lowering each column
+    // potential as little as needed. If the costs didn't change since the initial row
+    // potentials were found, this gives back the same column potentials
+    for (size_t col = 0; col < n; col++)
+    {
+        col_potentials(col) = (costs.col(col) - row_potentials).minCoeff();
+    }
+
+    std::vector<size_t> col_to_row(n + 1, UNASSIGNED);
+    std::vector<size_t> unassigned_rows;
+    for (size_t row = 0; row < n; row++)
+    {
+        std::optional<size_t> col =
+            initial_row_to_col.empty() ? std::nullopt : initial_row_to_col[row];
+        // A cell can only be kept if it is tight, since every assigned cell of an
+        // optimal solution is
+        if (col && *col < n && col_to_row[*col] == UNASSIGNED &&
+            std::abs(costs(row, *col) - row_potentials(row) - col_potentials(*col)) <=
+                TIGHT_CELL_TOLERANCE)
+        {
+            col_to_row[*col] = row;
+        }
+        else
+        {
+            unassigned_rows.emplace_back(row);
+        }
+    }
+
+    // For each unassigned row, search for the shortest augmenting path from it to an
+    // unassigned column using Dijkstra's algorithm, where the reduced costs
+    // costs(row, col) - row_potentials(row) - col_potentials(col) are the edge weights.
+    // The potentials are updated as the search goes so that every assigned cell stays
+    // tight, and then the assignments are shifted along the path
+    std::vector<double> min_reduced_cost(n + 1);
+    std::vector<size_t> previous_col(n + 1);
+    std::vector<bool> visited(n + 1);
+    for (size_t row : unassigned_rows)
+    {
+        std::fill(min_reduced_cost.begin(), min_reduced_cost.end(),
+                  std::numeric_limits<double>::infinity());
+        std::fill(visited.begin(), visited.end(), false);
+
+        size_t current_col      = n;
+        col_to_row[current_col] = row;
+        do
+        {
+            visited[current_col]     = true;
+            const size_t current_row = col_to_row[current_col];
+            double delta             = std::numeric_limits<double>::infinity();
+            size_t next_col          = UNASSIGNED;
+            for (size_t col = 0; col < n; col++)
+            {
+                if (visited[col])
+                {
+                    continue;
+                }
+                const double reduced_cost = costs(current_row, col) -
+                                            row_potentials(current_row) -
+                                            col_potentials(col);
+                if (reduced_cost < min_reduced_cost[col])
+                {
+                    min_reduced_cost[col] = reduced_cost;
+                    previous_col[col]     = current_col;
+                }
+                if (min_reduced_cost[col] < delta)
+                {
+                    delta    = min_reduced_cost[col];
+                    next_col = col;
+                }
+            }
+            for (size_t col = 0; col <= n; col++)
+            {
+                if (visited[col])
+                {
+                    row_potentials(col_to_row[col]) += delta;
+                    col_potentials(col) -= delta;
+                }
+                else
+                {
+                    min_reduced_cost[col] -= delta;
+                }
+            }
+            current_col = next_col;
+        } while (col_to_row[current_col] != UNASSIGNED);
+
+        // Shift the assignments back along the path to the dummy column
+        do
+        {
+            const size_t col        = previous_col[current_col];
+            col_to_row[current_col] = col_to_row[col];
+            current_col             = col;
+        } while (current_col != n);
+    }
+
+    HungarianSolution solution;
+    solution.row_to_col.resize(n);
+    for (size_t col = 0; col < n; col++)
+    {
+        solution.row_to_col[col_to_row[col]] = col;
+    }
+    solution.row_potentials    = row_potentials;
+    solution.col_potentials    = col_potentials.head(costs.cols());
+    solution.num_augmentations = unassigned_rows.size();
+    return solution;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <optional>
+#include <vector>
+
+/**
+ * The optimal solution to an assignment problem, along with the dual variables
+ * ("potentials") that prove it is optimal. The potentials can be used to warm start
+ * solving a similar assignment problem.
+ */
+struct HungarianSolution
+{
+    // The column assigned to each row
+    std::vector<size_t> row_to_col;
+    // The potentials of the rows and columns. For every row i and column j,
+    // row_potentials(i) + col_potentials(j) <= costs(i, j), with equality if j is
+    // assigned to i
+    Eigen::VectorXd row_potentials;
+    Eigen::VectorXd col_potentials;
+    // The number of rows that could not be kept from the initial assignment and had to
+    // be assigned by searching for an augmenting path
+    size_t num_augmentations;
+};
+
+/**
+ * Solves the square assignment problem for the given cost matrix, which is to assign
+ * exactly one column to each row so that the sum of the costs of the assigned cells is
+ * minimized.
+ *
+ * This is the shortest augmenting path version of the Hungarian algorithm, which can be
+ * warm started from a previous solution. The initial assignment is kept for every row
+ * whose initially assigned cell is still optimal given the initial row potentials, so
+ * only the rows whose costs changed enough to affect the assignment are searched for.
+ * Solving from scratch takes O(n^3) time, but solving again after only k rows have
+ * changed takes O(k * n^2) time.
+ *
+ * @param costs The cost of assigning each row (the rows of the matrix) to each column
+ * (the columns of the matrix)
+ * @param initial_row_to_col The column to initially assign to each row, if any. If
+ * this is empty, no rows are initially assigned. Otherwise it must have one entry per
+ * row. Columns that don't exist or were already initially assigned to an earlier row
+ * are ignored
+ * @param initial_row_potentials The row potentials to start from, usually taken from the
+ * solution to a previous similar problem. If this is empty, all the row potentials
+ * start at 0. Otherwise it must have one entry per row
+ *
+ * @throws std::invalid_argument if costs is not square, or the initial assignment or
+ * row potentials are the wrong size
+ *
+ * @return the optimal solution to the assignment problem
+ */
+HungarianSolution solveAssignmentProblem(
+    const Eigen::MatrixXd& costs,
+    const std::vector<std::optional<size_t>>& initial_row_to_col = {},
+    const Eigen::VectorXd& initial_row_potentials                = Eigen::VectorXd());
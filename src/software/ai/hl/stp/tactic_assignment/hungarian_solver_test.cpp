@@ -0,0 +1,204 @@
+#include "software/ai/hl/stp/tactic_assignment/hungarian_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+/**
+ * Finds the minimum total cost of any assignment by trying all of them
+ *
+ * @param costs The square cost matrix
+ *
+ * @return the minimum total cost of any assignment
+ */
+double bruteForceMinimumCost(const Eigen::MatrixXd& costs)
+{
+    std::vector<size_t> row_to_col(static_cast<size_t>(costs.rows()));
+    std::iota(row_to_col.begin(), row_to_col.end(), 0);
+    double min_cost = std::numeric_limits<double>::infinity();
+    do
+    {
+        double cost = 0;
+        for (size_t row = 0; row < row_to_col.size(); row++)
+        {
+            cost += costs(row, row_to_col[row]);
+        }
+        min_cost = std::min(min_cost, cost);
+    } while (std::next_permutation(row_to_col.begin(), row_to_col.end()));
+    return min_cost;
+}
+
+/**
+ * Returns the total cost of the given assignment
+ *
+ * @param costs The square cost matrix
+ * @param row_to_col The column assigned to each row
+ *
+ * @return the total cost of the given assignment
+ */
+double totalCost(const Eigen::MatrixXd& costs, const std::vector<size_t>& row_to_col)
+{
+    double cost = 0;
+    for (size_t row = 0; row < row_to_col.size(); row++)
+    {
+        cost += costs(row, row_to_col[row]);
+    }
+    return cost;
+}
+
+/**
+ * Checks that the solution is a valid assignment, and that its potentials prove that
+ * it is optimal for the given costs
+ *
+ * @param costs The square cost matrix
+ * @param solution The solution to check
+ */
+void expectValidOptimalSolution(const Eigen::MatrixXd& costs,
+                                const HungarianSolution& solution)
+{
+    const auto n = static_cast<size_t>(costs.rows());
+    ASSERT_EQ(n, solution.row_to_col.size());
+    std::vector<size_t> cols = solution.row_to_col;
+    std::sort(cols.begin(), cols.end());
+    for (size_t i = 0; i < n; i++)
+    {
+        EXPECT_EQ(i, cols[i]);
+    }
+
+    for (size_t row = 0; row < n; row++)
+    {
+        for (size_t col = 0; col < n; col++)
+        {
+            double slack = costs(row, col) - solution.row_potentials(row) -
+                           solution.col_potentials(col);
+            EXPECT_GE(slack, -1e-9);
+            if (solution.row_to_col[row] == col)
+            {
+                EXPECT_NEAR(0.0, slack, 1e-9);
+            }
+        }
+    }
+}
+
+TEST(HungarianSolverTest, empty_cost_matrix)
+{
+    HungarianSolution solution = solveAssignmentProblem(Eigen::MatrixXd(0, 0));
+    EXPECT_TRUE(solution.row_to_col.empty());
+    EXPECT_EQ(0, solution.num_augmentations);
+}
+
+TEST(HungarianSolverTest, non_square_cost_matrix_throws)
+{
+    EXPECT_THROW(solveAssignmentProblem(Eigen::MatrixXd::Zero(2, 3)),
+                 std::invalid_argument);
+}
+
+TEST(HungarianSolverTest, initial_assignment_wrong_size_throws)
+{
+    EXPECT_THROW(solveAssignmentProblem(Eigen::MatrixXd::Zero(2, 2), {0}),
+                 std::invalid_argument);
+}
+
+TEST(HungarianSolverTest, solves_small_assignment_problem)
+{
+    Eigen::MatrixXd costs(3, 3);
+    costs << 4, 1, 3,  //
+        2, 0, 5,       //
+        3, 2, 2;
+
+    HungarianSolution solution = solveAssignmentProblem(costs);
+
+    EXPECT_EQ((std::vector<size_t>{1, 0, 2}), solution.row_to_col);
+    EXPECT_DOUBLE_EQ(5.0, totalCost(costs, solution.row_to_col));
+    expectValidOptimalSolution(costs, solution);
+}
+
+TEST(HungarianSolverTest, solves_random_assignment_problems_optimally)
+{
+    std::mt19937 random_number_generator(1);
+    std::uniform_real_distribution<double> cost_distribution(-1.0, 10.0);
+
+    for (int size = 1; size <= 7; size++)
+    {
+        for (int trial = 0; trial < 20; trial++)
+        {
+            Eigen::MatrixXd costs = Eigen::MatrixXd::NullaryExpr(
+                size, size, [&]() { return cost_distribution(random_number_generator); });
+
+            HungarianSolution solution = solveAssignmentProblem(costs);
+
+            EXPECT_NEAR(bruteForceMinimumCost(costs),
+                        totalCost(costs, solution.row_to_col), 1e-9);
+            expectValidOptimalSolution(costs, solution);
+        }
+    }
+}
+
+TEST(HungarianSolverTest, warm_start_with_unchanged_costs_needs_no_augmentations)
+{
+    std::mt19937 random_number_generator(2);
+    std::uniform_real_distribution<double> cost_distribution(0.0, 1.0);
+    Eigen::MatrixXd costs = Eigen::MatrixXd::NullaryExpr(
+        16, 16, [&]() { return cost_distribution(random_number_generator); });
+
+    HungarianSolution cold_solution = solveAssignmentProblem(costs);
+    EXPECT_EQ(16, cold_solution.num_augmentations);
+
+    std::vector<std::optional<size_t>> initial_row_to_col(
+        cold_solution.row_to_col.begin(), cold_solution.row_to_col.end());
+    HungarianSolution warm_solution =
+        solveAssignmentProblem(costs, initial_row_to_col, cold_solution.row_potentials);
+
+    EXPECT_EQ(0, warm_solution.num_augmentations);
+    EXPECT_EQ(cold_solution.row_to_col, warm_solution.row_to_col);
+    expectValidOptimalSolution(costs, warm_solution);
+}
+
+TEST(HungarianSolverTest, warm_start_after_costs_change_is_optimal)
+{
+    std::mt19937 random_number_generator(3);
+    std::uniform_real_distribution<double> cost_distribution(0.0, 1.0);
+    std::uniform_real_distribution<double> change_distribution(-0.2, 0.2);
+    std::uniform_int_distribution<int> row_distribution(0, 6);
+
+    Eigen::MatrixXd costs = Eigen::MatrixXd::NullaryExpr(
+        7, 7, [&]() { return cost_distribution(random_number_generator); });
+    HungarianSolution solution = solveAssignmentProblem(costs);
+
+    for (int tick = 0; tick < 50; tick++)
+    {
+        // Change the costs of a single row, like when one robot moves
+        int row = row_distribution(random_number_generator);
+        for (int col = 0; col < costs.cols(); col++)
+        {
+            costs(row, col) += change_distribution(random_number_generator);
+        }
+
+        std::vector<std::optional<size_t>> initial_row_to_col(solution.row_to_col.begin(),
+                                                              solution.row_to_col.end());
+        solution =
+            solveAssignmentProblem(costs, initial_row_to_col, solution.row_potentials);
+
+        EXPECT_NEAR(bruteForceMinimumCost(costs), totalCost(costs, solution.row_to_col),
+                    1e-9);
+        expectValidOptimalSolution(costs, solution);
+    }
+}
+
+TEST(HungarianSolverTest, invalid_initial_assignment_is_ignored)
+{
+    Eigen::MatrixXd costs(3, 3);
+    costs << 4, 1, 3,  //
+        2, 0, 5,       //
+        3, 2, 2;
+
+    // Columns that don't exist or are initially assigned to more than one row are
+    // ignored, and the solution is still optimal
+    HungarianSolution solution =
+        solveAssignmentProblem(costs, {std::optional<size_t>(7), 0, 0});
+
+    EXPECT_EQ((std::vector<size_t>{1, 0, 2}), solution.row_to_col);
+    expectValidOptimalSolution(costs, solution);
+}
@@ -0,0 +1,107 @@
+#include "software/ai/hl/stp/tactic_assignment/robot_tactic_assigner.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "software/ai/hl/stp/tactic_assignment/hungarian_solver.h"
+#include "software/world/robot_capabilities.h"
+
+RobotTacticAssigner::RobotTacticAssigner(
+    std::shared_ptr<const RobotTacticAssignmentConfig> config)
+    : config(config), previous_assignments(), num_reassigned_robots(0)
+{
+}
+
+std::map<std::shared_ptr<const Tactic>, Robot> RobotTacticAssigner::assign(
+    const World& world, const std::vector<Robot>& robots,
+    const std::vector<std::shared_ptr<const Tactic>>& tactics)
+{
+    if (robots.size() != tactics.size())
+    {
+        throw std::invalid_argument(
+            "RobotTacticAssigner must be given the same number of robots and tactics");
+    }
+    const size_t n = robots.size();
+
+    // Convert the capabilities to flags once per robot and tactic, rather than taking
+    // the difference of two sets for every robot and tactic pair. A robot is missing a
+    // capability required by a tactic if it is one of the robot's unavailable ones
+    std::vector<RobotCapabilityFlags> unavailable_capabilities(n);
+    std::vector<RobotCapabilityFlags> required_capabilities(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        unavailable_capabilities[i] =
+            toRobotCapabilityFlags(robots[i].getUnavailableCapabilities());
+        required_capabilities[i] =
+            toRobotCapabilityFlags(tactics[i]->robotCapabilityRequirements());
+    }
+
+    // The rows of the matrix are the "workers" (the robots) and the columns are the
+    // "jobs" (the Tactics)
+    Eigen::MatrixXd costs(n, n);
+    for (size_t row = 0; row < n; row++)
+    {
+        for (size_t col = 0; col < n; col++)
+        {
+            costs(row, col) = tactics[col]->calculateRobotCost(robots[row], world);
+            if ((required_capabilities[col] & unavailable_capabilities[row]).any())
+            {
+                costs(row, col) += MISSING_CAPABILITY_COST;
+            }
+        }
+    }
+
+    // Start from the previous assignment of each robot, preferring the tactic it was
+    // assigned to over the tactic at the same index
+    const double hysteresis_cost = config->getHysteresisCost()->value();
+    std::vector<std::optional<size_t>> initial_row_to_col(n);
+    Eigen::VectorXd initial_row_potentials = Eigen::VectorXd::Zero(n);
+    for (size_t row = 0; row < n; row++)
+    {
+        auto iter = previous_assignments.find(robots[row].id());
+        if (iter == previous_assignments.end())
+        {
+            continue;
+        }
+
+        const PreviousAssignment& previous = iter->second;
+        auto previous_tactic               = previous.tactic.lock();
+        auto tactic_iter =
+            previous_tactic ? std::find(tactics.begin(), tactics.end(), previous_tactic)
+                            : tactics.end();
+        if (tactic_iter != tactics.end())
+        {
+            size_t col              = static_cast<size_t>(tactic_iter - tactics.begin());
+            initial_row_to_col[row] = col;
+            costs(row, col) -= hysteresis_cost;
+        }
+        else
+        {
+            initial_row_to_col[row] = previous.tactic_index;
+        }
+        initial_row_potentials(row) = previous.potential;
+    }
+
+    HungarianSolution solution =
+        solveAssignmentProblem(costs, initial_row_to_col, initial_row_potentials);
+    num_reassigned_robots = solution.num_augmentations;
+
+    std::map<std::shared_ptr<const Tactic>, Robot> robot_tactic_assignment;
+    previous_assignments.clear();
+    for (size_t row = 0; row < n; row++)
+    {
+        size_t col = solution.row_to_col[row];
+        robot_tactic_assignment.emplace(tactics[col], robots[row]);
+        previous_assignments.emplace(
+            robots[row].id(),
+            PreviousAssignment{.tactic       = tactics[col],
+                               .tactic_index = col,
+                               .potential    = solution.row_potentials(row)});
+    }
+    return robot_tactic_assignment;
+}
+
+size_t RobotTacticAssigner::getNumReassignedRobots() const
+{
+    return num_reassigned_robots;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "software/ai/hl/stp/tactic/tactic.h"
+#include "software/parameter/dynamic_parameters.h"
+#include "software/world/world.h"
+
+/**
+ * The RobotTacticAssigner assigns robots to tactics so that the total cost of the
+ * assignment is minimized, using the Hungarian algorithm.
+ *
+ * Since the robots and tactics usually barely change from one tick to the next, each
+ * assignment is warm started from the previous one. Robots whose costs didn't change
+ * enough to affect the assignment keep their tactic without being searched for, so
+ * reassigning the same robots and tactics is much cheaper than solving from scratch.
+ *
+ * To stop robots from swapping tactics back and forth when their costs are almost the
+ * same, the cost of keeping each robot on the tactic it was assigned last time can be
+ * lowered by a configurable hysteresis cost.
+ */
+class RobotTacticAssigner
+{
+   public:
+    /**
+     * Creates a new RobotTacticAssigner
+     *
+     * @param config The config for the assignment
+     */
+    explicit RobotTacticAssigner(
+        std::shared_ptr<const RobotTacticAssignmentConfig> config =
+            std::make_shared<const RobotTacticAssignmentConfig>());
+
+    /**
+     * Assigns each of the given robots to one of the given tactics, minimizing the total
+     * cost of the assignment. The cost of assigning a robot to a tactic is the tactic's
+     * cost for the robot, with a large penalty if the robot doesn't have all the
+     * capabilities the tactic requires.
+     *
+     * @param world The state of the world for calculating robot costs
+     * @param robots The robots to assign
+     * @param tactics The tactics to assign the robots to
+     *
+     * @throws std::invalid_argument if the number of robots and tactics are different
+     *
+     * @return map from each tactic to the robot assigned to it
+     */
+    std::map<std::shared_ptr<const Tactic>, Robot> assign(
+        const World& world, const std::vector<Robot>& robots,
+        const std::vector<std::shared_ptr<const Tactic>>& tactics);
+
+    /**
+     * Returns the number of robots that could not keep their tactic from the previous
+     * assignment and had to be reassigned in the last call to assign
+     *
+     * @return the number of robots that were reassigned in the last assignment
+     */
+    size_t getNumReassignedRobots() const;
+
+   private:
+    // The cost added for assigning a robot to a tactic when the robot doesn't have all
+    // the capabilities the tactic requires. This is larger than the cost of any robot
+    // for any tactic, so capable robots are always preferred
+    static constexpr double MISSING_CAPABILITY_COST = 10.0;
+
+    // What is remembered about a robot's assignment to warm start the next one
+    struct PreviousAssignment
+    {
+        std::weak_ptr<const Tactic> tactic;
+        // The index of the tactic in the tactics that were assigned, used as the
+        // initial assignment if the tactic is not assigned again
+        size_t tactic_index;
+        // The potential of the robot's row in the solution to the assignment problem
+        double potential;
+    };
+
+    std::shared_ptr<const RobotTacticAssignmentConfig> config;
+    std::map<RobotId, PreviousAssignment> previous_assignments;
+    size_t num_reassigned_robots;
+};
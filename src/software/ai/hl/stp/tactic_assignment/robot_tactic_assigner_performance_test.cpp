@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <munkres/munkres.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include "software/ai/hl/stp/tactic/test_tactics/move_test_tactic.h"
+#include "software/ai/hl/stp/tactic_assignment/robot_tactic_assigner.h"
+#include "software/test_util/test_util.h"
+
+/**
+ * Assigns robots to tactics the way STP used to, by building the cost matrix with a
+ * set difference of capabilities for every cell and solving it from scratch with
+ * munkres-cpp
+ *
+ * @param world The state of the world for calculating robot costs
+ * @param robots The robots to assign
+ * @param tactics The tactics to assign the robots to, the same number as the robots
+ *
+ * @return map from each tactic to the robot assigned to it
+ */
+std::map<std::shared_ptr<const Tactic>, Robot> assignWithMunkres(
+    const World& world, const std::vector<Robot>& robots,
+    const std::vector<std::shared_ptr<const Tactic>>& tactics)
+{
+    Matrix<double> matrix(robots.size(), tactics.size());
+    for (size_t row = 0; row < robots.size(); row++)
+    {
+        for (size_t col = 0; col < tactics.size(); col++)
+        {
+            Robot robot                                 = robots.at(row);
+            const std::shared_ptr<const Tactic>& tactic = tactics.at(col);
+            double robot_cost_for_tactic = tactic->calculateRobotCost(robot, world);
+
+            std::set<RobotCapability> required_capabilities =
+                tactic->robotCapabilityRequirements();
+            std::set<RobotCapability> robot_capabilities =
+                robot.getAvailableCapabilities();
+            std::set<RobotCapability> missing_capabilities;
+            std::set_difference(
+                required_capabilities.begin(), required_capabilities.end(),
+                robot_capabilities.begin(), robot_capabilities.end(),
+                std::inserter(missing_capabilities, missing_capabilities.begin()));
+
+            matrix(row, col) =
+                robot_cost_for_tactic + (missing_capabilities.empty() ? 0.0 : 10.0);
+        }
+    }
+
+    Munkres<double> m;
+    m.solve(matrix);
+
+    std::map<std::shared_ptr<const Tactic>, Robot> assignment;
+    for (size_t row = 0; row < robots.size(); row++)
+    {
+        for (size_t col = 0; col < tactics.size(); col++)
+        {
+            if (matrix(row, col) == 0)
+            {
+                assignment.emplace(tactics.at(col), robots.at(row));
+                break;
+            }
+        }
+    }
+    return assignment;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(RobotTacticAssignerPerformanceTest, DISABLED_assign_16_robots_to_16_tactics)
+{
+    const unsigned int num_robots = 16;
+    const unsigned int num_ticks  = 1000;
+    // How far each robot moves between ticks, as if it was moving at 3m/s at 60Hz
+    const double max_step_meters = 0.05;
+
+    std::mt19937 random_number_generator(0);
+    std::uniform_real_distribution<double> coordinate_distribution(-4.0, 4.0);
+    std::uniform_real_distribution<double> step_distribution(-max_step_meters,
+                                                             max_step_meters);
+
+    World world = ::TestUtil::createBlankTestingWorld();
+    std::vector<Point> robot_positions;
+    std::vector<std::shared_ptr<const Tactic>> tactics;
+    for (unsigned int i = 0; i < num_robots; i++)
+    {
+        robot_positions.emplace_back(coordinate_distribution(random_number_generator),
+                                     coordinate_distribution(random_number_generator));
+        auto tactic = std::make_shared<MoveTestTactic>();
+        tactic->updateControlParams(
+            Point(coordinate_distribution(random_number_generator),
+                  coordinate_distribution(random_number_generator)));
+        tactics.emplace_back(tactic);
+    }
+
+    // Precompute the robots on every tick so that all the assigners see the same ones
+    std::vector<std::vector<Robot>> robots_per_tick;
+    for (unsigned int tick = 0; tick < num_ticks; tick++)
+    {
+        std::vector<Robot> robots;
+        for (RobotId id = 0; id < num_robots; id++)
+        {
+            robot_positions[id] += Vector(step_distribution(random_number_generator),
+                                          step_distribution(random_number_generator));
+            robots.emplace_back(id, robot_positions[id], Vector(), Angle::zero(),
+                                AngularVelocity::zero(), Timestamp::fromSeconds(0));
+        }
+        robots_per_tick.emplace_back(robots);
+    }
+
+    auto munkres_start_time = std::chrono::steady_clock::now();
+    for (const auto& robots : robots_per_tick)
+    {
+        assignWithMunkres(world, robots, tactics);
+    }
+    auto munkres_duration = std::chrono::steady_clock::now() - munkres_start_time;
+
+    // A new assigner every tick solves from scratch
+    auto cold_start_time = std::chrono::steady_clock::now();
+    for (const auto& robots : robots_per_tick)
+    {
+        RobotTacticAssigner assigner;
+        assigner.assign(world, robots, tactics);
+    }
+    auto cold_duration = std::chrono::steady_clock::now() - cold_start_time;
+
+    RobotTacticAssigner warm_assigner;
+    size_t total_num_reassigned_robots = 0;
+    auto warm_start_time               = std::chrono::steady_clock::now();
+    for (const auto& robots : robots_per_tick)
+    {
+        warm_assigner.assign(world, robots, tactics);
+        total_num_reassigned_robots += warm_assigner.getNumReassignedRobots();
+    }
+    auto warm_duration = std::chrono::steady_clock::now() - warm_start_time;
+
+    auto microseconds_per_tick = [num_ticks](std::chrono::nanoseconds duration) {
+        return static_cast<double>(duration.count()) / 1000.0 / num_ticks;
+    };
+    std::cout << "Average time to assign " << num_robots << " robots to " << num_robots
+              << " tactics over " << num_ticks << " ticks:" << std::endl
+              << "munkres-cpp from scratch: " << microseconds_per_tick(munkres_duration)
+              << "us" << std::endl
+              << "RobotTacticAssigner from scratch: "
+              << microseconds_per_tick(cold_duration) << "us" << std::endl
+              << "RobotTacticAssigner warm started: "
+              << microseconds_per_tick(warm_duration) << "us, reassigning "
+              << static_cast<double>(total_num_reassigned_robots) / num_ticks
+              << " robots per tick on average" << std::endl;
+}
@@ -0,0 +1,165 @@
+#include "software/ai/hl/stp/tactic_assignment/robot_tactic_assigner.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/ai/hl/stp/tactic/test_tactics/move_test_tactic.h"
+#include "software/ai/hl/stp/tactic/test_tactics/stop_test_tactic.h"
+#include "software/test_util/test_util.h"
+
+class RobotTacticAssignerTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Creates a robot at the given position with all capabilities
+     *
+     * @param id The id of the robot
+     * @param position The position of the robot
+     *
+     * @return the robot
+     */
+    static Robot createRobot(RobotId id, const Point& position)
+    {
+        return Robot(id, position, Vector(), Angle::zero(), AngularVelocity::zero(),
+                     Timestamp::fromSeconds(0));
+    }
+
+    /**
+     * Creates a MoveTestTactic to the given destination
+     *
+     * @param destination The destination of the tactic
+     *
+     * @return the tactic
+     */
+    static std::shared_ptr<const Tactic> createMoveTactic(const Point& destination)
+    {
+        auto tactic = std::make_shared<MoveTestTactic>();
+        tactic->updateControlParams(destination);
+        return tactic;
+    }
+
+    World world = ::TestUtil::createBlankTestingWorld();
+};
+
+TEST_F(RobotTacticAssignerTest, different_number_of_robots_and_tactics_throws)
+{
+    RobotTacticAssigner assigner;
+    EXPECT_THROW(assigner.assign(world, {createRobot(0, Point(0, 0))}, {}),
+                 std::invalid_argument);
+}
+
+TEST_F(RobotTacticAssignerTest, no_robots_and_no_tactics)
+{
+    RobotTacticAssigner assigner;
+    EXPECT_TRUE(assigner.assign(world, {}, {}).empty());
+}
+
+TEST_F(RobotTacticAssignerTest, assigns_robots_to_minimize_total_cost)
+{
+    RobotTacticAssigner assigner;
+    // Each robot is closest to the tactic at the opposite index
+    std::vector<Robot> robots                          = {createRobot(0, Point(2, 0)),
+                                 createRobot(1, Point(-2, 0))};
+    std::vector<std::shared_ptr<const Tactic>> tactics = {createMoveTactic(Point(-2, 1)),
+                                                          createMoveTactic(Point(2, 1))};
+
+    auto assignment = assigner.assign(world, robots, tactics);
+
+    ASSERT_EQ(2, assignment.size());
+    EXPECT_EQ(1, assignment.at(tactics[0]).id());
+    EXPECT_EQ(0, assignment.at(tactics[1]).id());
+}
+
+TEST_F(RobotTacticAssignerTest, robot_missing_required_capabilities_is_not_preferred)
+{
+    RobotTacticAssigner assigner;
+    // Robot 0 is closer to the move tactic, but can't kick, which the move tactic
+    // requires
+    Robot robot_0(0, Point(0, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0), {RobotCapability::Kick});
+    std::vector<Robot> robots = {robot_0, createRobot(1, Point(3, 0))};
+    std::vector<std::shared_ptr<const Tactic>> tactics = {
+        createMoveTactic(Point(0, 0)), std::make_shared<StopTestTactic>()};
+
+    auto assignment = assigner.assign(world, robots, tactics);
+
+    EXPECT_EQ(1, assignment.at(tactics[0]).id());
+    EXPECT_EQ(0, assignment.at(tactics[1]).id());
+}
+
+TEST_F(RobotTacticAssignerTest, reassigning_unchanged_robots_and_tactics_reassigns_none)
+{
+    RobotTacticAssigner assigner;
+    std::mt19937 random_number_generator(0);
+    std::uniform_real_distribution<double> coordinate_distribution(-4.0, 4.0);
+    std::vector<Robot> robots;
+    std::vector<std::shared_ptr<const Tactic>> tactics;
+    for (RobotId id = 0; id < 16; id++)
+    {
+        robots.emplace_back(
+            createRobot(id, Point(coordinate_distribution(random_number_generator),
+                                  coordinate_distribution(random_number_generator))));
+        tactics.emplace_back(
+            createMoveTactic(Point(coordinate_distribution(random_number_generator),
+                                   coordinate_distribution(random_number_generator))));
+    }
+
+    auto first_assignment = assigner.assign(world, robots, tactics);
+    EXPECT_EQ(16, assigner.getNumReassignedRobots());
+
+    auto second_assignment = assigner.assign(world, robots, tactics);
+    EXPECT_EQ(0, assigner.getNumReassignedRobots());
+    EXPECT_EQ(first_assignment, second_assignment);
+}
+
+TEST_F(RobotTacticAssignerTest,
+       hysteresis_keeps_robots_on_their_tactics_when_costs_are_close)
+{
+    RobotTacticAssigner assigner;
+    std::vector<std::shared_ptr<const Tactic>> tactics = {createMoveTactic(Point(0, 0)),
+                                                          createMoveTactic(Point(1, 0))};
+    auto assignment                                    = assigner.assign(
+        world, {createRobot(0, Point(0, 0)), createRobot(1, Point(1, 0))}, tactics);
+    EXPECT_EQ(0, assignment.at(tactics[0]).id());
+    EXPECT_EQ(1, assignment.at(tactics[1]).id());
+
+    // The robots have just passed each other, so swapping their tactics is only
+    // slightly cheaper than keeping them
+    assignment = assigner.assign(
+        world, {createRobot(0, Point(0.55, 0)), createRobot(1, Point(0.45, 0))}, tactics);
+    EXPECT_EQ(0, assignment.at(tactics[0]).id());
+    EXPECT_EQ(1, assignment.at(tactics[1]).id());
+}
+
+TEST_F(RobotTacticAssignerTest, no_hysteresis_swaps_robots_when_slightly_cheaper)
+{
+    auto config = std::make_shared<RobotTacticAssignmentConfig>();
+    config->getMutableHysteresisCost()->setValue(0.0);
+    RobotTacticAssigner assigner(config);
+    std::vector<std::shared_ptr<const Tactic>> tactics = {createMoveTactic(Point(0, 0)),
+                                                          createMoveTactic(Point(1, 0))};
+    auto assignment                                    = assigner.assign(
+        world, {createRobot(0, Point(0, 0)), createRobot(1, Point(1, 0))}, tactics);
+    EXPECT_EQ(0, assignment.at(tactics[0]).id());
+    EXPECT_EQ(1, assignment.at(tactics[1]).id());
+
+    assignment = assigner.assign(
+        world, {createRobot(0, Point(0.55, 0)), createRobot(1, Point(0.45, 0))}, tactics);
+    EXPECT_EQ(1, assignment.at(tactics[0]).id());
+    EXPECT_EQ(0, assignment.at(tactics[1]).id());
+}
+
+TEST_F(RobotTacticAssignerTest, hysteresis_does_not_keep_robots_on_much_worse_tactics)
+{
+    RobotTacticAssigner assigner;
+    std::vector<std::shared_ptr<const Tactic>> tactics = {createMoveTactic(Point(0, 0)),
+                                                          createMoveTactic(Point(4, 0))};
+    assigner.assign(world, {createRobot(0, Point(0, 0)), createRobot(1, Point(4, 0))},
+                    tactics);
+
+    auto assignment = assigner.assign(
+        world, {createRobot(0, Point(4, 0)), createRobot(1, Point(0, 0))}, tactics);
+    EXPECT_EQ(1, assignment.at(tactics[0]).id());
+    EXPECT_EQ(0, assignment.at(tactics[1]).id());
+}
@@ -45,7 +45,7 @@ void NavigatingPrimitiveCreator::visit(const AutokickMoveIntent &intent)
 }
 
 std::pair<Point, double> NavigatingPrimitiveCreator::calculateDestinationAndFinalSpeed(
-    double final_speed, Path path,
+    double final_speed, const Path &path,
     const std::vector<ObstaclePtr> &enemy_robot_obstacles) const
 {
     double desired_final_speed;
@@ -91,7 +91,7 @@ class NavigatingPrimitiveCreator : public NavigatingIntentVisitor
      * @return the final destination and speed
      */
     std::pair<Point, double> calculateDestinationAndFinalSpeed(
-        double final_speed, Path path,
+        double final_speed, const Path &path,
         const std::vector<ObstaclePtr> &enemy_robot_obstacles) const;
 
     std::shared_ptr<const NavigatorConfig> config;
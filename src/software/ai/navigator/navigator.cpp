@@ -3,6 +3,7 @@
 #include "software/ai/navigator/navigating_primitive_creator.h"
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
+#include "software/metrics/metrics_registry.h"
 #include "software/proto/message_translation/tbots_protobuf.h"
 #include "software/proto/primitive/primitive_msg_factory.h"
 
@@ -24,22 +25,29 @@ void Navigator::visit(const DirectPrimitiveIntent &intent)
 
 void Navigator::visit(const MoveIntent &intent)
 {
-    navigating_intents.push_back(std::make_shared<MoveIntent>(intent));
+    navigating_intents.emplace_back(intent);
 }
 
 void Navigator::visit(const AutochipMoveIntent &intent)
 {
-    navigating_intents.push_back(std::make_shared<AutochipMoveIntent>(intent));
+    navigating_intents.emplace_back(intent);
 }
 
 void Navigator::visit(const AutokickMoveIntent &intent)
 {
-    navigating_intents.push_back(std::make_shared<AutokickMoveIntent>(intent));
+    navigating_intents.emplace_back(intent);
 }
 
 std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
     const World &world, const std::vector<std::unique_ptr<Intent>> &intents)
 {
+    static Histogram &get_assigned_primitives_time_histogram =
+        MetricsRegistry::getGlobalRegistry().getHistogram(
+            "navigator.get_assigned_primitives_time_us");
+    static Counter &paths_not_found_counter =
+        MetricsRegistry::getGlobalRegistry().getCounter("navigator.paths_not_found");
+    ScopedHistogramTimer timer(get_assigned_primitives_time_histogram);
+
     // Initialize variables
     navigating_intents.clear();
     planned_paths.clear();
@@ -59,30 +67,40 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
     auto robot_id_to_path =
         path_manager->getManagedPaths(path_objectives, navigable_area);
 
-    // Add primitives from navigating intents
+    // Add primitives from navigating intents. The enemy robot obstacles are the same
+    // for every intent, so they are only created once
     auto &robot_primitives_map = *primitive_set_msg->mutable_robot_primitives();
-    for (const auto &intent : navigating_intents)
+    NavigatingPrimitiveCreator navigating_primitive_creator(config);
+    auto enemy_robot_obstacles =
+        robot_navigation_obstacle_factory.createFromTeam(world.enemyTeam());
+    for (const NavigatingIntent &intent : navigating_intents)
     {
-        unsigned int robot_id      = intent->getRobotId();
+        unsigned int robot_id      = intent.getRobotId();
         auto robot_id_to_path_iter = robot_id_to_path.find(robot_id);
         if (robot_id_to_path_iter != robot_id_to_path.end() &&
             robot_id_to_path_iter->second)
         {
             planned_paths.push_back(robot_id_to_path_iter->second->getKnots());
             robot_primitives_map[robot_id] =
-                NavigatingPrimitiveCreator(config).createNavigatingPrimitive(
-                    *intent, *(robot_id_to_path_iter->second),
-                    robot_navigation_obstacle_factory.createFromTeam(world.enemyTeam()));
+                navigating_primitive_creator.createNavigatingPrimitive(
+                    intent, *(robot_id_to_path_iter->second), enemy_robot_obstacles);
         }
         else
         {
-            LOG(WARNING)
-                << "Navigator's path manager could not find a path for RobotId = "
-                << robot_id;
+            paths_not_found_counter.increment();
+            // This can happen every tick for every robot, so it is rate limited
+            LOG_STRUCTURED(
+                WARNING,
+                "Navigator's path manager could not find a path for RobotId = {}",
+                robot_id);
             robot_primitives_map[robot_id] = *createStopPrimitive(false);
         }
     }
 
+    // The navigating intents refer to the given intents, which may not outlive this
+    // function
+    navigating_intents.clear();
+
     return std::move(primitive_set_msg);
 }
 
@@ -111,19 +129,19 @@ std::unordered_set<PathObjective> Navigator::createPathObjectives(
         }
     }
 
-    for (const auto &intent : navigating_intents)
+    for (const NavigatingIntent &intent : navigating_intents)
     {
-        RobotId robot_id = intent->getRobotId();
+        RobotId robot_id = intent.getRobotId();
         // start with direct primitive intent robots and then add motion constraints
         auto obstacles = direct_primitive_intent_obstacles;
 
         auto motion_constraint_obstacles =
             robot_navigation_obstacle_factory.createFromMotionConstraints(
-                intent->getMotionConstraints(), world);
+                intent.getMotionConstraints(), world);
         obstacles.insert(obstacles.end(), motion_constraint_obstacles.begin(),
                          motion_constraint_obstacles.end());
 
-        if (intent->getBallCollisionType() == BallCollisionType::AVOID)
+        if (intent.getBallCollisionType() == BallCollisionType::AVOID)
         {
             obstacles.push_back(ball_obstacle);
         }
@@ -133,7 +151,7 @@ std::unordered_set<PathObjective> Navigator::createPathObjectives(
         if (robot)
         {
             Point start = robot->position();
-            Point end   = intent->getDestination();
+            Point end   = intent.getDestination();
 
             path_objectives.insert(PathObjective(start, end, robot->velocity().length(),
                                                  obstacles, robot_id));
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/ai/intent/all_intents.h"
 #include "software/ai/intent/intent.h"
@@ -80,7 +82,9 @@ class Navigator : public IntentVisitor
     std::unique_ptr<PathManager> path_manager;
 
     std::vector<std::vector<Point>> planned_paths;
-    std::vector<std::shared_ptr<NavigatingIntent>> navigating_intents;
+    // The navigating intents being processed by getAssignedPrimitives. These refer to
+    // the intents passed to getAssignedPrimitives, so they are only valid while it runs
+    std::vector<std::reference_wrapper<const NavigatingIntent>> navigating_intents;
     // These are the robots that were assigned direct primitive intents.
     // When navigating intents are processed to path plan, we can avoid these
     // non-navigating robots
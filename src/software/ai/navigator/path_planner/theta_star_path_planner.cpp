@@ -5,6 +5,7 @@
 #include "software/geom/algorithms/distance.h"
 #include "software/geom/algorithms/intersects.h"
 #include "software/logger/logger.h"
+#include "software/metrics/metrics_registry.h"
 
 ThetaStarPathPlanner::ThetaStarPathPlanner()
     : num_grid_rows(0),
@@ -237,14 +238,14 @@ bool ThetaStarPathPlanner::adjustEndPointsAndCheckForNoPath(Coordinate &start_co
     // If the source is out of range
     if (isCoordNavigable(start_coord) == false)
     {
-        LOG(WARNING) << "Source is not within navigable area; no path found" << std::endl;
+        LOG_STRUCTURED(WARNING, "Source is not within navigable area; no path found");
         ret_no_path = true;
     }
 
     // If the end is out of range
     if (isCoordNavigable(end_coord) == false)
     {
-        LOG(WARNING) << "End is not within navigable area; no path found" << std::endl;
+        LOG_STRUCTURED(WARNING, "End is not within navigable area; no path found");
         ret_no_path = true;
     }
 
@@ -281,6 +282,11 @@ bool ThetaStarPathPlanner::adjustEndPointsAndCheckForNoPath(Coordinate &start_co
 
 bool ThetaStarPathPlanner::findPathToEnd(const Coordinate &end_coord)
 {
+    static Histogram &node_expansions_histogram =
+        MetricsRegistry::getGlobalRegistry().getHistogram(
+            "path_planner.theta_star.node_expansions");
+
+    uint64_t num_node_expansions = 0;
     while (!open_list.empty())
     {
         Coordinate current_coord(open_list.begin()->second);
@@ -290,12 +296,15 @@ bool ThetaStarPathPlanner::findPathToEnd(const Coordinate &end_coord)
 
         // Add this vertex to the closed list
         closed_list.insert(current_coord);
+        num_node_expansions++;
 
         if (visitNeighbours(current_coord, end_coord))
         {
+            node_expansions_histogram.record(num_node_expansions);
             return true;
         }
     }
+    node_expansions_histogram.record(num_node_expansions);
 
     // When the end CellHeuristic is not found and the open list is empty, then we
     // conclude that we failed to reach the end CellHeuristic. This may happen when the
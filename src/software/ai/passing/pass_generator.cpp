@@ -5,6 +5,7 @@
 
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/pass_generator.h"
+#include "software/metrics/metrics_registry.h"
 
 PassGenerator::PassGenerator(const World& world, const Point& passer_point,
                              const PassType& pass_type, bool running_deterministically)
@@ -132,6 +133,14 @@ void PassGenerator::continuouslyGeneratePasses()
 
 void PassGenerator::updateAndOptimizeAndPrunePasses()
 {
+    static Counter& iterations_counter =
+        MetricsRegistry::getGlobalRegistry().getCounter("pass_generator.iterations");
+    static Histogram& iteration_time_histogram =
+        MetricsRegistry::getGlobalRegistry().getHistogram(
+            "pass_generator.iteration_time_us");
+    iterations_counter.increment();
+    ScopedHistogramTimer timer(iteration_time_histogram);
+
     // Copy over the updated world and remove the passer robot
     world_mutex.lock();
     updated_world_mutex.lock();
@@ -0,0 +1,203 @@
+#include <chrono>
+#include <cstdlib>
+#include <experimental/filesystem>
+#include <fstream>
+#include <iostream>
+#include <new>
+
+#include "software/ai/ai.h"
+#include "software/logger/logger.h"
+#include "software/metrics/metrics_registry.h"
+#include "software/parameter/dynamic_parameters.h"
+#include "software/proto/logging/indexed_proto_log_reader.h"
+#include "software/proto/logging/proto_log_reader.h"
+#include "software/sensor_fusion/sensor_fusion.h"
+
+/**
+ * Replays a recorded log of SensorProtos through SensorFusion and the AI as fast as
+ * possible, and reports how long each stage took and how many times each stage allocated
+ * memory per frame.
+ *
+ * The results are written in the same "<type> <name> <values>" format as the metrics the
+ * full system writes, one metric per line and sorted by name, so the results from two
+ * commits can be compared with diff. Along with the metrics recorded here, the results
+ * include every metric that the stack records in the global MetricsRegistry, like the
+ * time spent in STP and the Navigator and the number of nodes Theta* expands.
+ */
+
+namespace
+{
+    // The number of times the current thread has allocated memory with operator new.
+    // Only the thread running the benchmark is counted, so allocations made by
+    // background threads don't make the results noisy.
+    thread_local uint64_t num_thread_allocations = 0;
+
+    /**
+     * Returns the next SensorProto from a log, which can either be an indexed log file
+     * or a directory of chunks written by a ProtoLogger
+     */
+    class SensorProtoLogSource
+    {
+       public:
+        explicit SensorProtoLogSource(const std::string& replay_input_path)
+        {
+            if (std::experimental::filesystem::is_directory(replay_input_path))
+            {
+                proto_log_reader = std::make_unique<ProtoLogReader>(replay_input_path);
+            }
+            else
+            {
+                indexed_proto_log_reader =
+                    std::make_unique<IndexedProtoLogReader>(replay_input_path, true);
+            }
+        }
+
+        std::optional<SensorProto> getNextMsg()
+        {
+            if (proto_log_reader)
+            {
+                return proto_log_reader->getNextMsg<SensorProto>();
+            }
+            return indexed_proto_log_reader->getNextMsg<SensorProto>();
+        }
+
+       private:
+        std::unique_ptr<ProtoLogReader> proto_log_reader;
+        std::unique_ptr<IndexedProtoLogReader> indexed_proto_log_reader;
+    };
+
+    /**
+     * Runs a stage of the stack, and records how long it took in nanoseconds and how
+     * many times it allocated memory
+     *
+     * @param time_histogram The histogram to record the time in
+     * @param allocations_histogram The histogram to record the number of allocations in
+     * @param stage The stage to run
+     *
+     * @return the result of the stage
+     */
+    template <class Stage>
+    auto runStage(Histogram& time_histogram, Histogram& allocations_histogram,
+                  Stage stage)
+    {
+        uint64_t allocations_before = num_thread_allocations;
+        auto start_time             = std::chrono::steady_clock::now();
+
+        auto result = stage();
+
+        auto elapsed = std::chrono::steady_clock::now() - start_time;
+        time_histogram.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        allocations_histogram.record(num_thread_allocations - allocations_before);
+        return result;
+    }
+}  // namespace
+
+// Replace the global allocation functions so allocations can be counted. The
+// replacements allocate with malloc, which is what the default ones do.
+void* operator new(std::size_t size)
+{
+    num_thread_allocations++;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+int main(int argc, char** argv)
+{
+    // load command line arguments
+    auto args = MutableDynamicParameters->getMutableAiBenchmarkMainCommandLineArgs();
+    bool help_requested = args->loadFromCommandLineArguments(argc, argv);
+
+    LoggerSingleton::initializeLogger(args->getLoggingDir()->value());
+
+    if (help_requested)
+    {
+        return 0;
+    }
+
+    if (args->getReplayInputDir()->value().empty())
+    {
+        LOG(FATAL) << "The option '--replay_input_dir' is required but missing";
+    }
+
+    SensorProtoLogSource log_source(args->getReplayInputDir()->value());
+    SensorFusion sensor_fusion(DynamicParameters->getSensorFusionConfig());
+    AI ai(DynamicParameters->getAiConfig(), DynamicParameters->getAiControlConfig());
+
+    MetricsRegistry benchmark_registry;
+    Counter& num_frames = benchmark_registry.getCounter("benchmark.frames");
+    Counter& num_worlds = benchmark_registry.getCounter("benchmark.worlds");
+    Histogram& sensor_fusion_time_histogram =
+        benchmark_registry.getHistogram("benchmark.sensor_fusion.time_ns");
+    Histogram& sensor_fusion_allocations_histogram =
+        benchmark_registry.getHistogram("benchmark.sensor_fusion.allocations");
+    Histogram& ai_time_histogram =
+        benchmark_registry.getHistogram("benchmark.ai.time_ns");
+    Histogram& ai_allocations_histogram =
+        benchmark_registry.getHistogram("benchmark.ai.allocations");
+
+    auto benchmark_start_time = std::chrono::steady_clock::now();
+    while (auto sensor_msg = log_source.getNextMsg())
+    {
+        num_frames.increment();
+        std::optional<World> world = runStage(
+            sensor_fusion_time_histogram, sensor_fusion_allocations_histogram, [&]() {
+                sensor_fusion.processSensorProto(*sensor_msg);
+                return sensor_fusion.getWorld();
+            });
+
+        // The AI can only run once SensorFusion has seen enough data to create a World
+        if (world)
+        {
+            num_worlds.increment();
+            runStage(ai_time_histogram, ai_allocations_histogram,
+                     [&]() { return ai.getPrimitives(*world); });
+        }
+    }
+    std::chrono::duration<double> benchmark_duration =
+        std::chrono::steady_clock::now() - benchmark_start_time;
+    benchmark_registry.getGauge("benchmark.duration_s").set(benchmark_duration.count());
+
+    std::ofstream output_file;
+    if (!args->getOutputFile()->value().empty())
+    {
+        output_file.open(args->getOutputFile()->value(), std::ios::trunc);
+        if (!output_file.is_open())
+        {
+            LOG(FATAL) << "Could not open " << args->getOutputFile()->value();
+        }
+    }
+    std::ostream& output = output_file.is_open() ? output_file : std::cout;
+    output << benchmark_registry.getSnapshot()
+           << MetricsRegistry::getGlobalRegistry().getSnapshot();
+
+    return 0;
+}
@@ -1,14 +1,100 @@
 #include "replay_backend.h"
 
 #include <cstdlib>
+#include <experimental/filesystem>
 
 #include "software/util/design_patterns/generic_factory.h"
 
-ReplayBackend::ReplayBackend(const std::string& replay_input_dir)
-    : replay_reader(replay_input_dir),
-      pull_from_replay_thread(
-          boost::bind(&ReplayBackend::continuouslyPullFromReplayFiles, this))
+ReplayBackend::ReplayBackend(const std::string& replay_input_path,
+                             double replay_start_time_seconds,
+                             double replay_playback_speed, bool replay_paused,
+                             bool exit_when_finished)
+    : exit_when_finished(exit_when_finished)
 {
+    if (std::experimental::filesystem::is_directory(replay_input_path))
+    {
+        replay_reader           = std::make_unique<ProtoLogReader>(replay_input_path);
+        pull_from_replay_thread = std::thread(
+            boost::bind(&ReplayBackend::continuouslyPullFromReplayFiles, this));
+        return;
+    }
+
+    replay_player = std::make_shared<IndexedProtoLogPlayer<SensorProto>>(
+        replay_input_path,
+        [this](const SensorProto& sensor_msg) { this->sendValueToObservers(sensor_msg); },
+        true);
+    setPlaybackSpeed(*replay_player, replay_playback_speed);
+    seekToTime(*replay_player, replay_start_time_seconds);
+
+    // Let the playback be controlled through the dynamic parameters, which the GUI
+    // can change while replaying
+    std::weak_ptr<IndexedProtoLogPlayer<SensorProto>> weak_replay_player = replay_player;
+    auto args = DynamicParameters->getFullSystemMainCommandLineArgs();
+    args->getReplayPlaybackSpeed()->registerCallbackFunction(
+        [weak_replay_player](double new_replay_playback_speed) {
+            if (auto player = weak_replay_player.lock())
+            {
+                setPlaybackSpeed(*player, new_replay_playback_speed);
+            }
+        });
+    args->getReplayStartTimeSeconds()->registerCallbackFunction(
+        [weak_replay_player](double new_replay_start_time_seconds) {
+            if (auto player = weak_replay_player.lock())
+            {
+                seekToTime(*player, new_replay_start_time_seconds);
+            }
+        });
+    args->getReplayPaused()->registerCallbackFunction(
+        [weak_replay_player](bool new_replay_paused) {
+            if (auto player = weak_replay_player.lock())
+            {
+                setPaused(*player, new_replay_paused);
+            }
+        });
+    setPaused(*replay_player, replay_paused);
+
+    // When the replay is being watched in the GUI, the player keeps running after it
+    // reaches the end of the log so that it can be seeked back through
+    if (exit_when_finished)
+    {
+        pull_from_replay_thread =
+            std::thread(boost::bind(&ReplayBackend::waitForReplayPlayerToFinish, this));
+    }
+}
+
+void ReplayBackend::setPlaybackSpeed(IndexedProtoLogPlayer<SensorProto>& player,
+                                     double replay_playback_speed)
+{
+    if (replay_playback_speed > 0)
+    {
+        player.setPlaybackSpeed(replay_playback_speed);
+    }
+    else
+    {
+        player.setPlaybackSpeed(IndexedProtoLogPlayer<SensorProto>::AS_FAST_AS_POSSIBLE);
+    }
+}
+
+void ReplayBackend::seekToTime(IndexedProtoLogPlayer<SensorProto>& player,
+                               double replay_start_time_seconds)
+{
+    if (player.getStartTimestamp())
+    {
+        player.seekToTimestamp(*player.getStartTimestamp() + replay_start_time_seconds);
+    }
+}
+
+void ReplayBackend::setPaused(IndexedProtoLogPlayer<SensorProto>& player,
+                              bool replay_paused)
+{
+    if (replay_paused)
+    {
+        player.pause();
+    }
+    else
+    {
+        player.play();
+    }
 }
 
 void ReplayBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
@@ -24,7 +110,7 @@ void ReplayBackend::onValueReceived(World world) {}
 
 void ReplayBackend::continuouslyPullFromReplayFiles()
 {
-    while (auto sensor_msg_or_null = replay_reader.getNextMsg<SensorProto>())
+    while (auto sensor_msg_or_null = replay_reader->getNextMsg<SensorProto>())
     {
         auto this_msg_received_time = std::chrono::duration<double>(
             sensor_msg_or_null->backend_received_time().epoch_timestamp_seconds());
@@ -49,6 +135,28 @@ void ReplayBackend::continuouslyPullFromReplayFiles()
         last_msg_received_time = this_msg_received_time;
     }
 
+    if (exit_when_finished)
+    {
+        exitOnceLastPrimitiveReceived();
+    }
+    else
+    {
+        LOG(INFO) << "Reached end of replay";
+    }
+}
+
+void ReplayBackend::waitForReplayPlayerToFinish()
+{
+    while (!replay_player->waitUntilFinished(
+        Duration::fromSeconds(CHECK_LAST_PRIMITIVE_TIME_DURATION.count())))
+    {
+    }
+
+    exitOnceLastPrimitiveReceived();
+}
+
+void ReplayBackend::exitOnceLastPrimitiveReceived()
+{
     bool exit = false;
     while (!exit)
     {
@@ -6,27 +6,109 @@
 #include "software/networking/threaded_proto_multicast_listener.h"
 #include "software/networking/threaded_proto_multicast_sender.h"
 #include "software/parameter/dynamic_parameters.h"
+#include "software/proto/logging/indexed_proto_log_player.h"
 #include "software/proto/logging/proto_log_reader.h"
 
 class ReplayBackend : public Backend
 {
    public:
-    explicit ReplayBackend(const std::string& replay_input_dir =
-                               DynamicParameters->getFullSystemMainCommandLineArgs()
-                                   ->getReplayInputDir()
-                                   ->value());
+    /**
+     * Creates a ReplayBackend that replays the SensorProtos logged at the given path.
+     * The path can either be an indexed proto log file, which is played back starting
+     * from `replay_start_time_seconds` into the log at `replay_playback_speed`, or a
+     * directory of RepeatedAnyMsg chunk files, which is played back from the start at
+     * the original speed.
+     *
+     * @param replay_input_path The path of the log to replay
+     * @param replay_start_time_seconds How far into an indexed log to start the replay
+     * @param replay_playback_speed How fast to replay an indexed log, relative to the
+     * speed it was logged at. Values less than or equal to 0 replay the log as fast as
+     * possible
+     * @param replay_paused Whether to start replaying an indexed log paused
+     * @param exit_when_finished Whether to exit once the whole log has been replayed.
+     * This should only be false when the replay is being watched in the GUI, so that the
+     * log can be seeked back through after it reaches the end
+     *
+     * While an indexed log is being replayed, changing the `replay_start_time_seconds`,
+     * `replay_playback_speed` or `replay_paused` dynamic parameters (e.g. from the GUI)
+     * seeks to the new time, changes the playback speed, or pauses or resumes playback.
+     */
+    explicit ReplayBackend(
+        const std::string& replay_input_path = DynamicParameters
+                                                   ->getFullSystemMainCommandLineArgs()
+                                                   ->getReplayInputDir()
+                                                   ->value(),
+        double replay_start_time_seconds = DynamicParameters
+                                               ->getFullSystemMainCommandLineArgs()
+                                               ->getReplayStartTimeSeconds()
+                                               ->value(),
+        double replay_playback_speed = DynamicParameters
+                                           ->getFullSystemMainCommandLineArgs()
+                                           ->getReplayPlaybackSpeed()
+                                           ->value(),
+        bool replay_paused = DynamicParameters->getFullSystemMainCommandLineArgs()
+                                 ->getReplayPaused()
+                                 ->value(),
+        bool exit_when_finished = DynamicParameters->getFullSystemMainCommandLineArgs()
+                                      ->getHeadless()
+                                      ->value());
 
    private:
     void onValueReceived(TbotsProto::PrimitiveSet primitives) override;
     void onValueReceived(World world) override;
     void continuouslyPullFromReplayFiles();
 
+    /**
+     * Sets how fast the given player plays back its log
+     *
+     * @param player The player
+     * @param replay_playback_speed How fast to replay the log, relative to the speed it
+     * was logged at. Values less than or equal to 0 replay the log as fast as possible
+     */
+    static void setPlaybackSpeed(IndexedProtoLogPlayer<SensorProto>& player,
+                                 double replay_playback_speed);
+
+    /**
+     * Seeks the given player to the given time into its log
+     *
+     * @param player The player
+     * @param replay_start_time_seconds How far into the log to seek to
+     */
+    static void seekToTime(IndexedProtoLogPlayer<SensorProto>& player,
+                           double replay_start_time_seconds);
+
+    /**
+     * Pauses or resumes the given player
+     *
+     * @param player The player
+     * @param replay_paused Whether to pause the player
+     */
+    static void setPaused(IndexedProtoLogPlayer<SensorProto>& player, bool replay_paused);
+
+    /**
+     * Waits until the indexed log has been played back to the end, and then exits once
+     * the downstream components have finished processing it
+     */
+    void waitForReplayPlayerToFinish();
+
+    /**
+     * Waits until the downstream components have finished processing the replayed data,
+     * and then exits
+     */
+    void exitOnceLastPrimitiveReceived();
+
     static constexpr std::chrono::duration<double> CHECK_LAST_PRIMITIVE_TIME_DURATION =
         std::chrono::duration<double>(0.1);
     static constexpr std::chrono::duration<double> LAST_PRIMITIVE_TO_SHUTDOWN_DURATION =
         std::chrono::duration<double>(1.0);
 
-    ProtoLogReader replay_reader;
+    bool exit_when_finished;
+
+    // Only one of these is used, depending on the format of the replayed log. The
+    // player is shared with the dynamic parameter callbacks, which can't be
+    // unregistered and so only hold a weak_ptr to it
+    std::unique_ptr<ProtoLogReader> replay_reader;
+    std::shared_ptr<IndexedProtoLogPlayer<SensorProto>> replay_player;
     // a thread that continuously pulls from replay data files and emits them to the
     // observers of this class
     std::thread pull_from_replay_thread;
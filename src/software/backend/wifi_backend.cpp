@@ -34,24 +34,38 @@ WifiBackend::WifiBackend(std::shared_ptr<const NetworkConfig> network_config,
 
 void WifiBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
-    primitive_output->sendProto(primitives);
+    if (network_config->getEnableDeltaFrames()->value())
+    {
+        primitive_encoder->encodeFrame(*primitives.mutable_robot_primitives(),
+                                       *primitives.mutable_delta_frame_info());
+    }
+
+    // Queue the messages rather than sending them here, so that the network doesn't
+    // hold up the AI
+    primitive_output->sendProtoAsync(primitives);
 
     if (sensor_fusion_config->getOverrideGameControllerDefendingSide()->value())
     {
-        defending_side_output->sendProto(
+        defending_side_output->sendProtoAsync(
             *createDefendingSide(sensor_fusion_config->getDefendingPositiveSide()->value()
                                      ? FieldSide::POS_X
                                      : FieldSide::NEG_X));
     }
     else
     {
-        defending_side_output->sendProto(*createDefendingSide(FieldSide::NEG_X));
+        defending_side_output->sendProtoAsync(*createDefendingSide(FieldSide::NEG_X));
     }
 }
 
 void WifiBackend::onValueReceived(World world)
 {
-    vision_output->sendProto(*createVision(world));
+    auto vision = createVision(world);
+    if (network_config->getEnableDeltaFrames()->value())
+    {
+        robot_state_encoder->encodeFrame(*vision->mutable_robot_states(),
+                                         *vision->mutable_delta_frame_info());
+    }
+    vision_output->sendProtoAsync(*vision);
 }
 
 void WifiBackend::receiveRobotLogs(TbotsProto::RobotLog log)
@@ -80,6 +94,15 @@ void WifiBackend::joinMulticastChannel(int channel, const std::string& interface
 
     defending_side_output.reset(new ThreadedProtoMulticastSender<DefendingSideProto>(
         std::string(MULTICAST_CHANNELS[channel]) + "%" + interface, DEFENDING_SIDE_PORT));
+
+    // Start the new channel with a keyframe, since the robots on it haven't received
+    // anything yet
+    auto keyframe_interval = static_cast<unsigned int>(
+        network_config->getDeltaFrameKeyframeInterval()->value());
+    primitive_encoder.reset(
+        new DeltaFrameEncoder<TbotsProto::Primitive>(keyframe_interval));
+    robot_state_encoder.reset(
+        new DeltaFrameEncoder<TbotsProto::RobotState>(keyframe_interval));
 }
 
 // Register this backend in the genericFactory
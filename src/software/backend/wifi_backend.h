@@ -9,6 +9,7 @@
 #include "software/networking/threaded_proto_multicast_sender.h"
 #include "software/parameter/dynamic_parameters.h"
 #include "software/proto/defending_side_msg.pb.h"
+#include "software/proto/message_translation/delta_frame.h"
 
 class WifiBackend : public Backend
 {
@@ -60,4 +61,9 @@ class WifiBackend : public Backend
     std::unique_ptr<ThreadedProtoMulticastListener<TbotsProto::RobotLog>> robot_log_input;
     std::unique_ptr<ThreadedProtoMulticastSender<DefendingSideProto>>
         defending_side_output;
+
+    // Encoders to only send the robots the primitives and robot states that have changed
+    // since the last keyframe, if delta frames are enabled
+    std::unique_ptr<DeltaFrameEncoder<TbotsProto::Primitive>> primitive_encoder;
+    std::unique_ptr<DeltaFrameEncoder<TbotsProto::RobotState>> robot_state_encoder;
 };
@@ -9,8 +9,10 @@
 #include "software/constants.h"
 #include "software/gui/full_system/threaded_full_system_gui.h"
 #include "software/logger/logger.h"
+#include "software/metrics/metrics_file_writer.h"
 #include "software/multithreading/observer_subject_adapter.h"
 #include "software/parameter/dynamic_parameters.h"
+#include "software/proto/logging/indexed_proto_logger.h"
 #include "software/proto/logging/proto_logger.h"
 #include "software/proto/message_translation/ssl_wrapper.h"
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
@@ -72,6 +74,12 @@ int main(int argc, char** argv)
         auto ai            = std::make_shared<ThreadedAI>(ai_config, ai_control_config);
         std::shared_ptr<ThreadedFullSystemGUI> visualizer;
 
+        // Periodically write the AI's performance metrics alongside the logs, so they
+        // can be compared after a match
+        MetricsFileWriter metrics_file_writer(
+            MetricsRegistry::getGlobalRegistry(),
+            args->getLoggingDir()->value() + "/metrics.txt", std::chrono::seconds(5));
+
         // Connect observers
         ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(backend);
         sensor_fusion->Subject<World>::registerObserver(ai);
@@ -109,6 +117,19 @@ int main(int argc, char** argv)
                     proto_log_output_dir / "AI_PrimitiveSet");
             backend->Subject<SensorProto>::registerObserver(sensor_msg_logger);
             ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(primitive_set_logger);
+            if (args->getLogIndexedSensorProto()->value())
+            {
+                // also log incoming SensorMsg to an indexed log, which the replay
+                // backend can seek through and play back at different speeds
+                auto indexed_sensor_msg_logger =
+                    std::make_shared<IndexedProtoLogger<SensorProto>>(
+                        proto_log_output_dir / "Backend_SensorProto.log",
+                        [](const SensorProto& msg) {
+                            return msg.backend_received_time().epoch_timestamp_seconds();
+                        });
+                backend->Subject<SensorProto>::registerObserver(
+                    indexed_sensor_msg_logger);
+            }
             // log filtered world state
 
             constexpr auto world_to_ssl_wrapper_conversion_fn = [](const World& world) {
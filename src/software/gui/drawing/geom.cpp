@@ -1,54 +1,48 @@
 #include "software/gui/drawing/geom.h"
 
+#include "software/gui/drawing/retained_graphics_scene.h"
+
 void drawRectangle(QGraphicsScene* scene, const Rectangle& rectangle, const QPen& pen,
                    const std::optional<QBrush>& brush_opt)
 {
-    QRectF qrect = createQRectF(rectangle);
-    if (brush_opt)
-    {
-        scene->addRect(qrect, pen, brush_opt.value());
-    }
-    else
-    {
-        scene->addRect(qrect, pen);
-    }
+    // Items may be reused from the last frame, so every property is set even if no brush
+    // is given
+    auto rect_item = acquireGraphicsItem<QGraphicsRectItem>(scene);
+    rect_item->setRect(createQRectF(rectangle));
+    rect_item->setPen(pen);
+    rect_item->setBrush(brush_opt.value_or(QBrush()));
 }
 
 void drawPolygon(QGraphicsScene* scene, const Polygon& polygon, const QPen& pen,
                  const std::optional<QBrush>& brush_opt)
 {
-    auto poly = createQPolygonF(polygon);
-    if (brush_opt)
-    {
-        scene->addPolygon(poly, pen, brush_opt.value());
-    }
-    else
-    {
-        scene->addPolygon(poly, pen);
-    }
+    auto polygon_item = acquireGraphicsItem<QGraphicsPolygonItem>(scene);
+    polygon_item->setPolygon(createQPolygonF(polygon));
+    polygon_item->setPen(pen);
+    polygon_item->setBrush(brush_opt.value_or(QBrush()));
 }
 
 void drawCircle(QGraphicsScene* scene, const Circle& circle, const QPen& pen,
                 const std::optional<QBrush>& brush_opt)
 {
-    // The addEllipse function does not center the ellipse at the given coordinates, so it
-    // is slightly easier to define the bounding rect within which the ellipse is drawn
+    // The ellipse item does not center the ellipse at the given coordinates, so it is
+    // slightly easier to define the bounding rect within which the ellipse is drawn
     Point origin  = circle.origin();
     double radius = circle.radius();
     QRectF circle_bounding_rect(createQPointF(origin + Vector(-radius, radius)),
                                 createQPointF(origin + Vector(radius, -radius)));
-    if (brush_opt)
-    {
-        scene->addEllipse(circle_bounding_rect, pen, brush_opt.value());
-    }
-    else
-    {
-        scene->addEllipse(circle_bounding_rect, pen);
-    }
+    auto ellipse_item = acquireGraphicsItem<QGraphicsEllipseItem>(scene);
+    ellipse_item->setRect(circle_bounding_rect);
+    // Reused ellipse items may have been drawn as an arc, like the robot body
+    ellipse_item->setStartAngle(0);
+    ellipse_item->setSpanAngle(360 * 16);
+    ellipse_item->setPen(pen);
+    ellipse_item->setBrush(brush_opt.value_or(QBrush()));
 }
 
 void drawSegment(QGraphicsScene* scene, const Segment& segment, const QPen& pen)
 {
-    QLineF line = createQLineF(segment);
-    scene->addLine(line, pen);
+    auto line_item = acquireGraphicsItem<QGraphicsLineItem>(scene);
+    line_item->setLine(createQLineF(segment));
+    line_item->setPen(pen);
 }
@@ -0,0 +1,97 @@
+#include "software/gui/drawing/retained_graphics_scene.h"
+
+RetainedGraphicsScene::RetainedGraphicsScene(QObject* parent)
+    : QGraphicsScene(parent),
+      item_pools(),
+      static_layers(),
+      static_layer_being_drawn(nullptr),
+      next_z_value(0)
+{
+}
+
+void RetainedGraphicsScene::beginFrame()
+{
+    next_z_value = 0;
+    std::apply([](auto&... pools) { ((pools.num_acquired = 0), ...); }, item_pools);
+    for (auto& [layer_name, layer] : static_layers)
+    {
+        layer.drawn_this_frame = false;
+    }
+
+    // Items that were added to the scene directly can't be reused, so they only last
+    // for the frame they were added in. Deleting an item deletes its children, so only
+    // the top level items are deleted, after they have all been found.
+    std::vector<QGraphicsItem*> unmanaged_items;
+    for (QGraphicsItem* item : items())
+    {
+        if (!item->parentItem() && !item->data(MANAGED_ITEM_DATA_KEY).toBool())
+        {
+            unmanaged_items.emplace_back(item);
+        }
+    }
+    for (QGraphicsItem* item : unmanaged_items)
+    {
+        delete item;
+    }
+}
+
+void RetainedGraphicsScene::endFrame()
+{
+    std::apply([](auto&... pools) { (hideUnacquiredItems(pools), ...); }, item_pools);
+
+    for (auto& [layer_name, layer] : static_layers)
+    {
+        if (!layer.drawn_this_frame)
+        {
+            for (QGraphicsItem* item : layer.items)
+            {
+                item->setVisible(false);
+            }
+        }
+    }
+}
+
+template <typename ItemT>
+void RetainedGraphicsScene::hideUnacquiredItems(ItemPool<ItemT>& pool)
+{
+    for (size_t i = pool.num_acquired; i < pool.items.size(); i++)
+    {
+        pool.items[i]->setVisible(false);
+    }
+}
+
+void RetainedGraphicsScene::addManagedItem(QGraphicsItem* item)
+{
+    item->setData(MANAGED_ITEM_DATA_KEY, true);
+    addItem(item);
+}
+
+void RetainedGraphicsScene::showItemOnTop(QGraphicsItem* item)
+{
+    item->setZValue(next_z_value++);
+    item->setVisible(true);
+}
+
+void RetainedGraphicsScene::redrawStaticLayer(StaticLayer& layer,
+                                              const std::function<void()>& draw_layer)
+{
+    for (QGraphicsItem* item : layer.items)
+    {
+        delete item;
+    }
+    layer.items.clear();
+
+    // Static layers may be drawn while drawing another static layer
+    StaticLayer* outer_static_layer = static_layer_being_drawn;
+    static_layer_being_drawn        = &layer;
+    draw_layer();
+    static_layer_being_drawn = outer_static_layer;
+}
+
+void RetainedGraphicsScene::showStaticLayer(StaticLayer& layer)
+{
+    for (QGraphicsItem* item : layer.items)
+    {
+        showItemOnTop(item);
+    }
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <QtWidgets/QGraphicsEllipseItem>
+#include <QtWidgets/QGraphicsLineItem>
+#include <QtWidgets/QGraphicsPolygonItem>
+#include <QtWidgets/QGraphicsRectItem>
+#include <QtWidgets/QGraphicsScene>
+#include <QtWidgets/QGraphicsSimpleTextItem>
+#include <any>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A QGraphicsScene that keeps its items from one frame to the next, rather than
+ * clearing the scene and creating every item again each frame.
+ *
+ * Each frame is drawn between calls to beginFrame and endFrame. Items are created with
+ * acquireItem, which reuses an item of the same type from the last frame if there is
+ * one, and items that aren't reused in a frame are hidden. Parts of the scene that
+ * rarely change, like the field lines, can be drawn as static layers, which are only
+ * drawn again when the value they are drawn from changes.
+ *
+ * Since items are reused, their stacking order is set from the order they are acquired
+ * in each frame, so items drawn later are on top, just like in a QGraphicsScene that is
+ * cleared every frame.
+ */
+class RetainedGraphicsScene : public QGraphicsScene
+{
+   public:
+    explicit RetainedGraphicsScene(QObject* parent = nullptr);
+
+    /**
+     * Starts drawing a new frame. Every item acquired in the last frame is made
+     * available to be reused, and any items that were added to the scene directly
+     * rather than through acquireItem are removed. Items added directly aren't given a
+     * stacking order, so they may be drawn under the acquired items.
+     */
+    void beginFrame();
+
+    /**
+     * Finishes drawing the frame by hiding all the items and static layers that weren't
+     * drawn in it
+     */
+    void endFrame();
+
+    /**
+     * Gets an item to draw in the current frame. The item is reused from the last frame
+     * if possible, so the caller must set all the type specific properties it relies on
+     * (rect, pen, brush, etc.). The position, rotation and transform are reset.
+     *
+     * @tparam ItemT The type of the item, one of QGraphicsRectItem,
+     * QGraphicsEllipseItem, QGraphicsLineItem, QGraphicsPolygonItem or
+     * QGraphicsSimpleTextItem
+     *
+     * @return the item, which is owned by the scene
+     */
+    template <typename ItemT>
+    ItemT* acquireItem();
+
+    /**
+     * Draws a layer of items that only has to be drawn again when the key it is drawn
+     * from changes. If the key is the same as the last time the layer was drawn, the
+     * items from then are shown again in place instead.
+     *
+     * @tparam KeyT The type of the key, which must be copyable and equality comparable
+     *
+     * @param layer_name The name that identifies the layer
+     * @param key The value the layer is drawn from
+     * @param draw_layer Draws the layer by acquiring items from this scene
+     */
+    template <typename KeyT>
+    void drawStaticLayer(const std::string& layer_name, const KeyT& key,
+                         const std::function<void()>& draw_layer);
+
+   private:
+    template <typename ItemT>
+    struct ItemPool
+    {
+        std::vector<ItemT*> items;
+        // The number of items that have been acquired in the current frame
+        size_t num_acquired = 0;
+    };
+
+    struct StaticLayer
+    {
+        std::any key;
+        std::vector<QGraphicsItem*> items;
+        bool drawn_this_frame = false;
+    };
+
+    /**
+     * Hides the items in the pool that weren't acquired in the current frame
+     *
+     * @param pool The pool to hide the items in
+     */
+    template <typename ItemT>
+    static void hideUnacquiredItems(ItemPool<ItemT>& pool);
+
+    /**
+     * Adds a new item to the scene and marks it as managed by this scene, so it is not
+     * removed by beginFrame
+     *
+     * @param item The item to add
+     */
+    void addManagedItem(QGraphicsItem* item);
+
+    /**
+     * Shows an item and puts it on top of everything else drawn so far this frame
+     *
+     * @param item The item to show
+     */
+    void showItemOnTop(QGraphicsItem* item);
+
+    /**
+     * Deletes the items in the static layer and draws them again
+     *
+     * @param layer The static layer to redraw
+     * @param draw_layer Draws the layer
+     */
+    void redrawStaticLayer(StaticLayer& layer, const std::function<void()>& draw_layer);
+
+    /**
+     * Shows the items in the static layer from the last time it was drawn
+     *
+     * @param layer The static layer to show
+     */
+    void showStaticLayer(StaticLayer& layer);
+
+    // The key used with QGraphicsItem::setData to mark the items managed by this scene
+    static constexpr int MANAGED_ITEM_DATA_KEY = 0;
+
+    std::tuple<ItemPool<QGraphicsRectItem>, ItemPool<QGraphicsEllipseItem>,
+               ItemPool<QGraphicsLineItem>, ItemPool<QGraphicsPolygonItem>,
+               ItemPool<QGraphicsSimpleTextItem>>
+        item_pools;
+    std::unordered_map<std::string, StaticLayer> static_layers;
+    // The static layer that is currently being drawn, if any
+    StaticLayer* static_layer_being_drawn;
+    qreal next_z_value;
+};
+
+template <typename ItemT>
+ItemT* RetainedGraphicsScene::acquireItem()
+{
+    if (static_layer_being_drawn)
+    {
+        ItemT* item = new ItemT();
+        addManagedItem(item);
+        showItemOnTop(item);
+        static_layer_being_drawn->items.emplace_back(item);
+        return item;
+    }
+
+    auto& pool = std::get<ItemPool<ItemT>>(item_pools);
+    if (pool.num_acquired == pool.items.size())
+    {
+        ItemT* item = new ItemT();
+        addManagedItem(item);
+        pool.items.emplace_back(item);
+    }
+
+    ItemT* item = pool.items[pool.num_acquired++];
+    item->setPos(0, 0);
+    item->setRotation(0);
+    item->setTransform(QTransform());
+    showItemOnTop(item);
+    return item;
+}
+
+template <typename KeyT>
+void RetainedGraphicsScene::drawStaticLayer(const std::string& layer_name,
+                                            const KeyT& key,
+                                            const std::function<void()>& draw_layer)
+{
+    StaticLayer& layer     = static_layers[layer_name];
+    const KeyT* last_key   = std::any_cast<KeyT>(&layer.key);
+    layer.drawn_this_frame = true;
+    if (last_key && *last_key == key)
+    {
+        showStaticLayer(layer);
+    }
+    else
+    {
+        layer.key = key;
+        redrawStaticLayer(layer, draw_layer);
+    }
+}
+
+/**
+ * Gets an item to draw on the given scene. If the scene is a RetainedGraphicsScene
+ * the item may be reused from the last frame, so all the type specific properties that
+ * are relied on must be set. Otherwise a new item is added to the scene.
+ *
+ * @tparam ItemT The type of the item
+ *
+ * @param scene The scene to draw on
+ *
+ * @return the item, which is owned by the scene
+ */
+template <typename ItemT>
+ItemT* acquireGraphicsItem(QGraphicsScene* scene)
+{
+    if (auto retained_scene = dynamic_cast<RetainedGraphicsScene*>(scene))
+    {
+        return retained_scene->acquireItem<ItemT>();
+    }
+
+    ItemT* item = new ItemT();
+    scene->addItem(item);
+    return item;
+}
+
+/**
+ * Draws a layer that only changes when the given key changes on the given scene. If
+ * the scene is a RetainedGraphicsScene the layer is only drawn again when the key
+ * changes, otherwise it is always drawn.
+ *
+ * @tparam KeyT The type of the key, which must be copyable and equality comparable
+ *
+ * @param scene The scene to draw on
+ * @param layer_name The name that identifies the layer
+ * @param key The value the layer is drawn from
+ * @param draw_layer Draws the layer
+ */
+template <typename KeyT>
+void drawStaticLayer(QGraphicsScene* scene, const std::string& layer_name,
+                     const KeyT& key, const std::function<void()>& draw_layer)
+{
+    if (auto retained_scene = dynamic_cast<RetainedGraphicsScene*>(scene))
+    {
+        retained_scene->drawStaticLayer(layer_name, key, draw_layer);
+    }
+    else
+    {
+        draw_layer();
+    }
+}
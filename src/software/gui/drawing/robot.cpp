@@ -7,6 +7,7 @@
 #include "software/geom/algorithms/acute_angle.h"
 #include "software/geom/segment.h"
 #include "software/gui/drawing/geom.h"
+#include "software/gui/drawing/retained_graphics_scene.h"
 #include "software/gui/geometry_conversion.h"
 #include "software/math/math_functions.h"
 
@@ -76,15 +77,15 @@ void drawRobotAtPosition(QGraphicsScene* scene, const Point& position,
     // This ellipse will draw the majority of the Robot body in an arc from the
     // front-left of the robot all the way around the back to the front-right
     QGraphicsEllipseItem* robot_body_ellipse =
-        new QGraphicsEllipseItem(QRectF(createQPointF(robot_bounding_box_top_left),
-                                        createQPointF(robot_bounding_box_bottom_right)));
+        acquireGraphicsItem<QGraphicsEllipseItem>(scene);
+    robot_body_ellipse->setRect(QRectF(createQPointF(robot_bounding_box_top_left),
+                                       createQPointF(robot_bounding_box_bottom_right)));
     robot_body_ellipse->setPen(robot_body_pen);
     robot_body_ellipse->setBrush(brush);
     robot_body_ellipse->setStartAngle(createQAngle(robot_face_front_left.orientation()));
     Angle robot_body_ellipse_span =
         Angle::full() - acuteAngle(robot_face_front_left, robot_face_front_right);
     robot_body_ellipse->setSpanAngle(createQAngle(robot_body_ellipse_span));
-    scene->addItem(robot_body_ellipse);
 
     drawPolygon(scene, robot_body_fill_polygon, Qt::NoPen, brush);
 
@@ -105,7 +106,9 @@ void drawRobotId(QGraphicsScene* scene, const Point& position, const RobotId id)
     QRectF robot_bounding_box(createQPointF(robot_bounding_box_top_left),
                               createQPointF(robot_bounding_box_bottom_right));
 
-    QGraphicsSimpleTextItem* robot_id = new QGraphicsSimpleTextItem(QString::number(id));
+    QGraphicsSimpleTextItem* robot_id =
+        acquireGraphicsItem<QGraphicsSimpleTextItem>(scene);
+    robot_id->setText(QString::number(id));
     QFont sansFont("Helvetica [Cronyx]");
     sansFont.setPointSizeF(1);
     robot_id->setFont(sansFont);
@@ -128,7 +131,6 @@ void drawRobotId(QGraphicsScene* scene, const Point& position, const RobotId id)
     // Place the text right under the robot
     robot_id->setPos(robot_bounding_box_top_left.x(),
                      robot_bounding_box_bottom_right.y());
-    scene->addItem(robot_id);
 }
 
 void drawRobot(QGraphicsScene* scene, const RobotStateWithId& robot, const QColor& color)
@@ -2,6 +2,7 @@
 
 #include "software/gui/full_system/widgets/ai_control.h"
 #include "software/gui/generic_widgets/robot_status/robot_status.h"
+#include "software/metrics/metrics_registry.h"
 
 FullSystemGUI::FullSystemGUI(
     std::shared_ptr<ThreadSafeBuffer<WorldDrawFunction>> world_draw_functions_buffer,
@@ -52,6 +53,10 @@ FullSystemGUI::FullSystemGUI(
     // This is a separate timer as the update timer is too fast
     connect(data_per_second_timer, &QTimer::timeout, this,
             &FullSystemGUI::updateDataPerSecondLCD);
+    connect(data_per_second_timer, &QTimer::timeout, this,
+            &FullSystemGUI::updateFrameTimeLCD);
+    connect(data_per_second_timer, &QTimer::timeout, this,
+            &FullSystemGUI::updateMetricsTable);
     update_timer->start(static_cast<int>(
         Duration::fromSeconds(UPDATE_INTERVAL_SECONDS).toMilliseconds()));
     data_per_second_timer->start(static_cast<int>(
@@ -128,3 +133,44 @@ void FullSystemGUI::updateDataPerSecondLCD()
         main_widget->primitives_sent_lcd->display(primitives_sent_int);
     }
 }
+
+void FullSystemGUI::updateFrameTimeLCD()
+{
+    double frame_time_milliseconds =
+        main_widget->ai_visualization_graphics_view->getAverageFrameTimeMilliseconds();
+    main_widget->frame_time_lcd->display(
+        QString::number(frame_time_milliseconds, 'f', 1));
+}
+
+void FullSystemGUI::updateMetricsTable()
+{
+    MetricsSnapshot snapshot = MetricsRegistry::getGlobalRegistry().getSnapshot();
+
+    std::vector<std::pair<std::string, QString>> rows;
+    for (const auto& [name, value] : snapshot.counters)
+    {
+        rows.emplace_back(name, QString::number(value));
+    }
+    for (const auto& [name, value] : snapshot.gauges)
+    {
+        rows.emplace_back(name, QString::number(value));
+    }
+    for (const auto& [name, histogram] : snapshot.histograms)
+    {
+        rows.emplace_back(name, QString("p50=%1 p90=%2 p99=%3 max=%4 (n=%5)")
+                                    .arg(histogram.p50)
+                                    .arg(histogram.p90)
+                                    .arg(histogram.p99)
+                                    .arg(histogram.max)
+                                    .arg(histogram.count));
+    }
+
+    QTableWidget* table = main_widget->metrics_table_widget;
+    table->setRowCount(static_cast<int>(rows.size()));
+    for (int row = 0; row < static_cast<int>(rows.size()); row++)
+    {
+        const auto& [name, value] = rows[static_cast<size_t>(row)];
+        table->setItem(row, 0, new QTableWidgetItem(QString::fromStdString(name)));
+        table->setItem(row, 1, new QTableWidgetItem(value));
+    }
+}
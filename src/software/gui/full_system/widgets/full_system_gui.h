@@ -81,6 +81,18 @@ class FullSystemGUI : public QMainWindow
      */
     void updateDataPerSecondLCD();
 
+    /**
+     * Updates the LCD showing the average time it takes to draw and paint the
+     * visualization
+     */
+    void updateFrameTimeLCD();
+
+    /**
+     * Updates the table showing the latest value of every metric in the global
+     * MetricsRegistry
+     */
+    void updateMetricsTable();
+
     // The "parent" of each of these widgets is set during construction, meaning that
     // the Qt system takes ownership of the pointer and is responsible for de-allocating
     // it, so we don't have to
@@ -6,7 +6,9 @@
 
 DrawFunctionVisualizer::DrawFunctionVisualizer(QWidget *parent)
     : ZoomableQGraphicsView(parent),
-      graphics_scene(new QGraphicsScene(this)),
+      average_draw_milliseconds(0.0),
+      average_paint_milliseconds(0.0),
+      graphics_scene(new RetainedGraphicsScene(this)),
       open_gl_widget(new QOpenGLWidget(this))
 {
     setScene(graphics_scene);
@@ -54,7 +56,9 @@ DrawFunctionVisualizer::DrawFunctionVisualizer(QWidget *parent)
 
 void DrawFunctionVisualizer::clearAndDraw(const std::vector<DrawFunction> &draw_functions)
 {
-    graphics_scene->clear();
+    auto start_time = std::chrono::steady_clock::now();
+
+    graphics_scene->beginFrame();
     for (auto draw_function : draw_functions)
     {
         if (draw_function)
@@ -66,6 +70,31 @@ void DrawFunctionVisualizer::clearAndDraw(const std::vector<DrawFunction> &draw_
             LOG(WARNING) << "Attempted to draw a non-callable DrawFunction";
         }
     }
+    graphics_scene->endFrame();
+
+    updateAverageMilliseconds(average_draw_milliseconds, start_time);
+}
+
+double DrawFunctionVisualizer::getAverageFrameTimeMilliseconds() const
+{
+    return average_draw_milliseconds + average_paint_milliseconds;
+}
+
+void DrawFunctionVisualizer::paintEvent(QPaintEvent *event)
+{
+    auto start_time = std::chrono::steady_clock::now();
+    ZoomableQGraphicsView::paintEvent(event);
+    updateAverageMilliseconds(average_paint_milliseconds, start_time);
+}
+
+void DrawFunctionVisualizer::updateAverageMilliseconds(
+    double &average_milliseconds, const std::chrono::steady_clock::time_point &start_time)
+{
+    double milliseconds = std::chrono::duration<double, std::milli>(
+                              std::chrono::steady_clock::now() - start_time)
+                              .count();
+    average_milliseconds = FRAME_TIME_SMOOTHING_FACTOR * milliseconds +
+                           (1.0 - FRAME_TIME_SMOOTHING_FACTOR) * average_milliseconds;
 }
 
 void DrawFunctionVisualizer::setViewArea(const Rectangle &view_area)
@@ -2,9 +2,11 @@
 
 #include <QtWidgets/QGraphicsScene>
 #include <QtWidgets/QOpenGLWidget>
+#include <chrono>
 
 #include "software/geom/rectangle.h"
 #include "software/gui/drawing/draw_functions.h"
+#include "software/gui/drawing/retained_graphics_scene.h"
 #include "software/gui/generic_widgets/draw_function_visualizer/zoomable_qgraphics_view.h"
 
 /**
@@ -20,12 +22,22 @@ class DrawFunctionVisualizer : public ZoomableQGraphicsView
     explicit DrawFunctionVisualizer(QWidget* parent = nullptr);
 
     /**
-     * Clears the scene and draws each of the provided DrawFunctions in order
+     * Clears the scene and draws each of the provided DrawFunctions in order. The items
+     * drawn in the last frame are reused where possible rather than being deleted and
+     * created again, so the scene only looks as if it was cleared.
      *
      * @param draw_functions The DrawFunctions to draw on the scene, in order
      */
     void clearAndDraw(const std::vector<DrawFunction>& draw_functions);
 
+    /**
+     * Gets the average time it takes to draw and paint a frame, which includes
+     * running the DrawFunctions and painting the scene in the view
+     *
+     * @return the average time it takes to draw and paint a frame, in milliseconds
+     */
+    double getAverageFrameTimeMilliseconds() const;
+
     /**
      * Sets the area of the scene that's visible in the view
      *
@@ -33,10 +45,30 @@ class DrawFunctionVisualizer : public ZoomableQGraphicsView
      */
     void setViewArea(const Rectangle& view_area);
 
+   protected:
+    void paintEvent(QPaintEvent* event) override;
+
    private:
+    /**
+     * Adds the given time to the average time it takes to draw or paint a frame
+     *
+     * @param average_milliseconds The average to update
+     * @param start_time The time the drawing or painting started
+     */
+    static void updateAverageMilliseconds(
+        double& average_milliseconds,
+        const std::chrono::steady_clock::time_point& start_time);
+
+    // How much each new time is weighted in the exponential moving average of the
+    // draw and paint times. Smaller values give a smoother average.
+    static constexpr double FRAME_TIME_SMOOTHING_FACTOR = 0.1;
+
+    double average_draw_milliseconds;
+    double average_paint_milliseconds;
+
     // The "parent" of each of these widgets is set during construction, meaning that
     // the Qt system takes ownership of the pointer and is responsible for de-allocating
     // it, so we don't have to
-    QGraphicsScene* graphics_scene;
+    RetainedGraphicsScene* graphics_scene;
     QOpenGLWidget* open_gl_widget;
 };
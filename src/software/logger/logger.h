@@ -10,6 +10,7 @@
 
 #include "software/logger/coloured_cout_sink.h"
 #include "software/logger/custom_logging_levels.h"
+#include "software/logger/structured_logger.h"
 
 /**
  * This class acts as a Singleton that's responsible for initializing the logger.
@@ -66,6 +67,16 @@ class LoggerSingleton
             &LogRotateWithFilter::save);
 
         g3::initializeLogging(logWorker.get());
+
+        // Structured log messages are formatted in the background and then logged
+        // through g3log like any other message, with their original call site
+        structured_log_worker = std::make_unique<StructuredLogWorker>(
+            [](const LogCallSite& call_site, const std::string& message) {
+                LogCapture(call_site.file, call_site.line, call_site.function,
+                           call_site.level)
+                        .stream()
+                    << message;
+            });
     }
 
     // levels is this vector are filtered out of the filtered log rotate sink
@@ -73,4 +84,7 @@ class LoggerSingleton
     const std::string filter_suffix  = "_filtered";
     const std::string log_name       = "thunderbots";
     std::unique_ptr<g3::LogWorker> logWorker;
+    // Declared after the logWorker so that it is destroyed first, and can output the
+    // last structured log messages
+    std::unique_ptr<StructuredLogWorker> structured_log_worker;
 };
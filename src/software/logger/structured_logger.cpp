@@ -0,0 +1,313 @@
+#include "software/logger/structured_logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    /**
+     * The buffers of every thread that has logged a structured message, which the
+     * worker reads from
+     */
+    struct StructuredLogBufferRegistry
+    {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<StructuredLogBuffer>> buffers;
+        bool has_worker = false;
+    };
+
+    StructuredLogBufferRegistry& getRegistry()
+    {
+        static StructuredLogBufferRegistry registry;
+        return registry;
+    }
+
+    /**
+     * Owns a thread's buffer, and marks it as exited when the thread exits so the
+     * worker can free it once it has been read
+     */
+    struct ThreadStructuredLogBuffer
+    {
+        ThreadStructuredLogBuffer() : buffer(std::make_shared<StructuredLogBuffer>())
+        {
+            StructuredLogBufferRegistry& registry = getRegistry();
+            std::scoped_lock lock(registry.mutex);
+            registry.buffers.emplace_back(buffer);
+        }
+
+        ~ThreadStructuredLogBuffer()
+        {
+            buffer->writer_exited = true;
+        }
+
+        std::shared_ptr<StructuredLogBuffer> buffer;
+    };
+
+    // Logged when records are dropped because a thread's buffer was full
+    LogCallSite dropped_records_call_site(WARNING,
+                                          "Dropped {} structured log messages because "
+                                          "a thread logged faster than they were output",
+                                          __FILE__, __LINE__,
+                                          "StructuredLogWorker::flush");
+}  // namespace
+
+LogCallSite::LogCallSite(const LEVELS& level, const char* format, const char* file,
+                         int line, const char* function,
+                         unsigned int max_messages_per_second)
+    : level(level),
+      format(format),
+      file(file),
+      line(line),
+      function(function),
+      max_messages_per_second(max_messages_per_second),
+      window_start(std::chrono::steady_clock::now().time_since_epoch().count()),
+      num_messages_in_window(0),
+      num_suppressed(0)
+{
+}
+
+bool LogCallSite::shouldLog()
+{
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto start     = window_start.load(std::memory_order_relaxed);
+    const auto window_length =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::seconds(1))
+            .count();
+    if (now - start >= window_length &&
+        window_start.compare_exchange_strong(start, now, std::memory_order_relaxed))
+    {
+        num_messages_in_window.store(0, std::memory_order_relaxed);
+    }
+
+    if (num_messages_in_window.fetch_add(1, std::memory_order_relaxed) <
+        max_messages_per_second)
+    {
+        return true;
+    }
+    num_suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+unsigned int LogCallSite::takeNumSuppressed()
+{
+    return num_suppressed.exchange(0, std::memory_order_relaxed);
+}
+
+void addLogArgument(StructuredLogRecord& record, bool value)
+{
+    LogArgument& argument = record.arguments[record.num_arguments++];
+    argument.type         = LogArgument::Type::BOOL;
+    argument.bool_value   = value;
+}
+
+void addLogArgument(StructuredLogRecord& record, double value)
+{
+    LogArgument& argument = record.arguments[record.num_arguments++];
+    argument.type         = LogArgument::Type::DOUBLE;
+    argument.double_value = value;
+}
+
+void addLogArgument(StructuredLogRecord& record, const char* value)
+{
+    LogArgument& argument = record.arguments[record.num_arguments++];
+    argument.type         = LogArgument::Type::STRING;
+
+    size_t length =
+        std::min(std::strlen(value),
+                 StructuredLogRecord::MAX_STRING_DATA_LENGTH - record.string_data_length);
+    std::memcpy(record.string_data.data() + record.string_data_length, value, length);
+    argument.string_value.offset = static_cast<uint16_t>(record.string_data_length);
+    argument.string_value.length = static_cast<uint16_t>(length);
+    record.string_data_length += length;
+}
+
+void addLogArgument(StructuredLogRecord& record, const std::string& value)
+{
+    addLogArgument(record, value.c_str());
+}
+
+StructuredLogBuffer::StructuredLogBuffer()
+    : writer_exited(false), records(), num_written(0), num_read(0), num_dropped(0)
+{
+}
+
+StructuredLogRecord* StructuredLogBuffer::startWrite()
+{
+    size_t write_count = num_written.load(std::memory_order_relaxed);
+    if (write_count - num_read.load(std::memory_order_acquire) == CAPACITY)
+    {
+        num_dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    return &records[write_count % CAPACITY];
+}
+
+void StructuredLogBuffer::finishWrite()
+{
+    num_written.fetch_add(1, std::memory_order_release);
+}
+
+const StructuredLogRecord* StructuredLogBuffer::startRead()
+{
+    size_t read_count = num_read.load(std::memory_order_relaxed);
+    if (read_count == num_written.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+    return &records[read_count % CAPACITY];
+}
+
+void StructuredLogBuffer::finishRead()
+{
+    num_read.fetch_add(1, std::memory_order_release);
+}
+
+unsigned int StructuredLogBuffer::takeNumDropped()
+{
+    return num_dropped.exchange(0, std::memory_order_relaxed);
+}
+
+StructuredLogBuffer& getThreadStructuredLogBuffer()
+{
+    thread_local ThreadStructuredLogBuffer thread_buffer;
+    return *thread_buffer.buffer;
+}
+
+StructuredLogWorker::StructuredLogWorker(OutputFunction output)
+    : output(output), stopped(false)
+{
+    StructuredLogBufferRegistry& registry = getRegistry();
+    {
+        std::scoped_lock lock(registry.mutex);
+        if (registry.has_worker)
+        {
+            throw std::runtime_error("Only one StructuredLogWorker may exist at a time");
+        }
+        registry.has_worker = true;
+    }
+
+    worker_thread = std::thread(&StructuredLogWorker::runWorkerThread, this);
+}
+
+StructuredLogWorker::~StructuredLogWorker()
+{
+    {
+        std::scoped_lock lock(stop_mutex);
+        stopped = true;
+    }
+    stop_cv.notify_one();
+    worker_thread.join();
+    flush();
+
+    StructuredLogBufferRegistry& registry = getRegistry();
+    std::scoped_lock lock(registry.mutex);
+    registry.has_worker = false;
+}
+
+void StructuredLogWorker::flush()
+{
+    std::scoped_lock flush_lock(flush_mutex);
+    StructuredLogBufferRegistry& registry = getRegistry();
+
+    // The registry isn't locked while outputting, so that output functions can log
+    // structured messages themselves
+    std::vector<std::shared_ptr<StructuredLogBuffer>> buffers;
+    {
+        std::scoped_lock registry_lock(registry.mutex);
+        buffers = registry.buffers;
+    }
+
+    unsigned int num_dropped = 0;
+    for (const auto& buffer : buffers)
+    {
+        while (const StructuredLogRecord* record = buffer->startRead())
+        {
+            output(*record->call_site, formatRecord(*record));
+            buffer->finishRead();
+        }
+        num_dropped += buffer->takeNumDropped();
+    }
+
+    if (num_dropped > 0)
+    {
+        StructuredLogRecord record;
+        record.call_site          = &dropped_records_call_site;
+        record.num_suppressed     = 0;
+        record.num_arguments      = 0;
+        record.string_data_length = 0;
+        addLogArgument(record, num_dropped);
+        output(dropped_records_call_site, formatRecord(record));
+    }
+
+    // Every record from an exited thread has been read, so its buffer can be freed
+    std::scoped_lock registry_lock(registry.mutex);
+    registry.buffers.erase(
+        std::remove_if(registry.buffers.begin(), registry.buffers.end(),
+                       [](const std::shared_ptr<StructuredLogBuffer>& buffer) {
+                           return buffer->writer_exited && !buffer->startRead();
+                       }),
+        registry.buffers.end());
+}
+
+std::string StructuredLogWorker::formatRecord(const StructuredLogRecord& record)
+{
+    std::ostringstream message;
+    const std::string format = record.call_site->format;
+    size_t argument_index    = 0;
+    size_t format_index      = 0;
+    while (format_index < format.size())
+    {
+        size_t placeholder_index = format.find("{}", format_index);
+        if (placeholder_index == std::string::npos ||
+            argument_index == record.num_arguments)
+        {
+            message << format.substr(format_index);
+            break;
+        }
+
+        message << format.substr(format_index, placeholder_index - format_index);
+        const LogArgument& argument = record.arguments[argument_index++];
+        switch (argument.type)
+        {
+            case LogArgument::Type::BOOL:
+                message << (argument.bool_value ? "true" : "false");
+                break;
+            case LogArgument::Type::INT:
+                message << argument.int_value;
+                break;
+            case LogArgument::Type::UINT:
+                message << argument.uint_value;
+                break;
+            case LogArgument::Type::DOUBLE:
+                message << argument.double_value;
+                break;
+            case LogArgument::Type::STRING:
+                message.write(record.string_data.data() + argument.string_value.offset,
+                              argument.string_value.length);
+                break;
+        }
+        format_index = placeholder_index + 2;
+    }
+
+    if (record.num_suppressed > 0)
+    {
+        message << " (" << record.num_suppressed << " similar messages were suppressed)";
+    }
+    return message.str();
+}
+
+void StructuredLogWorker::runWorkerThread()
+{
+    std::unique_lock lock(stop_mutex);
+    while (!stop_cv.wait_for(lock, FLUSH_PERIOD, [this]() { return stopped; }))
+    {
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
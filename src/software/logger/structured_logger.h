@@ -0,0 +1,335 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <g3log/loglevels.hpp>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+/**
+ * Structured logging records a call site and the raw values of the arguments on the
+ * calling thread, and leaves formatting the message to a background thread. This keeps
+ * logging cheap for code that may log every tick, like the AI.
+ *
+ * Usage:
+ *
+ *   LOG_STRUCTURED(WARNING, "Could not find a path for robot {}", robot_id);
+ *
+ * Each "{}" in the format string is replaced by the next argument. Arguments must be
+ * bools, numbers, enums, string literals or std::strings. Every call site is rate
+ * limited to LogCallSite::DEFAULT_MAX_MESSAGES_PER_SECOND messages per second, and the
+ * number of messages that were suppressed is added to the next message from that call
+ * site that is logged.
+ *
+ * Messages are only output once a StructuredLogWorker has been created, which the
+ * LoggerSingleton does when the logger is initialized.
+ */
+#define LOG_STRUCTURED(level, format, ...)                                               \
+    do                                                                                   \
+    {                                                                                    \
+        static LogCallSite log_call_site(level, format, __FILE__, __LINE__, __func__);   \
+        logStructured(log_call_site, ##__VA_ARGS__);                                     \
+    } while (false)
+
+/**
+ * The place in the code a structured log message comes from. Each call site is created
+ * once, as a static variable by LOG_STRUCTURED, and limits how often it logs.
+ */
+class LogCallSite
+{
+   public:
+    /**
+     * Creates a new LogCallSite
+     *
+     * @param level The level of the messages logged here
+     * @param format The format string, where each "{}" is replaced by an argument
+     * @param file The file the call site is in
+     * @param line The line the call site is on
+     * @param function The function the call site is in
+     * @param max_messages_per_second The most messages that will be logged from here
+     * each second
+     */
+    explicit LogCallSite(
+        const LEVELS& level, const char* format, const char* file, int line,
+        const char* function,
+        unsigned int max_messages_per_second = DEFAULT_MAX_MESSAGES_PER_SECOND);
+
+    /**
+     * Checks whether a message from this call site should be logged now, or be
+     * suppressed because too many messages have been logged from it in the last second.
+     * Since this is called from many threads without a lock, the limit is approximate.
+     *
+     * @return true if the message should be logged, false if it is suppressed
+     */
+    bool shouldLog();
+
+    /**
+     * Gets the number of messages that have been suppressed since this was last called
+     *
+     * @return the number of suppressed messages
+     */
+    unsigned int takeNumSuppressed();
+
+    const LEVELS level;
+    const char* const format;
+    const char* const file;
+    const int line;
+    const char* const function;
+    const unsigned int max_messages_per_second;
+
+    static constexpr unsigned int DEFAULT_MAX_MESSAGES_PER_SECOND = 10;
+
+   private:
+    std::atomic<std::chrono::steady_clock::rep> window_start;
+    std::atomic<unsigned int> num_messages_in_window;
+    std::atomic<unsigned int> num_suppressed;
+};
+
+/**
+ * The raw value of an argument to a structured log message
+ */
+struct LogArgument
+{
+    enum class Type : uint8_t
+    {
+        BOOL,
+        INT,
+        UINT,
+        DOUBLE,
+        STRING
+    };
+
+    Type type;
+    union
+    {
+        bool bool_value;
+        int64_t int_value;
+        uint64_t uint_value;
+        double double_value;
+        // Where the string is in the record's string data
+        struct
+        {
+            uint16_t offset;
+            uint16_t length;
+        } string_value;
+    };
+};
+
+/**
+ * A structured log message waiting to be formatted. Records have a fixed size so they
+ * can be stored in a StructuredLogBuffer without allocating.
+ */
+struct StructuredLogRecord
+{
+    static constexpr size_t MAX_ARGUMENTS          = 8;
+    static constexpr size_t MAX_STRING_DATA_LENGTH = 128;
+
+    const LogCallSite* call_site;
+    // The number of messages from the call site suppressed before this one
+    unsigned int num_suppressed;
+    size_t num_arguments;
+    std::array<LogArgument, MAX_ARGUMENTS> arguments;
+    // The characters of every string argument. Strings that don't fit are truncated.
+    size_t string_data_length;
+    std::array<char, MAX_STRING_DATA_LENGTH> string_data;
+};
+
+/**
+ * A fixed size queue of StructuredLogRecords that is written by one thread and read by
+ * another without either taking a lock. Every thread that logs structured messages gets
+ * its own buffer. Records are dropped when the buffer is full.
+ */
+class StructuredLogBuffer
+{
+   public:
+    static constexpr size_t CAPACITY = 256;
+
+    StructuredLogBuffer();
+
+    /**
+     * Gets the next record to write. Only the writing thread may call this.
+     *
+     * @return the record to write, or nullptr if the buffer is full, in which case the
+     * record is counted as dropped
+     */
+    StructuredLogRecord* startWrite();
+
+    /**
+     * Makes the record returned by startWrite available to the reader
+     */
+    void finishWrite();
+
+    /**
+     * Gets the oldest record that hasn't been read yet. Only the reading thread may call
+     * this.
+     *
+     * @return the oldest record, or nullptr if there aren't any records to read
+     */
+    const StructuredLogRecord* startRead();
+
+    /**
+     * Frees the record returned by startRead so it can be written again
+     */
+    void finishRead();
+
+    /**
+     * Gets the number of records that have been dropped since this was last called
+     *
+     * @return the number of dropped records
+     */
+    unsigned int takeNumDropped();
+
+    // Set once the writing thread has exited, so no more records will be written
+    std::atomic_bool writer_exited;
+
+   private:
+    std::array<StructuredLogRecord, CAPACITY> records;
+    // These only ever increase, the index of a record is the count modulo CAPACITY
+    std::atomic<size_t> num_written;
+    std::atomic<size_t> num_read;
+    std::atomic<unsigned int> num_dropped;
+};
+
+/**
+ * Formats the structured log messages from every thread's buffer in a background
+ * thread, and passes them to an output function. Only one worker may exist at a time.
+ */
+class StructuredLogWorker
+{
+   public:
+    using OutputFunction =
+        std::function<void(const LogCallSite& call_site, const std::string& message)>;
+
+    /**
+     * Creates a new StructuredLogWorker and starts its background thread
+     *
+     * @param output Called from the background thread with every formatted message
+     *
+     * @throws std::runtime_error if another StructuredLogWorker exists
+     */
+    explicit StructuredLogWorker(OutputFunction output);
+
+    /**
+     * Stops the background thread, after outputting every message logged so far
+     */
+    ~StructuredLogWorker();
+
+    /**
+     * Formats and outputs every message that has been logged so far, on the calling
+     * thread
+     */
+    void flush();
+
+    /**
+     * Formats a structured log message
+     *
+     * @param record The record of the message
+     *
+     * @return the formatted message
+     */
+    static std::string formatRecord(const StructuredLogRecord& record);
+
+   private:
+    /**
+     * Runs the background thread, which flushes the buffers periodically until the
+     * worker is stopped
+     */
+    void runWorkerThread();
+
+    OutputFunction output;
+    // Only one thread may read the buffers at a time
+    std::mutex flush_mutex;
+    std::mutex stop_mutex;
+    std::condition_variable stop_cv;
+    bool stopped;
+    std::thread worker_thread;
+
+    static constexpr std::chrono::milliseconds FLUSH_PERIOD =
+        std::chrono::milliseconds(5);
+};
+
+/**
+ * Gets the calling thread's StructuredLogBuffer, creating it the first time it is used
+ *
+ * @return the calling thread's StructuredLogBuffer
+ */
+StructuredLogBuffer& getThreadStructuredLogBuffer();
+
+/**
+ * Adds an argument to a record
+ *
+ * @param record The record to add the argument to
+ * @param value The value of the argument
+ */
+void addLogArgument(StructuredLogRecord& record, bool value);
+void addLogArgument(StructuredLogRecord& record, double value);
+void addLogArgument(StructuredLogRecord& record, const char* value);
+void addLogArgument(StructuredLogRecord& record, const std::string& value);
+
+template <class T>
+void addLogArgument(StructuredLogRecord& record, const T& value)
+{
+    static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                  "Structured log arguments must be bools, numbers, enums or strings");
+
+    LogArgument& argument = record.arguments[record.num_arguments++];
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        argument.type         = LogArgument::Type::DOUBLE;
+        argument.double_value = static_cast<double>(value);
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        argument.type      = LogArgument::Type::INT;
+        argument.int_value = static_cast<int64_t>(value);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        argument.type      = LogArgument::Type::INT;
+        argument.int_value = static_cast<int64_t>(value);
+    }
+    else
+    {
+        argument.type       = LogArgument::Type::UINT;
+        argument.uint_value = static_cast<uint64_t>(value);
+    }
+}
+
+/**
+ * Records a structured log message from the given call site in the calling thread's
+ * buffer, unless the call site is rate limited or the buffer is full. This never takes
+ * a lock or allocates, except the first time a thread logs.
+ *
+ * @param call_site The call site the message is logged from
+ * @param args The arguments of the message
+ */
+template <class... Args>
+void logStructured(LogCallSite& call_site, const Args&... args)
+{
+    static_assert(sizeof...(Args) <= StructuredLogRecord::MAX_ARGUMENTS,
+                  "Too many arguments to a structured log message");
+
+    if (!call_site.shouldLog())
+    {
+        return;
+    }
+
+    StructuredLogBuffer& buffer = getThreadStructuredLogBuffer();
+    StructuredLogRecord* record = buffer.startWrite();
+    if (!record)
+    {
+        return;
+    }
+    record->call_site          = &call_site;
+    record->num_suppressed     = call_site.takeNumSuppressed();
+    record->num_arguments      = 0;
+    record->string_data_length = 0;
+    (addLogArgument(*record, args), ...);
+    buffer.finishWrite();
+}
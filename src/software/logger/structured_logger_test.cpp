@@ -0,0 +1,168 @@
+#include "software/logger/structured_logger.h"
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class StructuredLoggerTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Creates a worker that stores every message it outputs
+     *
+     * @return the worker
+     */
+    std::unique_ptr<StructuredLogWorker> createWorker()
+    {
+        return std::make_unique<StructuredLogWorker>(
+            [this](const LogCallSite& call_site, const std::string& message) {
+                std::scoped_lock lock(messages_mutex);
+                messages.emplace_back(message);
+            });
+    }
+
+    std::mutex messages_mutex;
+    std::vector<std::string> messages;
+};
+
+TEST_F(StructuredLoggerTest, test_format_every_argument_type)
+{
+    enum class TestEnum
+    {
+        FIRST,
+        SECOND
+    };
+    LogCallSite call_site(INFO, "{} {} {} {} {} {} {}", __FILE__, __LINE__, __func__);
+
+    StructuredLogRecord record;
+    record.call_site          = &call_site;
+    record.num_suppressed     = 0;
+    record.num_arguments      = 0;
+    record.string_data_length = 0;
+    addLogArgument(record, true);
+    addLogArgument(record, -3);
+    addLogArgument(record, 7u);
+    addLogArgument(record, 2.5);
+    addLogArgument(record, "literal");
+    addLogArgument(record, std::string("string"));
+    addLogArgument(record, TestEnum::SECOND);
+
+    EXPECT_EQ("true -3 7 2.5 literal string 1",
+              StructuredLogWorker::formatRecord(record));
+}
+
+TEST_F(StructuredLoggerTest, test_format_with_fewer_arguments_than_placeholders)
+{
+    LogCallSite call_site(INFO, "robot {} at {}", __FILE__, __LINE__, __func__);
+
+    StructuredLogRecord record;
+    record.call_site          = &call_site;
+    record.num_suppressed     = 2;
+    record.num_arguments      = 0;
+    record.string_data_length = 0;
+    addLogArgument(record, 3);
+
+    EXPECT_EQ("robot 3 at {} (2 similar messages were suppressed)",
+              StructuredLogWorker::formatRecord(record));
+}
+
+TEST_F(StructuredLoggerTest, test_long_strings_truncated)
+{
+    LogCallSite call_site(INFO, "{}{}", __FILE__, __LINE__, __func__);
+
+    StructuredLogRecord record;
+    record.call_site          = &call_site;
+    record.num_suppressed     = 0;
+    record.num_arguments      = 0;
+    record.string_data_length = 0;
+    addLogArgument(record, std::string(100, 'a'));
+    addLogArgument(record, std::string(100, 'b'));
+
+    EXPECT_EQ(std::string(100, 'a') +
+                  std::string(StructuredLogRecord::MAX_STRING_DATA_LENGTH - 100, 'b'),
+              StructuredLogWorker::formatRecord(record));
+}
+
+TEST_F(StructuredLoggerTest, test_messages_from_every_thread_output)
+{
+    auto worker = createWorker();
+    LogCallSite call_site(INFO, "thread {} message {}", __FILE__, __LINE__, __func__,
+                          1000);
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; thread++)
+    {
+        threads.emplace_back([&call_site, thread]() {
+            for (int message = 0; message < 10; message++)
+            {
+                logStructured(call_site, thread, message);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    worker->flush();
+
+    std::scoped_lock lock(messages_mutex);
+    EXPECT_EQ(40, messages.size());
+    EXPECT_NE(messages.end(),
+              std::find(messages.begin(), messages.end(), "thread 3 message 9"));
+}
+
+TEST_F(StructuredLoggerTest, test_call_site_rate_limited)
+{
+    auto worker = createWorker();
+    for (unsigned int i = 0; i < 3 * LogCallSite::DEFAULT_MAX_MESSAGES_PER_SECOND; i++)
+    {
+        LOG_STRUCTURED(WARNING, "message {}", i);
+    }
+    worker->flush();
+
+    std::scoped_lock lock(messages_mutex);
+    EXPECT_EQ(LogCallSite::DEFAULT_MAX_MESSAGES_PER_SECOND, messages.size());
+}
+
+TEST_F(StructuredLoggerTest, test_call_site_counts_suppressed_messages)
+{
+    auto worker = createWorker();
+    LogCallSite call_site(INFO, "message", __FILE__, __LINE__, __func__, 1);
+
+    logStructured(call_site);
+    logStructured(call_site);
+    logStructured(call_site);
+    EXPECT_EQ(2, call_site.takeNumSuppressed());
+    EXPECT_EQ(0, call_site.takeNumSuppressed());
+}
+
+TEST_F(StructuredLoggerTest, test_records_dropped_when_buffer_full)
+{
+    LogCallSite call_site(INFO, "message", __FILE__, __LINE__, __func__, 100000);
+
+    // Log from a new thread without a worker so that its buffer fills up
+    std::thread([&call_site]() {
+        for (size_t i = 0; i < StructuredLogBuffer::CAPACITY + 5; i++)
+        {
+            logStructured(call_site);
+        }
+    }).join();
+
+    auto worker = createWorker();
+    worker->flush();
+
+    std::scoped_lock lock(messages_mutex);
+    ASSERT_EQ(StructuredLogBuffer::CAPACITY + 1, messages.size());
+    EXPECT_EQ(
+        "Dropped 5 structured log messages because a thread logged faster than they "
+        "were output",
+        messages.back());
+}
+
+TEST_F(StructuredLoggerTest, test_only_one_worker_at_a_time)
+{
+    auto worker = createWorker();
+    EXPECT_THROW(createWorker(), std::runtime_error);
+}
@@ -0,0 +1,158 @@
+#include "software/metrics/metrics.h"
+
+#include <algorithm>
+#include <limits>
+
+Counter::Counter() : count(0) {}
+
+void Counter::increment(uint64_t amount)
+{
+    count.fetch_add(amount, std::memory_order_relaxed);
+}
+
+uint64_t Counter::value() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+Gauge::Gauge() : current_value(0.0) {}
+
+void Gauge::set(double new_value)
+{
+    current_value.store(new_value, std::memory_order_relaxed);
+}
+
+double Gauge::value() const
+{
+    return current_value.load(std::memory_order_relaxed);
+}
+
+Histogram::Histogram()
+    : buckets(), count(0), sum(0), min(std::numeric_limits<uint64_t>::max()), max(0)
+{
+    for (auto& bucket : buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void Histogram::record(uint64_t value)
+{
+    buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current_min = min.load(std::memory_order_relaxed);
+    while (value < current_min &&
+           !min.compare_exchange_weak(current_min, value, std::memory_order_relaxed))
+    {
+    }
+    uint64_t current_max = max.load(std::memory_order_relaxed);
+    while (value > current_max &&
+           !max.compare_exchange_weak(current_max, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+HistogramSnapshot Histogram::getSnapshot() const
+{
+    std::array<uint64_t, NUM_BUCKETS> bucket_counts;
+    uint64_t bucket_total = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        bucket_counts[i] = buckets[i].load(std::memory_order_relaxed);
+        bucket_total += bucket_counts[i];
+    }
+
+    if (bucket_total == 0)
+    {
+        return HistogramSnapshot{0, 0.0, 0, 0, 0, 0, 0};
+    }
+
+    uint64_t min_value = min.load(std::memory_order_relaxed);
+    uint64_t max_value = std::max(min_value, max.load(std::memory_order_relaxed));
+    // Percentiles are the middle of a bucket, which can be outside the recorded range
+    auto percentile = [&](double fraction) {
+        return std::clamp(getPercentile(bucket_counts, bucket_total, fraction), min_value,
+                          max_value);
+    };
+
+    return HistogramSnapshot{
+        bucket_total,
+        static_cast<double>(sum.load(std::memory_order_relaxed)) /
+            static_cast<double>(count.load(std::memory_order_relaxed)),
+        min_value,
+        percentile(0.5),
+        percentile(0.9),
+        percentile(0.99),
+        max_value};
+}
+
+size_t Histogram::getBucketIndex(uint64_t value)
+{
+    if (value < SUB_BUCKETS_PER_POWER_OF_TWO)
+    {
+        return static_cast<size_t>(value);
+    }
+
+    // The index of the highest set bit, which is at least SUB_BUCKET_BITS
+    unsigned int exponent = 63 - static_cast<unsigned int>(__builtin_clzll(value));
+    unsigned int shift    = exponent - SUB_BUCKET_BITS;
+    size_t sub_bucket =
+        static_cast<size_t>(value >> shift) - SUB_BUCKETS_PER_POWER_OF_TWO;
+    return SUB_BUCKETS_PER_POWER_OF_TWO * (shift + 1) + sub_bucket;
+}
+
+uint64_t Histogram::getBucketLowerBound(size_t bucket_index)
+{
+    if (bucket_index < SUB_BUCKETS_PER_POWER_OF_TWO)
+    {
+        return bucket_index;
+    }
+
+    size_t shift      = bucket_index / SUB_BUCKETS_PER_POWER_OF_TWO - 1;
+    size_t sub_bucket = bucket_index % SUB_BUCKETS_PER_POWER_OF_TWO;
+    return static_cast<uint64_t>(SUB_BUCKETS_PER_POWER_OF_TWO + sub_bucket) << shift;
+}
+
+uint64_t Histogram::getBucketUpperBound(size_t bucket_index)
+{
+    if (bucket_index < SUB_BUCKETS_PER_POWER_OF_TWO)
+    {
+        return bucket_index;
+    }
+
+    size_t shift = bucket_index / SUB_BUCKETS_PER_POWER_OF_TWO - 1;
+    return getBucketLowerBound(bucket_index) + ((uint64_t{1} << shift) - 1);
+}
+
+uint64_t Histogram::getPercentile(const std::array<uint64_t, NUM_BUCKETS>& bucket_counts,
+                                  uint64_t count, double fraction)
+{
+    // The rank of the value, counting from 1
+    uint64_t rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(fraction * static_cast<double>(count) + 0.5));
+    uint64_t cumulative_count = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        cumulative_count += bucket_counts[i];
+        if (cumulative_count >= rank)
+        {
+            uint64_t lower_bound = getBucketLowerBound(i);
+            return lower_bound + (getBucketUpperBound(i) - lower_bound) / 2;
+        }
+    }
+    return getBucketUpperBound(NUM_BUCKETS - 1);
+}
+
+ScopedHistogramTimer::ScopedHistogramTimer(Histogram& histogram)
+    : histogram(histogram), start_time(std::chrono::steady_clock::now())
+{
+}
+
+ScopedHistogramTimer::~ScopedHistogramTimer()
+{
+    auto elapsed = std::chrono::steady_clock::now() - start_time;
+    histogram.record(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+}
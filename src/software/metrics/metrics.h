@@ -0,0 +1,184 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * A count of events, like the number of values dropped from a buffer. Counters can be
+ * incremented from any thread without taking a lock.
+ */
+class Counter
+{
+   public:
+    Counter();
+
+    /**
+     * Adds to the count
+     *
+     * @param amount The amount to add
+     */
+    void increment(uint64_t amount = 1);
+
+    /**
+     * Returns the count
+     *
+     * @return the count
+     */
+    uint64_t value() const;
+
+   private:
+    std::atomic<uint64_t> count;
+};
+
+/**
+ * The latest value of a measurement, like the number of robots being tracked. Gauges can
+ * be set from any thread without taking a lock.
+ */
+class Gauge
+{
+   public:
+    Gauge();
+
+    /**
+     * Sets the value of the gauge
+     *
+     * @param new_value The new value
+     */
+    void set(double new_value);
+
+    /**
+     * Returns the value of the gauge
+     *
+     * @return the value of the gauge
+     */
+    double value() const;
+
+   private:
+    std::atomic<double> current_value;
+};
+
+/**
+ * A summary of the values recorded by a Histogram
+ */
+struct HistogramSnapshot
+{
+    uint64_t count;
+    double mean;
+    uint64_t min;
+    uint64_t p50;
+    uint64_t p90;
+    uint64_t p99;
+    uint64_t max;
+};
+
+/**
+ * Records the distribution of non-negative integer values, like tick durations in
+ * microseconds. Values can be recorded from any thread without taking a lock.
+ *
+ * Like an HDR histogram, values are counted in buckets whose width grows with the
+ * value: every power of two range is split into SUB_BUCKETS_PER_POWER_OF_TWO equal
+ * buckets, so percentiles are accurate to within 1 / SUB_BUCKETS_PER_POWER_OF_TWO of
+ * the value, for values of any size, with a fixed amount of memory.
+ */
+class Histogram
+{
+   public:
+    Histogram();
+
+    /**
+     * Records a value
+     *
+     * @param value The value to record
+     */
+    void record(uint64_t value);
+
+    /**
+     * Gets a summary of the values recorded so far. Values recorded while the summary is
+     * being made may only be partly included.
+     *
+     * @return a summary of the values recorded so far
+     */
+    HistogramSnapshot getSnapshot() const;
+
+    /**
+     * Gets the index of the bucket a value is counted in
+     *
+     * @param value The value
+     *
+     * @return the index of the bucket
+     */
+    static size_t getBucketIndex(uint64_t value);
+
+    /**
+     * Gets the smallest value counted in a bucket
+     *
+     * @param bucket_index The index of the bucket
+     *
+     * @return the smallest value counted in the bucket
+     */
+    static uint64_t getBucketLowerBound(size_t bucket_index);
+
+    /**
+     * Gets the largest value counted in a bucket
+     *
+     * @param bucket_index The index of the bucket
+     *
+     * @return the largest value counted in the bucket
+     */
+    static uint64_t getBucketUpperBound(size_t bucket_index);
+
+    static constexpr unsigned int SUB_BUCKET_BITS        = 4;
+    static constexpr size_t SUB_BUCKETS_PER_POWER_OF_TWO = 1 << SUB_BUCKET_BITS;
+    // Values below SUB_BUCKETS_PER_POWER_OF_TWO each get their own bucket, then every
+    // power of two from there up to 2^64 is split into sub buckets
+    static constexpr size_t NUM_BUCKETS =
+        SUB_BUCKETS_PER_POWER_OF_TWO * (64 - SUB_BUCKET_BITS + 1);
+
+   private:
+    /**
+     * Gets the value below which the given fraction of the recorded values are
+     *
+     * @param bucket_counts The count of each bucket
+     * @param count The total count
+     * @param fraction The fraction of values, in [0, 1]
+     *
+     * @return the value, as the middle of the bucket it is in
+     */
+    static uint64_t getPercentile(const std::array<uint64_t, NUM_BUCKETS>& bucket_counts,
+                                  uint64_t count, double fraction);
+
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets;
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> min;
+    std::atomic<uint64_t> max;
+};
+
+/**
+ * Records the time from when it is created to when it is destroyed in a Histogram, in
+ * microseconds
+ */
+class ScopedHistogramTimer
+{
+   public:
+    /**
+     * Starts timing
+     *
+     * @param histogram The histogram to record the time in
+     */
+    explicit ScopedHistogramTimer(Histogram& histogram);
+
+    /**
+     * Records the time since this was created
+     */
+    ~ScopedHistogramTimer();
+
+    ScopedHistogramTimer(const ScopedHistogramTimer&) = delete;
+    ScopedHistogramTimer& operator=(const ScopedHistogramTimer&) = delete;
+
+   private:
+    Histogram& histogram;
+    std::chrono::steady_clock::time_point start_time;
+};
@@ -0,0 +1,48 @@
+#include "software/metrics/metrics_file_writer.h"
+
+#include <stdexcept>
+
+MetricsFileWriter::MetricsFileWriter(const MetricsRegistry& registry,
+                                     const std::string& file_path,
+                                     std::chrono::milliseconds write_period)
+    : registry(registry),
+      file(file_path, std::ios::out | std::ios::trunc),
+      write_period(write_period),
+      start_time(std::chrono::steady_clock::now()),
+      stopped(false)
+{
+    if (!file.is_open())
+    {
+        throw std::invalid_argument("Could not open metrics file " + file_path);
+    }
+    writer_thread = std::thread(&MetricsFileWriter::runWriterThread, this);
+}
+
+MetricsFileWriter::~MetricsFileWriter()
+{
+    {
+        std::scoped_lock lock(stop_mutex);
+        stopped = true;
+    }
+    stop_cv.notify_one();
+    writer_thread.join();
+    writeSnapshot();
+}
+
+void MetricsFileWriter::writeSnapshot()
+{
+    double seconds_since_start =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+    file << "# " << seconds_since_start << " s" << std::endl;
+    file << registry.getSnapshot() << std::endl;
+}
+
+void MetricsFileWriter::runWriterThread()
+{
+    std::unique_lock lock(stop_mutex);
+    while (!stop_cv.wait_for(lock, write_period, [this]() { return stopped; }))
+    {
+        writeSnapshot();
+    }
+}
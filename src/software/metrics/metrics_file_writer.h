@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "software/metrics/metrics_registry.h"
+
+/**
+ * Periodically appends a snapshot of every metric in a registry to a file in a
+ * background thread, so metrics can be compared over the course of a match
+ */
+class MetricsFileWriter
+{
+   public:
+    /**
+     * Creates a new MetricsFileWriter and starts writing snapshots
+     *
+     * @param registry The registry to write snapshots of
+     * @param file_path The path of the file to write to, which is overwritten
+     * @param write_period How often to write a snapshot
+     *
+     * @throws std::invalid_argument if the file can't be opened
+     */
+    explicit MetricsFileWriter(const MetricsRegistry& registry,
+                               const std::string& file_path,
+                               std::chrono::milliseconds write_period);
+
+    /**
+     * Writes a final snapshot and stops the background thread
+     */
+    ~MetricsFileWriter();
+
+   private:
+    /**
+     * Writes a snapshot of the registry to the file
+     */
+    void writeSnapshot();
+
+    /**
+     * Runs the background thread, which writes snapshots until this is destroyed
+     */
+    void runWriterThread();
+
+    const MetricsRegistry& registry;
+    std::ofstream file;
+    const std::chrono::milliseconds write_period;
+    const std::chrono::steady_clock::time_point start_time;
+
+    std::mutex stop_mutex;
+    std::condition_variable stop_cv;
+    bool stopped;
+    std::thread writer_thread;
+};
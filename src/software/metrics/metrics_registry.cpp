@@ -0,0 +1,90 @@
+#include "software/metrics/metrics_registry.h"
+
+#include <ostream>
+
+namespace
+{
+    /**
+     * Gets the metric with the given name, creating it if it doesn't exist
+     *
+     * @param metrics The metrics of one type, by name
+     * @param name The name of the metric
+     *
+     * @return the metric
+     */
+    template <class MetricT>
+    MetricT& getOrCreateMetric(std::map<std::string, std::unique_ptr<MetricT>>& metrics,
+                               const std::string& name)
+    {
+        auto& metric = metrics[name];
+        if (!metric)
+        {
+            metric = std::make_unique<MetricT>();
+        }
+        return *metric;
+    }
+}  // namespace
+
+MetricsRegistry& MetricsRegistry::getGlobalRegistry()
+{
+    static MetricsRegistry registry;
+    return registry;
+}
+
+Counter& MetricsRegistry::getCounter(const std::string& name)
+{
+    std::scoped_lock lock(metrics_mutex);
+    return getOrCreateMetric(counters, name);
+}
+
+Gauge& MetricsRegistry::getGauge(const std::string& name)
+{
+    std::scoped_lock lock(metrics_mutex);
+    return getOrCreateMetric(gauges, name);
+}
+
+Histogram& MetricsRegistry::getHistogram(const std::string& name)
+{
+    std::scoped_lock lock(metrics_mutex);
+    return getOrCreateMetric(histograms, name);
+}
+
+MetricsSnapshot MetricsRegistry::getSnapshot() const
+{
+    std::scoped_lock lock(metrics_mutex);
+
+    MetricsSnapshot snapshot;
+    for (const auto& [name, counter] : counters)
+    {
+        snapshot.counters.emplace_back(name, counter->value());
+    }
+    for (const auto& [name, gauge] : gauges)
+    {
+        snapshot.gauges.emplace_back(name, gauge->value());
+    }
+    for (const auto& [name, histogram] : histograms)
+    {
+        snapshot.histograms.emplace_back(name, histogram->getSnapshot());
+    }
+    return snapshot;
+}
+
+std::ostream& operator<<(std::ostream& os, const MetricsSnapshot& snapshot)
+{
+    for (const auto& [name, value] : snapshot.counters)
+    {
+        os << "counter " << name << " " << value << std::endl;
+    }
+    for (const auto& [name, value] : snapshot.gauges)
+    {
+        os << "gauge " << name << " " << value << std::endl;
+    }
+    for (const auto& [name, histogram] : snapshot.histograms)
+    {
+        os << "histogram " << name << " count=" << histogram.count
+           << " mean=" << histogram.mean << " min=" << histogram.min
+           << " p50=" << histogram.p50 << " p90=" << histogram.p90
+           << " p99=" << histogram.p99 << " max=" << histogram.max << std::endl;
+    }
+    return os;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "software/metrics/metrics.h"
+
+/**
+ * A snapshot of the value of every metric in a MetricsRegistry, sorted by name
+ */
+struct MetricsSnapshot
+{
+    std::vector<std::pair<std::string, uint64_t>> counters;
+    std::vector<std::pair<std::string, double>> gauges;
+    std::vector<std::pair<std::string, HistogramSnapshot>> histograms;
+};
+
+/**
+ * Holds named metrics that subsystems report into, like the AI tick duration or the
+ * number of values dropped from buffers, so they can be exported together.
+ *
+ * Looking up a metric by name takes a lock, so code that reports often should look up
+ * its metrics once and keep the reference. Reporting into a metric never takes a lock.
+ * Metrics are never removed, so the references stay valid for the lifetime of the
+ * registry.
+ *
+ * Metric names are lowercase and dot separated, starting with the subsystem, and end
+ * with the unit if they have one, ex. "sensor_fusion.frame_time_us".
+ */
+class MetricsRegistry
+{
+   public:
+    MetricsRegistry() = default;
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    /**
+     * Returns the registry that every subsystem reports into
+     *
+     * @return the global registry
+     */
+    static MetricsRegistry& getGlobalRegistry();
+
+    /**
+     * Gets the counter with the given name, creating it if it doesn't exist
+     *
+     * @param name The name of the counter
+     *
+     * @return the counter
+     */
+    Counter& getCounter(const std::string& name);
+
+    /**
+     * Gets the gauge with the given name, creating it if it doesn't exist
+     *
+     * @param name The name of the gauge
+     *
+     * @return the gauge
+     */
+    Gauge& getGauge(const std::string& name);
+
+    /**
+     * Gets the histogram with the given name, creating it if it doesn't exist
+     *
+     * @param name The name of the histogram
+     *
+     * @return the histogram
+     */
+    Histogram& getHistogram(const std::string& name);
+
+    /**
+     * Gets a snapshot of the value of every metric
+     *
+     * @return a snapshot of every metric
+     */
+    MetricsSnapshot getSnapshot() const;
+
+   private:
+    mutable std::mutex metrics_mutex;
+    std::map<std::string, std::unique_ptr<Counter>> counters;
+    std::map<std::string, std::unique_ptr<Gauge>> gauges;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+};
+
+/**
+ * Writes a snapshot of every metric as text, with one metric per line
+ *
+ * @param os The stream to write to
+ * @param snapshot The snapshot to write
+ *
+ * @return the stream with the snapshot written to it
+ */
+std::ostream& operator<<(std::ostream& os, const MetricsSnapshot& snapshot);
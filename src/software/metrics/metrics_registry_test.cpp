@@ -0,0 +1,50 @@
+#include "software/metrics/metrics_registry.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+TEST(MetricsRegistryTest, test_same_name_returns_same_metric)
+{
+    MetricsRegistry registry;
+    EXPECT_EQ(&registry.getCounter("test.counter"), &registry.getCounter("test.counter"));
+    EXPECT_EQ(&registry.getGauge("test.gauge"), &registry.getGauge("test.gauge"));
+    EXPECT_EQ(&registry.getHistogram("test.histogram"),
+              &registry.getHistogram("test.histogram"));
+    EXPECT_NE(&registry.getCounter("test.counter"), &registry.getCounter("test.other"));
+}
+
+TEST(MetricsRegistryTest, test_snapshot_sorted_by_name)
+{
+    MetricsRegistry registry;
+    registry.getCounter("b.counter").increment(2);
+    registry.getCounter("a.counter").increment();
+    registry.getGauge("a.gauge").set(1.5);
+    registry.getHistogram("a.histogram_us").record(10);
+
+    MetricsSnapshot snapshot = registry.getSnapshot();
+    ASSERT_EQ(2, snapshot.counters.size());
+    EXPECT_EQ("a.counter", snapshot.counters[0].first);
+    EXPECT_EQ(1, snapshot.counters[0].second);
+    EXPECT_EQ("b.counter", snapshot.counters[1].first);
+    EXPECT_EQ(2, snapshot.counters[1].second);
+    ASSERT_EQ(1, snapshot.gauges.size());
+    EXPECT_DOUBLE_EQ(1.5, snapshot.gauges[0].second);
+    ASSERT_EQ(1, snapshot.histograms.size());
+    EXPECT_EQ(1, snapshot.histograms[0].second.count);
+}
+
+TEST(MetricsRegistryTest, test_snapshot_written_one_metric_per_line)
+{
+    MetricsRegistry registry;
+    registry.getCounter("test.counter").increment(3);
+    registry.getHistogram("test.histogram_us").record(10);
+
+    std::stringstream ss;
+    ss << registry.getSnapshot();
+    EXPECT_EQ(
+        "counter test.counter 3\n"
+        "histogram test.histogram_us count=1 mean=10 min=10 p50=10 p90=10 p99=10 "
+        "max=10\n",
+        ss.str());
+}
@@ -0,0 +1,109 @@
+#include "software/metrics/metrics.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(MetricsTest, test_counter_incremented_from_many_threads)
+{
+    Counter counter;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; thread++)
+    {
+        threads.emplace_back([&counter]() {
+            for (int i = 0; i < 1000; i++)
+            {
+                counter.increment();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(4000, counter.value());
+}
+
+TEST(MetricsTest, test_gauge_keeps_latest_value)
+{
+    Gauge gauge;
+    EXPECT_DOUBLE_EQ(0.0, gauge.value());
+    gauge.set(3.5);
+    gauge.set(-1.25);
+    EXPECT_DOUBLE_EQ(-1.25, gauge.value());
+}
+
+TEST(MetricsTest, test_histogram_buckets_cover_every_value_once)
+{
+    // Every bucket starts right after the previous one ends
+    EXPECT_EQ(0, Histogram::getBucketLowerBound(0));
+    for (size_t i = 1; i < Histogram::NUM_BUCKETS; i++)
+    {
+        EXPECT_EQ(Histogram::getBucketUpperBound(i - 1) + 1,
+                  Histogram::getBucketLowerBound(i));
+    }
+    EXPECT_EQ(UINT64_MAX, Histogram::getBucketUpperBound(Histogram::NUM_BUCKETS - 1));
+
+    for (uint64_t value : {uint64_t{0}, uint64_t{15}, uint64_t{16}, uint64_t{17},
+                           uint64_t{1000}, uint64_t{123456789}, UINT64_MAX})
+    {
+        size_t index = Histogram::getBucketIndex(value);
+        EXPECT_LE(Histogram::getBucketLowerBound(index), value);
+        EXPECT_GE(Histogram::getBucketUpperBound(index), value);
+    }
+}
+
+TEST(MetricsTest, test_histogram_percentiles_within_bucket_precision)
+{
+    Histogram histogram;
+    for (uint64_t value = 1; value <= 10000; value++)
+    {
+        histogram.record(value);
+    }
+
+    HistogramSnapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(10000, snapshot.count);
+    EXPECT_DOUBLE_EQ(5000.5, snapshot.mean);
+    EXPECT_EQ(1, snapshot.min);
+    EXPECT_EQ(10000, snapshot.max);
+
+    const double precision = 1.0 / Histogram::SUB_BUCKETS_PER_POWER_OF_TWO;
+    EXPECT_NEAR(5000, static_cast<double>(snapshot.p50), 5000 * precision);
+    EXPECT_NEAR(9000, static_cast<double>(snapshot.p90), 9000 * precision);
+    EXPECT_NEAR(9900, static_cast<double>(snapshot.p99), 9900 * precision);
+}
+
+TEST(MetricsTest, test_histogram_percentiles_within_recorded_range)
+{
+    // 1475 is near the bottom of its bucket, so the middle of the bucket is larger
+    Histogram histogram;
+    histogram.record(1475);
+
+    HistogramSnapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(1475, snapshot.p50);
+    EXPECT_EQ(1475, snapshot.p90);
+    EXPECT_EQ(1475, snapshot.p99);
+}
+
+TEST(MetricsTest, test_empty_histogram_snapshot)
+{
+    Histogram histogram;
+    HistogramSnapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(0, snapshot.count);
+    EXPECT_EQ(0, snapshot.min);
+    EXPECT_EQ(0, snapshot.max);
+}
+
+TEST(MetricsTest, test_scoped_histogram_timer_records_elapsed_time)
+{
+    Histogram histogram;
+    {
+        ScopedHistogramTimer timer(histogram);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    HistogramSnapshot snapshot = histogram.getSnapshot();
+    EXPECT_EQ(1, snapshot.count);
+    EXPECT_GE(snapshot.min, 2000);
+}
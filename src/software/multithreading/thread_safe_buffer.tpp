@@ -1,6 +1,7 @@
 #pragma once
 
 #include "software/logger/logger.h"
+#include "software/metrics/metrics_registry.h"
 #include "software/util/typename/typename.h"
 
 template <typename T>
@@ -44,11 +45,20 @@ std::optional<T> ThreadSafeBuffer<T>::popMostRecentlyAddedValue(Duration max_wai
 template <typename T>
 void ThreadSafeBuffer<T>::push(const T& value)
 {
+    // Each type of buffer gets its own counter, so it's clear which buffers overflow
+    static Counter& values_dropped_counter =
+        MetricsRegistry::getGlobalRegistry().getCounter(
+            "thread_safe_buffer.values_dropped." + TYPENAME(T));
+
     std::scoped_lock<std::mutex> buffer_lock(buffer_mutex);
-    if (log_buffer_full && buffer.full())
+    if (buffer.full())
     {
-        LOG(WARNING) << "Pushing to a full ThreadSafeBuffer of type: " << TYPENAME(T)
-                     << std::endl;
+        values_dropped_counter.increment();
+        if (log_buffer_full)
+        {
+            LOG(WARNING) << "Pushing to a full ThreadSafeBuffer of type: " << TYPENAME(T)
+                         << std::endl;
+        }
     }
     buffer.push_back(value);
     received_new_value.notify_all();
@@ -1,9 +1,28 @@
 #pragma once
 
+#include <sys/socket.h>
+
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
+#include <chrono>
+#include <mutex>
 #include <string>
+#include <vector>
+
+#include "software/metrics/metrics_registry.h"
+#include "software/networking/proto_multicast_listener_stats.h"
 
+/**
+ * Listens for ReceiveProtoT packets sent to a multicast group.
+ *
+ * Every time the socket becomes readable, all the packets waiting on it are received
+ * with as few system calls as possible (using recvmmsg) and handled in one go, rather
+ * than waking up once per packet. The same message is parsed into for every packet so
+ * that the memory it has allocated is reused.
+ *
+ * The receive stats are also published to the global MetricsRegistry under
+ * "networking.multicast_listener.<port>", so they are exported with the other metrics.
+ */
 template <class ReceiveProtoT>
 class ProtoMulticastListener
 {
@@ -28,26 +47,92 @@ class ProtoMulticastListener
 
     virtual ~ProtoMulticastListener();
 
+    /**
+     * Gets statistics about the packets received so far. This is safe to call from any
+     * thread.
+     *
+     * @return statistics about the packets received so far
+     */
+    ProtoMulticastListenerStats getStats() const;
+
    private:
     /**
-     * This function is setup as the callback to handle packets received over the network.
+     * Waits asynchronously for the socket to have packets to receive
+     */
+    void startListening();
+
+    /**
+     * This function is setup as the callback for when the socket has packets to
+     * receive. It receives and handles every packet waiting on the socket, and then
+     * starts listening again.
+     *
+     * @param error The error code obtained when waiting for incoming data
+     */
+    void handleDataReception(const boost::system::error_code& error);
+
+    /**
+     * Receives a batch of packets waiting on the socket without blocking
      *
-     * @param error The error code obtained when receiving the incoming data
-     * @param num_bytes_received How many bytes of data were received
+     * @return the number of packets received, which is 0 if no packets were waiting or
+     * there was an error
      */
-    void handleDataReception(const boost::system::error_code& error,
-                             size_t num_bytes_received);
+    unsigned int receiveBatch();
+
+    /**
+     * Parses the received packet with the given index in the batch and calls the
+     * receive callback with it, recording the result in the given stats
+     *
+     * @param packet_idx The index of the packet in the batch
+     * @param batch_stats The stats of the batch being handled
+     */
+    void handlePacket(unsigned int packet_idx, ProtoMulticastListenerStats& batch_stats);
+
+    /**
+     * Gets the name of a metric of the listener on the given port
+     *
+     * @param port The port the listener is listening on
+     * @param metric_name The name of the metric, without the listener prefix
+     *
+     * @return the full name of the metric
+     */
+    static std::string getMetricName(unsigned short port, const std::string& metric_name);
 
     // A UDP socket that we listen on for ReceiveProtoT messages from the network
     boost::asio::ip::udp::socket socket_;
-    // The endpoint for the sender
-    boost::asio::ip::udp::endpoint sender_endpoint_;
 
     static constexpr unsigned int MAX_BUFFER_LENGTH = 9000;
-    std::array<char, MAX_BUFFER_LENGTH> raw_received_data_;
+    // The most packets that are received with a single system call
+    static constexpr unsigned int MAX_BATCH_SIZE = 16;
+    // Enough space for the kernel to pass us the number of packets it has dropped
+    static constexpr size_t CONTROL_BUFFER_LENGTH = CMSG_SPACE(sizeof(uint32_t));
+
+    // The buffers each packet in a batch is received into, and the headers passed to
+    // recvmmsg to describe them
+    std::vector<std::array<char, MAX_BUFFER_LENGTH>> raw_received_data_;
+    std::vector<std::array<char, CONTROL_BUFFER_LENGTH>> control_data_;
+    std::vector<iovec> iovecs_;
+    std::vector<mmsghdr> message_headers_;
+
+    // Every packet is parsed into this message, so that the memory allocated for its
+    // fields is reused rather than reallocated for every packet
+    ReceiveProtoT received_proto_;
 
     // The function to call on every received packet of ReceiveProtoT data
     std::function<void(ReceiveProtoT&)> receive_callback;
+
+    const std::chrono::steady_clock::time_point creation_time;
+    mutable std::mutex stats_mutex;
+    ProtoMulticastListenerStats stats;
+
+    // The metrics the stats are published to. These are updated after every wakeup,
+    // except the parse latency which is recorded for every packet
+    Counter& packets_received_counter;
+    Counter& bytes_received_counter;
+    Counter& batches_received_counter;
+    Counter& truncated_packets_counter;
+    Counter& parse_failures_counter;
+    Gauge& packets_dropped_by_kernel_gauge;
+    Histogram& parse_latency_us_histogram;
 };
 
 #include "software/networking/proto_multicast_listener.tpp"
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
 #include "software/logger/logger.h"
 #include "software/networking/proto_multicast_listener.h"
 #include "software/util/typename/typename.h"
@@ -8,7 +12,30 @@ template <class ReceiveProtoT>
 ProtoMulticastListener<ReceiveProtoT>::ProtoMulticastListener(
     boost::asio::io_service& io_service, const std::string& ip_address,
     const unsigned short port, std::function<void(ReceiveProtoT&)> receive_callback)
-    : socket_(io_service), receive_callback(receive_callback)
+    : socket_(io_service),
+      raw_received_data_(MAX_BATCH_SIZE),
+      control_data_(MAX_BATCH_SIZE),
+      iovecs_(MAX_BATCH_SIZE),
+      message_headers_(MAX_BATCH_SIZE),
+      received_proto_(),
+      receive_callback(receive_callback),
+      creation_time(std::chrono::steady_clock::now()),
+      stats_mutex(),
+      stats(),
+      packets_received_counter(MetricsRegistry::getGlobalRegistry().getCounter(
+          getMetricName(port, "packets_received"))),
+      bytes_received_counter(MetricsRegistry::getGlobalRegistry().getCounter(
+          getMetricName(port, "bytes_received"))),
+      batches_received_counter(MetricsRegistry::getGlobalRegistry().getCounter(
+          getMetricName(port, "batches_received"))),
+      truncated_packets_counter(MetricsRegistry::getGlobalRegistry().getCounter(
+          getMetricName(port, "truncated_packets"))),
+      parse_failures_counter(MetricsRegistry::getGlobalRegistry().getCounter(
+          getMetricName(port, "parse_failures"))),
+      packets_dropped_by_kernel_gauge(MetricsRegistry::getGlobalRegistry().getGauge(
+          getMetricName(port, "packets_dropped_by_kernel"))),
+      parse_latency_us_histogram(MetricsRegistry::getGlobalRegistry().getHistogram(
+          getMetricName(port, "parse_latency_us")))
 {
     boost::asio::ip::udp::endpoint listen_endpoint(
         boost::asio::ip::make_address(ip_address), port);
@@ -32,55 +59,220 @@ ProtoMulticastListener<ReceiveProtoT>::ProtoMulticastListener(
     socket_.set_option(boost::asio::ip::multicast::join_group(
         boost::asio::ip::address::from_string(ip_address)));
 
-    // Start listening for data asynchronously
+    // Ask the kernel to tell us how many packets it has dropped because the receive
+    // buffer of the socket was full. This is only used for stats, so it's fine if it
+    // isn't supported
+    int enable_drop_count = 1;
+    if (setsockopt(socket_.native_handle(), SOL_SOCKET, SO_RXQ_OVFL, &enable_drop_count,
+                   sizeof(enable_drop_count)) != 0)
+    {
+        LOG(WARNING) << "MulticastListener: Failed to enable counting packets dropped by "
+                        "the kernel: "
+                     << std::strerror(errno) << std::endl;
+    }
+
+    for (unsigned int i = 0; i < MAX_BATCH_SIZE; i++)
+    {
+        iovecs_[i].iov_base = raw_received_data_[i].data();
+        iovecs_[i].iov_len  = MAX_BUFFER_LENGTH;
+    }
+
+    startListening();
+}
+
+template <class ReceiveProtoT>
+void ProtoMulticastListener<ReceiveProtoT>::startListening()
+{
+    // Start listening for data asynchronously. We only wait for the socket to become
+    // readable here, and receive the data ourselves so that we can receive every
+    // waiting packet at once.
     // See here for a great explanation about asynchronous operations:
     // https://stackoverflow.com/questions/34680985/what-is-the-difference-between-asynchronous-programming-and-multithreading
-    socket_.async_receive_from(boost::asio::buffer(raw_received_data_, MAX_BUFFER_LENGTH),
-                               sender_endpoint_,
-                               boost::bind(&ProtoMulticastListener::handleDataReception,
-                                           this, boost::asio::placeholders::error,
-                                           boost::asio::placeholders::bytes_transferred));
+    socket_.async_wait(boost::asio::ip::udp::socket::wait_read,
+                       boost::bind(&ProtoMulticastListener::handleDataReception, this,
+                                   boost::asio::placeholders::error));
 }
 
 template <class ReceiveProtoT>
 void ProtoMulticastListener<ReceiveProtoT>::handleDataReception(
-    const boost::system::error_code& error, size_t num_bytes_received)
+    const boost::system::error_code& error)
 {
-    if (!error)
+    if (error == boost::asio::error::operation_aborted)
     {
-        auto packet_data = ReceiveProtoT();
-        packet_data.ParseFromArray(raw_received_data_.data(),
-                                   static_cast<int>(num_bytes_received));
-        receive_callback(packet_data);
-
-        // Once we've handled the data, start listening again
-        socket_.async_receive_from(
-            boost::asio::buffer(raw_received_data_, MAX_BUFFER_LENGTH), sender_endpoint_,
-            boost::bind(&ProtoMulticastListener::handleDataReception, this,
-                        boost::asio::placeholders::error,
-                        boost::asio::placeholders::bytes_transferred));
+        // The socket has been closed, so there is nothing left to listen for
+        return;
     }
-    else
-    {
-        // Start listening again to receive the next data
-        socket_.async_receive_from(
-            boost::asio::buffer(raw_received_data_, MAX_BUFFER_LENGTH), sender_endpoint_,
-            boost::bind(&ProtoMulticastListener::handleDataReception, this,
-                        boost::asio::placeholders::error,
-                        boost::asio::placeholders::bytes_transferred));
 
+    if (error)
+    {
         LOG(WARNING)
             << "An unknown network error occurred when attempting to receive ReceiveProtoT Data. The boost system error code is "
             << error << std::endl;
+        // Start listening again to receive the next data
+        startListening();
+        return;
+    }
+
+    ProtoMulticastListenerStats batch_stats;
+    batch_stats.num_batches_received = 1;
+
+    // Keep receiving until we get a batch that isn't full, which means that there are
+    // (most likely) no more packets waiting. Capping the number of batches stops a
+    // flood of packets from starving the other work on the io_service
+    static constexpr unsigned int MAX_BATCHES_PER_WAKEUP = 8;
+    for (unsigned int batch = 0; batch < MAX_BATCHES_PER_WAKEUP; batch++)
+    {
+        unsigned int num_packets = receiveBatch();
+        for (unsigned int i = 0; i < num_packets; i++)
+        {
+            handlePacket(i, batch_stats);
+        }
+
+        if (num_packets < MAX_BATCH_SIZE)
+        {
+            break;
+        }
     }
 
-    if (num_bytes_received > MAX_BUFFER_LENGTH)
     {
+        std::scoped_lock lock(stats_mutex);
+        stats.num_packets_received += batch_stats.num_packets_received;
+        stats.num_bytes_received += batch_stats.num_bytes_received;
+        stats.num_batches_received += batch_stats.num_batches_received;
+        stats.num_truncated_packets += batch_stats.num_truncated_packets;
+        stats.num_parse_failures += batch_stats.num_parse_failures;
+        // The kernel reports the total number of packets it has dropped, rather than
+        // the number dropped since the last packet
+        stats.num_packets_dropped_by_kernel =
+            std::max(stats.num_packets_dropped_by_kernel,
+                     batch_stats.num_packets_dropped_by_kernel);
+        for (size_t i = 0; i < stats.parse_latency_histogram.size(); i++)
+        {
+            stats.parse_latency_histogram[i] += batch_stats.parse_latency_histogram[i];
+        }
+        packets_dropped_by_kernel_gauge.set(
+            static_cast<double>(stats.num_packets_dropped_by_kernel));
+    }
+
+    packets_received_counter.increment(batch_stats.num_packets_received);
+    bytes_received_counter.increment(batch_stats.num_bytes_received);
+    batches_received_counter.increment(batch_stats.num_batches_received);
+    truncated_packets_counter.increment(batch_stats.num_truncated_packets);
+    parse_failures_counter.increment(batch_stats.num_parse_failures);
+
+    // Once we've handled the data, start listening again
+    startListening();
+}
+
+template <class ReceiveProtoT>
+unsigned int ProtoMulticastListener<ReceiveProtoT>::receiveBatch()
+{
+    // recvmmsg overwrites the lengths in the headers, so they have to be reset before
+    // every call
+    for (unsigned int i = 0; i < MAX_BATCH_SIZE; i++)
+    {
+        msghdr& header              = message_headers_[i].msg_hdr;
+        header                      = msghdr();
+        header.msg_iov              = &iovecs_[i];
+        header.msg_iovlen           = 1;
+        header.msg_control          = control_data_[i].data();
+        header.msg_controllen       = CONTROL_BUFFER_LENGTH;
+        message_headers_[i].msg_len = 0;
+    }
+
+    int num_packets = -1;
+    do
+    {
+        num_packets = recvmmsg(socket_.native_handle(), message_headers_.data(),
+                               MAX_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+    } while (num_packets < 0 && errno == EINTR);
+
+    if (num_packets < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            LOG(WARNING) << "An error occurred when attempting to receive "
+                         << TYPENAME(ReceiveProtoT) << " data: " << std::strerror(errno)
+                         << std::endl;
+        }
+        return 0;
+    }
+
+    return static_cast<unsigned int>(num_packets);
+}
+
+template <class ReceiveProtoT>
+void ProtoMulticastListener<ReceiveProtoT>::handlePacket(
+    unsigned int packet_idx, ProtoMulticastListenerStats& batch_stats)
+{
+    const mmsghdr& message_header = message_headers_[packet_idx];
+    size_t num_bytes_received     = message_header.msg_len;
+    batch_stats.num_bytes_received += num_bytes_received;
+
+    for (cmsghdr* control_header = CMSG_FIRSTHDR(&message_header.msg_hdr);
+         control_header != nullptr;
+         control_header =
+             CMSG_NXTHDR(const_cast<msghdr*>(&message_header.msg_hdr), control_header))
+    {
+        if (control_header->cmsg_level == SOL_SOCKET &&
+            control_header->cmsg_type == SO_RXQ_OVFL)
+        {
+            uint32_t num_dropped;
+            std::memcpy(&num_dropped, CMSG_DATA(control_header), sizeof(num_dropped));
+            batch_stats.num_packets_dropped_by_kernel = std::max<uint64_t>(
+                batch_stats.num_packets_dropped_by_kernel, num_dropped);
+        }
+    }
+
+    if (message_header.msg_hdr.msg_flags & MSG_TRUNC)
+    {
+        batch_stats.num_truncated_packets++;
         LOG(WARNING)
-            << "num_bytes_received > MAX_BUFFER_LENGTH, "
-            << "which means that the receive buffer is full and data loss has potentially occurred. "
+            << "Received a packet larger than MAX_BUFFER_LENGTH, "
+            << "which means that it did not fit in the receive buffer and has been dropped. "
             << "Consider increasing MAX_BUFFER_LENGTH";
+        return;
     }
+
+    auto parse_start_time = std::chrono::steady_clock::now();
+    bool parsed = received_proto_.ParseFromArray(raw_received_data_[packet_idx].data(),
+                                                 static_cast<int>(num_bytes_received));
+    std::chrono::duration<double, std::micro> parse_latency =
+        std::chrono::steady_clock::now() - parse_start_time;
+    batch_stats.recordParseLatency(parse_latency.count());
+    parse_latency_us_histogram.record(static_cast<uint64_t>(parse_latency.count()));
+
+    if (!parsed)
+    {
+        batch_stats.num_parse_failures++;
+        return;
+    }
+
+    batch_stats.num_packets_received++;
+    receive_callback(received_proto_);
+}
+
+template <class ReceiveProtoT>
+ProtoMulticastListenerStats ProtoMulticastListener<ReceiveProtoT>::getStats() const
+{
+    std::scoped_lock lock(stats_mutex);
+    ProtoMulticastListenerStats current_stats = stats;
+    std::chrono::duration<double> time_since_creation =
+        std::chrono::steady_clock::now() - creation_time;
+    if (time_since_creation.count() > 0)
+    {
+        current_stats.packets_per_second =
+            static_cast<double>(current_stats.num_packets_received) /
+            time_since_creation.count();
+    }
+    return current_stats;
+}
+
+template <class ReceiveProtoT>
+std::string ProtoMulticastListener<ReceiveProtoT>::getMetricName(
+    unsigned short port, const std::string& metric_name)
+{
+    return "networking.multicast_listener." + std::to_string(port) + "." + metric_name;
 }
 
 template <class ReceiveProtoT>
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/**
+ * Statistics about the packets a ProtoMulticastListener has received
+ */
+struct ProtoMulticastListenerStats
+{
+    // The upper bound of each bucket of the parse latency histogram, in microseconds. The
+    // last bucket holds every parse that took longer than the second last bound
+    static constexpr std::array<double, 10> PARSE_LATENCY_BUCKET_UPPER_BOUNDS_US = {
+        1, 2, 5, 10, 20, 50, 100, 500, 1000, std::numeric_limits<double>::infinity()};
+
+    // The number of packets that were received and parsed successfully
+    uint64_t num_packets_received = 0;
+    // The number of bytes in the packets that were received, including the ones that
+    // could not be parsed
+    uint64_t num_bytes_received = 0;
+    // How many times the listener woke up to receive the packets waiting on the socket
+    uint64_t num_batches_received = 0;
+    // The average number of packets received per second since the listener was created
+    double packets_per_second = 0;
+
+    // The number of packets that were dropped by the kernel because the receive buffer
+    // of the socket was full
+    uint64_t num_packets_dropped_by_kernel = 0;
+    // The number of packets that were dropped because they did not fit in the receive
+    // buffer of the listener
+    uint64_t num_truncated_packets = 0;
+    // The number of packets that were dropped because they could not be parsed
+    uint64_t num_parse_failures = 0;
+
+    // How many parses took at most the corresponding bound in
+    // PARSE_LATENCY_BUCKET_UPPER_BOUNDS_US (and more than the previous bound)
+    std::array<uint64_t, PARSE_LATENCY_BUCKET_UPPER_BOUNDS_US.size()>
+        parse_latency_histogram = {};
+
+    /**
+     * Records how long it took to parse a packet in the parse latency histogram
+     *
+     * @param parse_latency_us How long the parse took, in microseconds
+     */
+    void recordParseLatency(double parse_latency_us)
+    {
+        for (size_t i = 0; i < PARSE_LATENCY_BUCKET_UPPER_BOUNDS_US.size(); i++)
+        {
+            if (parse_latency_us <= PARSE_LATENCY_BUCKET_UPPER_BOUNDS_US[i])
+            {
+                parse_latency_histogram[i]++;
+                return;
+            }
+        }
+    }
+};
@@ -0,0 +1,149 @@
+#include "software/networking/proto_multicast_listener.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include "shared/proto/geometry.pb.h"
+#include "software/networking/proto_multicast_sender.h"
+
+class ProtoMulticastListenerTest : public ::testing::Test
+{
+   protected:
+    /**
+     * Sends a raw packet to the multicast group the listener is listening on
+     *
+     * @param data The contents of the packet
+     */
+    void sendRawPacket(const std::string& data)
+    {
+        boost::asio::ip::udp::socket socket(io_service);
+        boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::make_address(IP_ADDRESS),
+                                                PORT);
+        socket.open(endpoint.protocol());
+        socket.send_to(boost::asio::buffer(data), endpoint);
+    }
+
+    /**
+     * Runs the io_service until the listener has seen the given number of packets, or
+     * until a timeout
+     *
+     * @param listener The listener
+     * @param num_packets The number of packets the listener should have seen, including
+     * the ones that were dropped
+     *
+     * @return the stats of the listener once it has seen the packets or timed out
+     */
+    ProtoMulticastListenerStats receivePackets(
+        ProtoMulticastListener<TbotsProto::Point>& listener, uint64_t num_packets)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        ProtoMulticastListenerStats stats = listener.getStats();
+        while (stats.num_packets_received + stats.num_parse_failures +
+                       stats.num_truncated_packets + stats.num_packets_dropped_by_kernel <
+                   num_packets &&
+               std::chrono::steady_clock::now() < deadline)
+        {
+            io_service.run_one_for(std::chrono::milliseconds(10));
+            stats = listener.getStats();
+        }
+        return stats;
+    }
+
+    /**
+     * Gets the value of a counter of the listener from the global MetricsRegistry
+     *
+     * @param metric_name The name of the counter, without the listener prefix
+     *
+     * @return the value of the counter
+     */
+    static uint64_t getCounterValue(const std::string& metric_name)
+    {
+        return MetricsRegistry::getGlobalRegistry()
+            .getCounter("networking.multicast_listener." + std::to_string(PORT) + "." +
+                        metric_name)
+            .value();
+    }
+
+    static constexpr const char* IP_ADDRESS = "224.5.23.11";
+    static constexpr unsigned short PORT    = 42998;
+
+    boost::asio::io_service io_service;
+};
+
+TEST_F(ProtoMulticastListenerTest, counts_received_and_invalid_packets)
+{
+    const uint64_t initial_packets_received  = getCounterValue("packets_received");
+    const uint64_t initial_parse_failures    = getCounterValue("parse_failures");
+    const uint64_t initial_truncated_packets = getCounterValue("truncated_packets");
+
+    unsigned int num_callbacks = 0;
+    ProtoMulticastListener<TbotsProto::Point> listener(
+        io_service, IP_ADDRESS, PORT, [&num_callbacks](TbotsProto::Point& point) {
+            EXPECT_FLOAT_EQ(1.5f, point.x_meters());
+            num_callbacks++;
+        });
+    ProtoMulticastSender<TbotsProto::Point> sender(io_service, IP_ADDRESS, PORT);
+
+    TbotsProto::Point point;
+    point.set_x_meters(1.5f);
+    point.set_y_meters(-2.0f);
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        sender.sendProto(point);
+    }
+    // Field number 0 is invalid, so this can't be parsed
+    sendRawPacket(std::string(2, '\0'));
+    // Too large to fit in the receive buffer of the listener
+    sendRawPacket(std::string(20000, 'a'));
+
+    ProtoMulticastListenerStats stats = receivePackets(listener, 12);
+
+    EXPECT_EQ(10, stats.num_packets_received);
+    EXPECT_EQ(10, num_callbacks);
+    EXPECT_EQ(1, stats.num_parse_failures);
+    EXPECT_EQ(1, stats.num_truncated_packets);
+    EXPECT_EQ(0, stats.num_packets_dropped_by_kernel);
+    EXPECT_GE(stats.num_batches_received, 1);
+
+    EXPECT_EQ(10, getCounterValue("packets_received") - initial_packets_received);
+    EXPECT_EQ(1, getCounterValue("parse_failures") - initial_parse_failures);
+    EXPECT_EQ(1, getCounterValue("truncated_packets") - initial_truncated_packets);
+}
+
+TEST_F(ProtoMulticastListenerTest, counts_packets_dropped_by_kernel)
+{
+    ProtoMulticastListener<TbotsProto::Point> listener(io_service, IP_ADDRESS, PORT,
+                                                       [](TbotsProto::Point&) {});
+    ProtoMulticastSender<TbotsProto::Point> sender(io_service, IP_ADDRESS, PORT);
+
+    // The io_service isn't run while sending, so nothing is received until every
+    // packet has been sent, and the receive buffer of the socket overflows
+    TbotsProto::Point point;
+    point.set_x_meters(1.5f);
+    const uint64_t num_packets_sent = 20000;
+    for (uint64_t i = 0; i < num_packets_sent; i++)
+    {
+        sender.sendProto(point);
+    }
+
+    // The kernel reports how many packets it has dropped along with the packets it
+    // receives, so once the packets that fit in the receive buffer have been handled,
+    // one more is sent to find out how many were dropped after them
+    while (io_service.poll() > 0)
+    {
+    }
+    sender.sendProto(point);
+    ProtoMulticastListenerStats stats = receivePackets(listener, num_packets_sent + 1);
+
+    EXPECT_GT(stats.num_packets_dropped_by_kernel, 0);
+    EXPECT_GT(stats.num_packets_received, 0);
+    EXPECT_EQ(num_packets_sent + 1,
+              stats.num_packets_received + stats.num_packets_dropped_by_kernel);
+    EXPECT_DOUBLE_EQ(static_cast<double>(stats.num_packets_dropped_by_kernel),
+                     MetricsRegistry::getGlobalRegistry()
+                         .getGauge("networking.multicast_listener." +
+                                   std::to_string(PORT) + ".packets_dropped_by_kernel")
+                         .value());
+}
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <sys/socket.h>
+
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
+#include <mutex>
 #include <string>
+#include <vector>
 
 template <class SendProto>
 class ProtoMulticastSender
@@ -35,7 +39,47 @@ class ProtoMulticastSender
      */
     void sendProto(const SendProto& message);
 
+    /**
+     * Serializes a protobuf message and queues it to be sent by the next call to
+     * sendQueuedProtos. If the queue is full, the message is dropped.
+     *
+     * This is safe to call from any thread.
+     *
+     * @param message The protobuf message to queue
+     *
+     * @return true if the message was queued, false if it was dropped because the queue
+     * was full
+     */
+    bool queueProto(const SendProto& message);
+
+    /**
+     * Sends every queued message over the initialized multicast group and port, using
+     * as few system calls as possible. Messages can be queued while this is running.
+     *
+     * This must not be called from multiple threads at the same time.
+     */
+    void sendQueuedProtos();
+
+    /**
+     * Gets the number of messages that were dropped because the queue was full
+     *
+     * @return the number of messages dropped because the queue was full
+     */
+    size_t getNumDroppedMessages() const;
+
+    // The most messages that can be waiting to be sent
+    static constexpr size_t MAX_QUEUE_SIZE = 32;
+
    private:
+    /**
+     * Serializes the message into the given buffer. The buffer is only resized, so that
+     * once it has grown large enough no more memory is allocated.
+     *
+     * @param message The message to serialize
+     * @param buffer The buffer to serialize the message into
+     */
+    static void serializeToBuffer(const SendProto& message, std::string& buffer);
+
     // A UDP socket to send data over
     boost::asio::ip::udp::socket socket_;
 
@@ -44,6 +88,18 @@ class ProtoMulticastSender
 
     // Buffer to hold serialized protobuf data
     std::string data_buffer;
+
+    // Messages are serialized into the queued buffers, and the queued and sending
+    // buffers are swapped when the queue is sent, so that the buffers (and the memory
+    // they have allocated) are reused
+    mutable std::mutex queue_mutex;
+    std::vector<std::string> queued_buffers;
+    size_t num_queued;
+    size_t num_dropped;
+    std::vector<std::string> sending_buffers;
+    // The headers passed to sendmmsg to send the sending buffers
+    std::vector<iovec> iovecs;
+    std::vector<mmsghdr> message_headers;
 };
 
 #include "software/networking/proto_multicast_sender.tpp"
@@ -1,12 +1,22 @@
 #pragma once
 
+#include <cerrno>
+#include <cstring>
+
 #include "software/logger/logger.h"
 
 template <class SendProto>
 ProtoMulticastSender<SendProto>::ProtoMulticastSender(boost::asio::io_service& io_service,
                                                       const std::string& ip_address,
                                                       const unsigned short port)
-    : socket_(io_service)
+    : socket_(io_service),
+      queue_mutex(),
+      queued_buffers(MAX_QUEUE_SIZE),
+      num_queued(0),
+      num_dropped(0),
+      sending_buffers(MAX_QUEUE_SIZE),
+      iovecs(MAX_QUEUE_SIZE),
+      message_headers(MAX_QUEUE_SIZE)
 {
     boost::asio::ip::address multicast_addr = boost::asio::ip::make_address(ip_address);
 
@@ -20,10 +30,87 @@ ProtoMulticastSender<SendProto>::ProtoMulticastSender(boost::asio::io_service& i
 template <class SendProto>
 void ProtoMulticastSender<SendProto>::sendProto(const SendProto& message)
 {
-    message.SerializeToString(&data_buffer);
+    serializeToBuffer(message, data_buffer);
     socket_.send_to(boost::asio::buffer(data_buffer), receiver_endpoint);
 }
 
+template <class SendProto>
+bool ProtoMulticastSender<SendProto>::queueProto(const SendProto& message)
+{
+    std::scoped_lock lock(queue_mutex);
+    if (num_queued >= MAX_QUEUE_SIZE)
+    {
+        num_dropped++;
+        return false;
+    }
+
+    serializeToBuffer(message, queued_buffers[num_queued]);
+    num_queued++;
+    return true;
+}
+
+template <class SendProto>
+void ProtoMulticastSender<SendProto>::sendQueuedProtos()
+{
+    size_t num_to_send = 0;
+    {
+        std::scoped_lock lock(queue_mutex);
+        queued_buffers.swap(sending_buffers);
+        num_to_send = num_queued;
+        num_queued  = 0;
+    }
+
+    for (size_t i = 0; i < num_to_send; i++)
+    {
+        iovecs[i].iov_base = sending_buffers[i].data();
+        iovecs[i].iov_len  = sending_buffers[i].size();
+
+        msghdr& header     = message_headers[i].msg_hdr;
+        header             = msghdr();
+        header.msg_name    = receiver_endpoint.data();
+        header.msg_namelen = static_cast<socklen_t>(receiver_endpoint.size());
+        header.msg_iov     = &iovecs[i];
+        header.msg_iovlen  = 1;
+    }
+
+    // sendmmsg may send fewer messages than we ask it to, so keep going until they have
+    // all been sent
+    size_t num_sent = 0;
+    while (num_sent < num_to_send)
+    {
+        int result = sendmmsg(socket_.native_handle(), &message_headers[num_sent],
+                              static_cast<unsigned int>(num_to_send - num_sent), 0);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            LOG(WARNING) << "Failed to send " << num_to_send - num_sent
+                         << " queued protos: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        num_sent += static_cast<size_t>(result);
+    }
+}
+
+template <class SendProto>
+size_t ProtoMulticastSender<SendProto>::getNumDroppedMessages() const
+{
+    std::scoped_lock lock(queue_mutex);
+    return num_dropped;
+}
+
+template <class SendProto>
+void ProtoMulticastSender<SendProto>::serializeToBuffer(const SendProto& message,
+                                                        std::string& buffer)
+{
+    // Resizing a std::string never gives back the memory it has already allocated, so
+    // once the buffer has grown to fit the largest message no more memory is allocated
+    buffer.resize(message.ByteSizeLong());
+    message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(buffer.data()));
+}
+
 template <class SendProto>
 ProtoMulticastSender<SendProto>::~ProtoMulticastSender()
 {
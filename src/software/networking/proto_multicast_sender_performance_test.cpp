@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include "shared/constants.h"
+#include "shared/proto/tbots_software_msgs.pb.h"
+#include "software/networking/threaded_proto_multicast_listener.h"
+#include "software/networking/threaded_proto_multicast_sender.h"
+
+/**
+ * Creates a primitive set with a move primitive for every robot, which is about the
+ * size of the primitive sets the AI sends every tick
+ *
+ * @return the primitive set
+ */
+TbotsProto::PrimitiveSet createPrimitiveSet()
+{
+    TbotsProto::PrimitiveSet primitive_set;
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(1234.5);
+    for (unsigned int robot_id = 0; robot_id < MAX_ROBOTS_OVER_RADIO; robot_id++)
+    {
+        auto move = (*primitive_set.mutable_robot_primitives())[robot_id].mutable_move();
+        move->mutable_position_params()->mutable_destination()->set_x_meters(
+            static_cast<float>(robot_id));
+        move->mutable_position_params()->mutable_destination()->set_y_meters(-1.0f);
+        move->mutable_position_params()->set_final_speed_meters_per_second(1.0f);
+        move->mutable_final_angle()->set_radians(3.14f);
+        move->set_dribbler_speed_rpm(1000.0f);
+    }
+    return primitive_set;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(ProtoMulticastSenderPerformanceTest, DISABLED_loopback_send_throughput)
+{
+    const std::string ip_address    = "224.5.23.10";
+    const unsigned short port       = 42999;
+    const unsigned int num_messages = 20000;
+    // How many messages are queued before they are sent when sending in batches
+    const unsigned int batch_size = 8;
+
+    TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+
+    using SendMethod =
+        std::function<void(ThreadedProtoMulticastSender<TbotsProto::PrimitiveSet>&,
+                           ProtoMulticastSender<TbotsProto::PrimitiveSet>&)>;
+    std::vector<std::pair<std::string, SendMethod>> send_methods = {
+        {"Blocking send per message",
+         [&](auto& sender, auto& batch_sender) {
+             for (unsigned int i = 0; i < num_messages; i++)
+             {
+                 sender.sendProto(primitive_set);
+             }
+         }},
+        {"Queue and send in batches of " + std::to_string(batch_size),
+         [&](auto& sender, auto& batch_sender) {
+             for (unsigned int i = 0; i < num_messages; i++)
+             {
+                 batch_sender.queueProto(primitive_set);
+                 if ((i + 1) % batch_size == 0)
+                 {
+                     batch_sender.sendQueuedProtos();
+                 }
+             }
+             batch_sender.sendQueuedProtos();
+         }},
+        {"Async send on the io_service thread",
+         [&](auto& sender, auto& batch_sender) {
+             for (unsigned int i = 0; i < num_messages; i++)
+             {
+                 // Wait for the io_service thread to catch up if the queue is full,
+                 // since we want to measure how fast messages can be sent rather
+                 // than how fast they can be dropped
+                 while (!sender.sendProtoAsync(primitive_set))
+                 {
+                     std::this_thread::yield();
+                 }
+             }
+         }},
+    };
+
+    for (const auto& [name, send_messages] : send_methods)
+    {
+        ThreadedProtoMulticastListener<TbotsProto::PrimitiveSet> listener(
+            ip_address, port, [](TbotsProto::PrimitiveSet) {});
+        ThreadedProtoMulticastSender<TbotsProto::PrimitiveSet> sender(ip_address, port);
+        boost::asio::io_service batch_io_service;
+        ProtoMulticastSender<TbotsProto::PrimitiveSet> batch_sender(batch_io_service,
+                                                                    ip_address, port);
+
+        auto start_time = std::chrono::steady_clock::now();
+        send_messages(sender, batch_sender);
+        std::chrono::duration<double> elapsed_time =
+            std::chrono::steady_clock::now() - start_time;
+
+        // Give the listener time to receive everything that was sent
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        ProtoMulticastListenerStats stats = listener.getStats();
+
+        std::cout << std::endl << name << ":" << std::endl;
+        std::cout << "Messages sent per second = " << num_messages / elapsed_time.count()
+                  << " | Message size = " << primitive_set.ByteSizeLong() << " bytes"
+                  << std::endl;
+        std::cout << "Messages received = " << stats.num_packets_received << " / "
+                  << num_messages << " | Dropped by the receiving kernel = "
+                  << stats.num_packets_dropped_by_kernel << std::endl
+                  << std::endl;
+    }
+}
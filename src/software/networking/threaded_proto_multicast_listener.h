@@ -28,6 +28,13 @@ class ThreadedProtoMulticastListener
 
     ~ThreadedProtoMulticastListener();
 
+    /**
+     * Gets statistics about the packets received so far
+     *
+     * @return statistics about the packets received so far
+     */
+    ProtoMulticastListenerStats getStats() const;
+
    private:
     // The io_service that will be used to service all network requests
     boost::asio::io_service io_service;
@@ -25,3 +25,10 @@ ThreadedProtoMulticastListener<ReceiveProtoT>::~ThreadedProtoMulticastListener()
     // `std::terminate` when we deallocate the thread object and kill our whole program
     io_service_thread.join();
 }
+
+template <class ReceiveProtoT>
+ProtoMulticastListenerStats ThreadedProtoMulticastListener<ReceiveProtoT>::getStats()
+    const
+{
+    return multicast_listener.getStats();
+}
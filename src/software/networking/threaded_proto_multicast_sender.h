@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 #include <string>
@@ -32,10 +33,28 @@ class ThreadedProtoMulticastSender
      */
     void sendProto(const SendProto& message);
 
+    /**
+     * Queues a protobuf message to be sent over the initialized multicast group and port
+     * on the io_service thread, and returns without waiting for it to be sent. Messages
+     * queued before the io_service thread gets to them are sent together with a single
+     * system call. Messages still queued when the sender is destroyed are not sent.
+     *
+     * @param message The protobuf message to send over the multicast group
+     *
+     * @return true if the message was queued, false if it was dropped because
+     * ProtoMulticastSender::MAX_QUEUE_SIZE messages were already waiting to be sent
+     */
+    bool sendProtoAsync(const SendProto& message);
+
    private:
     // The io_service that will be used to service all network requests
     boost::asio::io_service io_service;
+    // Keeps the io_service running while there are no messages to send
+    boost::asio::executor_work_guard<boost::asio::io_service::executor_type> work_guard;
     ProtoMulticastSender<SendProto> multicast_sender;
+    // Whether sending the queued messages has been posted to the io_service and has not
+    // started yet
+    std::atomic_bool send_queued_protos_posted;
     // The thread running the io_service in the background. This thread will run for the
     // entire lifetime of the class
     std::thread io_service_thread;
@@ -4,7 +4,9 @@ template <class SendProto>
 ThreadedProtoMulticastSender<SendProto>::ThreadedProtoMulticastSender(
     const std::string& ip_address, const unsigned short port)
     : io_service(),
+      work_guard(boost::asio::make_work_guard(io_service)),
       multicast_sender(io_service, ip_address, port),
+      send_queued_protos_posted(false),
       io_service_thread([this]() { io_service.run(); })
 {
 }
@@ -29,3 +31,25 @@ void ThreadedProtoMulticastSender<SendProto>::sendProto(const SendProto& message
 {
     multicast_sender.sendProto(message);
 }
+
+template <class SendProto>
+bool ThreadedProtoMulticastSender<SendProto>::sendProtoAsync(const SendProto& message)
+{
+    if (!multicast_sender.queueProto(message))
+    {
+        return false;
+    }
+
+    // Only post once for all the messages queued before the io_service thread starts
+    // sending them, so they are sent together
+    if (!send_queued_protos_posted.exchange(true))
+    {
+        boost::asio::post(io_service, [this]() {
+            // Clear the flag first, so messages queued while we're sending are sent
+            // by another post
+            send_queued_protos_posted = false;
+            multicast_sender.sendQueuedProtos();
+        });
+    }
+    return true;
+}
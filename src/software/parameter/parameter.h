@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 
+#include "software/parameter/parameter_value_storage.h"
+
 template <class T>
 class Parameter
 {
@@ -17,21 +19,20 @@ class Parameter
      * @param name The name of the parameter
      * @param value The value for this parameter
      */
-    explicit Parameter<T>(const std::string& name, T value)
+    explicit Parameter<T>(const std::string& name, T value) : value_(value)
     {
-        this->name_  = name;
-        this->value_ = value;
+        this->name_ = name;
     }
 
     /**
-     * Returns the value of this parameter
+     * Returns the value of this parameter. This never blocks, even while the value is
+     * being set from another thread, so it can be called in tight loops.
      *
      * @return the value of this parameter
      */
     const T value() const
     {
-        std::scoped_lock lock(this->value_mutex_);
-        return this->value_;
+        return this->value_.load();
     }
 
     /**
@@ -53,8 +54,10 @@ class Parameter
      */
     virtual bool setValue(const T new_value)
     {
+        // Readers don't take this lock, it only makes sure concurrent calls to setValue
+        // store values and call the callbacks in the same order
         std::scoped_lock value_lock(this->value_mutex_);
-        this->value_ = new_value;
+        this->value_.store(new_value);
 
         std::scoped_lock callback_lock(this->callback_mutex_);
         for (auto callback_func : callback_functions)
@@ -79,7 +82,7 @@ class Parameter
 
    protected:
     // Store the value so it can be retrieved without fetching from the server again
-    T value_;
+    ParameterValueStorage<T> value_;
 
     // Store the name of the parameter
     std::string name_;
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "software/parameter/parameter.h"
+
+/**
+ * A parameter value that is read and set under a mutex, to compare reads against
+ */
+template <class T>
+class MutexParameterValue
+{
+   public:
+    explicit MutexParameterValue(T value) : value_(value) {}
+
+    T value() const
+    {
+        std::scoped_lock lock(value_mutex_);
+        return value_;
+    }
+
+    void setValue(T new_value)
+    {
+        std::scoped_lock lock(value_mutex_);
+        value_ = new_value;
+    }
+
+   private:
+    T value_;
+    mutable std::mutex value_mutex_;
+};
+
+/**
+ * Gets the size of a value, so that reads of the value can't be optimized out
+ *
+ * @param value The value
+ *
+ * @return the size of the value
+ */
+template <class T>
+size_t getValueSize(const T& value)
+{
+    return sizeof(value);
+}
+
+size_t getValueSize(const std::string& value)
+{
+    return value.size();
+}
+
+/**
+ * Reads the parameter from several threads while another thread keeps setting it, like
+ * the AI reading parameters while they're being changed from the GUI
+ *
+ * @param parameter The parameter to read and set
+ * @param values The values to set the parameter to in turn
+ * @param num_reader_threads The number of threads reading the parameter
+ * @param num_reads_per_thread The number of times each thread reads the parameter
+ *
+ * @return the average time each read takes, in nanoseconds
+ */
+template <class ParameterT, class T>
+double measureReadNanoseconds(ParameterT& parameter, const std::vector<T>& values,
+                              unsigned int num_reader_threads,
+                              unsigned int num_reads_per_thread)
+{
+    std::atomic_bool done = false;
+    std::thread setter_thread([&]() {
+        for (size_t i = 0; !done; i = (i + 1) % values.size())
+        {
+            parameter.setValue(values[i]);
+            // The GUI sets parameters far less often than they're read
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+        }
+    });
+
+    std::atomic<size_t> total_value_size = 0;
+    std::vector<std::thread> reader_threads;
+    auto start_time = std::chrono::steady_clock::now();
+    for (unsigned int thread = 0; thread < num_reader_threads; thread++)
+    {
+        reader_threads.emplace_back([&]() {
+            size_t value_size = 0;
+            for (unsigned int i = 0; i < num_reads_per_thread; i++)
+            {
+                value_size += getValueSize(parameter.value());
+            }
+            total_value_size += value_size;
+        });
+    }
+    for (auto& reader_thread : reader_threads)
+    {
+        reader_thread.join();
+    }
+    auto end_time = std::chrono::steady_clock::now();
+
+    done = true;
+    setter_thread.join();
+
+    return std::chrono::duration<double, std::nano>(end_time - start_time).count() /
+           num_reads_per_thread;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(ParameterPerformanceTest, DISABLED_read_while_setting_from_another_thread)
+{
+    const unsigned int num_reads_per_thread = 1000000;
+
+    for (unsigned int num_reader_threads : {1, 4})
+    {
+        std::vector<double> double_values = {1.0, 2.0, 3.0};
+        Parameter<double> double_parameter("double_parameter", 0.0);
+        MutexParameterValue<double> mutex_double_parameter(0.0);
+
+        std::vector<std::string> string_values = {"vision", "gamecontroller",
+                                                  "a_longer_network_interface_name"};
+        Parameter<std::string> string_parameter("string_parameter", "");
+        MutexParameterValue<std::string> mutex_string_parameter("");
+
+        std::cout << num_reader_threads << " reader thread(s):" << std::endl;
+        std::cout << "double, lock-free = "
+                  << measureReadNanoseconds(double_parameter, double_values,
+                                            num_reader_threads, num_reads_per_thread)
+                  << " ns/read" << std::endl;
+        std::cout << "double, mutex = "
+                  << measureReadNanoseconds(mutex_double_parameter, double_values,
+                                            num_reader_threads, num_reads_per_thread)
+                  << " ns/read" << std::endl;
+        std::cout << "string, snapshot = "
+                  << measureReadNanoseconds(string_parameter, string_values,
+                                            num_reader_threads, num_reads_per_thread)
+                  << " ns/read" << std::endl;
+        std::cout << "string, mutex = "
+                  << measureReadNanoseconds(mutex_string_parameter, string_values,
+                                            num_reader_threads, num_reads_per_thread)
+                  << " ns/read" << std::endl
+                  << std::endl;
+    }
+}
@@ -2,7 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <optional>
+#include <thread>
+#include <vector>
 
 #include "software/parameter/enumerated_parameter.h"
 #include "software/parameter/numeric_parameter.h"
@@ -226,3 +229,96 @@ TEST(ParameterTest, register_callback_on_const_parameter)
     test_param->setValue(1);
     EXPECT_EQ(test_value, 2);
 }
+
+TEST(ParameterTest, read_string_while_setting_from_another_thread)
+{
+    const std::string short_value = "a";
+    const std::string long_value(100, 'b');
+    Parameter<std::string> test_param("test_param", short_value);
+
+    std::atomic_bool done = false;
+    std::thread setter_thread([&]() {
+        for (unsigned int i = 0; i < 10000; i++)
+        {
+            test_param.setValue(i % 2 == 0 ? long_value : short_value);
+        }
+        done = true;
+    });
+
+    // Every read should see one of the complete values that was set
+    bool all_values_complete = true;
+    while (!done)
+    {
+        std::string value = test_param.value();
+        all_values_complete &= value == short_value || value == long_value;
+    }
+    setter_thread.join();
+
+    EXPECT_TRUE(all_values_complete);
+    EXPECT_EQ(short_value, test_param.value());
+}
+
+TEST(ParameterTest, read_string_from_many_threads_while_setting_from_another_thread)
+{
+    const std::string short_value = "a";
+    const std::string long_value(100, 'b');
+    Parameter<std::string> test_param("test_param", short_value);
+
+    std::atomic_bool done                = false;
+    std::atomic_bool all_values_complete = true;
+    std::vector<std::thread> reader_threads;
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        reader_threads.emplace_back([&]() {
+            while (!done)
+            {
+                std::string value = test_param.value();
+                if (value != short_value && value != long_value)
+                {
+                    all_values_complete = false;
+                }
+            }
+        });
+    }
+
+    for (unsigned int i = 0; i < 10000; i++)
+    {
+        test_param.setValue(i % 2 == 0 ? long_value : short_value);
+    }
+    done = true;
+    for (auto& reader_thread : reader_threads)
+    {
+        reader_thread.join();
+    }
+
+    EXPECT_TRUE(all_values_complete);
+    EXPECT_EQ(short_value, test_param.value());
+}
+
+TEST(ParameterTest, read_numeric_parameter_while_setting_from_another_thread)
+{
+    NumericParameter<double> test_param("test_param", 0.0, 0.0, 10000.0);
+
+    std::atomic_bool done = false;
+    std::thread setter_thread([&]() {
+        for (unsigned int i = 1; i <= 10000; i++)
+        {
+            test_param.setValue(static_cast<double>(i));
+        }
+        done = true;
+    });
+
+    // Values are only ever increased, so reads should never go backwards
+    bool values_increasing = true;
+    double last_value      = 0.0;
+    while (!done)
+    {
+        double value = test_param.value();
+        values_increasing &= value >= last_value;
+        last_value = value;
+    }
+    setter_thread.join();
+
+    EXPECT_TRUE(values_increasing);
+    EXPECT_DOUBLE_EQ(10000.0, test_param.value());
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
+/**
+ * Whether values of type T can be stored in a std::atomic that never uses a lock.
+ * std::atomic<T> is only instantiated if T is trivially copyable, since it is ill-formed
+ * otherwise.
+ */
+template <class T>
+struct IsAlwaysLockFreeAtomic : std::bool_constant<std::atomic<T>::is_always_lock_free>
+{
+};
+
+template <class T>
+inline constexpr bool IS_ALWAYS_LOCK_FREE_ATOMIC_V =
+    std::conjunction_v<std::is_trivially_copyable<T>, IsAlwaysLockFreeAtomic<T>>;
+
+/**
+ * Stores the value of a Parameter so that it can be read from any number of threads
+ * without taking a lock, while it is being set from another thread.
+ *
+ * Values that can't be stored in a lock-free std::atomic, like std::string, are double
+ * buffered. Readers copy the current buffer, and announce that they are copying it by
+ * incrementing its reader count. Storing a value writes it into the other buffer once
+ * every reader of that buffer is done, and then makes it the current buffer. A reader
+ * that announces itself on a buffer that is no longer current retries on the new one,
+ * so it never copies a buffer that is being written to. Storing only waits for readers
+ * that started copying the old buffer before the previous store, so no memory is kept
+ * for old values.
+ *
+ * Only one thread should store a value at a time.
+ *
+ * @tparam T The type of the value
+ */
+template <class T, class Enable = void>
+class ParameterValueStorage
+{
+   public:
+    /**
+     * Creates a new ParameterValueStorage
+     *
+     * @param value The initial value
+     */
+    explicit ParameterValueStorage(const T& value)
+        : buffers_{value, value}, num_readers_{0, 0}, current_buffer_(0)
+    {
+    }
+
+    /**
+     * Returns a copy of the current value
+     *
+     * @return a copy of the current value
+     */
+    T load() const
+    {
+        while (true)
+        {
+            const size_t buffer = current_buffer_.load();
+            num_readers_[buffer].fetch_add(1);
+            // The buffer may have stopped being the current one before this reader was
+            // counted, in which case the storing thread could be writing to it
+            if (current_buffer_.load() == buffer)
+            {
+                T value = buffers_[buffer];
+                num_readers_[buffer].fetch_sub(1);
+                return value;
+            }
+            num_readers_[buffer].fetch_sub(1);
+        }
+    }
+
+    /**
+     * Replaces the current value
+     *
+     * @param value The new value
+     */
+    void store(const T& value)
+    {
+        const size_t next_buffer = 1 - current_buffer_.load();
+        // Readers of the other buffer either started copying it before the last store
+        // made it stale, or will see that it is stale and stop reading it, so this only
+        // waits for copies that are already in progress
+        while (num_readers_[next_buffer].load() != 0)
+        {
+            std::this_thread::yield();
+        }
+        buffers_[next_buffer] = value;
+        current_buffer_.store(next_buffer);
+    }
+
+   private:
+    // All the accesses to the reader counts and the current buffer are sequentially
+    // consistent, so that a reader's increment of a count and its check of the current
+    // buffer can't be reordered around the store that makes the buffer stale
+    std::array<T, 2> buffers_;
+    mutable std::array<std::atomic<unsigned int>, 2> num_readers_;
+    std::atomic<size_t> current_buffer_;
+};
+
+/**
+ * Stores values that fit in a lock-free std::atomic, like bools, numbers and enums.
+ * Loads and stores are a single atomic instruction.
+ */
+template <class T>
+class ParameterValueStorage<T, std::enable_if_t<IS_ALWAYS_LOCK_FREE_ATOMIC_V<T>>>
+{
+   public:
+    /**
+     * Creates a new ParameterValueStorage
+     *
+     * @param value The initial value
+     */
+    explicit ParameterValueStorage(const T& value) : value_(value) {}
+
+    /**
+     * Returns a copy of the current value
+     *
+     * @return a copy of the current value
+     */
+    T load() const
+    {
+        return value_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Replaces the current value
+     *
+     * @param value The new value
+     */
+    void store(const T& value)
+    {
+        value_.store(value, std::memory_order_release);
+    }
+
+   private:
+    std::atomic<T> value_;
+};
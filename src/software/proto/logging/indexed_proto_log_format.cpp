@@ -0,0 +1,92 @@
+#include "software/proto/logging/indexed_proto_log_format.h"
+
+#include <google/protobuf/io/gzip_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+std::string compressProtoLogPayload(const char* data, size_t size,
+                                    ProtoLogCompression compression)
+{
+    if (compression == ProtoLogCompression::NONE)
+    {
+        return std::string(data, size);
+    }
+
+    std::string compressed;
+    google::protobuf::io::StringOutputStream string_stream(&compressed);
+    google::protobuf::io::GzipOutputStream::Options options;
+    options.format = google::protobuf::io::GzipOutputStream::ZLIB;
+    google::protobuf::io::GzipOutputStream zlib_stream(&string_stream, options);
+
+    size_t bytes_written = 0;
+    while (bytes_written < size)
+    {
+        void* buffer;
+        int buffer_size;
+        if (!zlib_stream.Next(&buffer, &buffer_size))
+        {
+            throw std::runtime_error("Failed to compress proto log payload");
+        }
+        size_t bytes_to_copy =
+            std::min(static_cast<size_t>(buffer_size), size - bytes_written);
+        std::memcpy(buffer, data + bytes_written, bytes_to_copy);
+        bytes_written += bytes_to_copy;
+        if (bytes_to_copy < static_cast<size_t>(buffer_size))
+        {
+            zlib_stream.BackUp(
+                static_cast<int>(static_cast<size_t>(buffer_size) - bytes_to_copy));
+        }
+    }
+
+    if (!zlib_stream.Close())
+    {
+        throw std::runtime_error("Failed to compress proto log payload");
+    }
+    return compressed;
+}
+
+void decompressProtoLogPayload(const char* data, size_t size,
+                               ProtoLogCompression compression, size_t uncompressed_size,
+                               std::string& output)
+{
+    output.resize(uncompressed_size);
+    if (compression == ProtoLogCompression::NONE)
+    {
+        if (size != uncompressed_size)
+        {
+            throw std::runtime_error("Uncompressed proto log payload has the wrong size");
+        }
+        std::memcpy(output.data(), data, size);
+        return;
+    }
+    if (compression != ProtoLogCompression::ZLIB)
+    {
+        throw std::runtime_error("Unknown proto log payload compression");
+    }
+
+    google::protobuf::io::ArrayInputStream array_stream(data, static_cast<int>(size));
+    google::protobuf::io::GzipInputStream zlib_stream(
+        &array_stream, google::protobuf::io::GzipInputStream::ZLIB);
+
+    size_t bytes_read = 0;
+    const void* buffer;
+    int buffer_size;
+    while (zlib_stream.Next(&buffer, &buffer_size))
+    {
+        size_t bytes_to_copy = static_cast<size_t>(buffer_size);
+        if (bytes_read + bytes_to_copy > uncompressed_size)
+        {
+            throw std::runtime_error("Decompressed proto log payload is too large");
+        }
+        std::memcpy(output.data() + bytes_read, buffer, bytes_to_copy);
+        bytes_read += bytes_to_copy;
+    }
+
+    if (bytes_read != uncompressed_size)
+    {
+        throw std::runtime_error("Failed to decompress proto log payload");
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+/**
+ * Definitions of the on-disk layout of an indexed proto log. An indexed proto log is a
+ * single file with the following layout:
+ *
+ *   ProtoLogFileHeader
+ *   chunk 0
+ *   chunk 1
+ *   ...
+ *   chunk n
+ *   ProtoLogIndexEntry * (n + 1)
+ *   ProtoLogFileFooter
+ *
+ * Each chunk is laid out as:
+ *
+ *   ProtoLogChunkHeader
+ *   message type name (ProtoLogChunkHeader::message_type_size bytes)
+ *   payload (ProtoLogChunkHeader::payload_size bytes, possibly compressed)
+ *
+ * and the uncompressed payload of a chunk is a sequence of messages, each laid out as:
+ *
+ *   ProtoLogMessageHeader
+ *   serialized protobuf message (ProtoLogMessageHeader::message_size bytes)
+ *
+ * Messages within a chunk are sorted by timestamp. The index and footer are only
+ * written when the log is closed, so if the process writing the log crashes the index
+ * can be rebuilt by walking the chunk headers from the start of the file.
+ *
+ * All values are stored in the byte order of the machine that wrote the log, which is
+ * little-endian on every platform we run on.
+ */
+
+enum class ProtoLogCompression : uint32_t
+{
+    NONE = 0,
+    // zlib is used because it is already a dependency of protobuf
+    ZLIB = 1,
+};
+
+struct ProtoLogFileHeader
+{
+    char magic[4];
+    uint32_t version;
+};
+
+struct ProtoLogChunkHeader
+{
+    char magic[4];
+    ProtoLogCompression compression;
+    uint32_t num_messages;
+    uint32_t message_type_size;
+    uint64_t payload_size;
+    uint64_t uncompressed_payload_size;
+    double start_timestamp_seconds;
+    double end_timestamp_seconds;
+};
+
+struct ProtoLogMessageHeader
+{
+    double timestamp_seconds;
+    uint32_t message_size;
+    uint32_t reserved;
+};
+
+struct ProtoLogIndexEntry
+{
+    double start_timestamp_seconds;
+    double end_timestamp_seconds;
+    uint64_t chunk_offset;
+    uint32_t num_messages;
+    uint32_t reserved;
+};
+
+struct ProtoLogFileFooter
+{
+    uint64_t index_offset;
+    uint64_t num_chunks;
+    char magic[4];
+    uint32_t version;
+};
+
+// The headers are written to and read from the file byte-for-byte, so their layout
+// must not depend on the compiler
+static_assert(sizeof(ProtoLogFileHeader) == 8 &&
+                  std::is_trivially_copyable_v<ProtoLogFileHeader>,
+              "Unexpected ProtoLogFileHeader layout");
+static_assert(sizeof(ProtoLogChunkHeader) == 48 &&
+                  std::is_trivially_copyable_v<ProtoLogChunkHeader>,
+              "Unexpected ProtoLogChunkHeader layout");
+static_assert(sizeof(ProtoLogMessageHeader) == 16 &&
+                  std::is_trivially_copyable_v<ProtoLogMessageHeader>,
+              "Unexpected ProtoLogMessageHeader layout");
+static_assert(sizeof(ProtoLogIndexEntry) == 32 &&
+                  std::is_trivially_copyable_v<ProtoLogIndexEntry>,
+              "Unexpected ProtoLogIndexEntry layout");
+static_assert(sizeof(ProtoLogFileFooter) == 24 &&
+                  std::is_trivially_copyable_v<ProtoLogFileFooter>,
+              "Unexpected ProtoLogFileFooter layout");
+
+static constexpr uint32_t PROTO_LOG_FORMAT_VERSION = 1;
+static constexpr char PROTO_LOG_FILE_MAGIC[4]      = {'T', 'B', 'L', 'G'};
+static constexpr char PROTO_LOG_CHUNK_MAGIC[4]     = {'C', 'H', 'N', 'K'};
+static constexpr char PROTO_LOG_FOOTER_MAGIC[4]    = {'T', 'B', 'I', 'X'};
+
+/**
+ * Compresses the given chunk payload
+ *
+ * @param data The uncompressed payload
+ * @param size The size of the uncompressed payload in bytes
+ * @param compression The compression to use
+ *
+ * @throws std::runtime_error if the payload could not be compressed
+ *
+ * @return The compressed payload
+ */
+std::string compressProtoLogPayload(const char* data, size_t size,
+                                    ProtoLogCompression compression);
+
+/**
+ * Decompresses the given chunk payload into the given buffer. The buffer is passed in
+ * so that its memory can be reused between chunks.
+ *
+ * @param data The compressed payload
+ * @param size The size of the compressed payload in bytes
+ * @param compression The compression the payload was compressed with
+ * @param uncompressed_size The size of the payload once decompressed
+ * @param output The buffer to decompress the payload into. It will be resized to
+ * uncompressed_size
+ *
+ * @throws std::runtime_error if the payload could not be decompressed
+ */
+void decompressProtoLogPayload(const char* data, size_t size,
+                               ProtoLogCompression compression, size_t uncompressed_size,
+                               std::string& output);
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "software/proto/logging/indexed_proto_log_reader.h"
+#include "software/time/duration.h"
+
+/**
+ * Plays back the messages in an indexed proto log, calling a callback with each message
+ * at the same rate the messages were originally logged at (scaled by the playback
+ * speed). Playback runs on its own thread, and can be paused, sped up or slowed down,
+ * and moved to any point in the log while it is running.
+ *
+ * The log is read with an IndexedProtoLogReader, so seeking does not read the messages
+ * before the new position, and the next chunk of the log is prefetched in the
+ * background so that loading it does not delay playback.
+ *
+ * @tparam MsgT The type of protobuf message in the log
+ */
+template <typename MsgT>
+class IndexedProtoLogPlayer
+{
+    static_assert(
+        std::is_base_of_v<google::protobuf::Message, MsgT>,
+        "IndexedProtoLogPlayer can only be instantiated with a protobuf message as template parameter!");
+
+   public:
+    /**
+     * Opens the given log and starts playing it back from the start
+     *
+     * @param log_file_path The path of the indexed proto log to play back
+     * @param on_msg_played Called on the playback thread with every message that is
+     * played back
+     * @param start_paused Whether playback should start paused
+     *
+     * @throws std::invalid_argument if the log could not be opened
+     */
+    explicit IndexedProtoLogPlayer(const std::string& log_file_path,
+                                   std::function<void(const MsgT&)> on_msg_played,
+                                   bool start_paused = false);
+
+    IndexedProtoLogPlayer(const IndexedProtoLogPlayer&) = delete;
+    IndexedProtoLogPlayer& operator=(const IndexedProtoLogPlayer&) = delete;
+
+    /**
+     * Stops playback and waits for the playback thread to finish
+     */
+    ~IndexedProtoLogPlayer();
+
+    /**
+     * Resumes playback if it is paused
+     */
+    void play();
+
+    /**
+     * Pauses playback. The message currently being played will finish being played.
+     */
+    void pause();
+
+    /**
+     * Returns whether playback is paused
+     *
+     * @return true if playback is paused, false otherwise
+     */
+    bool isPaused() const;
+
+    /**
+     * Moves playback to the first message at or after the given timestamp. This does not
+     * change whether playback is paused.
+     *
+     * @param timestamp_seconds The timestamp in the log to move playback to
+     */
+    void seekToTimestamp(double timestamp_seconds);
+
+    /**
+     * Sets how fast the log is played back, relative to the rate it was logged at.
+     * AS_FAST_AS_POSSIBLE plays back messages without waiting between them.
+     *
+     * @param playback_speed The playback speed. Must be greater than 0
+     *
+     * @throws std::invalid_argument if the playback speed is not greater than 0
+     */
+    void setPlaybackSpeed(double playback_speed);
+
+    /**
+     * Gets how fast the log is played back, relative to the rate it was logged at
+     *
+     * @return the playback speed
+     */
+    double getPlaybackSpeed() const;
+
+    /**
+     * Gets the timestamp of the message that was played most recently
+     *
+     * @return the timestamp of the last message played, or nullopt if no message has
+     * been played since the player was created or playback was moved
+     */
+    std::optional<double> getCurrentTimestamp() const;
+
+    /**
+     * Gets the timestamp of the first message in the log
+     *
+     * @return the timestamp of the first message, or nullopt if the log is empty
+     */
+    std::optional<double> getStartTimestamp() const;
+
+    /**
+     * Gets the timestamp of the last message in the log
+     *
+     * @return the timestamp of the last message, or nullopt if the log is empty
+     */
+    std::optional<double> getEndTimestamp() const;
+
+    /**
+     * Returns whether every message up to the end of the log has been played. Seeking
+     * to an earlier point in the log starts playback again.
+     *
+     * @return true if playback has reached the end of the log, false otherwise
+     */
+    bool isFinished() const;
+
+    /**
+     * Blocks until playback reaches the end of the log, or the timeout expires
+     *
+     * @param timeout The longest time to wait for
+     *
+     * @return true if playback reached the end of the log, false if the timeout expired
+     */
+    bool waitUntilFinished(const Duration& timeout) const;
+
+    static constexpr double AS_FAST_AS_POSSIBLE = std::numeric_limits<double>::infinity();
+
+   private:
+    /**
+     * Plays back messages until the player is destroyed. This is run on the playback
+     * thread.
+     */
+    void continuouslyPlayMessages();
+
+    std::function<void(const MsgT&)> on_msg_played;
+    // Only used by the playback thread once playback has started, apart from the
+    // timestamps of the log which never change
+    IndexedProtoLogReader reader;
+    const std::optional<double> start_timestamp;
+    const std::optional<double> end_timestamp;
+
+    // Everything below is protected by the mutex
+    mutable std::mutex playback_mutex;
+    // Notified whenever the playback state changes
+    mutable std::condition_variable playback_state_changed;
+    bool paused;
+    bool finished;
+    bool in_destructor;
+    double playback_speed;
+    std::optional<double> seek_timestamp;
+    std::optional<double> current_timestamp;
+    // A timestamp in the log and the time it was (or would have been) played at. The
+    // time to play each message at is calculated relative to this, and it is reset
+    // whenever the timing of playback is changed
+    std::optional<std::pair<double, std::chrono::steady_clock::time_point>>
+        playback_reference;
+
+    std::thread playback_thread;
+};
+
+#include "software/proto/logging/indexed_proto_log_player.tpp"
@@ -0,0 +1,209 @@
+#include "software/logger/logger.h"
+#include "software/proto/logging/indexed_proto_log_player.h"
+
+template <typename MsgT>
+IndexedProtoLogPlayer<MsgT>::IndexedProtoLogPlayer(
+    const std::string& log_file_path, std::function<void(const MsgT&)> on_msg_played,
+    bool start_paused)
+    : on_msg_played(on_msg_played),
+      reader(log_file_path, true),
+      start_timestamp(reader.getStartTimestamp()),
+      end_timestamp(reader.getEndTimestamp()),
+      playback_mutex(),
+      playback_state_changed(),
+      paused(start_paused),
+      finished(false),
+      in_destructor(false),
+      playback_speed(1.0),
+      seek_timestamp(std::nullopt),
+      current_timestamp(std::nullopt),
+      playback_reference(std::nullopt),
+      playback_thread()
+{
+    // Start the thread last so that everything it uses has been initialized
+    playback_thread =
+        std::thread(&IndexedProtoLogPlayer<MsgT>::continuouslyPlayMessages, this);
+}
+
+template <typename MsgT>
+IndexedProtoLogPlayer<MsgT>::~IndexedProtoLogPlayer()
+{
+    {
+        std::scoped_lock lock(playback_mutex);
+        in_destructor = true;
+    }
+    playback_state_changed.notify_all();
+    playback_thread.join();
+}
+
+template <typename MsgT>
+void IndexedProtoLogPlayer<MsgT>::play()
+{
+    {
+        std::scoped_lock lock(playback_mutex);
+        paused = false;
+        playback_reference.reset();
+    }
+    playback_state_changed.notify_all();
+}
+
+template <typename MsgT>
+void IndexedProtoLogPlayer<MsgT>::pause()
+{
+    {
+        std::scoped_lock lock(playback_mutex);
+        paused = true;
+    }
+    playback_state_changed.notify_all();
+}
+
+template <typename MsgT>
+bool IndexedProtoLogPlayer<MsgT>::isPaused() const
+{
+    std::scoped_lock lock(playback_mutex);
+    return paused;
+}
+
+template <typename MsgT>
+void IndexedProtoLogPlayer<MsgT>::seekToTimestamp(double timestamp_seconds)
+{
+    {
+        std::scoped_lock lock(playback_mutex);
+        seek_timestamp = timestamp_seconds;
+        finished       = false;
+        current_timestamp.reset();
+        playback_reference.reset();
+    }
+    playback_state_changed.notify_all();
+}
+
+template <typename MsgT>
+void IndexedProtoLogPlayer<MsgT>::setPlaybackSpeed(double playback_speed)
+{
+    if (!(playback_speed > 0.0))
+    {
+        throw std::invalid_argument("The playback speed must be greater than 0");
+    }
+
+    {
+        std::scoped_lock lock(playback_mutex);
+        this->playback_speed = playback_speed;
+        playback_reference.reset();
+    }
+    playback_state_changed.notify_all();
+}
+
+template <typename MsgT>
+double IndexedProtoLogPlayer<MsgT>::getPlaybackSpeed() const
+{
+    std::scoped_lock lock(playback_mutex);
+    return playback_speed;
+}
+
+template <typename MsgT>
+std::optional<double> IndexedProtoLogPlayer<MsgT>::getCurrentTimestamp() const
+{
+    std::scoped_lock lock(playback_mutex);
+    return current_timestamp;
+}
+
+template <typename MsgT>
+std::optional<double> IndexedProtoLogPlayer<MsgT>::getStartTimestamp() const
+{
+    return start_timestamp;
+}
+
+template <typename MsgT>
+std::optional<double> IndexedProtoLogPlayer<MsgT>::getEndTimestamp() const
+{
+    return end_timestamp;
+}
+
+template <typename MsgT>
+bool IndexedProtoLogPlayer<MsgT>::isFinished() const
+{
+    std::scoped_lock lock(playback_mutex);
+    return finished;
+}
+
+template <typename MsgT>
+bool IndexedProtoLogPlayer<MsgT>::waitUntilFinished(const Duration& timeout) const
+{
+    std::unique_lock lock(playback_mutex);
+    return playback_state_changed.wait_for(
+        lock, std::chrono::duration<double>(timeout.toSeconds()),
+        [this]() { return finished; });
+}
+
+template <typename MsgT>
+void IndexedProtoLogPlayer<MsgT>::continuouslyPlayMessages()
+{
+    std::unique_lock lock(playback_mutex);
+    while (!in_destructor)
+    {
+        std::optional<MsgT> msg;
+        try
+        {
+            if (seek_timestamp)
+            {
+                reader.seekToTimestamp(*seek_timestamp);
+                seek_timestamp.reset();
+            }
+
+            if (paused || finished)
+            {
+                playback_state_changed.wait(lock);
+                continue;
+            }
+
+            std::optional<double> next_timestamp = reader.getNextMsgTimestamp();
+            if (!next_timestamp)
+            {
+                finished = true;
+                playback_state_changed.notify_all();
+                continue;
+            }
+
+            if (!playback_reference)
+            {
+                playback_reference =
+                    std::make_pair(*next_timestamp, std::chrono::steady_clock::now());
+            }
+
+            if (playback_speed != AS_FAST_AS_POSSIBLE)
+            {
+                // replicate the timing of the messages by waiting until the time
+                // between the reference message and this message has passed, scaled by
+                // the playback speed
+                auto play_time = playback_reference->second +
+                                 std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::duration<double>(
+                                         (*next_timestamp - playback_reference->first) /
+                                         playback_speed));
+                if (std::chrono::steady_clock::now() < play_time)
+                {
+                    // The playback state may change while we wait, so check it again
+                    // before playing the message
+                    playback_state_changed.wait_until(lock, play_time);
+                    continue;
+                }
+            }
+
+            msg               = reader.getNextMsg<MsgT>();
+            current_timestamp = next_timestamp;
+        }
+        catch (const std::invalid_argument& e)
+        {
+            LOG(WARNING) << "Stopping playback of corrupted log: " << e.what();
+            finished = true;
+            playback_state_changed.notify_all();
+            continue;
+        }
+
+        // Don't hold the lock while calling the callback, so the callback can control
+        // playback
+        lock.unlock();
+        on_msg_played(*msg);
+        lock.lock();
+    }
+}
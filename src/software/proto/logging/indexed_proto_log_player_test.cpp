@@ -0,0 +1,166 @@
+#include "software/proto/logging/indexed_proto_log_player.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <experimental/filesystem>
+
+#include "software/proto/logging/indexed_proto_log_writer.h"
+#include "software/proto/sensor_msg.pb.h"
+
+namespace fs = std::experimental::filesystem;
+
+class IndexedProtoLogPlayerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        log_path = fs::temp_directory_path() /
+                   ("indexed_proto_log_player_test_" + std::to_string(getpid()) + ".log");
+        fs::remove(log_path);
+
+        // Write messages 0.01s apart, split into multiple chunks
+        IndexedProtoLogWriter writer(log_path, SensorProto::descriptor()->full_name(),
+                                     ProtoLogCompression::ZLIB, 7);
+        for (int i = 0; i < NUM_MESSAGES; i++)
+        {
+            SensorProto msg;
+            msg.mutable_backend_received_time()->set_epoch_timestamp_seconds(
+                getTimestamp(i));
+            writer.addMessage(getTimestamp(i), msg);
+        }
+    }
+
+    void TearDown() override
+    {
+        fs::remove(log_path);
+    }
+
+    /**
+     * Returns the timestamp of the message with the given index in the log
+     *
+     * @param i The index of the message
+     *
+     * @return the timestamp of the message
+     */
+    static double getTimestamp(int i)
+    {
+        return 100.0 + 0.01 * i;
+    }
+
+    /**
+     * Returns a callback for the player that records the timestamps of the messages
+     * played
+     *
+     * @return a callback that records the timestamps of the messages played
+     */
+    std::function<void(const SensorProto&)> recordTimestamps()
+    {
+        return [this](const SensorProto& msg) {
+            std::scoped_lock lock(played_timestamps_mutex);
+            played_timestamps.emplace_back(
+                msg.backend_received_time().epoch_timestamp_seconds());
+        };
+    }
+
+    std::vector<double> getPlayedTimestamps()
+    {
+        std::scoped_lock lock(played_timestamps_mutex);
+        return played_timestamps;
+    }
+
+    static constexpr int NUM_MESSAGES = 30;
+
+    fs::path log_path;
+    std::mutex played_timestamps_mutex;
+    std::vector<double> played_timestamps;
+};
+
+TEST_F(IndexedProtoLogPlayerTest, test_play_whole_log_as_fast_as_possible)
+{
+    IndexedProtoLogPlayer<SensorProto> player(log_path, recordTimestamps(), true);
+    player.setPlaybackSpeed(IndexedProtoLogPlayer<SensorProto>::AS_FAST_AS_POSSIBLE);
+    player.play();
+    ASSERT_TRUE(player.waitUntilFinished(Duration::fromSeconds(5)));
+
+    std::vector<double> expected_timestamps;
+    for (int i = 0; i < NUM_MESSAGES; i++)
+    {
+        expected_timestamps.emplace_back(getTimestamp(i));
+    }
+    EXPECT_EQ(expected_timestamps, getPlayedTimestamps());
+    EXPECT_EQ(getTimestamp(NUM_MESSAGES - 1), player.getCurrentTimestamp());
+    EXPECT_EQ(getTimestamp(0), player.getStartTimestamp());
+    EXPECT_EQ(getTimestamp(NUM_MESSAGES - 1), player.getEndTimestamp());
+}
+
+TEST_F(IndexedProtoLogPlayerTest, test_playback_replicates_original_timing)
+{
+    auto start_time = std::chrono::steady_clock::now();
+    IndexedProtoLogPlayer<SensorProto> player(log_path, recordTimestamps());
+    ASSERT_TRUE(player.waitUntilFinished(Duration::fromSeconds(5)));
+    auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+    // The messages span 0.29s of the original log
+    EXPECT_GE(elapsed_time, std::chrono::milliseconds(280));
+    EXPECT_EQ(NUM_MESSAGES, getPlayedTimestamps().size());
+}
+
+TEST_F(IndexedProtoLogPlayerTest, test_faster_playback_speed)
+{
+    auto start_time = std::chrono::steady_clock::now();
+    IndexedProtoLogPlayer<SensorProto> player(log_path, recordTimestamps(), true);
+    player.setPlaybackSpeed(10.0);
+    player.play();
+    ASSERT_TRUE(player.waitUntilFinished(Duration::fromSeconds(5)));
+    auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+    EXPECT_GE(elapsed_time, std::chrono::milliseconds(28));
+    EXPECT_LT(elapsed_time, std::chrono::milliseconds(280));
+    EXPECT_EQ(NUM_MESSAGES, getPlayedTimestamps().size());
+}
+
+TEST_F(IndexedProtoLogPlayerTest, test_paused_player_does_not_play_messages)
+{
+    IndexedProtoLogPlayer<SensorProto> player(log_path, recordTimestamps(), true);
+    EXPECT_TRUE(player.isPaused());
+    EXPECT_FALSE(player.waitUntilFinished(Duration::fromSeconds(0.1)));
+    EXPECT_TRUE(getPlayedTimestamps().empty());
+    EXPECT_EQ(std::nullopt, player.getCurrentTimestamp());
+}
+
+TEST_F(IndexedProtoLogPlayerTest, test_seek_then_play)
+{
+    IndexedProtoLogPlayer<SensorProto> player(log_path, recordTimestamps(), true);
+    player.setPlaybackSpeed(IndexedProtoLogPlayer<SensorProto>::AS_FAST_AS_POSSIBLE);
+    player.seekToTimestamp(getTimestamp(20) - 0.001);
+    player.play();
+    ASSERT_TRUE(player.waitUntilFinished(Duration::fromSeconds(5)));
+
+    auto timestamps = getPlayedTimestamps();
+    ASSERT_EQ(NUM_MESSAGES - 20, timestamps.size());
+    EXPECT_EQ(getTimestamp(20), timestamps.front());
+}
+
+TEST_F(IndexedProtoLogPlayerTest, test_seek_backwards_after_finishing_restarts_playback)
+{
+    IndexedProtoLogPlayer<SensorProto> player(log_path, recordTimestamps(), true);
+    player.setPlaybackSpeed(IndexedProtoLogPlayer<SensorProto>::AS_FAST_AS_POSSIBLE);
+    player.play();
+    ASSERT_TRUE(player.waitUntilFinished(Duration::fromSeconds(5)));
+
+    player.seekToTimestamp(getTimestamp(NUM_MESSAGES - 3));
+    ASSERT_TRUE(player.waitUntilFinished(Duration::fromSeconds(5)));
+
+    auto timestamps = getPlayedTimestamps();
+    ASSERT_EQ(NUM_MESSAGES + 3, timestamps.size());
+    EXPECT_EQ(getTimestamp(NUM_MESSAGES - 3), timestamps[NUM_MESSAGES]);
+}
+
+TEST_F(IndexedProtoLogPlayerTest, test_invalid_playback_speed_throws_exception)
+{
+    IndexedProtoLogPlayer<SensorProto> player(log_path, recordTimestamps(), true);
+    EXPECT_THROW(player.setPlaybackSpeed(0.0), std::invalid_argument);
+    EXPECT_THROW(player.setPlaybackSpeed(-1.0), std::invalid_argument);
+    EXPECT_EQ(1.0, player.getPlaybackSpeed());
+}
@@ -0,0 +1,369 @@
+#include "software/proto/logging/indexed_proto_log_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+IndexedProtoLogReader::IndexedProtoLogReader(const std::string& file_path,
+                                             bool prefetch_next_chunk)
+    : file_path(file_path),
+      file_data(nullptr),
+      file_size(0),
+      index_rebuilt(false),
+      index(),
+      cur_chunk_idx(0),
+      cur_chunk_loaded(false),
+      cur_chunk_message_type(),
+      cur_chunk_payload(),
+      cur_payload_offset(0),
+      decompressed_payload(),
+      prefetch_next_chunk(prefetch_next_chunk),
+      prefetched_chunk_idx(0),
+      prefetched_chunk()
+{
+    int fd = open(file_path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::invalid_argument("Failed to open " + file_path);
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 ||
+        static_cast<size_t>(file_stat.st_size) < sizeof(ProtoLogFileHeader))
+    {
+        ::close(fd);
+        throw std::invalid_argument(file_path + " is not an indexed proto log!");
+    }
+    file_size = static_cast<size_t>(file_stat.st_size);
+
+    void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the file descriptor is closed
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::invalid_argument("Failed to memory-map " + file_path);
+    }
+    file_data = static_cast<const char*>(mapping);
+
+    ProtoLogFileHeader header;
+    std::memcpy(&header, file_data, sizeof(header));
+    if (std::memcmp(header.magic, PROTO_LOG_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != PROTO_LOG_FORMAT_VERSION)
+    {
+        munmap(const_cast<char*>(file_data), file_size);
+        throw std::invalid_argument(file_path + " is not an indexed proto log!");
+    }
+
+    if (!readIndex())
+    {
+        rebuildIndex();
+        index_rebuilt = true;
+    }
+}
+
+IndexedProtoLogReader::~IndexedProtoLogReader()
+{
+    // The prefetch reads from the mapped file, so it must finish before we unmap it
+    if (prefetched_chunk.valid())
+    {
+        prefetched_chunk.wait();
+    }
+    munmap(const_cast<char*>(file_data), file_size);
+}
+
+std::optional<double> IndexedProtoLogReader::getNextMsgTimestamp()
+{
+    auto serialized_msg = peekNextSerializedMsg();
+    if (!serialized_msg)
+    {
+        return std::nullopt;
+    }
+    return serialized_msg->timestamp_seconds;
+}
+
+void IndexedProtoLogReader::seekToTimestamp(double timestamp_seconds)
+{
+    // Find the first chunk that ends at or after the timestamp
+    auto chunk_it = std::partition_point(
+        index.begin(), index.end(), [timestamp_seconds](const ProtoLogIndexEntry& entry) {
+            return entry.end_timestamp_seconds < timestamp_seconds;
+        });
+    cur_chunk_idx      = static_cast<size_t>(std::distance(index.begin(), chunk_it));
+    cur_chunk_loaded   = false;
+    cur_payload_offset = 0;
+
+    // Messages within a chunk are sorted, so skip forwards until we reach the timestamp
+    while (auto serialized_msg = peekNextSerializedMsg())
+    {
+        if (serialized_msg->timestamp_seconds >= timestamp_seconds)
+        {
+            break;
+        }
+        cur_payload_offset += sizeof(ProtoLogMessageHeader) + serialized_msg->data.size();
+    }
+}
+
+std::optional<double> IndexedProtoLogReader::getStartTimestamp() const
+{
+    if (index.empty())
+    {
+        return std::nullopt;
+    }
+    return index.front().start_timestamp_seconds;
+}
+
+std::optional<double> IndexedProtoLogReader::getEndTimestamp() const
+{
+    if (index.empty())
+    {
+        return std::nullopt;
+    }
+    return index.back().end_timestamp_seconds;
+}
+
+size_t IndexedProtoLogReader::getNumMessages() const
+{
+    size_t num_messages = 0;
+    for (const auto& entry : index)
+    {
+        num_messages += entry.num_messages;
+    }
+    return num_messages;
+}
+
+const std::vector<ProtoLogIndexEntry>& IndexedProtoLogReader::getIndex() const
+{
+    return index;
+}
+
+bool IndexedProtoLogReader::wasIndexRebuilt() const
+{
+    return index_rebuilt;
+}
+
+std::optional<IndexedProtoLogReader::SerializedMessage>
+IndexedProtoLogReader::peekNextSerializedMsg()
+{
+    while (cur_chunk_idx < index.size())
+    {
+        if (!cur_chunk_loaded)
+        {
+            loadChunk(cur_chunk_idx);
+        }
+
+        if (cur_payload_offset + sizeof(ProtoLogMessageHeader) > cur_chunk_payload.size())
+        {
+            cur_chunk_idx++;
+            cur_chunk_loaded   = false;
+            cur_payload_offset = 0;
+            continue;
+        }
+
+        ProtoLogMessageHeader msg_header;
+        std::memcpy(&msg_header, cur_chunk_payload.data() + cur_payload_offset,
+                    sizeof(msg_header));
+        size_t msg_offset = cur_payload_offset + sizeof(msg_header);
+        if (msg_offset + msg_header.message_size > cur_chunk_payload.size())
+        {
+            throw std::invalid_argument("Corrupted message in chunk " +
+                                        std::to_string(cur_chunk_idx) + " of " +
+                                        file_path);
+        }
+
+        return SerializedMessage{
+            .timestamp_seconds = msg_header.timestamp_seconds,
+            .data         = cur_chunk_payload.substr(msg_offset, msg_header.message_size),
+            .message_type = cur_chunk_message_type};
+    }
+    return std::nullopt;
+}
+
+bool IndexedProtoLogReader::readIndex()
+{
+    if (file_size < sizeof(ProtoLogFileHeader) + sizeof(ProtoLogFileFooter))
+    {
+        return false;
+    }
+
+    ProtoLogFileFooter footer;
+    std::memcpy(&footer, file_data + file_size - sizeof(footer), sizeof(footer));
+    if (std::memcmp(footer.magic, PROTO_LOG_FOOTER_MAGIC, sizeof(footer.magic)) != 0 ||
+        footer.version != PROTO_LOG_FORMAT_VERSION ||
+        footer.index_offset < sizeof(ProtoLogFileHeader) ||
+        footer.index_offset > file_size - sizeof(footer) ||
+        footer.num_chunks > (file_size - sizeof(footer) - footer.index_offset) /
+                                sizeof(ProtoLogIndexEntry) ||
+        footer.index_offset + footer.num_chunks * sizeof(ProtoLogIndexEntry) +
+                sizeof(footer) !=
+            file_size)
+    {
+        return false;
+    }
+
+    index.resize(footer.num_chunks);
+    std::memcpy(index.data(), file_data + footer.index_offset,
+                index.size() * sizeof(ProtoLogIndexEntry));
+    return true;
+}
+
+void IndexedProtoLogReader::rebuildIndex()
+{
+    index.clear();
+    uint64_t offset = sizeof(ProtoLogFileHeader);
+    while (auto chunk_header = readChunkHeader(offset))
+    {
+        ProtoLogIndexEntry entry{};
+        entry.start_timestamp_seconds = chunk_header->start_timestamp_seconds;
+        entry.end_timestamp_seconds   = chunk_header->end_timestamp_seconds;
+        entry.chunk_offset            = offset;
+        entry.num_messages            = chunk_header->num_messages;
+        index.emplace_back(entry);
+
+        offset += sizeof(ProtoLogChunkHeader) + chunk_header->message_type_size +
+                  chunk_header->payload_size;
+    }
+}
+
+std::optional<ProtoLogChunkHeader> IndexedProtoLogReader::readChunkHeader(
+    uint64_t offset) const
+{
+    if (offset > file_size || file_size - offset < sizeof(ProtoLogChunkHeader))
+    {
+        return std::nullopt;
+    }
+
+    ProtoLogChunkHeader chunk_header;
+    std::memcpy(&chunk_header, file_data + offset, sizeof(chunk_header));
+    uint64_t remaining_size = file_size - offset - sizeof(chunk_header);
+    if (std::memcmp(chunk_header.magic, PROTO_LOG_CHUNK_MAGIC,
+                    sizeof(chunk_header.magic)) != 0 ||
+        chunk_header.message_type_size > remaining_size ||
+        chunk_header.payload_size > remaining_size - chunk_header.message_type_size)
+    {
+        return std::nullopt;
+    }
+    return chunk_header;
+}
+
+void IndexedProtoLogReader::loadChunk(size_t chunk_idx)
+{
+    ProtoLogChunkHeader chunk_header = getChunkHeader(chunk_idx);
+    uint64_t chunk_offset            = index[chunk_idx].chunk_offset;
+    const char* message_type_data    = getChunkMessageType(chunk_offset);
+    const char* payload_data         = message_type_data + chunk_header.message_type_size;
+    cur_chunk_message_type =
+        std::string_view(message_type_data, chunk_header.message_type_size);
+
+    if (prefetched_chunk.valid() && prefetched_chunk_idx == chunk_idx)
+    {
+        PrefetchedChunk prefetched = prefetched_chunk.get();
+        if (prefetched.decompressed)
+        {
+            decompressed_payload.swap(prefetched.payload);
+        }
+    }
+    else if (isCompressed(chunk_header))
+    {
+        decompressChunk(chunk_idx, chunk_header, decompressed_payload);
+    }
+
+    if (isCompressed(chunk_header))
+    {
+        cur_chunk_payload = decompressed_payload;
+    }
+    else
+    {
+        // Read the messages directly out of the mapped file
+        cur_chunk_payload = std::string_view(payload_data, chunk_header.payload_size);
+    }
+
+    cur_chunk_idx      = chunk_idx;
+    cur_chunk_loaded   = true;
+    cur_payload_offset = 0;
+
+    if (prefetch_next_chunk && chunk_idx + 1 < index.size())
+    {
+        // Assigning to the future waits for any prefetch that has been superseded, so
+        // there is never more than one prefetch in flight
+        prefetched_chunk_idx = chunk_idx + 1;
+        prefetched_chunk =
+            std::async(std::launch::async, &IndexedProtoLogReader::prefetchChunk, this,
+                       prefetched_chunk_idx);
+    }
+}
+
+IndexedProtoLogReader::PrefetchedChunk IndexedProtoLogReader::prefetchChunk(
+    size_t chunk_idx) const
+{
+    ProtoLogChunkHeader chunk_header = getChunkHeader(chunk_idx);
+    PrefetchedChunk prefetched{.decompressed = isCompressed(chunk_header),
+                               .payload      = std::string()};
+    if (prefetched.decompressed)
+    {
+        decompressChunk(chunk_idx, chunk_header, prefetched.payload);
+        return prefetched;
+    }
+
+    // Page the payload into memory so that reading it later does not block on disk
+    uint64_t chunk_offset = index[chunk_idx].chunk_offset;
+    const char* payload_data =
+        getChunkMessageType(chunk_offset) + chunk_header.message_type_size;
+    const size_t page_size  = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t payload_start = reinterpret_cast<uintptr_t>(payload_data);
+    uintptr_t page_start    = payload_start - payload_start % page_size;
+    madvise(reinterpret_cast<void*>(page_start),
+            payload_start - page_start + chunk_header.payload_size, MADV_WILLNEED);
+
+    volatile char page_byte;
+    for (size_t i = 0; i < chunk_header.payload_size; i += page_size)
+    {
+        page_byte = payload_data[i];
+    }
+    (void)page_byte;
+    return prefetched;
+}
+
+ProtoLogChunkHeader IndexedProtoLogReader::getChunkHeader(size_t chunk_idx) const
+{
+    auto chunk_header = readChunkHeader(index.at(chunk_idx).chunk_offset);
+    if (!chunk_header)
+    {
+        throw std::invalid_argument("Corrupted chunk " + std::to_string(chunk_idx) +
+                                    " in " + file_path);
+    }
+    return *chunk_header;
+}
+
+void IndexedProtoLogReader::decompressChunk(size_t chunk_idx,
+                                            const ProtoLogChunkHeader& chunk_header,
+                                            std::string& output) const
+{
+    const char* payload_data = getChunkMessageType(index[chunk_idx].chunk_offset) +
+                               chunk_header.message_type_size;
+    try
+    {
+        decompressProtoLogPayload(payload_data, chunk_header.payload_size,
+                                  chunk_header.compression,
+                                  chunk_header.uncompressed_payload_size, output);
+    }
+    catch (const std::runtime_error& e)
+    {
+        throw std::invalid_argument("Corrupted chunk " + std::to_string(chunk_idx) +
+                                    " in " + file_path + ": " + e.what());
+    }
+}
+
+const char* IndexedProtoLogReader::getChunkMessageType(uint64_t chunk_offset) const
+{
+    return file_data + chunk_offset + sizeof(ProtoLogChunkHeader);
+}
+
+bool IndexedProtoLogReader::isCompressed(const ProtoLogChunkHeader& chunk_header)
+{
+    return chunk_header.compression != ProtoLogCompression::NONE ||
+           chunk_header.payload_size != chunk_header.uncompressed_payload_size;
+}
@@ -0,0 +1,271 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+
+#include <future>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "software/proto/logging/indexed_proto_log_format.h"
+#include "software/util/typename/typename.h"
+
+/**
+ * Reads protobuf messages from an indexed proto log written by an IndexedProtoLogWriter.
+ * See indexed_proto_log_format.h for the layout of the file.
+ *
+ * The file is memory-mapped rather than read into memory, so opening a log only reads
+ * its index, and uncompressed messages are parsed directly from the mapped file. Seeking
+ * to a timestamp binary searches the index for the chunk containing it, so it takes
+ * O(log n) time in the number of chunks.
+ *
+ * The reader can optionally prefetch the chunk after the one currently being read on a
+ * background thread, so that paging in and decompressing the next chunk does not stall
+ * whoever is reading through the log in real time.
+ */
+class IndexedProtoLogReader
+{
+   public:
+    /**
+     * Opens the indexed proto log at the given path. If the log does not have an index
+     * (because the process writing it crashed before it was closed), the index is
+     * rebuilt from all the complete chunks in the file.
+     *
+     * @param file_path The path of the log to read
+     * @param prefetch_next_chunk Whether to prefetch the next chunk of the log on a
+     * background thread whenever a new chunk is loaded
+     *
+     * @throws std::invalid_argument if the file could not be opened or is not an indexed
+     * proto log
+     */
+    explicit IndexedProtoLogReader(const std::string& file_path,
+                                   bool prefetch_next_chunk = false);
+
+    // The reader owns the memory mapping, so it cannot be copied
+    IndexedProtoLogReader(const IndexedProtoLogReader&) = delete;
+    IndexedProtoLogReader& operator=(const IndexedProtoLogReader&) = delete;
+
+    ~IndexedProtoLogReader();
+
+    /**
+     * Returns the next message in the log, parsed into the desired type `MsgT`.
+     * Throws std::invalid_argument if the message is not a `MsgT` or could not be
+     * parsed.
+     *
+     * @return the next message in the log if available, nullopt otherwise
+     */
+    template <typename MsgT>
+    std::optional<MsgT> getNextMsg();
+
+    /**
+     * Returns the timestamp of the message that will be returned by the next call to
+     * `getNextMsg`, without advancing through the log
+     *
+     * @return the timestamp of the next message if available, nullopt otherwise
+     */
+    std::optional<double> getNextMsgTimestamp();
+
+    /**
+     * Moves through the log so that the next message returned is the first message with
+     * a timestamp at or after the given timestamp. If there is no such message, there
+     * will be no next message.
+     *
+     * @param timestamp_seconds The timestamp to seek to
+     */
+    void seekToTimestamp(double timestamp_seconds);
+
+    /**
+     * Gets the timestamp of the first message in the log
+     *
+     * @return the timestamp of the first message, or nullopt if the log is empty
+     */
+    std::optional<double> getStartTimestamp() const;
+
+    /**
+     * Gets the timestamp of the last message in the log
+     *
+     * @return the timestamp of the last message, or nullopt if the log is empty
+     */
+    std::optional<double> getEndTimestamp() const;
+
+    /**
+     * Gets the total number of messages in the log
+     *
+     * @return the number of messages in the log
+     */
+    size_t getNumMessages() const;
+
+    /**
+     * Gets the index of the chunks in the log
+     *
+     * @return the index of the chunks in the log, in the order they were written
+     */
+    const std::vector<ProtoLogIndexEntry>& getIndex() const;
+
+    /**
+     * Returns whether the index was rebuilt from the chunks in the log because the log
+     * was not closed properly
+     *
+     * @return true if the index was rebuilt, and false if it was read from the log
+     */
+    bool wasIndexRebuilt() const;
+
+   private:
+    // A message in the log that has not been parsed yet
+    struct SerializedMessage
+    {
+        double timestamp_seconds;
+        std::string_view data;
+        std::string_view message_type;
+    };
+
+    /**
+     * Returns the next serialized message in the log without advancing through the log
+     *
+     * @return the next serialized message if available, nullopt otherwise
+     */
+    std::optional<SerializedMessage> peekNextSerializedMsg();
+
+    /**
+     * Reads the index from the footer of the log
+     *
+     * @return true if the log has a valid index, and false otherwise
+     */
+    bool readIndex();
+
+    /**
+     * Rebuilds the index by walking the chunk headers from the start of the log, up
+     * until the first incomplete or corrupted chunk
+     */
+    void rebuildIndex();
+
+    /**
+     * Reads the chunk header at the given offset if there is a complete chunk there
+     *
+     * @param offset The offset of the chunk in the file
+     *
+     * @return the chunk header if there is a complete chunk at the offset, nullopt
+     * otherwise
+     */
+    std::optional<ProtoLogChunkHeader> readChunkHeader(uint64_t offset) const;
+
+    /**
+     * Loads the chunk with the given index, decompressing it if necessary, and moves to
+     * the start of it
+     *
+     * @param chunk_idx The index of the chunk to load
+     */
+    void loadChunk(size_t chunk_idx);
+
+    // A chunk that has been loaded ahead of time
+    struct PrefetchedChunk
+    {
+        // Whether the payload had to be decompressed. If not, the payload is read from
+        // the mapped file and the prefetch only paged it into memory
+        bool decompressed;
+        std::string payload;
+    };
+
+    /**
+     * Loads the chunk with the given index ahead of time. This only reads the mapped
+     * file and the index, which do not change after construction, so it is safe to
+     * call from another thread while the log is being read.
+     *
+     * @param chunk_idx The index of the chunk to prefetch
+     *
+     * @return the prefetched chunk
+     */
+    PrefetchedChunk prefetchChunk(size_t chunk_idx) const;
+
+    /**
+     * Reads the header of the chunk with the given index
+     *
+     * @param chunk_idx The index of the chunk
+     *
+     * @throws std::invalid_argument if the chunk is incomplete or corrupted
+     *
+     * @return the chunk header
+     */
+    ProtoLogChunkHeader getChunkHeader(size_t chunk_idx) const;
+
+    /**
+     * Decompresses the payload of the chunk with the given index
+     *
+     * @param chunk_idx The index of the chunk
+     * @param chunk_header The header of the chunk
+     * @param output The buffer to decompress the payload into
+     *
+     * @throws std::invalid_argument if the payload could not be decompressed
+     */
+    void decompressChunk(size_t chunk_idx, const ProtoLogChunkHeader& chunk_header,
+                         std::string& output) const;
+
+    /**
+     * Gets a pointer to the start of the message type of the chunk at the given offset
+     *
+     * @param chunk_offset The offset of the chunk in the file
+     *
+     * @return a pointer to the start of the message type of the chunk
+     */
+    const char* getChunkMessageType(uint64_t chunk_offset) const;
+
+    /**
+     * Returns whether the payload of a chunk has to be decompressed to be read
+     *
+     * @param chunk_header The header of the chunk
+     *
+     * @return true if the payload has to be decompressed, false if it can be read
+     * directly from the mapped file
+     */
+    static bool isCompressed(const ProtoLogChunkHeader& chunk_header);
+
+    std::string file_path;
+    const char* file_data;
+    size_t file_size;
+    bool index_rebuilt;
+    std::vector<ProtoLogIndexEntry> index;
+
+    // The chunk currently being read from
+    size_t cur_chunk_idx;
+    bool cur_chunk_loaded;
+    std::string_view cur_chunk_message_type;
+    std::string_view cur_chunk_payload;
+    size_t cur_payload_offset;
+    // Holds the payload of the current chunk if it had to be decompressed
+    std::string decompressed_payload;
+
+    const bool prefetch_next_chunk;
+    size_t prefetched_chunk_idx;
+    std::future<PrefetchedChunk> prefetched_chunk;
+};
+
+template <typename MsgT>
+std::optional<MsgT> IndexedProtoLogReader::getNextMsg()
+{
+    static_assert(std::is_base_of_v<google::protobuf::Message, MsgT>,
+                  "MsgT must be a derived class of google::protobuf::Message!");
+
+    auto serialized_msg = peekNextSerializedMsg();
+    if (!serialized_msg)
+    {
+        return std::nullopt;
+    }
+
+    if (serialized_msg->message_type != MsgT::descriptor()->full_name())
+    {
+        throw std::invalid_argument("Failed to parse " + TYPENAME(MsgT) + " from " +
+                                    std::string(serialized_msg->message_type));
+    }
+
+    MsgT ret;
+    if (!ret.ParseFromArray(serialized_msg->data.data(),
+                            static_cast<int>(serialized_msg->data.size())))
+    {
+        throw std::invalid_argument("Failed to parse " + TYPENAME(MsgT) + " from " +
+                                    file_path);
+    }
+
+    cur_payload_offset += sizeof(ProtoLogMessageHeader) + serialized_msg->data.size();
+    return ret;
+}
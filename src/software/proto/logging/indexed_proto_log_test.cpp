@@ -0,0 +1,261 @@
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <experimental/filesystem>
+#include <fstream>
+#include <thread>
+
+#include "software/multithreading/subject.h"
+#include "software/proto/logging/indexed_proto_log_reader.h"
+#include "software/proto/logging/indexed_proto_log_writer.h"
+#include "software/proto/logging/indexed_proto_logger.h"
+#include "software/proto/sensor_msg.pb.h"
+
+namespace fs = std::experimental::filesystem;
+
+class IndexedProtoLogTest : public ::testing::TestWithParam<ProtoLogCompression>
+{
+   protected:
+    void SetUp() override
+    {
+        log_path = fs::temp_directory_path() /
+                   ("indexed_proto_log_test_" + std::to_string(getpid()) + ".log");
+        fs::remove(log_path);
+    }
+
+    void TearDown() override
+    {
+        fs::remove(log_path);
+    }
+
+    /**
+     * Creates a SensorProto with the given timestamp
+     *
+     * @param timestamp_seconds The backend received time of the SensorProto
+     *
+     * @return a SensorProto with the given timestamp
+     */
+    static SensorProto createSensorProto(double timestamp_seconds)
+    {
+        SensorProto msg;
+        msg.mutable_backend_received_time()->set_epoch_timestamp_seconds(
+            timestamp_seconds);
+        return msg;
+    }
+
+    /**
+     * Writes messages with timestamps 0, 1, ..., num_messages - 1 to the log
+     *
+     * @param num_messages The number of messages to write
+     * @param msgs_per_chunk The number of messages in each chunk
+     */
+    void writeLog(size_t num_messages, size_t msgs_per_chunk)
+    {
+        IndexedProtoLogWriter writer(log_path, SensorProto::descriptor()->full_name(),
+                                     GetParam(), msgs_per_chunk);
+        for (size_t i = 0; i < num_messages; i++)
+        {
+            writer.addMessage(static_cast<double>(i),
+                              createSensorProto(static_cast<double>(i)));
+        }
+    }
+
+    static double getTimestamp(const SensorProto& msg)
+    {
+        return msg.backend_received_time().epoch_timestamp_seconds();
+    }
+
+    fs::path log_path;
+};
+
+TEST_P(IndexedProtoLogTest, test_read_all_messages_in_order)
+{
+    writeLog(25, 10);
+
+    IndexedProtoLogReader reader(log_path);
+    EXPECT_FALSE(reader.wasIndexRebuilt());
+    EXPECT_EQ(3, reader.getIndex().size());
+    EXPECT_EQ(25, reader.getNumMessages());
+    EXPECT_EQ(0.0, reader.getStartTimestamp());
+    EXPECT_EQ(24.0, reader.getEndTimestamp());
+
+    for (size_t i = 0; i < 25; i++)
+    {
+        auto msg = reader.getNextMsg<SensorProto>();
+        ASSERT_TRUE(msg);
+        EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equivalent(
+            createSensorProto(static_cast<double>(i)), *msg));
+    }
+    EXPECT_FALSE(reader.getNextMsg<SensorProto>());
+}
+
+TEST_P(IndexedProtoLogTest, test_read_all_messages_with_prefetching)
+{
+    writeLog(25, 10);
+
+    IndexedProtoLogReader reader(log_path, true);
+    for (size_t i = 0; i < 25; i++)
+    {
+        auto msg = reader.getNextMsg<SensorProto>();
+        ASSERT_TRUE(msg);
+        EXPECT_EQ(static_cast<double>(i), getTimestamp(*msg));
+    }
+    EXPECT_FALSE(reader.getNextMsg<SensorProto>());
+
+    // Seeking away from the prefetched chunk still reads the right messages
+    reader.seekToTimestamp(2.0);
+    auto msg = reader.getNextMsg<SensorProto>();
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(2.0, getTimestamp(*msg));
+}
+
+TEST_P(IndexedProtoLogTest, test_seek_to_timestamp)
+{
+    writeLog(25, 10);
+    IndexedProtoLogReader reader(log_path);
+
+    reader.seekToTimestamp(13.5);
+    EXPECT_EQ(14.0, reader.getNextMsgTimestamp());
+    auto msg = reader.getNextMsg<SensorProto>();
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(14.0, getTimestamp(*msg));
+
+    // Seeking backwards works as well
+    reader.seekToTimestamp(3.0);
+    msg = reader.getNextMsg<SensorProto>();
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(3.0, getTimestamp(*msg));
+    msg = reader.getNextMsg<SensorProto>();
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(4.0, getTimestamp(*msg));
+}
+
+TEST_P(IndexedProtoLogTest, test_seek_outside_log)
+{
+    writeLog(25, 10);
+    IndexedProtoLogReader reader(log_path);
+
+    reader.seekToTimestamp(100.0);
+    EXPECT_FALSE(reader.getNextMsgTimestamp());
+    EXPECT_FALSE(reader.getNextMsg<SensorProto>());
+
+    reader.seekToTimestamp(-100.0);
+    EXPECT_EQ(0.0, reader.getNextMsgTimestamp());
+}
+
+TEST_P(IndexedProtoLogTest, test_messages_within_chunk_sorted_by_timestamp)
+{
+    {
+        IndexedProtoLogWriter writer(log_path, SensorProto::descriptor()->full_name(),
+                                     GetParam(), 10);
+        for (double timestamp : {2.0, 0.0, 1.0})
+        {
+            writer.addMessage(timestamp, createSensorProto(timestamp));
+        }
+    }
+
+    IndexedProtoLogReader reader(log_path);
+    for (double expected_timestamp : {0.0, 1.0, 2.0})
+    {
+        auto msg = reader.getNextMsg<SensorProto>();
+        ASSERT_TRUE(msg);
+        EXPECT_EQ(expected_timestamp, getTimestamp(*msg));
+    }
+}
+
+TEST_P(IndexedProtoLogTest, test_index_rebuilt_when_log_not_closed)
+{
+    writeLog(25, 10);
+
+    // Simulate a crash partway through writing the last chunk, by cutting off the
+    // index, the footer, and part of the last chunk
+    IndexedProtoLogReader complete_reader(log_path);
+    uint64_t last_chunk_offset = complete_reader.getIndex().back().chunk_offset;
+    fs::resize_file(log_path, last_chunk_offset + sizeof(ProtoLogChunkHeader) + 2);
+
+    IndexedProtoLogReader reader(log_path);
+    EXPECT_TRUE(reader.wasIndexRebuilt());
+    EXPECT_EQ(2, reader.getIndex().size());
+    EXPECT_EQ(20, reader.getNumMessages());
+
+    size_t num_messages_read = 0;
+    while (reader.getNextMsg<SensorProto>())
+    {
+        num_messages_read++;
+    }
+    EXPECT_EQ(20, num_messages_read);
+}
+
+TEST_P(IndexedProtoLogTest, test_reading_wrong_message_type_throws_exception)
+{
+    writeLog(5, 10);
+    IndexedProtoLogReader reader(log_path);
+    EXPECT_THROW(reader.getNextMsg<TbotsProto::Timestamp>(), std::invalid_argument);
+}
+
+TEST_P(IndexedProtoLogTest, test_writing_to_existing_file_throws_exception)
+{
+    writeLog(5, 10);
+    EXPECT_THROW(IndexedProtoLogWriter(log_path, SensorProto::descriptor()->full_name()),
+                 std::invalid_argument);
+}
+
+INSTANTIATE_TEST_CASE_P(Compression, IndexedProtoLogTest,
+                        ::testing::Values(ProtoLogCompression::NONE,
+                                          ProtoLogCompression::ZLIB));
+
+TEST(IndexedProtoLogReaderTest, test_reading_file_that_is_not_a_log_throws_exception)
+{
+    auto path = fs::temp_directory_path() /
+                ("indexed_proto_log_reader_test_" + std::to_string(getpid()) + ".log");
+    {
+        std::ofstream file(path);
+        file << "this is not an indexed proto log";
+    }
+    EXPECT_THROW(IndexedProtoLogReader reader(path), std::invalid_argument);
+    fs::remove(path);
+}
+
+class TestSubject : public Subject<SensorProto>
+{
+   public:
+    void sendValue(SensorProto val)
+    {
+        sendValueToObservers(val);
+    }
+};
+
+TEST(IndexedProtoLoggerTest, test_logged_messages_can_be_read_back)
+{
+    auto path = fs::temp_directory_path() /
+                ("indexed_proto_logger_test_" + std::to_string(getpid()) + ".log");
+    fs::remove(path);
+
+    {
+        auto logger = std::make_shared<IndexedProtoLogger<SensorProto>>(
+            path,
+            [](const SensorProto& msg) {
+                return msg.backend_received_time().epoch_timestamp_seconds();
+            },
+            ProtoLogCompression::ZLIB, 10);
+        TestSubject subject;
+        subject.registerObserver(logger);
+        for (int i = 0; i < 25; i++)
+        {
+            SensorProto msg;
+            msg.mutable_backend_received_time()->set_epoch_timestamp_seconds(i);
+            subject.sendValue(msg);
+        }
+        // give the logger time to pull all the messages from its buffer
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    }
+
+    IndexedProtoLogReader reader(path);
+    EXPECT_EQ(25, reader.getNumMessages());
+    reader.seekToTimestamp(12);
+    auto msg = reader.getNextMsg<SensorProto>();
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(12, msg->backend_received_time().epoch_timestamp_seconds());
+    fs::remove(path);
+}
@@ -0,0 +1,197 @@
+#include "software/proto/logging/indexed_proto_log_writer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <experimental/filesystem>
+#include <stdexcept>
+
+#include "software/logger/logger.h"
+
+IndexedProtoLogWriter::IndexedProtoLogWriter(const std::string& file_path,
+                                             const std::string& message_type,
+                                             ProtoLogCompression compression,
+                                             size_t msgs_per_chunk)
+    : file_path(file_path),
+      file(),
+      file_size(0),
+      message_type(message_type),
+      compression(compression),
+      msgs_per_chunk(std::max<size_t>(msgs_per_chunk, 1)),
+      closed(false),
+      chunk_buffer(),
+      chunk_messages(),
+      index()
+{
+    // silently overwriting a previous log would destroy it
+    if (std::experimental::filesystem::exists(file_path))
+    {
+        throw std::invalid_argument(file_path + " already exists! Find another path!");
+    }
+
+    file.open(file_path, std::ios_base::out | std::ios_base::binary);
+    if (!file.is_open())
+    {
+        throw std::invalid_argument("Failed to create " + file_path);
+    }
+
+    ProtoLogFileHeader header{};
+    std::memcpy(header.magic, PROTO_LOG_FILE_MAGIC, sizeof(header.magic));
+    header.version = PROTO_LOG_FORMAT_VERSION;
+    write(reinterpret_cast<const char*>(&header), sizeof(header));
+    flush();
+
+    chunk_messages.reserve(this->msgs_per_chunk);
+}
+
+IndexedProtoLogWriter::~IndexedProtoLogWriter() noexcept
+{
+    try
+    {
+        close();
+    }
+    catch (const std::exception& e)
+    {
+        LOG(WARNING) << "Failed to close proto log " << file_path << ": " << e.what();
+    }
+}
+
+void IndexedProtoLogWriter::addMessage(double timestamp_seconds,
+                                       const google::protobuf::MessageLite& msg)
+{
+    if (closed)
+    {
+        throw std::runtime_error("Cannot add a message to a closed proto log");
+    }
+
+    size_t msg_size = msg.ByteSizeLong();
+    ProtoLogMessageHeader msg_header{};
+    msg_header.timestamp_seconds = timestamp_seconds;
+    msg_header.message_size      = static_cast<uint32_t>(msg_size);
+
+    // Serialize the message directly into the chunk buffer to avoid an extra copy
+    size_t offset = chunk_buffer.size();
+    chunk_buffer.resize(offset + sizeof(msg_header) + msg_size);
+    std::memcpy(chunk_buffer.data() + offset, &msg_header, sizeof(msg_header));
+    msg.SerializeWithCachedSizesToArray(
+        reinterpret_cast<uint8_t*>(chunk_buffer.data() + offset + sizeof(msg_header)));
+
+    chunk_messages.emplace_back(BufferedMessage{.timestamp_seconds = timestamp_seconds,
+                                                .offset            = offset,
+                                                .size = sizeof(msg_header) + msg_size});
+    if (chunk_messages.size() >= msgs_per_chunk)
+    {
+        flushChunk();
+    }
+}
+
+void IndexedProtoLogWriter::flushChunk()
+{
+    if (chunk_messages.empty())
+    {
+        return;
+    }
+
+    sortCurrentChunk();
+    std::string payload =
+        compressProtoLogPayload(chunk_buffer.data(), chunk_buffer.size(), compression);
+
+    ProtoLogChunkHeader chunk_header{};
+    std::memcpy(chunk_header.magic, PROTO_LOG_CHUNK_MAGIC, sizeof(chunk_header.magic));
+    chunk_header.compression               = compression;
+    chunk_header.num_messages              = static_cast<uint32_t>(chunk_messages.size());
+    chunk_header.message_type_size         = static_cast<uint32_t>(message_type.size());
+    chunk_header.payload_size              = payload.size();
+    chunk_header.uncompressed_payload_size = chunk_buffer.size();
+    chunk_header.start_timestamp_seconds   = chunk_messages.front().timestamp_seconds;
+    chunk_header.end_timestamp_seconds     = chunk_messages.back().timestamp_seconds;
+
+    ProtoLogIndexEntry index_entry{};
+    index_entry.start_timestamp_seconds = chunk_header.start_timestamp_seconds;
+    index_entry.end_timestamp_seconds   = chunk_header.end_timestamp_seconds;
+    index_entry.chunk_offset            = file_size;
+    index_entry.num_messages            = chunk_header.num_messages;
+
+    // The chunk is dropped even if it can't be written, so that the buffer doesn't keep
+    // growing while writes are failing
+    chunk_buffer.clear();
+    chunk_messages.clear();
+
+    write(reinterpret_cast<const char*>(&chunk_header), sizeof(chunk_header));
+    write(message_type.data(), message_type.size());
+    write(payload.data(), payload.size());
+    // Flush every chunk so that as little as possible is lost if we crash
+    flush();
+
+    // Only chunks that were written successfully are indexed
+    index.emplace_back(index_entry);
+}
+
+void IndexedProtoLogWriter::close()
+{
+    if (closed)
+    {
+        return;
+    }
+    // Set this first so that a log that failed to close is not closed again by the
+    // destructor
+    closed = true;
+
+    flushChunk();
+
+    ProtoLogFileFooter footer{};
+    footer.index_offset = file_size;
+    footer.num_chunks   = index.size();
+    std::memcpy(footer.magic, PROTO_LOG_FOOTER_MAGIC, sizeof(footer.magic));
+    footer.version = PROTO_LOG_FORMAT_VERSION;
+
+    write(reinterpret_cast<const char*>(index.data()),
+          index.size() * sizeof(ProtoLogIndexEntry));
+    write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+    file.close();
+    if (file.fail())
+    {
+        throw std::runtime_error("Failed to close " + file_path);
+    }
+}
+
+void IndexedProtoLogWriter::write(const char* data, size_t size)
+{
+    file.write(data, static_cast<std::streamsize>(size));
+    if (!file)
+    {
+        throw std::runtime_error("Failed to write " + std::to_string(size) +
+                                 " bytes to " + file_path);
+    }
+    file_size += size;
+}
+
+void IndexedProtoLogWriter::flush()
+{
+    file.flush();
+    if (!file)
+    {
+        throw std::runtime_error("Failed to flush " + file_path);
+    }
+}
+
+void IndexedProtoLogWriter::sortCurrentChunk()
+{
+    auto compare_timestamps = [](const BufferedMessage& lhs, const BufferedMessage& rhs) {
+        return lhs.timestamp_seconds < rhs.timestamp_seconds;
+    };
+    if (std::is_sorted(chunk_messages.begin(), chunk_messages.end(), compare_timestamps))
+    {
+        return;
+    }
+
+    std::stable_sort(chunk_messages.begin(), chunk_messages.end(), compare_timestamps);
+    std::string sorted_chunk_buffer;
+    sorted_chunk_buffer.reserve(chunk_buffer.size());
+    for (auto& msg : chunk_messages)
+    {
+        size_t sorted_offset = sorted_chunk_buffer.size();
+        sorted_chunk_buffer.append(chunk_buffer, msg.offset, msg.size);
+        msg.offset = sorted_offset;
+    }
+    chunk_buffer.swap(sorted_chunk_buffer);
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <google/protobuf/message_lite.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "software/proto/logging/indexed_proto_log_format.h"
+
+/**
+ * Writes protobuf messages of a single type to an indexed proto log file. See
+ * indexed_proto_log_format.h for the layout of the file.
+ *
+ * Unlike the RepeatedAnyMsg chunks written by the ProtoLogger, messages are stored as
+ * raw length-prefixed bytes, with the message type stored once per chunk, and an index
+ * from timestamps to chunk offsets is appended when the log is closed so readers can
+ * seek through the log without reading all of it.
+ */
+class IndexedProtoLogWriter
+{
+   public:
+    /**
+     * Creates a new indexed proto log file at the given path
+     *
+     * @param file_path The path of the file to create. The file must not already exist
+     * @param message_type The full name of the protobuf message type that will be logged
+     * @param compression The compression to apply to each chunk
+     * @param msgs_per_chunk The number of messages to store in each chunk
+     *
+     * @throws std::invalid_argument if the file already exists or could not be created
+     * @throws std::runtime_error if the file header could not be written
+     */
+    explicit IndexedProtoLogWriter(
+        const std::string& file_path, const std::string& message_type,
+        ProtoLogCompression compression = ProtoLogCompression::NONE,
+        size_t msgs_per_chunk           = DEFAULT_MSGS_PER_CHUNK);
+
+    // if we allow copying of an `IndexedProtoLogWriter`, we could end up with 2 writers
+    // writing over each other and corrupting the log
+    IndexedProtoLogWriter(const IndexedProtoLogWriter&) = delete;
+    IndexedProtoLogWriter& operator=(const IndexedProtoLogWriter&) = delete;
+
+    /**
+     * Closes the log if it has not already been closed. Errors while closing are
+     * logged rather than thrown
+     */
+    ~IndexedProtoLogWriter() noexcept;
+
+    /**
+     * Adds a message to the current chunk, and writes the chunk to disk if it is full
+     *
+     * @param timestamp_seconds The timestamp of the message, used to seek through the
+     * log when it is read
+     * @param msg The message to add
+     *
+     * @throws std::runtime_error if the log has already been closed, or the chunk could
+     * not be written to disk
+     */
+    void addMessage(double timestamp_seconds, const google::protobuf::MessageLite& msg);
+
+    /**
+     * Writes the current chunk to disk, if it contains any messages
+     *
+     * @throws std::runtime_error if the chunk could not be compressed or written
+     */
+    void flushChunk();
+
+    /**
+     * Writes the current chunk, the index, and the footer to disk and closes the file.
+     * No more messages can be added once the log is closed, even if closing it failed.
+     *
+     * @throws std::runtime_error if the log could not be written or closed
+     */
+    void close();
+
+    static constexpr size_t DEFAULT_MSGS_PER_CHUNK = 1000;
+
+   private:
+    /**
+     * Writes the given bytes to the end of the file
+     *
+     * @param data The bytes to write
+     * @param size The number of bytes to write
+     *
+     * @throws std::runtime_error if the bytes could not be written
+     */
+    void write(const char* data, size_t size);
+
+    /**
+     * Flushes the file to disk
+     *
+     * @throws std::runtime_error if the file could not be flushed
+     */
+    void flush();
+
+    /**
+     * Sorts the messages in the current chunk by timestamp. Messages usually arrive in
+     * order, so this only rearranges the chunk if they did not.
+     */
+    void sortCurrentChunk();
+
+    // Where a message in the current chunk starts in the chunk buffer
+    struct BufferedMessage
+    {
+        double timestamp_seconds;
+        size_t offset;
+        size_t size;
+    };
+
+    const std::string file_path;
+    std::ofstream file;
+    uint64_t file_size;
+    const std::string message_type;
+    const ProtoLogCompression compression;
+    const size_t msgs_per_chunk;
+    bool closed;
+
+    // The uncompressed payload of the current chunk
+    std::string chunk_buffer;
+    std::vector<BufferedMessage> chunk_messages;
+    std::vector<ProtoLogIndexEntry> index;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+
+#include "software/multithreading/first_in_first_out_threaded_observer.h"
+#include "software/proto/logging/indexed_proto_log_writer.h"
+
+/**
+ * Logs all the MsgT's it receives to an indexed proto log file, which can be read back
+ * and seeked through with an IndexedProtoLogReader.
+ *
+ * @tparam MsgT The type of protobuf message to log
+ */
+template <typename MsgT>
+class IndexedProtoLogger : public FirstInFirstOutThreadedObserver<MsgT>
+{
+    static_assert(
+        std::is_base_of_v<google::protobuf::Message, MsgT>,
+        "IndexedProtoLogger can only be instantiated with a protobuf message as template parameter!");
+
+   public:
+    /**
+     * Constructs an IndexedProtoLogger
+     *
+     * @param output_file_path The path of the log file to create. The file must not
+     * already exist
+     * @param get_msg_timestamp_seconds Returns the timestamp a message is indexed by
+     * in the log
+     * @param compression The compression to apply to each chunk of the log
+     * @param msgs_per_chunk The number of messages in each chunk of the log. We write
+     * the log to disk one chunk at a time to reduce the amount of lost data in the case
+     * of a crash
+     */
+    explicit IndexedProtoLogger(
+        const std::string& output_file_path,
+        std::function<double(const MsgT&)> get_msg_timestamp_seconds,
+        ProtoLogCompression compression = ProtoLogCompression::NONE,
+        size_t msgs_per_chunk           = IndexedProtoLogWriter::DEFAULT_MSGS_PER_CHUNK);
+
+    // if we allow copying of an `IndexedProtoLogger`, we could end up with 2 loggers
+    // writing over each other and possibly resulting in lost data
+    IndexedProtoLogger(const IndexedProtoLogger&) = delete;
+    ~IndexedProtoLogger() override;
+
+   private:
+    void onValueReceived(MsgT msg) override;
+
+    // The writer is used by both the observer thread and the destructor
+    std::mutex writer_mutex;
+    IndexedProtoLogWriter writer;
+    std::function<double(const MsgT&)> get_msg_timestamp_seconds;
+};
+
+#include "software/proto/logging/indexed_proto_logger.tpp"
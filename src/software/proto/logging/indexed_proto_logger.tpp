@@ -0,0 +1,45 @@
+#include "software/logger/logger.h"
+#include "software/proto/logging/indexed_proto_logger.h"
+#include "software/util/typename/typename.h"
+
+template <typename MsgT>
+IndexedProtoLogger<MsgT>::IndexedProtoLogger(
+    const std::string& output_file_path,
+    std::function<double(const MsgT&)> get_msg_timestamp_seconds,
+    ProtoLogCompression compression, size_t msgs_per_chunk)
+    : FirstInFirstOutThreadedObserver<MsgT>(2000),
+      writer_mutex(),
+      writer(output_file_path, MsgT::descriptor()->full_name(), compression,
+             msgs_per_chunk),
+      get_msg_timestamp_seconds(get_msg_timestamp_seconds)
+{
+    LOG(INFO) << "Logging " << TYPENAME(MsgT) << " to " << output_file_path;
+}
+
+template <typename MsgT>
+IndexedProtoLogger<MsgT>::~IndexedProtoLogger()
+{
+    std::scoped_lock lock(writer_mutex);
+    try
+    {
+        writer.close();
+    }
+    catch (const std::runtime_error& e)
+    {
+        LOG(WARNING) << "Failed to close the " << TYPENAME(MsgT) << " log: " << e.what();
+    }
+}
+
+template <typename MsgT>
+void IndexedProtoLogger<MsgT>::onValueReceived(MsgT msg)
+{
+    std::scoped_lock lock(writer_mutex);
+    try
+    {
+        writer.addMessage(get_msg_timestamp_seconds(msg), msg);
+    }
+    catch (const std::runtime_error& e)
+    {
+        LOG(WARNING) << "Failed to log " << TYPENAME(MsgT) << ": " << e.what();
+    }
+}
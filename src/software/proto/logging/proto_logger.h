@@ -1,9 +1,27 @@
 #pragma once
+#include <condition_variable>
+#include <deque>
 #include <experimental/filesystem>
+#include <mutex>
+#include <thread>
 
+#include "software/metrics/metrics_registry.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/proto/repeated_any_msg.pb.h"
 
+/**
+ * Logs all the MsgT's it receives to a directory of numerically-named chunk files, which
+ * can be read back with a ProtoLogReader.
+ *
+ * Messages are added to the current chunk on the observer thread, while full chunks are
+ * sorted, serialized and written to disk on a separate writer thread, so that writing a
+ * chunk doesn't stop the logger from receiving messages. To bound the memory used, at
+ * most `max_pending_chunks` full chunks can be waiting to be written. If the writer falls
+ * further behind than that, new messages are dropped and counted in the
+ * "proto_logger.messages_dropped.<MsgT>" metric until a chunk has been written.
+ *
+ * @tparam MsgT The type of protobuf message to log
+ */
 template <typename MsgT>
 class ProtoLogger : public FirstInFirstOutThreadedObserver<MsgT>
 {
@@ -21,45 +39,148 @@ class ProtoLogger : public FirstInFirstOutThreadedObserver<MsgT>
      * @param output_directory The absolute path of the directory that we output
      *                         RepeatedAnyMsg chunk files to.
      * @param _msgs_per_chunk number of messages per chunk
+     * @param message_sort_comparator If set, the messages in each chunk are sorted
+     *                                with this comparator before the chunk is written
+     * @param max_pending_chunks The most full chunks that can be waiting to be written
+     *                           before messages are dropped. 1 double-buffers the chunks
+     * @param chunks_per_fsync The number of chunks to write before flushing them to the
+     *                         disk together with fsync. 0 leaves flushing to the OS
+     *
+     * @throws std::invalid_argument if the output directory exists and isn't empty, or
+     *                               if max_pending_chunks is 0
      */
     explicit ProtoLogger(const std::string& output_directory,
                          int _msgs_per_chunk = DEFAULT_MSGS_PER_CHUNK,
                          std::optional<std::function<bool(const MsgT&, const MsgT&)>>
-                             message_sort_comparator = std::nullopt);
+                             message_sort_comparator = std::nullopt,
+                         size_t max_pending_chunks   = DEFAULT_MAX_PENDING_CHUNKS,
+                         size_t chunks_per_fsync     = DEFAULT_CHUNKS_PER_FSYNC);
 
     // if we allow copying of a `ProtoLogger`, we could end up with 2 `ProtoLogger`s
     // writing over each other and possibly resulting in lost data
     ProtoLogger(const ProtoLogger&) = delete;
+
+    /**
+     * Writes the current chunk and every chunk waiting to be written, then stops the
+     * writer thread
+     */
     ~ProtoLogger() override;
 
-    static constexpr int DEFAULT_MSGS_PER_CHUNK = 1000;
+    /**
+     * Adds the given value to the buffer of values for the observer thread to log
+     *
+     * @param msg The value to log
+     */
+    void receiveValue(MsgT msg) override;
+
+    /**
+     * Waits until every value received so far has been added to a chunk or dropped,
+     * and every full chunk has been written to disk. The chunk that isn't full yet is
+     * only written when the logger is destroyed.
+     *
+     * @param timeout The longest time to wait
+     *
+     * @return true if everything received has been flushed, false if the timeout was
+     * reached first, e.g. because the observer buffer was full and values were dropped
+     * from it
+     */
+    bool flush(const Duration& timeout);
+
+    static constexpr int DEFAULT_MSGS_PER_CHUNK        = 1000;
+    static constexpr size_t DEFAULT_MAX_PENDING_CHUNKS = 1;
+    static constexpr size_t DEFAULT_CHUNKS_PER_FSYNC   = 5;
 
    private:
     /**
-     * Adds a MsgT to the current chunk. This will also save it to disk and clear the
-     * chunk in memory, if the chunk contains `msgs_per_chunk` messages after the
-     * addition.
+     * A full chunk waiting to be written
+     */
+    struct PendingChunk
+    {
+        size_t chunk_idx;
+        RepeatedAnyMsg chunk;
+    };
+
+    /**
+     * Adds a MsgT to the current chunk. If the chunk contains `msgs_per_chunk` messages
+     * after the addition, it is passed to the writer thread and a new chunk is started.
+     * If the writer thread is too far behind to take the chunk, the message is dropped.
      *
      * @param frame a MsgT
      */
     void onValueReceived(MsgT msg) override;
 
     /**
-     * Increments the chunk index of the file we are writing to.
+     * Adds a MsgT to the current chunk, as described in onValueReceived
+     *
+     * @param msg a MsgT
      */
-    void nextChunk();
+    void addToCurrentChunk(const MsgT& msg);
 
     /**
-     * Saves the current chunk to a file in the output directory with a filename that is
-     * the index of the chunk.
+     * Passes the current chunk to the writer thread and starts the next chunk, unless
+     * `max_pending_chunks` chunks are already waiting to be written. The caller must
+     * hold current_chunk_mutex.
+     *
+     * @return true if the chunk was passed to the writer thread, false otherwise
      */
-    void saveCurrentChunk();
+    bool tryQueueCurrentChunk();
+
+    /**
+     * Writes pending chunks until the logger is destroyed and every chunk has been
+     * written
+     */
+    void runWriterThread();
+
+    /**
+     * Saves a chunk to a file in the output directory with a filename that is the index
+     * of the chunk.
+     *
+     * @param pending_chunk The chunk to save, which is sorted in place if there is a
+     * sort comparator
+     */
+    void saveChunk(PendingChunk& pending_chunk);
+
+    /**
+     * Flushes every chunk written since the last call to the disk with fsync
+     */
+    void syncWrittenChunks();
 
-    RepeatedAnyMsg current_chunk;
-    size_t current_chunk_idx;
     std::experimental::filesystem::path output_dir_path;
     const int msgs_per_chunk;
     std::optional<std::function<bool(MsgT, MsgT)>> sort_comparator;
+    const size_t max_pending_chunks;
+    const size_t chunks_per_fsync;
+
+    // The chunk being filled, which is used by the observer thread and the destructor
+    std::mutex current_chunk_mutex;
+    RepeatedAnyMsg current_chunk;
+    size_t current_chunk_idx;
+    // Set once the logger is being destroyed, after which messages are ignored
+    bool closed;
+
+    // The writer thread takes chunks from the front of pending_chunks, and keeps the
+    // chunks it has written in free_chunks so their memory can be reused
+    std::mutex writer_mutex;
+    std::condition_variable writer_cv;
+    std::deque<PendingChunk> pending_chunks;
+    std::vector<RepeatedAnyMsg> free_chunks;
+    bool writer_stopped;
+    // Notified by the writer thread whenever it has written a chunk
+    std::condition_variable chunk_written_cv;
+    std::thread writer_thread;
+
+    // How many values have been received, and how many of them the observer thread has
+    // added to a chunk or dropped, so that flush() can wait for them
+    std::mutex values_handled_mutex;
+    std::condition_variable values_handled_cv;
+    size_t num_values_received;
+    size_t num_values_handled;
+
+    // Only used by the writer thread
+    std::vector<std::experimental::filesystem::path> unsynced_chunk_paths;
+
+    Counter& messages_dropped_counter;
+    Histogram& chunk_write_time_histogram;
 };
 
 
@@ -1,21 +1,51 @@
+#include <fcntl.h>
 #include <google/protobuf/util/delimited_message_util.h>
+#include <unistd.h>
 
 #include <fstream>
 
 #include "software/logger/logger.h"
+#include "software/logger/structured_logger.h"
 #include "software/proto/logging/proto_logger.h"
 
 template <typename MsgT>
 ProtoLogger<MsgT>::ProtoLogger(
     const std::string& output_directory, int _msgs_per_chunk,
-    std::optional<std::function<bool(const MsgT&, const MsgT&)>> message_sort_comparator)
+    std::optional<std::function<bool(const MsgT&, const MsgT&)>> message_sort_comparator,
+    size_t max_pending_chunks, size_t chunks_per_fsync)
     : FirstInFirstOutThreadedObserver<MsgT>(2000),
-      current_chunk(),
-      current_chunk_idx(0),
       output_dir_path(output_directory),
       msgs_per_chunk(_msgs_per_chunk),
-      sort_comparator(message_sort_comparator)
+      sort_comparator(message_sort_comparator),
+      max_pending_chunks(max_pending_chunks),
+      chunks_per_fsync(chunks_per_fsync),
+      current_chunk_mutex(),
+      current_chunk(),
+      current_chunk_idx(0),
+      closed(false),
+      writer_mutex(),
+      writer_cv(),
+      pending_chunks(),
+      free_chunks(),
+      writer_stopped(false),
+      chunk_written_cv(),
+      writer_thread(),
+      values_handled_mutex(),
+      values_handled_cv(),
+      num_values_received(0),
+      num_values_handled(0),
+      unsynced_chunk_paths(),
+      messages_dropped_counter(MetricsRegistry::getGlobalRegistry().getCounter(
+          "proto_logger.messages_dropped." + TYPENAME(MsgT))),
+      chunk_write_time_histogram(MetricsRegistry::getGlobalRegistry().getHistogram(
+          "proto_logger.chunk_write_time_us." + TYPENAME(MsgT)))
 {
+    if (max_pending_chunks == 0)
+    {
+        throw std::invalid_argument(
+            "ProtoLogger needs to be able to queue at least one chunk");
+    }
+
     // check if directory exists, if not make a directory
     if (std::experimental::filesystem::exists(output_dir_path))
     {
@@ -42,42 +72,176 @@ ProtoLogger<MsgT>::ProtoLogger(
     // set the current chunk's message_type to the name of MsgT's type
     *current_chunk.mutable_message_type() = TYPENAME(MsgT);
 
+    writer_thread = std::thread(&ProtoLogger::runWriterThread, this);
+
     LOG(INFO) << "Logging " << TYPENAME(MsgT) << " to " << output_dir_path.string();
 }
 
 template <typename MsgT>
 ProtoLogger<MsgT>::~ProtoLogger()
 {
-    saveCurrentChunk();
+    {
+        std::scoped_lock lock(current_chunk_mutex, writer_mutex);
+        // The last chunk is written even if the writer is behind, so no messages that
+        // have been received are lost. An empty last chunk is only written if it is the
+        // only chunk, since the ProtoLogReader can't read an empty chunk after others
+        if (current_chunk.messages_size() > 0 || current_chunk_idx == 0)
+        {
+            pending_chunks.emplace_back();
+            pending_chunks.back().chunk_idx = current_chunk_idx;
+            pending_chunks.back().chunk.Swap(&current_chunk);
+        }
+        closed         = true;
+        writer_stopped = true;
+    }
+    writer_cv.notify_one();
+    writer_thread.join();
+}
+
+template <typename MsgT>
+void ProtoLogger<MsgT>::receiveValue(MsgT msg)
+{
+    {
+        // Counted before the value is buffered, so that flush() can't miss a value
+        // the observer thread is about to handle
+        std::scoped_lock lock(values_handled_mutex);
+        num_values_received++;
+    }
+    FirstInFirstOutThreadedObserver<MsgT>::receiveValue(std::move(msg));
+}
+
+template <typename MsgT>
+bool ProtoLogger<MsgT>::flush(const Duration& timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::duration<double>(timeout.toSeconds()));
+    {
+        std::unique_lock lock(values_handled_mutex);
+        if (!values_handled_cv.wait_until(lock, deadline, [this]() {
+                return num_values_handled >= num_values_received;
+            }))
+        {
+            return false;
+        }
+    }
+
+    std::unique_lock lock(writer_mutex);
+    return chunk_written_cv.wait_until(lock, deadline,
+                                       [this]() { return pending_chunks.empty(); });
 }
 
 template <typename MsgT>
 void ProtoLogger<MsgT>::onValueReceived(MsgT msg)
 {
-    current_chunk.add_messages()->PackFrom(std::move(msg));
+    addToCurrentChunk(msg);
+    {
+        std::scoped_lock lock(values_handled_mutex);
+        num_values_handled++;
+    }
+    values_handled_cv.notify_all();
+}
+
+template <typename MsgT>
+void ProtoLogger<MsgT>::addToCurrentChunk(const MsgT& msg)
+{
+    std::scoped_lock lock(current_chunk_mutex);
+    if (closed)
+    {
+        return;
+    }
+
+    // The current chunk is only still full if the writer thread couldn't take it
+    if (current_chunk.messages_size() >= msgs_per_chunk && !tryQueueCurrentChunk())
+    {
+        messages_dropped_counter.increment();
+        LOG_STRUCTURED(WARNING,
+                       "Dropped a {} because the ProtoLogger could not write chunks to "
+                       "disk fast enough",
+                       TYPENAME(MsgT));
+        return;
+    }
+
+    current_chunk.add_messages()->PackFrom(msg);
     if (current_chunk.messages_size() >= msgs_per_chunk)
     {
-        saveCurrentChunk();
-        nextChunk();
+        tryQueueCurrentChunk();
     }
 }
 
 template <typename MsgT>
-void ProtoLogger<MsgT>::nextChunk()
+bool ProtoLogger<MsgT>::tryQueueCurrentChunk()
 {
+    {
+        std::scoped_lock lock(writer_mutex);
+        if (pending_chunks.size() >= max_pending_chunks)
+        {
+            return false;
+        }
+
+        pending_chunks.emplace_back();
+        pending_chunks.back().chunk_idx = current_chunk_idx;
+        pending_chunks.back().chunk.Swap(&current_chunk);
+
+        // Reuse the memory of a chunk that has already been written, if there is one
+        if (!free_chunks.empty())
+        {
+            current_chunk.Swap(&free_chunks.back());
+            free_chunks.pop_back();
+        }
+    }
+    writer_cv.notify_one();
+
+    // Clearing the messages keeps them allocated, so they can be reused by the next chunk
+    current_chunk.mutable_messages()->Clear();
+    *current_chunk.mutable_message_type() = TYPENAME(MsgT);
     current_chunk_idx++;
-    current_chunk.Clear();
+    return true;
+}
+
+template <typename MsgT>
+void ProtoLogger<MsgT>::runWriterThread()
+{
+    std::unique_lock lock(writer_mutex);
+    while (true)
+    {
+        writer_cv.wait(lock,
+                       [this]() { return writer_stopped || !pending_chunks.empty(); });
+        if (pending_chunks.empty())
+        {
+            // The logger is being destroyed and every chunk has been written
+            break;
+        }
+
+        // The chunk stays in the queue while it is being written so that it counts
+        // towards max_pending_chunks. The observer thread only adds chunks to the back
+        // of the queue, which doesn't move the chunk at the front.
+        PendingChunk& pending_chunk = pending_chunks.front();
+        lock.unlock();
+        saveChunk(pending_chunk);
+        lock.lock();
+
+        free_chunks.emplace_back();
+        free_chunks.back().Swap(&pending_chunk.chunk);
+        pending_chunks.pop_front();
+        chunk_written_cv.notify_all();
+    }
+    lock.unlock();
+
+    syncWrittenChunks();
 }
 
 template <typename MsgT>
-void ProtoLogger<MsgT>::saveCurrentChunk()
+void ProtoLogger<MsgT>::saveChunk(PendingChunk& pending_chunk)
 {
+    ScopedHistogramTimer timer(chunk_write_time_histogram);
+    RepeatedAnyMsg& chunk = pending_chunk.chunk;
+
     if (sort_comparator)
     {
         // if a function is passed in to compare the chunks to sort them, use it
         // to sort the outgoing chunk
-        std::sort(current_chunk.mutable_messages()->begin(),
-                  current_chunk.mutable_messages()->end(),
+        std::sort(chunk.mutable_messages()->begin(), chunk.mutable_messages()->end(),
                   [this](const google::protobuf::Any& l, const google::protobuf::Any& r) {
                       // we have to convert the Any's back into MsgT here in order to sort
                       // them and this also provides a cleaner interface externally for
@@ -91,17 +255,49 @@ void ProtoLogger<MsgT>::saveCurrentChunk()
     }
 
     std::experimental::filesystem::path chunk_path =
-        output_dir_path / std::to_string(current_chunk_idx);
+        output_dir_path / std::to_string(pending_chunk.chunk_idx);
     std::ofstream chunk_ofstream(chunk_path);
-    auto result = google::protobuf::util::SerializeDelimitedToOstream(current_chunk,
-                                                                      &chunk_ofstream);
-    if (!result)
+    auto result =
+        google::protobuf::util::SerializeDelimitedToOstream(chunk, &chunk_ofstream);
+    chunk_ofstream.close();
+    if (!result || chunk_ofstream.fail())
     {
         LOG(WARNING) << "Failed to serialize chunk to output filestream: " << chunk_path;
+        return;
     }
-    else
+    LOG(DEBUG) << "Successfully saved " << TYPENAME(MsgT) << " chunk "
+               << pending_chunk.chunk_idx << " to disk";
+
+    unsynced_chunk_paths.emplace_back(chunk_path);
+    if (chunks_per_fsync > 0 && unsynced_chunk_paths.size() >= chunks_per_fsync)
     {
-        LOG(DEBUG) << "Successfully saved " << TYPENAME(MsgT) << " chunk "
-                   << current_chunk_idx << " to disk";
+        syncWrittenChunks();
+    }
+}
+
+template <typename MsgT>
+void ProtoLogger<MsgT>::syncWrittenChunks()
+{
+    if (chunks_per_fsync == 0 || unsynced_chunk_paths.empty())
+    {
+        return;
+    }
+
+    // fsync flushes a file's data no matter which descriptor it is called on, so the
+    // chunks can be reopened and flushed together. The directory is flushed once for
+    // the whole batch so the new files are guaranteed to appear in it.
+    unsynced_chunk_paths.emplace_back(output_dir_path);
+    for (const auto& path : unsynced_chunk_paths)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0 || ::fsync(fd) != 0)
+        {
+            LOG(WARNING) << "Failed to flush " << path << " to disk";
+        }
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
     }
+    unsynced_chunk_paths.clear();
 }
@@ -120,3 +120,53 @@ TEST(ProtoLoggerLogReaderTest, test_read_and_write_proto_log)
         EXPECT_TRUE(eq);
     }
 }
+
+TEST(ProtoLoggerLogReaderTest, test_messages_dropped_when_writer_is_behind)
+{
+    static constexpr int MSGS_PER_CHUNK = 10;
+    static constexpr int NUM_MSGS       = 100;
+
+    Counter& messages_dropped_counter = MetricsRegistry::getGlobalRegistry().getCounter(
+        "proto_logger.messages_dropped." + TYPENAME(SensorProto));
+    uint64_t initial_messages_dropped = messages_dropped_counter.value();
+
+    auto output_path = fs::current_path() / "droppedtest";
+    {
+        // sorting each chunk is made slow, so the writer can only keep up with the
+        // first chunks and messages are dropped until it catches up
+        auto logger_ptr = std::make_shared<ProtoLogger<SensorProto>>(
+            output_path, MSGS_PER_CHUNK,
+            [](const SensorProto& lhs, const SensorProto& rhs) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                return lhs.backend_received_time().epoch_timestamp_seconds() <
+                       rhs.backend_received_time().epoch_timestamp_seconds();
+            },
+            1);
+        TestSubject subject;
+        subject.registerObserver(logger_ptr);
+
+        for (int i = 0; i < NUM_MSGS; i++)
+        {
+            SensorProto msg;
+            msg.mutable_backend_received_time()->set_epoch_timestamp_seconds(i);
+            subject.sendValue(msg);
+        }
+        // every message has to be handled before the logger is destroyed, since it
+        // ignores the messages it receives once it is being destroyed
+        EXPECT_TRUE(logger_ptr->flush(Duration::fromSeconds(10)));
+    }
+
+    uint64_t messages_dropped =
+        messages_dropped_counter.value() - initial_messages_dropped;
+    EXPECT_GT(messages_dropped, 0);
+
+    // every message that wasn't dropped is in the log, in order
+    std::vector<double> timestamps;
+    ProtoLogReader reader(output_path);
+    while (auto frame = reader.getNextMsg<SensorProto>())
+    {
+        timestamps.emplace_back(frame->backend_received_time().epoch_timestamp_seconds());
+    }
+    EXPECT_EQ(NUM_MSGS - messages_dropped, timestamps.size());
+    EXPECT_TRUE(std::is_sorted(timestamps.begin(), timestamps.end()));
+}
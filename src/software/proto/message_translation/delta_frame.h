@@ -0,0 +1,128 @@
+#pragma once
+
+#include <google/protobuf/map.h>
+
+#include <map>
+#include <optional>
+#include <string>
+
+#include "shared/proto/tbots_software_msgs.pb.h"
+
+/**
+ * Turns a stream of messages with an entry for every robot (like the primitives in a
+ * PrimitiveSet or the robot states in Vision) into keyframes and delta frames, so that
+ * entries that aren't changing don't have to be sent every time. See DeltaFrameInfo
+ * in tbots_software_msgs.proto for how the frames are described.
+ *
+ * @tparam EntryT The type of the entry each robot has in the message
+ */
+template <typename EntryT>
+class DeltaFrameEncoder
+{
+   public:
+    using RobotEntryMap = google::protobuf::Map<uint32_t, EntryT>;
+
+    /**
+     * Creates a DeltaFrameEncoder
+     *
+     * @param keyframe_interval How many frames are encoded for every keyframe. 1 makes
+     * every frame a keyframe
+     *
+     * @throws std::invalid_argument if the keyframe interval is 0
+     */
+    explicit DeltaFrameEncoder(unsigned int keyframe_interval);
+
+    /**
+     * Encodes the given entries as the next frame. If the frame is a delta frame, the
+     * entries that haven't changed since the last keyframe are removed from the map.
+     *
+     * @param robot_entries The entry of every robot. This is modified to hold the
+     * entries of the frame
+     * @param delta_frame_info Set to describe the frame
+     */
+    void encodeFrame(RobotEntryMap& robot_entries,
+                     TbotsProto::DeltaFrameInfo& delta_frame_info);
+
+   private:
+    struct RobotEntryState
+    {
+        bool has_entry               = false;
+        std::string serialized_entry = "";
+        uint32_t version             = 0;
+        // The version of the entry in the last keyframe, or 0 if the robot didn't have
+        // an entry in it
+        uint32_t keyframe_version = 0;
+    };
+
+    const unsigned int keyframe_interval;
+    uint32_t next_sequence_number;
+    unsigned int frames_since_keyframe;
+    // The state of every robot that has ever had an entry. Robots are never removed so
+    // that their versions keep increasing if they leave and come back.
+    std::map<uint32_t, RobotEntryState> robot_entry_states;
+};
+
+/**
+ * Rebuilds the entry of every robot from frames encoded by a DeltaFrameEncoder. Frames
+ * from senders that don't use delta frames are accepted as well, since they are
+ * keyframes with no versions.
+ *
+ * @tparam EntryT The type of the entry each robot has in the message
+ */
+template <typename EntryT>
+class DeltaFrameDecoder
+{
+   public:
+    using RobotEntryMap = google::protobuf::Map<uint32_t, EntryT>;
+
+    DeltaFrameDecoder();
+
+    /**
+     * Merges a received frame into the entries of the robots. Frames older than the
+     * last frame decoded are ignored, since UDP may deliver them out of order.
+     *
+     * @param robot_entries The entries in the received frame
+     * @param delta_frame_info The delta frame info of the received frame
+     *
+     * @return true if the entry of every robot is up to date after merging the frame
+     */
+    bool decodeFrame(const RobotEntryMap& robot_entries,
+                     const TbotsProto::DeltaFrameInfo& delta_frame_info);
+
+    /**
+     * Gets the latest entry of every robot that has been received
+     *
+     * @return the entry of every robot
+     */
+    const RobotEntryMap& getRobotEntries() const;
+
+    /**
+     * Returns whether the entry for the given robot is the latest one the sender has
+     * sent. If the robot doesn't have an entry, it's up to date if the sender doesn't
+     * have an entry for it either.
+     *
+     * @param robot_id The id of the robot
+     *
+     * @return true if the entry for the robot is up to date, false otherwise
+     */
+    bool isRobotEntryUpToDate(uint32_t robot_id) const;
+
+    /**
+     * Gets how many frames were never received, based on the gaps in the sequence
+     * numbers of the frames that were received
+     *
+     * @return the number of frames that were never received
+     */
+    uint64_t getNumMissedFrames() const;
+
+   private:
+    RobotEntryMap robot_entries;
+    // The version of each entry in robot_entries
+    std::map<uint32_t, uint32_t> robot_entry_versions;
+    // The latest version of each entry the sender has, from the last frame received
+    std::map<uint32_t, uint32_t> latest_robot_entry_versions;
+    std::optional<uint32_t> last_sequence_number;
+    uint64_t num_missed_frames;
+};
+
+#include "software/proto/message_translation/delta_frame.tpp"
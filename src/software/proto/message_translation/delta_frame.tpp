@@ -0,0 +1,185 @@
+#pragma once
+
+#include <stdexcept>
+
+#include "software/proto/message_translation/delta_frame.h"
+
+template <typename EntryT>
+DeltaFrameEncoder<EntryT>::DeltaFrameEncoder(unsigned int keyframe_interval)
+    : keyframe_interval(keyframe_interval),
+      // Sequence number 0 is what senders that don't use delta frames send
+      next_sequence_number(1),
+      frames_since_keyframe(0),
+      robot_entry_states()
+{
+    if (keyframe_interval == 0)
+    {
+        throw std::invalid_argument("The keyframe interval must be at least 1");
+    }
+}
+
+template <typename EntryT>
+void DeltaFrameEncoder<EntryT>::encodeFrame(RobotEntryMap& robot_entries,
+                                            TbotsProto::DeltaFrameInfo& delta_frame_info)
+{
+    const bool is_keyframe = frames_since_keyframe == 0;
+    frames_since_keyframe  = (frames_since_keyframe + 1) % keyframe_interval;
+
+    delta_frame_info.Clear();
+    delta_frame_info.set_sequence_number(next_sequence_number);
+    delta_frame_info.set_is_delta(!is_keyframe);
+    next_sequence_number =
+        next_sequence_number == UINT32_MAX ? 1 : next_sequence_number + 1;
+
+    // Robots that don't have an entry in this frame get a new version when they come
+    // back, so that their entry is sent again even if it hasn't changed
+    for (auto& [robot_id, state] : robot_entry_states)
+    {
+        if (robot_entries.find(robot_id) == robot_entries.end())
+        {
+            state.has_entry = false;
+            if (is_keyframe)
+            {
+                state.keyframe_version = 0;
+            }
+        }
+    }
+
+    auto& robot_entry_versions = *delta_frame_info.mutable_robot_entry_versions();
+    for (auto it = robot_entries.begin(); it != robot_entries.end();)
+    {
+        std::string serialized_entry = it->second.SerializeAsString();
+        // Versions start at 1, so that a version of 0 means "never sent"
+        RobotEntryState& state = robot_entry_states[it->first];
+        if (!state.has_entry || state.serialized_entry != serialized_entry)
+        {
+            state.serialized_entry = std::move(serialized_entry);
+            state.has_entry        = true;
+            state.version++;
+        }
+        if (is_keyframe)
+        {
+            state.keyframe_version = state.version;
+        }
+        robot_entry_versions[it->first] = state.version;
+
+        if (!is_keyframe && state.version == state.keyframe_version)
+        {
+            it = robot_entries.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+template <typename EntryT>
+DeltaFrameDecoder<EntryT>::DeltaFrameDecoder()
+    : robot_entries(),
+      robot_entry_versions(),
+      latest_robot_entry_versions(),
+      last_sequence_number(std::nullopt),
+      num_missed_frames(0)
+{
+}
+
+template <typename EntryT>
+bool DeltaFrameDecoder<EntryT>::decodeFrame(
+    const RobotEntryMap& received_robot_entries,
+    const TbotsProto::DeltaFrameInfo& delta_frame_info)
+{
+    // Senders that don't use delta frames always send sequence number 0, so their
+    // frames can't be ordered
+    const uint32_t sequence_number = delta_frame_info.sequence_number();
+    if (sequence_number != 0 && last_sequence_number)
+    {
+        // Comparing the difference as a signed number handles the sequence number
+        // wrapping around
+        auto frames_since_last =
+            static_cast<int32_t>(sequence_number - *last_sequence_number);
+        if (frames_since_last <= 0)
+        {
+            return false;
+        }
+        num_missed_frames += static_cast<uint64_t>(frames_since_last - 1);
+    }
+    if (sequence_number != 0)
+    {
+        last_sequence_number = sequence_number;
+    }
+
+    const auto& received_versions = delta_frame_info.robot_entry_versions();
+    if (!delta_frame_info.is_delta())
+    {
+        robot_entries = received_robot_entries;
+        robot_entry_versions.clear();
+    }
+    else
+    {
+        // Robots the sender no longer has an entry for are left out of the versions
+        for (auto it = robot_entries.begin(); it != robot_entries.end();)
+        {
+            if (received_versions.find(it->first) == received_versions.end())
+            {
+                robot_entry_versions.erase(it->first);
+                it = robot_entries.erase(it);
+            }
+            else
+            {
+                it++;
+            }
+        }
+
+        for (const auto& [robot_id, entry] : received_robot_entries)
+        {
+            robot_entries[robot_id] = entry;
+        }
+    }
+
+    for (const auto& [robot_id, entry] : received_robot_entries)
+    {
+        auto version_it = received_versions.find(robot_id);
+        if (version_it != received_versions.end())
+        {
+            robot_entry_versions[robot_id] = version_it->second;
+        }
+    }
+
+    latest_robot_entry_versions.clear();
+    bool all_up_to_date = true;
+    for (const auto& [robot_id, version] : received_versions)
+    {
+        latest_robot_entry_versions[robot_id] = version;
+        all_up_to_date &= isRobotEntryUpToDate(robot_id);
+    }
+    return all_up_to_date;
+}
+
+template <typename EntryT>
+const typename DeltaFrameDecoder<EntryT>::RobotEntryMap&
+DeltaFrameDecoder<EntryT>::getRobotEntries() const
+{
+    return robot_entries;
+}
+
+template <typename EntryT>
+bool DeltaFrameDecoder<EntryT>::isRobotEntryUpToDate(uint32_t robot_id) const
+{
+    auto version_it        = robot_entry_versions.find(robot_id);
+    auto latest_version_it = latest_robot_entry_versions.find(robot_id);
+    if (latest_version_it == latest_robot_entry_versions.end())
+    {
+        // The sender didn't say which version it has, which means it either doesn't
+        // have an entry for the robot or doesn't use delta frames
+        return version_it == robot_entry_versions.end();
+    }
+    return version_it != robot_entry_versions.end() &&
+           version_it->second == latest_version_it->second;
+}
+
+template <typename EntryT>
+uint64_t DeltaFrameDecoder<EntryT>::getNumMissedFrames() const
+{
+    return num_missed_frames;
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "shared/constants.h"
+#include "shared/proto/tbots_software_msgs.pb.h"
+#include "software/networking/threaded_proto_multicast_listener.h"
+#include "software/networking/threaded_proto_multicast_sender.h"
+#include "software/proto/message_translation/delta_frame.h"
+
+/**
+ * Gets the current time in seconds since the epoch
+ *
+ * @return the current time in seconds since the epoch
+ */
+double getEpochTimestampSeconds()
+{
+    return std::chrono::duration<double>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(DeltaFramePerformanceTest, DISABLED_loopback_bytes_per_tick_and_latency)
+{
+    const std::string ip_address         = "224.5.23.11";
+    const unsigned short port            = 42998;
+    const unsigned int num_ticks         = 5000;
+    const unsigned int keyframe_interval = 10;
+    const unsigned int num_robots        = MAX_ROBOTS_OVER_RADIO;
+    const auto tick_period               = std::chrono::microseconds(200);
+
+    // Every tick a few robots get a new primitive, like when the AI assigns a new
+    // destination to some of the robots. Since delta frames have every primitive that
+    // has changed since the last keyframe, they are only smaller when most primitives
+    // don't change between keyframes.
+    for (unsigned int num_changes_per_tick : {0, 1, 3})
+    {
+        for (bool use_delta_frames : {false, true})
+        {
+            std::mutex receive_mutex;
+            DeltaFrameDecoder<TbotsProto::Primitive> decoder;
+            unsigned int num_received    = 0;
+            unsigned int num_up_to_date  = 0;
+            double total_latency_seconds = 0.0;
+
+            ThreadedProtoMulticastListener<TbotsProto::PrimitiveSet> listener(
+                ip_address, port, [&](TbotsProto::PrimitiveSet primitive_set) {
+                    double latency_seconds =
+                        getEpochTimestampSeconds() -
+                        primitive_set.time_sent().epoch_timestamp_seconds();
+                    std::scoped_lock lock(receive_mutex);
+                    num_received++;
+                    total_latency_seconds += latency_seconds;
+                    if (decoder.decodeFrame(primitive_set.robot_primitives(),
+                                            primitive_set.delta_frame_info()))
+                    {
+                        num_up_to_date++;
+                    }
+                });
+            ThreadedProtoMulticastSender<TbotsProto::PrimitiveSet> sender(ip_address,
+                                                                          port);
+            DeltaFrameEncoder<TbotsProto::Primitive> encoder(keyframe_interval);
+
+            TbotsProto::PrimitiveSet primitive_set;
+            for (unsigned int robot_id = 0; robot_id < num_robots; robot_id++)
+            {
+                (*primitive_set.mutable_robot_primitives())[robot_id]
+                    .mutable_move()
+                    ->set_dribbler_speed_rpm(1000.0f);
+            }
+            std::mt19937 random_engine(0);
+            std::uniform_int_distribution<unsigned int> robot_distribution(
+                0, num_robots - 1);
+            std::uniform_real_distribution<float> position_distribution(-4.5f, 4.5f);
+
+            size_t total_bytes_sent = 0;
+            for (unsigned int tick = 0; tick < num_ticks; tick++)
+            {
+                for (unsigned int i = 0; i < num_changes_per_tick; i++)
+                {
+                    auto destination =
+                        (*primitive_set.mutable_robot_primitives())[robot_distribution(
+                                                                        random_engine)]
+                            .mutable_move()
+                            ->mutable_position_params()
+                            ->mutable_destination();
+                    destination->set_x_meters(position_distribution(random_engine));
+                    destination->set_y_meters(position_distribution(random_engine));
+                }
+
+                TbotsProto::PrimitiveSet frame = primitive_set;
+                if (use_delta_frames)
+                {
+                    encoder.encodeFrame(*frame.mutable_robot_primitives(),
+                                        *frame.mutable_delta_frame_info());
+                }
+                frame.mutable_time_sent()->set_epoch_timestamp_seconds(
+                    getEpochTimestampSeconds());
+                total_bytes_sent += frame.ByteSizeLong();
+                sender.sendProto(frame);
+
+                std::this_thread::sleep_for(tick_period);
+            }
+
+            // Give the listener time to receive everything that was sent
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+            std::scoped_lock lock(receive_mutex);
+            std::cout << std::endl
+                      << (use_delta_frames
+                              ? "Delta frames with a keyframe every " +
+                                    std::to_string(keyframe_interval) + " frames"
+                              : "Full primitive set every tick")
+                      << ", " << num_changes_per_tick
+                      << " primitives changed per tick:" << std::endl;
+            std::cout << "Bytes per tick = "
+                      << static_cast<double>(total_bytes_sent) / num_ticks << std::endl;
+            std::cout << "Frames received = " << num_received << " / " << num_ticks
+                      << " | Frames with every primitive up to date = " << num_up_to_date
+                      << " | Frames missed = " << decoder.getNumMissedFrames()
+                      << std::endl;
+            if (num_received > 0)
+            {
+                std::cout << "Average end-to-end latency = "
+                          << total_latency_seconds / num_received * 1e6 << " us"
+                          << std::endl
+                          << std::endl;
+            }
+        }
+    }
+}
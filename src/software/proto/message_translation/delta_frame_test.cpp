@@ -0,0 +1,243 @@
+#include "software/proto/message_translation/delta_frame.h"
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+class DeltaFrameTest : public ::testing::Test
+{
+   protected:
+    using RobotEntryMap = google::protobuf::Map<uint32_t, TbotsProto::Primitive>;
+
+    /**
+     * Creates a primitive that moves to the given x coordinate
+     *
+     * @param x_meters The x coordinate of the destination
+     *
+     * @return the primitive
+     */
+    static TbotsProto::Primitive createMovePrimitive(float x_meters)
+    {
+        TbotsProto::Primitive primitive;
+        primitive.mutable_move()
+            ->mutable_position_params()
+            ->mutable_destination()
+            ->set_x_meters(x_meters);
+        return primitive;
+    }
+
+    /**
+     * Encodes the given entries and returns the entries in the encoded frame
+     *
+     * @param robot_entries The entry of every robot
+     * @param delta_frame_info Set to describe the encoded frame
+     *
+     * @return the entries in the encoded frame
+     */
+    RobotEntryMap encode(RobotEntryMap robot_entries,
+                         TbotsProto::DeltaFrameInfo& delta_frame_info)
+    {
+        encoder.encodeFrame(robot_entries, delta_frame_info);
+        return robot_entries;
+    }
+
+    /**
+     * Checks whether two maps have equal entries for the same robots
+     *
+     * @param entries1 The first map
+     * @param entries2 The second map
+     *
+     * @return true if the maps have equal entries, false otherwise
+     */
+    static bool entriesEqual(const RobotEntryMap& entries1, const RobotEntryMap& entries2)
+    {
+        if (entries1.size() != entries2.size())
+        {
+            return false;
+        }
+        for (const auto& [robot_id, entry] : entries1)
+        {
+            auto it = entries2.find(robot_id);
+            if (it == entries2.end() ||
+                !google::protobuf::util::MessageDifferencer::Equals(entry, it->second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    DeltaFrameEncoder<TbotsProto::Primitive> encoder{4};
+    DeltaFrameDecoder<TbotsProto::Primitive> decoder;
+};
+
+TEST_F(DeltaFrameTest, test_zero_keyframe_interval_throws)
+{
+    EXPECT_THROW(DeltaFrameEncoder<TbotsProto::Primitive>(0), std::invalid_argument);
+}
+
+TEST_F(DeltaFrameTest, test_first_frame_is_keyframe_with_every_entry)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+    entries[2] = createMovePrimitive(2.0f);
+
+    TbotsProto::DeltaFrameInfo info;
+    RobotEntryMap frame = encode(entries, info);
+
+    EXPECT_FALSE(info.is_delta());
+    EXPECT_EQ(1, info.sequence_number());
+    EXPECT_TRUE(entriesEqual(entries, frame));
+    EXPECT_EQ(2, info.robot_entry_versions().size());
+}
+
+TEST_F(DeltaFrameTest, test_delta_frame_only_has_entries_changed_since_keyframe)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+    entries[2] = createMovePrimitive(2.0f);
+
+    TbotsProto::DeltaFrameInfo info;
+    encode(entries, info);
+
+    RobotEntryMap frame = encode(entries, info);
+    EXPECT_TRUE(info.is_delta());
+    EXPECT_EQ(2, info.sequence_number());
+    EXPECT_TRUE(frame.empty());
+
+    entries[2] = createMovePrimitive(3.0f);
+    frame      = encode(entries, info);
+    ASSERT_EQ(1, frame.size());
+    EXPECT_EQ(1, frame.count(2));
+
+    // The changed entry keeps being sent until the next keyframe, so that it gets to
+    // the receiver even if this frame is lost
+    frame = encode(entries, info);
+    ASSERT_EQ(1, frame.size());
+    EXPECT_EQ(1, frame.count(2));
+}
+
+TEST_F(DeltaFrameTest, test_keyframe_sent_every_keyframe_interval)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+
+    TbotsProto::DeltaFrameInfo info;
+    for (unsigned int frame = 0; frame < 12; frame++)
+    {
+        encode(entries, info);
+        EXPECT_EQ(frame % 4 != 0, info.is_delta());
+    }
+}
+
+TEST_F(DeltaFrameTest, test_decoder_rebuilds_entries_from_every_frame)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+    entries[2] = createMovePrimitive(2.0f);
+
+    TbotsProto::DeltaFrameInfo info;
+    for (unsigned int frame = 0; frame < 10; frame++)
+    {
+        entries[frame % 2 + 1] = createMovePrimitive(static_cast<float>(frame));
+        RobotEntryMap encoded  = encode(entries, info);
+        EXPECT_TRUE(decoder.decodeFrame(encoded, info));
+        EXPECT_TRUE(entriesEqual(entries, decoder.getRobotEntries()));
+    }
+    EXPECT_EQ(0, decoder.getNumMissedFrames());
+}
+
+TEST_F(DeltaFrameTest, test_decoder_recovers_from_lost_frame_before_next_keyframe)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+    entries[2] = createMovePrimitive(2.0f);
+
+    TbotsProto::DeltaFrameInfo info;
+    EXPECT_TRUE(decoder.decodeFrame(encode(entries, info), info));
+
+    // Lose the frame where robot 1's entry changed
+    entries[1] = createMovePrimitive(5.0f);
+    encode(entries, info);
+
+    EXPECT_TRUE(decoder.decodeFrame(encode(entries, info), info));
+    EXPECT_TRUE(entriesEqual(entries, decoder.getRobotEntries()));
+    EXPECT_EQ(1, decoder.getNumMissedFrames());
+}
+
+TEST_F(DeltaFrameTest, test_decoder_not_up_to_date_when_keyframe_is_lost)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+
+    // Lose the keyframe
+    TbotsProto::DeltaFrameInfo info;
+    encode(entries, info);
+
+    entries[2] = createMovePrimitive(2.0f);
+    EXPECT_FALSE(decoder.decodeFrame(encode(entries, info), info));
+    EXPECT_FALSE(decoder.isRobotEntryUpToDate(1));
+    EXPECT_TRUE(decoder.isRobotEntryUpToDate(2));
+
+    // Skip to the next keyframe
+    encode(entries, info);
+    encode(entries, info);
+    EXPECT_TRUE(decoder.decodeFrame(encode(entries, info), info));
+    EXPECT_FALSE(info.is_delta());
+    EXPECT_TRUE(entriesEqual(entries, decoder.getRobotEntries()));
+}
+
+TEST_F(DeltaFrameTest, test_robot_removed_and_added_back_between_keyframes)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+    entries[2] = createMovePrimitive(2.0f);
+
+    TbotsProto::DeltaFrameInfo info;
+    EXPECT_TRUE(decoder.decodeFrame(encode(entries, info), info));
+
+    RobotEntryMap without_robot_2;
+    without_robot_2[1]    = entries[1];
+    RobotEntryMap encoded = encode(without_robot_2, info);
+    EXPECT_EQ(0, info.robot_entry_versions().count(2));
+    EXPECT_TRUE(decoder.decodeFrame(encoded, info));
+    EXPECT_TRUE(entriesEqual(without_robot_2, decoder.getRobotEntries()));
+
+    // Robot 2 comes back with the same entry it had in the keyframe, which has to be
+    // sent again since the receiver removed it
+    encoded = encode(entries, info);
+    EXPECT_EQ(1, encoded.count(2));
+    EXPECT_TRUE(decoder.decodeFrame(encoded, info));
+    EXPECT_TRUE(entriesEqual(entries, decoder.getRobotEntries()));
+}
+
+TEST_F(DeltaFrameTest, test_decoder_ignores_out_of_order_frames)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+
+    TbotsProto::DeltaFrameInfo old_info;
+    RobotEntryMap old_frame = encode(entries, old_info);
+
+    entries[1] = createMovePrimitive(2.0f);
+    TbotsProto::DeltaFrameInfo info;
+    EXPECT_TRUE(decoder.decodeFrame(encode(entries, info), info));
+
+    EXPECT_FALSE(decoder.decodeFrame(old_frame, old_info));
+    EXPECT_TRUE(entriesEqual(entries, decoder.getRobotEntries()));
+}
+
+TEST_F(DeltaFrameTest, test_decoder_accepts_frames_from_sender_without_delta_frames)
+{
+    RobotEntryMap entries;
+    entries[1] = createMovePrimitive(1.0f);
+    TbotsProto::DeltaFrameInfo empty_info;
+
+    EXPECT_TRUE(decoder.decodeFrame(entries, empty_info));
+    EXPECT_TRUE(entriesEqual(entries, decoder.getRobotEntries()));
+
+    entries.erase(1);
+    entries[2] = createMovePrimitive(2.0f);
+    EXPECT_TRUE(decoder.decodeFrame(entries, empty_info));
+    EXPECT_TRUE(entriesEqual(entries, decoder.getRobotEntries()));
+    EXPECT_TRUE(decoder.isRobotEntryUpToDate(2));
+}
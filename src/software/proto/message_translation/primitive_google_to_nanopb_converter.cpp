@@ -1,23 +1,360 @@
 #include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
 
-#include <pb_decode.h>
+#include <iterator>
+#include <stdexcept>
 
-TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_primitive)
+namespace
 {
-    // Serialize the message to an array of raw values
-    std::vector<uint8_t> serialized_proto(google_primitive.ByteSizeLong());
-    google_primitive.SerializeToArray(serialized_proto.data(),
-                                      static_cast<int>(google_primitive.ByteSizeLong()));
+    // The fields are copied one by one rather than serializing the google proto and
+    // decoding it with NanoPb, since this is called for every primitive we send and the
+    // round trip through the wire format is much slower than copying a few floats.
+    //
+    // Fields added to the protos are not copied unless they are added here too, so the
+    // number of fields in each message that is converted is checked at compile time.
+    // If one of these fails, copy the new field and update the number of fields.
+    //
+    // NanoPb generates a `has_<field>` flag for every submessage field outside of a
+    // oneof, and only encodes the submessage if the flag is set. The flags are copied
+    // from the google proto, so that submessages the google proto leaves out are left
+    // out here too.
+
+    /**
+     * Returns the number of fields in a NanoPb message. NanoPb declares the fields of
+     * each message as an array with one extra entry that marks the end of the fields.
+     *
+     * @param nanopb_fields The fields of the NanoPb message
+     *
+     * @return the number of fields in the NanoPb message
+     */
+    template <size_t NUM_NANOPB_FIELDS_AND_END>
+    constexpr size_t numNanoPbFields(
+        const pb_field_t (&nanopb_fields)[NUM_NANOPB_FIELDS_AND_END])
+    {
+        return NUM_NANOPB_FIELDS_AND_END - 1;
+    }
+
+    static_assert(numNanoPbFields(TbotsProto_Point_fields) == 2);
+    static_assert(numNanoPbFields(TbotsProto_Vector_fields) == 2);
+    static_assert(numNanoPbFields(TbotsProto_Angle_fields) == 1);
+    static_assert(numNanoPbFields(TbotsProto_AngularVelocity_fields) == 1);
+    static_assert(numNanoPbFields(TbotsProto_Timestamp_fields) == 1);
+    static_assert(numNanoPbFields(TbotsProto_MovePositionParams_fields) == 3);
+    static_assert(numNanoPbFields(TbotsProto_EstopPrimitive_fields) == 0);
+    static_assert(numNanoPbFields(TbotsProto_ChipPrimitive_fields) == 3);
+    static_assert(numNanoPbFields(TbotsProto_KickPrimitive_fields) == 3);
+    static_assert(numNanoPbFields(TbotsProto_MovePrimitive_fields) == 3);
+    static_assert(numNanoPbFields(TbotsProto_SpinningMovePrimitive_fields) == 3);
+    static_assert(numNanoPbFields(TbotsProto_AutochipMovePrimitive_fields) == 4);
+    static_assert(numNanoPbFields(TbotsProto_AutokickMovePrimitive_fields) == 4);
+    static_assert(numNanoPbFields(TbotsProto_StopPrimitive_fields) == 1);
+    static_assert(
+        numNanoPbFields(TbotsProto_DirectControlPrimitive_DirectPerWheelControl_fields) ==
+        4);
+    static_assert(
+        numNanoPbFields(TbotsProto_DirectControlPrimitive_DirectVelocityControl_fields) ==
+        2);
+    static_assert(numNanoPbFields(TbotsProto_DirectControlPrimitive_fields) == 8);
+    static_assert(numNanoPbFields(TbotsProto_Primitive_fields) == 9);
+    static_assert(numNanoPbFields(TbotsProto_DeltaFrameInfo_fields) == 3);
+    static_assert(
+        numNanoPbFields(TbotsProto_DeltaFrameInfo_RobotEntryVersionsEntry_fields) == 2);
+    static_assert(numNanoPbFields(TbotsProto_PrimitiveSet_RobotPrimitivesEntry_fields) ==
+                  2);
+    static_assert(numNanoPbFields(TbotsProto_PrimitiveSet_fields) == 3);
+
+    TbotsProto_Point createNanoPbPoint(const TbotsProto::Point& google_point)
+    {
+        TbotsProto_Point nanopb_point = TbotsProto_Point_init_zero;
+        nanopb_point.x_meters         = google_point.x_meters();
+        nanopb_point.y_meters         = google_point.y_meters();
+        return nanopb_point;
+    }
+
+    TbotsProto_Vector createNanoPbVector(const TbotsProto::Vector& google_vector)
+    {
+        TbotsProto_Vector nanopb_vector  = TbotsProto_Vector_init_zero;
+        nanopb_vector.x_component_meters = google_vector.x_component_meters();
+        nanopb_vector.y_component_meters = google_vector.y_component_meters();
+        return nanopb_vector;
+    }
+
+    TbotsProto_Angle createNanoPbAngle(const TbotsProto::Angle& google_angle)
+    {
+        TbotsProto_Angle nanopb_angle = TbotsProto_Angle_init_zero;
+        nanopb_angle.radians          = google_angle.radians();
+        return nanopb_angle;
+    }
+
+    TbotsProto_AngularVelocity createNanoPbAngularVelocity(
+        const TbotsProto::AngularVelocity& google_angular_velocity)
+    {
+        TbotsProto_AngularVelocity nanopb_angular_velocity =
+            TbotsProto_AngularVelocity_init_zero;
+        nanopb_angular_velocity.radians_per_second =
+            google_angular_velocity.radians_per_second();
+        return nanopb_angular_velocity;
+    }
+
+    TbotsProto_MovePositionParams createNanoPbMovePositionParams(
+        const TbotsProto::MovePositionParams& google_position_params)
+    {
+        TbotsProto_MovePositionParams nanopb_position_params =
+            TbotsProto_MovePositionParams_init_zero;
+        nanopb_position_params.has_destination = google_position_params.has_destination();
+        nanopb_position_params.destination =
+            createNanoPbPoint(google_position_params.destination());
+        nanopb_position_params.final_speed_meters_per_second =
+            google_position_params.final_speed_meters_per_second();
+        nanopb_position_params.controller_type =
+            static_cast<TbotsProto_MovePositionParams_ControllerType>(
+                google_position_params.controller_type());
+        return nanopb_position_params;
+    }
+
+    TbotsProto_DirectControlPrimitive createNanoPbDirectControlPrimitive(
+        const TbotsProto::DirectControlPrimitive& google_direct_control)
+    {
+        TbotsProto_DirectControlPrimitive nanopb_direct_control =
+            TbotsProto_DirectControlPrimitive_init_zero;
 
+        switch (google_direct_control.wheel_control_case())
+        {
+            case TbotsProto::DirectControlPrimitive::kDirectPerWheelControl:
+            {
+                const auto& google_per_wheel_control =
+                    google_direct_control.direct_per_wheel_control();
+                auto& nanopb_per_wheel_control =
+                    nanopb_direct_control.wheel_control.direct_per_wheel_control;
+                nanopb_direct_control.which_wheel_control =
+                    TbotsProto_DirectControlPrimitive_direct_per_wheel_control_tag;
+                nanopb_per_wheel_control.front_left_wheel_rpm =
+                    google_per_wheel_control.front_left_wheel_rpm();
+                nanopb_per_wheel_control.back_left_wheel_rpm =
+                    google_per_wheel_control.back_left_wheel_rpm();
+                nanopb_per_wheel_control.front_right_wheel_rpm =
+                    google_per_wheel_control.front_right_wheel_rpm();
+                nanopb_per_wheel_control.back_right_wheel_rpm =
+                    google_per_wheel_control.back_right_wheel_rpm();
+                break;
+            }
+            case TbotsProto::DirectControlPrimitive::kDirectVelocityControl:
+            {
+                const auto& google_velocity_control =
+                    google_direct_control.direct_velocity_control();
+                auto& nanopb_velocity_control =
+                    nanopb_direct_control.wheel_control.direct_velocity_control;
+                nanopb_direct_control.which_wheel_control =
+                    TbotsProto_DirectControlPrimitive_direct_velocity_control_tag;
+                nanopb_velocity_control.has_velocity =
+                    google_velocity_control.has_velocity();
+                nanopb_velocity_control.velocity =
+                    createNanoPbVector(google_velocity_control.velocity());
+                nanopb_velocity_control.has_angular_velocity =
+                    google_velocity_control.has_angular_velocity();
+                nanopb_velocity_control.angular_velocity = createNanoPbAngularVelocity(
+                    google_velocity_control.angular_velocity());
+                break;
+            }
+            case TbotsProto::DirectControlPrimitive::WHEEL_CONTROL_NOT_SET:
+                break;
+        }
 
+        nanopb_direct_control.charge_mode =
+            static_cast<TbotsProto_DirectControlPrimitive_ChargeMode>(
+                google_direct_control.charge_mode());
+
+        switch (google_direct_control.chick_command_case())
+        {
+            case TbotsProto::DirectControlPrimitive::kKickSpeedMetersPerSecond:
+                nanopb_direct_control.which_chick_command =
+                    TbotsProto_DirectControlPrimitive_kick_speed_meters_per_second_tag;
+                nanopb_direct_control.chick_command.kick_speed_meters_per_second =
+                    google_direct_control.kick_speed_meters_per_second();
+                break;
+            case TbotsProto::DirectControlPrimitive::kChipDistanceMeters:
+                nanopb_direct_control.which_chick_command =
+                    TbotsProto_DirectControlPrimitive_chip_distance_meters_tag;
+                nanopb_direct_control.chick_command.chip_distance_meters =
+                    google_direct_control.chip_distance_meters();
+                break;
+            case TbotsProto::DirectControlPrimitive::kAutokickSpeedMetersPerSecond:
+                nanopb_direct_control.which_chick_command =
+                    TbotsProto_DirectControlPrimitive_autokick_speed_meters_per_second_tag;
+                nanopb_direct_control.chick_command.autokick_speed_meters_per_second =
+                    google_direct_control.autokick_speed_meters_per_second();
+                break;
+            case TbotsProto::DirectControlPrimitive::kAutochipDistanceMeters:
+                nanopb_direct_control.which_chick_command =
+                    TbotsProto_DirectControlPrimitive_autochip_distance_meters_tag;
+                nanopb_direct_control.chick_command.autochip_distance_meters =
+                    google_direct_control.autochip_distance_meters();
+                break;
+            case TbotsProto::DirectControlPrimitive::CHICK_COMMAND_NOT_SET:
+                break;
+        }
+
+        nanopb_direct_control.dribbler_speed_rpm =
+            google_direct_control.dribbler_speed_rpm();
+
+        return nanopb_direct_control;
+    }
+
+    TbotsProto_DeltaFrameInfo createNanoPbDeltaFrameInfo(
+        const TbotsProto::DeltaFrameInfo& google_delta_frame_info)
+    {
+        TbotsProto_DeltaFrameInfo nanopb_delta_frame_info =
+            TbotsProto_DeltaFrameInfo_init_zero;
+
+        const size_t max_robot_entry_versions =
+            std::size(nanopb_delta_frame_info.robot_entry_versions);
+        if (static_cast<size_t>(google_delta_frame_info.robot_entry_versions_size()) >
+            max_robot_entry_versions)
+        {
+            throw std::runtime_error(
+                "Failed to convert google DeltaFrameInfo proto to NanoPb, it has " +
+                std::to_string(google_delta_frame_info.robot_entry_versions_size()) +
+                " robot entry versions but NanoPb can only hold " +
+                std::to_string(max_robot_entry_versions));
+        }
+
+        nanopb_delta_frame_info.sequence_number =
+            google_delta_frame_info.sequence_number();
+        nanopb_delta_frame_info.is_delta = google_delta_frame_info.is_delta();
+        for (const auto& [robot_id, version] :
+             google_delta_frame_info.robot_entry_versions())
+        {
+            auto& robot_entry_version =
+                nanopb_delta_frame_info.robot_entry_versions
+                    [nanopb_delta_frame_info.robot_entry_versions_count++];
+            robot_entry_version.key   = robot_id;
+            robot_entry_version.value = version;
+        }
+
+        return nanopb_delta_frame_info;
+    }
+}  // namespace
+
+TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_primitive)
+{
     TbotsProto_Primitive nanopb_primitive = TbotsProto_Primitive_init_zero;
 
-    pb_istream_t pb_in_stream = pb_istream_from_buffer(
-        static_cast<uint8_t*>(serialized_proto.data()), serialized_proto.size());
-    if (!pb_decode(&pb_in_stream, TbotsProto_Primitive_fields, &nanopb_primitive))
+    switch (google_primitive.primitive_case())
     {
-        throw std::runtime_error(
-            "Failed to decode serialized primitive to NanoPb when converting google Primitive proto to NanoPb");
+        case TbotsProto::Primitive::kEstop:
+        {
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_estop_tag;
+            break;
+        }
+        case TbotsProto::Primitive::kChip:
+        {
+            const auto& google_chip          = google_primitive.chip();
+            auto& nanopb_chip                = nanopb_primitive.primitive.chip;
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_chip_tag;
+            nanopb_chip.has_chip_origin      = google_chip.has_chip_origin();
+            nanopb_chip.chip_origin        = createNanoPbPoint(google_chip.chip_origin());
+            nanopb_chip.has_chip_direction = google_chip.has_chip_direction();
+            nanopb_chip.chip_direction = createNanoPbAngle(google_chip.chip_direction());
+            nanopb_chip.chip_distance_meters = google_chip.chip_distance_meters();
+            break;
+        }
+        case TbotsProto::Primitive::kKick:
+        {
+            const auto& google_kick          = google_primitive.kick();
+            auto& nanopb_kick                = nanopb_primitive.primitive.kick;
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_kick_tag;
+            nanopb_kick.has_kick_origin      = google_kick.has_kick_origin();
+            nanopb_kick.kick_origin        = createNanoPbPoint(google_kick.kick_origin());
+            nanopb_kick.has_kick_direction = google_kick.has_kick_direction();
+            nanopb_kick.kick_direction = createNanoPbAngle(google_kick.kick_direction());
+            nanopb_kick.kick_speed_meters_per_second =
+                google_kick.kick_speed_meters_per_second();
+            break;
+        }
+        case TbotsProto::Primitive::kMove:
+        {
+            const auto& google_move          = google_primitive.move();
+            auto& nanopb_move                = nanopb_primitive.primitive.move;
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_move_tag;
+            nanopb_move.has_position_params  = google_move.has_position_params();
+            nanopb_move.position_params =
+                createNanoPbMovePositionParams(google_move.position_params());
+            nanopb_move.has_final_angle    = google_move.has_final_angle();
+            nanopb_move.final_angle        = createNanoPbAngle(google_move.final_angle());
+            nanopb_move.dribbler_speed_rpm = google_move.dribbler_speed_rpm();
+            break;
+        }
+        case TbotsProto::Primitive::kSpinningMove:
+        {
+            const auto& google_spinning_move = google_primitive.spinning_move();
+            auto& nanopb_spinning_move       = nanopb_primitive.primitive.spinning_move;
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_spinning_move_tag;
+            nanopb_spinning_move.has_position_params =
+                google_spinning_move.has_position_params();
+            nanopb_spinning_move.position_params =
+                createNanoPbMovePositionParams(google_spinning_move.position_params());
+            nanopb_spinning_move.has_angular_velocity =
+                google_spinning_move.has_angular_velocity();
+            nanopb_spinning_move.angular_velocity =
+                createNanoPbAngularVelocity(google_spinning_move.angular_velocity());
+            nanopb_spinning_move.dribbler_speed_rpm =
+                google_spinning_move.dribbler_speed_rpm();
+            break;
+        }
+        case TbotsProto::Primitive::kAutochipMove:
+        {
+            const auto& google_autochip_move = google_primitive.autochip_move();
+            auto& nanopb_autochip_move       = nanopb_primitive.primitive.autochip_move;
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_autochip_move_tag;
+            nanopb_autochip_move.has_position_params =
+                google_autochip_move.has_position_params();
+            nanopb_autochip_move.position_params =
+                createNanoPbMovePositionParams(google_autochip_move.position_params());
+            nanopb_autochip_move.has_final_angle = google_autochip_move.has_final_angle();
+            nanopb_autochip_move.final_angle =
+                createNanoPbAngle(google_autochip_move.final_angle());
+            nanopb_autochip_move.dribbler_speed_rpm =
+                google_autochip_move.dribbler_speed_rpm();
+            nanopb_autochip_move.chip_distance_meters =
+                google_autochip_move.chip_distance_meters();
+            break;
+        }
+        case TbotsProto::Primitive::kAutokickMove:
+        {
+            const auto& google_autokick_move = google_primitive.autokick_move();
+            auto& nanopb_autokick_move       = nanopb_primitive.primitive.autokick_move;
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_autokick_move_tag;
+            nanopb_autokick_move.has_position_params =
+                google_autokick_move.has_position_params();
+            nanopb_autokick_move.position_params =
+                createNanoPbMovePositionParams(google_autokick_move.position_params());
+            nanopb_autokick_move.has_final_angle = google_autokick_move.has_final_angle();
+            nanopb_autokick_move.final_angle =
+                createNanoPbAngle(google_autokick_move.final_angle());
+            nanopb_autokick_move.dribbler_speed_rpm =
+                google_autokick_move.dribbler_speed_rpm();
+            nanopb_autokick_move.kick_speed_meters_per_second =
+                google_autokick_move.kick_speed_meters_per_second();
+            break;
+        }
+        case TbotsProto::Primitive::kStop:
+        {
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_stop_tag;
+            nanopb_primitive.primitive.stop.stop_type =
+                static_cast<TbotsProto_StopPrimitive_StopType>(
+                    google_primitive.stop().stop_type());
+            break;
+        }
+        case TbotsProto::Primitive::kDirectControl:
+        {
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_direct_control_tag;
+            nanopb_primitive.primitive.direct_control =
+                createNanoPbDirectControlPrimitive(google_primitive.direct_control());
+            break;
+        }
+        case TbotsProto::Primitive::PRIMITIVE_NOT_SET:
+        {
+            break;
+        }
     }
 
     return nanopb_primitive;
@@ -26,21 +363,40 @@ TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_p
 TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
     const TbotsProto::PrimitiveSet& google_primitive_set)
 {
-    // Serialize the message to an array of raw values
-    std::vector<uint8_t> serialized_proto(google_primitive_set.ByteSizeLong());
-    google_primitive_set.SerializeToArray(
-        serialized_proto.data(), static_cast<int>(google_primitive_set.ByteSizeLong()));
-
-
     TbotsProto_PrimitiveSet nanopb_primitive_set = TbotsProto_PrimitiveSet_init_zero;
 
-    pb_istream_t pb_in_stream = pb_istream_from_buffer(
-        static_cast<uint8_t*>(serialized_proto.data()), serialized_proto.size());
-    if (!pb_decode(&pb_in_stream, TbotsProto_PrimitiveSet_fields, &nanopb_primitive_set))
+    const size_t max_robot_primitives = std::size(nanopb_primitive_set.robot_primitives);
+    if (static_cast<size_t>(google_primitive_set.robot_primitives_size()) >
+        max_robot_primitives)
     {
         throw std::runtime_error(
-            "Failed to decode serialized primitive_set to NanoPb when converting google PrimitiveSet proto to NanoPb");
+            "Failed to convert google PrimitiveSet proto to NanoPb, it has " +
+            std::to_string(google_primitive_set.robot_primitives_size()) +
+            " primitives but NanoPb can only hold " +
+            std::to_string(max_robot_primitives));
     }
 
+    nanopb_primitive_set.has_time_sent = google_primitive_set.has_time_sent();
+    nanopb_primitive_set.time_sent.epoch_timestamp_seconds =
+        google_primitive_set.time_sent().epoch_timestamp_seconds();
+
+    for (const auto& [robot_id, google_primitive] :
+         google_primitive_set.robot_primitives())
+    {
+        auto& robot_primitive =
+            nanopb_primitive_set
+                .robot_primitives[nanopb_primitive_set.robot_primitives_count++];
+        robot_primitive.key = robot_id;
+        // The google proto always serializes the value of a map entry, even if it is
+        // empty
+        robot_primitive.has_value = true;
+        robot_primitive.value     = createNanoPbPrimitive(google_primitive);
+    }
+
+    nanopb_primitive_set.has_delta_frame_info =
+        google_primitive_set.has_delta_frame_info();
+    nanopb_primitive_set.delta_frame_info =
+        createNanoPbDeltaFrameInfo(google_primitive_set.delta_frame_info());
+
     return nanopb_primitive_set;
 }
@@ -24,6 +24,9 @@ TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_p
  * @param google_primitive_set The google primitive set proto to convert to a NanoPb
  * message
  *
+ * @throws std::runtime_error if the primitive set has more primitives or robot entry
+ * versions than the NanoPb message can hold
+ *
  * @return The NanoPb message representing the given primitive
  */
 TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <pb_decode.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "shared/constants.h"
+#include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
+#include "software/proto/primitive/primitive_msg_factory.h"
+
+/**
+ * Converts the given primitive set to NanoPb by serializing it and decoding it with
+ * NanoPb, which is how primitive sets were converted before they were converted field
+ * by field
+ *
+ * @param google_primitive_set The primitive set to convert
+ *
+ * @return The NanoPb message representing the given primitive set
+ */
+TbotsProto_PrimitiveSet convertBySerializing(
+    const TbotsProto::PrimitiveSet& google_primitive_set)
+{
+    std::vector<uint8_t> serialized_proto(google_primitive_set.ByteSizeLong());
+    google_primitive_set.SerializeToArray(serialized_proto.data(),
+                                          static_cast<int>(serialized_proto.size()));
+
+    TbotsProto_PrimitiveSet nanopb_primitive_set = TbotsProto_PrimitiveSet_init_zero;
+    pb_istream_t pb_in_stream =
+        pb_istream_from_buffer(serialized_proto.data(), serialized_proto.size());
+    if (!pb_decode(&pb_in_stream, TbotsProto_PrimitiveSet_fields, &nanopb_primitive_set))
+    {
+        throw std::runtime_error("Failed to decode serialized primitive set");
+    }
+    return nanopb_primitive_set;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(PrimitiveGoogleToNanoPbConverterPerformanceTest,
+     DISABLED_full_team_primitive_set_conversion_performance)
+{
+    const unsigned int num_iterations = 100000;
+
+    // A full team of robots running a mix of primitives, like what the AI sends every
+    // tick
+    TbotsProto::PrimitiveSet google_primitive_set;
+    google_primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(1234.5);
+    auto& robot_primitives_map = *google_primitive_set.mutable_robot_primitives();
+    for (unsigned int robot_id = 0; robot_id < MAX_ROBOTS_OVER_RADIO; robot_id++)
+    {
+        Point destination(robot_id * 0.1, -0.5 * robot_id);
+        switch (robot_id % 4)
+        {
+            case 0:
+                robot_primitives_map[robot_id] = *createMovePrimitive(
+                    destination, 1.0, Angle::half(), DribblerMode::MAX_FORCE);
+                break;
+            case 1:
+                robot_primitives_map[robot_id] = *createAutokickMovePrimitive(
+                    destination, 0.0, Angle::quarter(), DribblerMode::OFF, 5.0);
+                break;
+            case 2:
+                robot_primitives_map[robot_id] =
+                    *createChipPrimitive(destination, Angle::zero(), 2.0);
+                break;
+            default:
+                robot_primitives_map[robot_id] = *createStopPrimitive(true);
+                break;
+        }
+    }
+
+    std::vector<std::pair<std::string,
+                          std::function<TbotsProto_PrimitiveSet(
+                              const TbotsProto::PrimitiveSet& google_primitive_set)>>>
+        converters = {
+            {"Serialize and decode with NanoPb", convertBySerializing},
+            {"Field by field", createNanoPbPrimitiveSet},
+        };
+
+    for (const auto& [name, convert] : converters)
+    {
+        // Accumulate something from every conversion so the compiler can't optimize
+        // the conversions away
+        double checksum = 0.0;
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < num_iterations; i++)
+        {
+            TbotsProto_PrimitiveSet nanopb_primitive_set = convert(google_primitive_set);
+            checksum += nanopb_primitive_set.robot_primitives_count;
+        }
+        std::chrono::duration<double> elapsed_time =
+            std::chrono::steady_clock::now() - start_time;
+
+        std::cout << std::endl << name << ":" << std::endl;
+        std::cout << "Conversions per second = " << num_iterations / elapsed_time.count()
+                  << " | Average conversion time = "
+                  << elapsed_time.count() * 1e6 / num_iterations << "us"
+                  << " | Checksum = " << checksum << std::endl
+                  << std::endl;
+    }
+}
@@ -3,15 +3,215 @@
 #include <google/protobuf/util/message_differencer.h>
 #include <gtest/gtest.h>
 #include <math.h>
+#include <pb_decode.h>
+#include <pb_encode.h>
 
 #include "software/proto/primitive/primitive_msg_factory.h"
 
 /**
- * Rather then testing every single primitive to make sure it's converted correctly,
- * we have a single simple integration test to ensure the primitive is being converted
- * at all, as all the code to actually perform the conversion is not here (it's generated
- * from the proto, or defined in other visitors)
+ * Converts the given google proto to NanoPb by serializing it and decoding it with
+ * NanoPb, which is what the converter used to do. The NanoPb decoder is generated from
+ * the proto, so the result is used as the reference for the field-by-field conversion.
+ *
+ * @param google_msg The google proto to convert
+ * @param nanopb_fields The NanoPb fields of the message
+ * @param nanopb_msg The NanoPb message to decode into
  */
+void convertBySerializing(const google::protobuf::Message& google_msg,
+                          const pb_field_t* nanopb_fields, void* nanopb_msg)
+{
+    std::string serialized_proto = google_msg.SerializeAsString();
+    pb_istream_t pb_in_stream =
+        pb_istream_from_buffer(reinterpret_cast<const uint8_t*>(serialized_proto.data()),
+                               serialized_proto.size());
+    ASSERT_TRUE(pb_decode(&pb_in_stream, nanopb_fields, nanopb_msg));
+}
+
+/**
+ * Encodes the given NanoPb message, so that two messages can be compared by comparing
+ * their encodings
+ *
+ * @param nanopb_fields The NanoPb fields of the message
+ * @param nanopb_msg The NanoPb message to encode
+ *
+ * @return the encoded message
+ */
+std::vector<uint8_t> encodeNanoPb(const pb_field_t* nanopb_fields, const void* nanopb_msg)
+{
+    std::vector<uint8_t> buffer(1024);
+    pb_ostream_t pb_out_stream = pb_ostream_from_buffer(buffer.data(), buffer.size());
+    EXPECT_TRUE(pb_encode(&pb_out_stream, nanopb_fields, nanopb_msg));
+    buffer.resize(pb_out_stream.bytes_written);
+    return buffer;
+}
+
+/**
+ * Checks that the same submessages are present in both NanoPb primitives. NanoPb only
+ * encodes a submessage if its `has_<field>` flag is set, so this finds flags that
+ * weren't copied even if the encodings of both primitives are compared too.
+ *
+ * @param expected_primitive The expected primitive
+ * @param primitive The primitive to check
+ */
+void expectSameSubmessagesPresent(const TbotsProto_Primitive& expected_primitive,
+                                  const TbotsProto_Primitive& primitive)
+{
+    ASSERT_EQ(expected_primitive.which_primitive, primitive.which_primitive);
+    const auto& expected = expected_primitive.primitive;
+    const auto& actual   = primitive.primitive;
+    switch (primitive.which_primitive)
+    {
+        case TbotsProto_Primitive_chip_tag:
+            EXPECT_EQ(expected.chip.has_chip_origin, actual.chip.has_chip_origin);
+            EXPECT_EQ(expected.chip.has_chip_direction, actual.chip.has_chip_direction);
+            break;
+        case TbotsProto_Primitive_kick_tag:
+            EXPECT_EQ(expected.kick.has_kick_origin, actual.kick.has_kick_origin);
+            EXPECT_EQ(expected.kick.has_kick_direction, actual.kick.has_kick_direction);
+            break;
+        case TbotsProto_Primitive_move_tag:
+            EXPECT_EQ(expected.move.has_position_params, actual.move.has_position_params);
+            EXPECT_EQ(expected.move.position_params.has_destination,
+                      actual.move.position_params.has_destination);
+            EXPECT_EQ(expected.move.has_final_angle, actual.move.has_final_angle);
+            break;
+        case TbotsProto_Primitive_spinning_move_tag:
+            EXPECT_EQ(expected.spinning_move.has_position_params,
+                      actual.spinning_move.has_position_params);
+            EXPECT_EQ(expected.spinning_move.position_params.has_destination,
+                      actual.spinning_move.position_params.has_destination);
+            EXPECT_EQ(expected.spinning_move.has_angular_velocity,
+                      actual.spinning_move.has_angular_velocity);
+            break;
+        case TbotsProto_Primitive_autochip_move_tag:
+            EXPECT_EQ(expected.autochip_move.has_position_params,
+                      actual.autochip_move.has_position_params);
+            EXPECT_EQ(expected.autochip_move.position_params.has_destination,
+                      actual.autochip_move.position_params.has_destination);
+            EXPECT_EQ(expected.autochip_move.has_final_angle,
+                      actual.autochip_move.has_final_angle);
+            break;
+        case TbotsProto_Primitive_autokick_move_tag:
+            EXPECT_EQ(expected.autokick_move.has_position_params,
+                      actual.autokick_move.has_position_params);
+            EXPECT_EQ(expected.autokick_move.position_params.has_destination,
+                      actual.autokick_move.position_params.has_destination);
+            EXPECT_EQ(expected.autokick_move.has_final_angle,
+                      actual.autokick_move.has_final_angle);
+            break;
+        case TbotsProto_Primitive_direct_control_tag:
+            if (primitive.primitive.direct_control.which_wheel_control ==
+                TbotsProto_DirectControlPrimitive_direct_velocity_control_tag)
+            {
+                const auto& expected_velocity_control =
+                    expected.direct_control.wheel_control.direct_velocity_control;
+                const auto& velocity_control =
+                    actual.direct_control.wheel_control.direct_velocity_control;
+                EXPECT_EQ(expected_velocity_control.has_velocity,
+                          velocity_control.has_velocity);
+                EXPECT_EQ(expected_velocity_control.has_angular_velocity,
+                          velocity_control.has_angular_velocity);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+class PrimitiveGoogleToNanoPbConverterParameterizedTest
+    : public ::testing::TestWithParam<TbotsProto::Primitive>
+{
+};
+
+TEST_P(PrimitiveGoogleToNanoPbConverterParameterizedTest,
+       conversion_matches_serialize_and_decode)
+{
+    TbotsProto::Primitive google_primitive = GetParam();
+
+    TbotsProto_Primitive expected_nanopb_primitive = TbotsProto_Primitive_init_zero;
+    convertBySerializing(google_primitive, TbotsProto_Primitive_fields,
+                         &expected_nanopb_primitive);
+
+    TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(google_primitive);
+
+    expectSameSubmessagesPresent(expected_nanopb_primitive, nanopb_primitive);
+    EXPECT_EQ(encodeNanoPb(TbotsProto_Primitive_fields, &expected_nanopb_primitive),
+              encodeNanoPb(TbotsProto_Primitive_fields, &nanopb_primitive));
+}
+
+TbotsProto::Primitive createDirectPerWheelControlPrimitive()
+{
+    TbotsProto::Primitive primitive;
+    auto direct_control = primitive.mutable_direct_control();
+    auto per_wheel      = direct_control->mutable_direct_per_wheel_control();
+    per_wheel->set_front_left_wheel_rpm(1.0f);
+    per_wheel->set_back_left_wheel_rpm(2.0f);
+    per_wheel->set_front_right_wheel_rpm(3.0f);
+    per_wheel->set_back_right_wheel_rpm(4.0f);
+    direct_control->set_charge_mode(TbotsProto::DirectControlPrimitive::CHARGE);
+    direct_control->set_autochip_distance_meters(2.5f);
+    direct_control->set_dribbler_speed_rpm(1000.0f);
+    return primitive;
+}
+
+TbotsProto::Primitive createDirectVelocityControlPrimitive()
+{
+    TbotsProto::Primitive primitive;
+    auto direct_control = primitive.mutable_direct_control();
+    auto velocity       = direct_control->mutable_direct_velocity_control();
+    velocity->mutable_velocity()->set_x_component_meters(-1.5f);
+    velocity->mutable_velocity()->set_y_component_meters(0.5f);
+    velocity->mutable_angular_velocity()->set_radians_per_second(3.0f);
+    direct_control->set_charge_mode(TbotsProto::DirectControlPrimitive::FLOAT);
+    direct_control->set_kick_speed_meters_per_second(4.0f);
+    return primitive;
+}
+
+TbotsProto::Primitive createMpcAutokickMovePrimitive()
+{
+    TbotsProto::Primitive primitive = *createAutokickMovePrimitive(
+        Point(1, -1), 1.0, Angle::quarter(), DribblerMode::INDEFINITE, 3.0);
+    primitive.mutable_autokick_move()->mutable_position_params()->set_controller_type(
+        TbotsProto::MovePositionParams::MPC);
+    return primitive;
+}
+
+TbotsProto::Primitive createEstopPrimitive()
+{
+    TbotsProto::Primitive primitive;
+    primitive.mutable_estop();
+    return primitive;
+}
+
+INSTANTIATE_TEST_CASE_P(
+    AllPrimitives, PrimitiveGoogleToNanoPbConverterParameterizedTest,
+    ::testing::Values(
+        TbotsProto::Primitive(), createEstopPrimitive(),
+        *createChipPrimitive(Point(1, -2), Angle::quarter(), 3.5),
+        *createKickPrimitive(Point(-1, 2), Angle::threeQuarter(), 5.5),
+        *createMovePrimitive(Point(1, 2), 1.5, Angle::half(), DribblerMode::MAX_FORCE),
+        *createSpinningMovePrimitive(Point(-3, 1), 0.5, AngularVelocity::fromRadians(4.0),
+                                     DribblerMode::INDEFINITE),
+        *createAutochipMovePrimitive(Point(2, 2), 0.0, Angle::zero(), DribblerMode::OFF,
+                                     2.0),
+        *createAutokickMovePrimitive(Point(0, -4), 2.0, Angle::fromDegrees(45),
+                                     DribblerMode::MAX_FORCE, 6.0),
+        *createStopPrimitive(false), *createStopPrimitive(true),
+        createDirectPerWheelControlPrimitive(), createDirectVelocityControlPrimitive(),
+        createMpcAutokickMovePrimitive()));
+
+TEST(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_with_submessages_left_out)
+{
+    TbotsProto::Primitive google_primitive;
+    google_primitive.mutable_move()->set_dribbler_speed_rpm(100.0f);
+
+    TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(google_primitive);
+
+    ASSERT_EQ(nanopb_primitive.which_primitive, TbotsProto_Primitive_move_tag);
+    EXPECT_FALSE(nanopb_primitive.primitive.move.has_position_params);
+    EXPECT_FALSE(nanopb_primitive.primitive.move.has_final_angle);
+    EXPECT_EQ(100.0f, nanopb_primitive.primitive.move.dribbler_speed_rpm);
+}
 
 TEST(PrimitiveGoogleToNanoPbConverterTest, convert_move_primitive)
 {
@@ -21,6 +221,9 @@ TEST(PrimitiveGoogleToNanoPbConverterTest, convert_move_primitive)
     TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(google_primitive);
 
     ASSERT_EQ(nanopb_primitive.which_primitive, TbotsProto_Primitive_move_tag);
+    EXPECT_TRUE(nanopb_primitive.primitive.move.has_position_params);
+    EXPECT_TRUE(nanopb_primitive.primitive.move.position_params.has_destination);
+    EXPECT_TRUE(nanopb_primitive.primitive.move.has_final_angle);
     EXPECT_EQ(nanopb_primitive.primitive.move.position_params.destination.x_meters, 1.0f);
     EXPECT_EQ(nanopb_primitive.primitive.move.position_params.destination.y_meters, 2.0f);
     EXPECT_EQ(
@@ -31,6 +234,20 @@ TEST(PrimitiveGoogleToNanoPbConverterTest, convert_move_primitive)
     EXPECT_EQ(nanopb_primitive.primitive.move.dribbler_speed_rpm, 16000);
 }
 
+TEST(PrimitiveGoogleToNanoPbConverterTest, convert_move_primitive_with_mpc_controller)
+{
+    TbotsProto::Primitive google_primitive =
+        *createMovePrimitive(Point(1, 2), 100, Angle::half(), DribblerMode::MAX_FORCE);
+    google_primitive.mutable_move()->mutable_position_params()->set_controller_type(
+        TbotsProto::MovePositionParams::MPC);
+
+    TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(google_primitive);
+
+    ASSERT_EQ(nanopb_primitive.which_primitive, TbotsProto_Primitive_move_tag);
+    EXPECT_EQ(nanopb_primitive.primitive.move.position_params.controller_type,
+              TbotsProto_MovePositionParams_ControllerType_MPC);
+}
+
 TEST(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_set)
 {
     *createMovePrimitive(Point(1, 2), 100, Angle::half(), DribblerMode::MAX_FORCE);
@@ -91,3 +308,77 @@ TEST(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_set)
         }
     }
 }
+
+TEST(PrimitiveGoogleToNanoPbConverterTest,
+     convert_primitive_set_matches_serialize_and_decode)
+{
+    TbotsProto::PrimitiveSet google_primitive_set;
+    google_primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(1234.5);
+    auto& robot_primitives_map = *google_primitive_set.mutable_robot_primitives();
+    robot_primitives_map[1]    = *createStopPrimitive(true);
+    robot_primitives_map[4]    = *createChipPrimitive(Point(1, 1), Angle::zero(), 1.0);
+    robot_primitives_map[7]    = createDirectVelocityControlPrimitive();
+    robot_primitives_map[9]    = createMpcAutokickMovePrimitive();
+    // Every field of the PrimitiveSet is set, so that fields the converter doesn't copy
+    // make the encodings different
+    auto delta_frame_info = google_primitive_set.mutable_delta_frame_info();
+    delta_frame_info->set_sequence_number(12);
+    delta_frame_info->set_is_delta(true);
+    (*delta_frame_info->mutable_robot_entry_versions())[1] = 3;
+    (*delta_frame_info->mutable_robot_entry_versions())[4] = 5;
+
+    TbotsProto_PrimitiveSet expected_nanopb_primitive_set =
+        TbotsProto_PrimitiveSet_init_zero;
+    convertBySerializing(google_primitive_set, TbotsProto_PrimitiveSet_fields,
+                         &expected_nanopb_primitive_set);
+
+    TbotsProto_PrimitiveSet nanopb_primitive_set =
+        createNanoPbPrimitiveSet(google_primitive_set);
+
+    EXPECT_TRUE(nanopb_primitive_set.has_time_sent);
+    EXPECT_EQ(1234.5, nanopb_primitive_set.time_sent.epoch_timestamp_seconds);
+    ASSERT_EQ(4, nanopb_primitive_set.robot_primitives_count);
+    ASSERT_EQ(4, expected_nanopb_primitive_set.robot_primitives_count);
+    for (pb_size_t i = 0; i < nanopb_primitive_set.robot_primitives_count; i++)
+    {
+        const auto& expected_entry = expected_nanopb_primitive_set.robot_primitives[i];
+        const auto& entry          = nanopb_primitive_set.robot_primitives[i];
+        EXPECT_EQ(expected_entry.key, entry.key);
+        EXPECT_EQ(expected_entry.has_value, entry.has_value);
+        expectSameSubmessagesPresent(expected_entry.value, entry.value);
+    }
+    EXPECT_TRUE(nanopb_primitive_set.has_delta_frame_info);
+    EXPECT_EQ(12, nanopb_primitive_set.delta_frame_info.sequence_number);
+    EXPECT_TRUE(nanopb_primitive_set.delta_frame_info.is_delta);
+    EXPECT_EQ(2, nanopb_primitive_set.delta_frame_info.robot_entry_versions_count);
+    EXPECT_EQ(
+        encodeNanoPb(TbotsProto_PrimitiveSet_fields, &expected_nanopb_primitive_set),
+        encodeNanoPb(TbotsProto_PrimitiveSet_fields, &nanopb_primitive_set));
+}
+
+TEST(PrimitiveGoogleToNanoPbConverterTest,
+     convert_primitive_set_with_too_many_primitives_throws_exception)
+{
+    TbotsProto::PrimitiveSet google_primitive_set;
+    auto& robot_primitives_map = *google_primitive_set.mutable_robot_primitives();
+    for (uint32_t robot_id = 0; robot_id < 21; robot_id++)
+    {
+        robot_primitives_map[robot_id] = *createStopPrimitive(false);
+    }
+
+    EXPECT_THROW(createNanoPbPrimitiveSet(google_primitive_set), std::runtime_error);
+}
+
+TEST(PrimitiveGoogleToNanoPbConverterTest,
+     convert_primitive_set_with_too_many_robot_entry_versions_throws_exception)
+{
+    TbotsProto::PrimitiveSet google_primitive_set;
+    auto& robot_entry_versions =
+        *google_primitive_set.mutable_delta_frame_info()->mutable_robot_entry_versions();
+    for (uint32_t robot_id = 0; robot_id < 21; robot_id++)
+    {
+        robot_entry_versions[robot_id] = 1;
+    }
+
+    EXPECT_THROW(createNanoPbPrimitiveSet(google_primitive_set), std::runtime_error);
+}
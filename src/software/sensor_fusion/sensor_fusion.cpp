@@ -1,6 +1,7 @@
 #include "software/sensor_fusion/sensor_fusion.h"
 
 #include "software/logger/logger.h"
+#include "software/metrics/metrics_registry.h"
 
 SensorFusion::SensorFusion(std::shared_ptr<const SensorFusionConfig> sensor_fusion_config)
     : sensor_fusion_config(sensor_fusion_config),
@@ -44,6 +45,11 @@ std::optional<World> SensorFusion::getWorld() const
 
 void SensorFusion::processSensorProto(const SensorProto &sensor_msg)
 {
+    static Histogram &process_sensor_proto_time_histogram =
+        MetricsRegistry::getGlobalRegistry().getHistogram(
+            "sensor_fusion.process_sensor_proto_time_us");
+    ScopedHistogramTimer timer(process_sensor_proto_time_histogram);
+
     if (sensor_msg.has_ssl_vision_msg())
     {
         updateWorld(sensor_msg.ssl_vision_msg());
@@ -9,6 +9,7 @@ NonTerminatingFunctionValidator::NonTerminatingFunctionValidator(
        // otherwise the World inside the coroutine will not update properly when the
        // pointer is updated, and the wrong validation_function may be run.
       validation_sequence(
+          getValidationCoroutineStackAllocator(),
           boost::bind(&NonTerminatingFunctionValidator::executeAndCheckForFailuresWrapper,
                       this, _1, world, validation_function)),
       world_(world),
@@ -18,13 +19,16 @@ NonTerminatingFunctionValidator::NonTerminatingFunctionValidator(
 
 void NonTerminatingFunctionValidator::executeAndCheckForFailures()
 {
-    // Check the coroutine status to see if it has any more work to do.
+    // The coroutine loops forever, so it will only have completed if an exception was
+    // thrown out of the validation_function. In that case we re-start the coroutine by
+    // re-creating it
     if (!validation_sequence)
     {
-        // Re-start the coroutine by re-creating it
-        validation_sequence = ValidationCoroutine::pull_type(boost::bind(
-            &NonTerminatingFunctionValidator::executeAndCheckForFailuresWrapper, this, _1,
-            world_, validation_function_));
+        validation_sequence = ValidationCoroutine::pull_type(
+            getValidationCoroutineStackAllocator(),
+            boost::bind(
+                &NonTerminatingFunctionValidator::executeAndCheckForFailuresWrapper, this,
+                _1, world_, validation_function_));
     }
 
     // Run the coroutine. This will call the bound executeAndCheckForFailuresWrapper
@@ -42,6 +46,16 @@ void NonTerminatingFunctionValidator::executeAndCheckForFailuresWrapper(
     yield();
 
     // Anytime after the first function call, the validation_function will be
-    // used to perform the real logic.
-    validation_function(world, yield);
+    // used to perform the real logic. Rather than letting the coroutine complete and
+    // re-creating it to restart the validation_function, we loop inside the same
+    // coroutine. This avoids creating a new coroutine (and its stack) every time the
+    // validation_function completes, which for most validation functions is every tick.
+    while (true)
+    {
+        validation_function(world, yield);
+
+        // Stop here until the next call to executeAndCheckForFailures, where the
+        // validation_function will be started again from the beginning
+        yield();
+    }
 }
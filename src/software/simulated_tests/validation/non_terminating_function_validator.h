@@ -7,8 +7,10 @@
  * an easy way to manage the coroutines required to run ValidationFunctions as well as see
  * if the function has succeeded / passed.
  *
- * This class will run the provided coroutine continuously by restarting it every time the
- * coroutine has completed.
+ * This class will run the provided ValidationFunction continuously by restarting it every
+ * time it has completed. The ValidationFunction is restarted within the same coroutine,
+ * so no new coroutines are created when it completes. A new coroutine is only created
+ * if an exception is thrown out of the ValidationFunction.
  */
 class NonTerminatingFunctionValidator
 {
@@ -43,6 +45,10 @@ class NonTerminatingFunctionValidator
      * wrapper function pass any arguments to the validation_function rather than pass
      * all parameters through coroutines.
      *
+     * The validation_function is run in a loop, so this function only returns (and the
+     * coroutine only completes) if an exception is thrown out of the
+     * validation_function.
+     *
      * @param yield The coroutine push_type for the validation_function
      * @param world The world that will be given to the validation_function being run.
      * Because it's a shared_ptr any external changes made to the world will be reflected
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <boost/bind.hpp>
+#include <iostream>
+
+#include "software/simulated_tests/non_terminating_validation_functions/robots_avoid_ball_validation.h"
+#include "software/simulated_tests/non_terminating_validation_functions/robots_in_friendly_half_validation.h"
+#include "software/simulated_tests/non_terminating_validation_functions/robots_not_in_center_circle_validation.h"
+#include "software/simulated_tests/non_terminating_validation_functions/robots_slow_down_validation.h"
+#include "software/simulated_tests/validation/non_terminating_function_validator.h"
+#include "software/simulated_tests/validation/validation_function.h"
+#include "software/test_util/test_util.h"
+
+/**
+ * A copy of the original NonTerminatingFunctionValidator implementation, which
+ * re-creates the coroutine (and allocates a new stack for it) every time the
+ * ValidationFunction completes. This is used as the baseline to compare against.
+ */
+class RestartingFunctionValidator
+{
+   public:
+    explicit RestartingFunctionValidator(ValidationFunction validation_function,
+                                         std::shared_ptr<World> world)
+        : validation_sequence(boost::bind(&RestartingFunctionValidator::executeWrapper,
+                                          _1, world, validation_function)),
+          world_(world),
+          validation_function_(validation_function)
+    {
+    }
+
+    void executeAndCheckForFailures()
+    {
+        if (!validation_sequence)
+        {
+            validation_sequence = ValidationCoroutine::pull_type(
+                boost::bind(&RestartingFunctionValidator::executeWrapper, _1, world_,
+                            validation_function_));
+        }
+        validation_sequence();
+    }
+
+   private:
+    static void executeWrapper(ValidationCoroutine::push_type& yield,
+                               std::shared_ptr<World> world,
+                               ValidationFunction validation_function)
+    {
+        yield();
+        validation_function(world, yield);
+    }
+
+    ValidationCoroutine::pull_type validation_sequence;
+    std::shared_ptr<World> world_;
+    ValidationFunction validation_function_;
+};
+
+/**
+ * Creates the given number of each of the existing non-terminating validation functions
+ *
+ * @param num_copies How many copies of each validation function to create
+ *
+ * @return the validation functions
+ */
+std::vector<ValidationFunction> createNonTerminatingValidationFunctions(
+    unsigned int num_copies)
+{
+    std::vector<ValidationFunction> validation_functions;
+    for (unsigned int i = 0; i < num_copies; i++)
+    {
+        validation_functions.emplace_back(robotsInFriendlyHalf);
+        validation_functions.emplace_back(robotsNotInCenterCircle);
+        validation_functions.emplace_back(
+            [](std::shared_ptr<World> world_ptr, ValidationCoroutine::push_type& yield) {
+                robotsAvoidBall(0.5, world_ptr, yield);
+            });
+        validation_functions.emplace_back(
+            [](std::shared_ptr<World> world_ptr, ValidationCoroutine::push_type& yield) {
+                robotsSlowDown(1.5, world_ptr, yield);
+            });
+    }
+    return validation_functions;
+}
+
+/**
+ * Creates validators for all the given validation functions and runs them all for the
+ * given number of ticks, and returns the average time taken per validator per tick
+ *
+ * @param validation_functions The validation functions to run
+ * @param world The world given to the validation functions
+ * @param num_ticks The number of ticks to run the validators for
+ *
+ * @return the average time taken to run a single validator for a single tick, in
+ * microseconds
+ */
+template <typename ValidatorType>
+double averageMicrosecondsPerValidatorTick(
+    const std::vector<ValidationFunction>& validation_functions,
+    std::shared_ptr<World> world, unsigned int num_ticks)
+{
+    std::vector<ValidatorType> validators;
+    for (const auto& validation_function : validation_functions)
+    {
+        validators.emplace_back(ValidatorType(validation_function, world));
+    }
+
+    auto start_time = std::chrono::system_clock::now();
+    for (unsigned int i = 0; i < num_ticks; i++)
+    {
+        for (auto& validator : validators)
+        {
+            validator.executeAndCheckForFailures();
+        }
+    }
+    double duration_ms = ::TestUtil::millisecondsSince(start_time);
+
+    return duration_ms * 1000.0 / (num_ticks * validators.size());
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(NonTerminatingFunctionValidatorPerformanceTest,
+     DISABLED_non_terminating_function_validator_performance)
+{
+    const unsigned int num_ticks = 10000;
+
+    // The robots are all stationary in the friendly half, away from the ball and center
+    // circle, so none of the validation functions fail
+    auto world = std::make_shared<World>(
+        ::TestUtil::setFriendlyRobotPositions(::TestUtil::createBlankTestingWorld(),
+                                              {Point(-3, -2), Point(-3, -1), Point(-3, 0),
+                                               Point(-3, 1), Point(-3, 2), Point(-4, 0)},
+                                              Timestamp::fromSeconds(0)));
+
+    for (unsigned int num_copies : {1u, 3u, 5u})
+    {
+        auto validation_functions = createNonTerminatingValidationFunctions(num_copies);
+
+        double restarting_us =
+            averageMicrosecondsPerValidatorTick<RestartingFunctionValidator>(
+                validation_functions, world, num_ticks);
+        double looping_us =
+            averageMicrosecondsPerValidatorTick<NonTerminatingFunctionValidator>(
+                validation_functions, world, num_ticks);
+
+        std::cout << std::endl
+                  << "# validators = " << validation_functions.size()
+                  << " | # ticks = " << num_ticks << std::endl;
+        std::cout << "Restarting coroutine per completion: " << restarting_us
+                  << "us per validator per tick | "
+                  << restarting_us * validation_functions.size() << "us per tick"
+                  << std::endl;
+        std::cout << "Looping coroutine with pooled stack: " << looping_us
+                  << "us per validator per tick | "
+                  << looping_us * validation_functions.size() << "us per tick"
+                  << std::endl
+                  << std::endl;
+    }
+}
@@ -115,3 +115,47 @@ TEST(NonTerminatingFunctionValidatorTest,
     function_validator.executeAndCheckForFailures();
     EXPECT_THROW(function_validator.executeAndCheckForFailures(), std::runtime_error);
 }
+
+TEST(NonTerminatingFunctionValidatorTest,
+     test_validation_function_that_does_not_yield_is_run_once_per_execution)
+{
+    unsigned int num_runs = 0;
+    ValidationFunction validation_function =
+        [&num_runs](std::shared_ptr<World> world, ValidationCoroutine::push_type& yield) {
+            num_runs++;
+        };
+
+    auto world = std::make_shared<World>(::TestUtil::createBlankTestingWorld());
+    NonTerminatingFunctionValidator function_validator(validation_function, world);
+    EXPECT_EQ(0, num_runs);
+
+    for (unsigned int i = 1; i <= 10; i++)
+    {
+        function_validator.executeAndCheckForFailures();
+        EXPECT_EQ(i, num_runs);
+    }
+}
+
+TEST(NonTerminatingFunctionValidatorTest,
+     test_validation_function_that_yields_is_restarted_on_execution_after_completing)
+{
+    std::vector<std::string> events;
+    ValidationFunction validation_function =
+        [&events](std::shared_ptr<World> world, ValidationCoroutine::push_type& yield) {
+            events.emplace_back("start");
+            yield();
+            events.emplace_back("end");
+        };
+
+    auto world = std::make_shared<World>(::TestUtil::createBlankTestingWorld());
+    NonTerminatingFunctionValidator function_validator(validation_function, world);
+
+    function_validator.executeAndCheckForFailures();
+    EXPECT_EQ(std::vector<std::string>({"start"}), events);
+
+    function_validator.executeAndCheckForFailures();
+    EXPECT_EQ(std::vector<std::string>({"start", "end"}), events);
+
+    function_validator.executeAndCheckForFailures();
+    EXPECT_EQ(std::vector<std::string>({"start", "end", "start"}), events);
+}
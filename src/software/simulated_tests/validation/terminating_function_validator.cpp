@@ -10,6 +10,7 @@ TerminatingFunctionValidator::TerminatingFunctionValidator(
        // otherwise the World inside the coroutine will not update properly when the
        // pointer is updated, and the wrong validation_function may be run.
       validation_sequence(
+          getValidationCoroutineStackAllocator(),
           boost::bind(&TerminatingFunctionValidator::executeAndCheckForSuccessWrapper,
                       this, _1, world, validation_function))
 {
@@ -8,3 +8,19 @@
 using ValidationCoroutine = boost::coroutines2::coroutine<void>;
 using ValidationFunction =
     std::function<void(std::shared_ptr<World>, ValidationCoroutine::push_type&)>;
+
+/**
+ * Returns the stack allocator that should be used to create ValidationCoroutines.
+ *
+ * The stacks are pooled per thread, so a stack is returned to the pool when its
+ * coroutine is destroyed and handed out again to the next coroutine that is created,
+ * rather than being mapped and unmapped for every coroutine. Because the pool is not
+ * thread-safe, coroutines must be destroyed on the same thread they were created on.
+ *
+ * @return the stack allocator for ValidationCoroutines created on this thread
+ */
+inline boost::coroutines2::pooled_fixedsize_stack getValidationCoroutineStackAllocator()
+{
+    static thread_local boost::coroutines2::pooled_fixedsize_stack stack_allocator;
+    return stack_allocator;
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
+#include "software/proto/primitive/primitive_msg_factory.h"
+#include "software/simulation/simulator.h"
+
+struct MoveSimulationResult
+{
+    // The time it took the robot to first get within the tolerance of the destination,
+    // or std::nullopt if it never did
+    std::optional<Duration> time_to_destination;
+    // The furthest the robot went past the destination along the direction of travel
+    double overshoot_meters;
+    // How far the robot was from the destination at the end of the simulation
+    double final_error_meters;
+};
+
+/**
+ * Simulates a single robot running a move primitive from a standstill, tracking the
+ * trajectory to the destination with the given controller
+ *
+ * @param start The position the robot starts at
+ * @param destination The destination of the move primitive
+ * @param controller_type The controller to track the trajectory with
+ * @param duration How long to simulate for
+ *
+ * @return The time to the destination, overshoot and final error of the robot
+ */
+MoveSimulationResult simulateMove(
+    const Point& start, const Point& destination,
+    TbotsProto::MovePositionParams::ControllerType controller_type,
+    const Duration& duration)
+{
+    const double destination_tolerance_meters = 0.02;
+    const Duration time_step                  = Duration::fromSeconds(1.0 / 60.0);
+
+    Simulator simulator(Field::createSSLDivisionBField());
+    simulator.addYellowRobots(
+        {RobotStateWithId{.id          = 1,
+                          .robot_state = RobotState(start, Vector(0, 0), Angle::zero(),
+                                                    AngularVelocity::zero())}});
+
+    auto primitive =
+        createMovePrimitive(destination, 0.0, Angle::quarter(), DribblerMode::OFF);
+    primitive->mutable_move()->mutable_position_params()->set_controller_type(
+        controller_type);
+    TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(*primitive);
+    // Make sure the robot is really running the controller being compared
+    EXPECT_EQ(static_cast<int>(controller_type),
+              static_cast<int>(
+                  nanopb_primitive.primitive.move.position_params.controller_type));
+    simulator.setYellowRobotPrimitive(1, nanopb_primitive);
+
+    const Vector direction_of_travel = (destination - start).normalize();
+    MoveSimulationResult result{.time_to_destination = std::nullopt,
+                                .overshoot_meters    = 0.0,
+                                .final_error_meters  = (destination - start).length()};
+    for (Duration time = Duration::fromSeconds(0); time < duration;
+         time          = time + time_step)
+    {
+        simulator.stepSimulation(time_step);
+
+        auto ssl_wrapper_packet = simulator.getSSLWrapperPacket();
+        if (!ssl_wrapper_packet ||
+            ssl_wrapper_packet->detection().robots_yellow_size() < 1)
+        {
+            continue;
+        }
+        const auto& robot = ssl_wrapper_packet->detection().robots_yellow(0);
+        const Point position(robot.x() / 1000.0, robot.y() / 1000.0);
+
+        result.final_error_meters = (destination - position).length();
+        result.overshoot_meters   = std::max(
+            result.overshoot_meters, (position - destination).dot(direction_of_travel));
+        if (!result.time_to_destination &&
+            result.final_error_meters < destination_tolerance_meters)
+        {
+            result.time_to_destination = time + time_step;
+        }
+    }
+
+    return result;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(MoveControllerPerformanceTest, DISABLED_compare_move_controllers)
+{
+    const std::vector<std::pair<Point, Point>> moves = {
+        {Point(0, 0), Point(1, 0)},
+        {Point(-3, -2), Point(3, 2)},
+        {Point(2, 1), Point(1.5, -1)},
+    };
+    const std::vector<
+        std::pair<std::string, TbotsProto::MovePositionParams::ControllerType>>
+        controllers = {
+            {"Bang-bang", TbotsProto::MovePositionParams::BANG_BANG},
+            {"MPC", TbotsProto::MovePositionParams::MPC},
+        };
+
+    for (const auto& move : moves)
+    {
+        std::cout << std::endl
+                  << "Move from " << move.first << " to " << move.second << ":"
+                  << std::endl;
+        for (const auto& controller : controllers)
+        {
+            MoveSimulationResult result = simulateMove(
+                move.first, move.second, controller.second, Duration::fromSeconds(6));
+
+            std::cout << controller.first << ": time to destination = ";
+            if (result.time_to_destination)
+            {
+                std::cout << result.time_to_destination->toSeconds() << "s";
+            }
+            else
+            {
+                std::cout << "never reached";
+            }
+            std::cout << " | overshoot = " << result.overshoot_meters
+                      << "m | final error = " << result.final_error_meters << "m"
+                      << std::endl;
+        }
+    }
+}
@@ -123,6 +123,31 @@ bool PhysicsBall::isTouchingOtherObject() const
     return false;
 }
 
+bool PhysicsBall::isTouchingRobot() const
+{
+    for (b2ContactEdge *contact_edge           = ball_body->GetContactList();
+         contact_edge != nullptr; contact_edge = contact_edge->next)
+    {
+        if (!contact_edge->contact->IsTouching())
+        {
+            continue;
+        }
+
+        // Only one of the fixtures in the contact belongs to the ball, so we only
+        // need to check that at least one of them belongs to a robot
+        for (b2Fixture *fixture :
+             {contact_edge->contact->GetFixtureA(), contact_edge->contact->GetFixtureB()})
+        {
+            auto user_data = static_cast<PhysicsObjectUserData *>(fixture->GetUserData());
+            if (user_data && user_data->type != PhysicsObjectType::BALL)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void PhysicsBall::setInFlightForDistance(double in_flight_distance,
                                          Angle angle_of_departure)
 {
@@ -129,6 +129,14 @@ class PhysicsBall
      */
     void applyImpulse(const Vector& impulse);
 
+    /**
+     * Returns true if this ball is touching any part of a robot in the physics world
+     *
+     * @return true if the ball is touching any part of a robot in the physics world,
+     * and false otherwise
+     */
+    bool isTouchingRobot() const;
+
    private:
     /**
      * Returns true if this ball is touching another object in the physics world
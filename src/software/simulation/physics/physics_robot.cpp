@@ -25,7 +25,7 @@ const double PhysicsRobot::TOTAL_DRIBBLER_DEPTH =
 
 PhysicsRobot::PhysicsRobot(RobotId id, std::shared_ptr<b2World> world,
                            const RobotState& robot_state, const double mass_kg)
-    : robot_id(id)
+    : robot_id(id), sub_step_fraction(1.0)
 {
     b2BodyDef robot_body_def;
     robot_body_def.type = b2_dynamicBody;
@@ -264,6 +264,12 @@ void PhysicsRobot::applyWheelForceFrontRight(double force_in_newtons)
 }
 
 void PhysicsRobot::applyWheelForceAtAngle(Angle angle_to_wheel, double force_in_newtons)
+{
+    wheel_forces.emplace_back(angle_to_wheel, force_in_newtons);
+    applyWheelForceToBody(angle_to_wheel, force_in_newtons);
+}
+
+void PhysicsRobot::applyWheelForceToBody(Angle angle_to_wheel, double force_in_newtons)
 {
     // The center of the robot is always at (0, 0) in its own coordinate frame
     Point local_robot_position = Point(0, 0);
@@ -381,6 +387,29 @@ void PhysicsRobot::runPostPhysicsStep()
     }
 }
 
+void PhysicsRobot::reapplyWheelForces()
+{
+    for (const auto& [angle_to_wheel, force_in_newtons] : wheel_forces)
+    {
+        applyWheelForceToBody(angle_to_wheel, force_in_newtons);
+    }
+}
+
+void PhysicsRobot::clearWheelForces()
+{
+    wheel_forces.clear();
+}
+
+void PhysicsRobot::setSubStepFraction(double fraction)
+{
+    sub_step_fraction = fraction;
+}
+
+double PhysicsRobot::getSubStepFraction() const
+{
+    return sub_step_fraction;
+}
+
 void PhysicsRobot::applyForceToCenterOfMass(const Vector& force)
 {
     b2Vec2 force_vector = createVec2(force);
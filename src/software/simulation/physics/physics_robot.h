@@ -109,6 +109,17 @@ class PhysicsRobot
     std::vector<std::function<void(PhysicsRobot *, PhysicsBall *)>>
     getDribblerBallEndContactCallbacks() const;
 
+    /**
+     * Returns the fraction of the current physics step that each Box2D step covers.
+     * This is less than 1 when the PhysicsWorld splits the physics step into several
+     * sub-steps, and lets contact callbacks that apply impulses scale them so that
+     * their total effect over the physics step doesn't depend on the number of
+     * sub-steps.
+     *
+     * @return the fraction of the current physics step that each Box2D step covers
+     */
+    double getSubStepFraction() const;
+
     /**
      * Returns the current robot state
      *
@@ -199,6 +210,28 @@ class PhysicsRobot
      */
     void runPostPhysicsStep();
 
+    /**
+     * Applies all the wheel forces that have been applied to this robot since the last
+     * call to clearWheelForces() again, relative to the robot's current orientation.
+     *
+     * Box2D clears all forces after every step, so this is used by the PhysicsWorld
+     * to keep the wheels driving the robot for every sub-step of a single physics step.
+     */
+    void reapplyWheelForces();
+
+    /**
+     * Clears the record of the wheel forces applied to this robot. This must be called
+     * once the physics step the forces were applied for has been completed.
+     */
+    void clearWheelForces();
+
+    /**
+     * Sets the fraction of the current physics step that each Box2D step covers
+     *
+     * @param fraction The fraction of the physics step, in (0, 1]
+     */
+    void setSubStepFraction(double fraction);
+
    private:
     /**
      * Creates as many fixtures as necessary to represent the body shape of the given
@@ -247,6 +280,17 @@ class PhysicsRobot
      */
     void applyWheelForceAtAngle(Angle angle_to_wheel, double force_in_newtons);
 
+    /**
+     * Applies force to the robot body as if there was a wheel at the given angle,
+     * relative to the front of the robot, without recording it in the wheel forces
+     * for the current physics step
+     *
+     * @param angle_to_wheel The angle to the wheel axis, relative to the front of the
+     * robot
+     * @param force_in_newtons The force to apply
+     */
+    void applyWheelForceToBody(Angle angle_to_wheel, double force_in_newtons);
+
     /**
      * Returns the motor speeds for all motors on the robot. Units are in rpm
      *
@@ -281,6 +325,13 @@ class PhysicsRobot
 
     std::queue<std::function<void()>> post_physics_step_functions;
 
+    // The angle to the wheel axis and the force applied for every wheel force applied
+    // during the current physics step
+    std::vector<std::pair<Angle, double>> wheel_forces;
+
+    // The fraction of the current physics step that each Box2D step covers
+    double sub_step_fraction;
+
     // This is a somewhat arbitrary value for damping. We keep it relatively low
     // so that robots still coast a ways before stopping, but non-zero so that robots
     // do come to a halt if no force is applied.
@@ -1,5 +1,6 @@
 #include "software/simulation/physics/physics_world.h"
 
+#include <chrono>
 #include <limits>
 
 #include "shared/constants.h"
@@ -190,26 +191,127 @@ bool PhysicsWorld::isRobotIdAvailable(RobotId id, TeamColour colour) const
 
 void PhysicsWorld::stepSimulation(const Duration& time_step)
 {
+    const auto step_start_time = std::chrono::steady_clock::now();
+
+    // Whether the ball is in flight decides how many sub-steps are needed, so it must
+    // be up to date before they are chosen
     if (physics_ball)
     {
         physics_ball->updateIsInFlight();
-        if (!physics_ball->isInFlight())
+    }
+    const unsigned int num_sub_steps = getNumSubSteps();
+    const double sub_step_fraction   = 1.0 / static_cast<double>(num_sub_steps);
+    const Duration sub_step =
+        Duration::fromSeconds(time_step.toSeconds() * sub_step_fraction);
+
+    for (const auto* physics_robots : {&yellow_physics_robots, &blue_physics_robots})
+    {
+        for (const auto& robot : *physics_robots)
         {
-            physics_ball->applyBallFrictionModel(time_step);
+            robot->setSubStepFraction(sub_step_fraction);
         }
     }
-    b2_world->Step(static_cast<float>(time_step.toSeconds()), velocity_iterations,
-                   position_iterations);
 
-    for (const auto& physics_robots : {yellow_physics_robots, blue_physics_robots})
+    for (unsigned int i = 0; i < num_sub_steps; i++)
     {
-        for (auto& robot : physics_robots)
+        // Box2D clears all forces after each step, so the forces applied by the
+        // robot wheels for this physics step must be re-applied for every sub-step.
+        // Forces applied by the contact listener are re-applied during each sub-step
+        // anyway, so they are cleared as usual.
+        if (i > 0)
         {
-            robot->runPostPhysicsStep();
+            for (const auto* physics_robots :
+                 {&yellow_physics_robots, &blue_physics_robots})
+            {
+                for (const auto& robot : *physics_robots)
+                {
+                    robot->reapplyWheelForces();
+                }
+            }
+        }
+
+        if (physics_ball)
+        {
+            // The flight state was already updated for the first sub-step before
+            // choosing the number of sub-steps
+            if (i > 0)
+            {
+                physics_ball->updateIsInFlight();
+            }
+            if (!physics_ball->isInFlight())
+            {
+                physics_ball->applyBallFrictionModel(sub_step);
+            }
+        }
+        b2_world->Step(static_cast<float>(sub_step.toSeconds()), velocity_iterations,
+                       position_iterations);
+
+        for (const auto* physics_robots : {&yellow_physics_robots, &blue_physics_robots})
+        {
+            for (const auto& robot : *physics_robots)
+            {
+                robot->runPostPhysicsStep();
+            }
+        }
+    }
+
+    for (const auto* physics_robots : {&yellow_physics_robots, &blue_physics_robots})
+    {
+        for (const auto& robot : *physics_robots)
+        {
+            robot->clearWheelForces();
         }
     }
 
     current_timestamp = current_timestamp + time_step;
+
+    const Duration step_time = Duration::fromSeconds(
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - step_start_time)
+            .count());
+    step_stats.num_steps++;
+    step_stats.num_sub_steps += num_sub_steps;
+    if (num_sub_steps > 1)
+    {
+        step_stats.num_sub_stepped_steps++;
+    }
+    step_stats.total_step_time = step_stats.total_step_time + step_time;
+    step_stats.max_step_time   = std::max(step_stats.max_step_time, step_time);
+}
+
+unsigned int PhysicsWorld::getNumSubSteps() const
+{
+    if (!physics_ball || !simulator_config->getEnableAdaptiveSubStepping()->value())
+    {
+        return 1;
+    }
+
+    // The ball passes through other objects while it is in flight, so there are no
+    // contacts to resolve more accurately
+    if (physics_ball->isInFlight())
+    {
+        return 1;
+    }
+
+    const double speed_threshold =
+        simulator_config->getSubSteppingBallSpeedThreshold()->value();
+    if (physics_ball->isTouchingRobot() ||
+        physics_ball->velocity().length() > speed_threshold)
+    {
+        return static_cast<unsigned int>(
+            std::max(simulator_config->getMaxPhysicsSubSteps()->value(), 1));
+    }
+
+    return 1;
+}
+
+const PhysicsWorldStepStats& PhysicsWorld::getStepStats() const
+{
+    return step_stats;
+}
+
+void PhysicsWorld::resetStepStats()
+{
+    step_stats = PhysicsWorldStepStats();
 }
 
 std::vector<std::weak_ptr<PhysicsRobot>> PhysicsWorld::getYellowPhysicsRobots() const
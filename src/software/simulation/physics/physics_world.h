@@ -14,6 +14,22 @@
 #include "software/world/robot_state.h"
 #include "software/world/world.h"
 
+/**
+ * Counters describing the work done by a PhysicsWorld to step the simulation
+ */
+struct PhysicsWorldStepStats
+{
+    // The number of times the simulation has been stepped
+    unsigned int num_steps = 0;
+    // The number of Box2D world steps taken, including all sub-steps
+    unsigned int num_sub_steps = 0;
+    // The number of steps that were split into more than one sub-step
+    unsigned int num_sub_stepped_steps = 0;
+    // The total and worst-case wall-clock time spent stepping the simulation
+    Duration total_step_time = Duration::fromSeconds(0);
+    Duration max_step_time   = Duration::fromSeconds(0);
+};
+
 /**
  * This class represents a World in a Box2D physics simulation. It provides a convenient
  * way for us to abstract and hold a lot of the world's contents. It's also used to
@@ -134,12 +150,30 @@ class PhysicsWorld
     RobotId getAvailableBlueRobotId() const;
 
     /**
-     * Advances the physics simulation by the given time step
+     * Advances the physics simulation by the given time step.
+     *
+     * If adaptive sub-stepping is enabled in the simulator config, the time step is
+     * split into several smaller Box2D steps while the ball is touching a robot or
+     * moving quickly, so that ball contacts are resolved more accurately without
+     * paying for small steps the rest of the time.
      *
      * @param time_step how much to advance the world physics by
      */
     void stepSimulation(const Duration& time_step);
 
+    /**
+     * Returns the counters describing the work done stepping the simulation since
+     * this world was created, or since the counters were last reset
+     *
+     * @return the step counters of this physics world
+     */
+    const PhysicsWorldStepStats& getStepStats() const;
+
+    /**
+     * Resets all the step counters of this physics world to zero
+     */
+    void resetStepStats();
+
     /**
      * Returns the yellow PhysicsRobots currently in the world
      *
@@ -213,6 +247,14 @@ class PhysicsWorld
      */
     bool isRobotIdAvailable(RobotId id, TeamColour colour) const;
 
+    /**
+     * Returns how many sub-steps the next physics step should be split into, based
+     * on the state of the ball and the simulator config
+     *
+     * @return how many sub-steps the next physics step should be split into
+     */
+    unsigned int getNumSubSteps() const;
+
     // Note: we declare the b2World first so it is destroyed last. If it is destroyed
     // before the physics objects, segfaults will occur due to pointers internal to Box2D
     // https://stackoverflow.com/questions/2254263/order-of-member-constructor-and-destructor-calls
@@ -228,6 +270,8 @@ class PhysicsWorld
 
     std::unique_ptr<SimulationContactListener> contact_listener;
 
+    PhysicsWorldStepStats step_stats;
+
     PhysicsField physics_field;
     std::shared_ptr<PhysicsBall> physics_ball;
     std::shared_ptr<const SimulatorConfig> simulator_config;
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "shared/constants.h"
+#include "software/simulation/physics/physics_world.h"
+#include "software/world/field.h"
+
+struct ScrumSimulationResult
+{
+    // The position of the ball and whether it was touching a robot after every step
+    std::vector<Point> ball_positions;
+    std::vector<bool> ball_touching_robot;
+    PhysicsWorldStepStats step_stats;
+};
+
+/**
+ * Simulates a ball being passed into a dense scrum of robots in front of the
+ * friendly goal, and records the state of the ball after every step
+ *
+ * @param simulator_config The simulator config to use for the physics world
+ * @param time_step The time step to advance the physics world by each step
+ * @param num_steps How many time steps to simulate
+ * @param record_every_n_steps Only the state of the ball after every n-th step is
+ * recorded, so that simulations with different time steps can be compared
+ *
+ * @return The recorded ball states and the step stats of the physics world
+ */
+ScrumSimulationResult simulateScrum(std::shared_ptr<SimulatorConfig> simulator_config,
+                                    const Duration& time_step, unsigned int num_steps,
+                                    unsigned int record_every_n_steps)
+{
+    Field field = Field::createSSLDivisionBField();
+    PhysicsWorld physics_world(field, simulator_config);
+
+    // The ball is passed into the crowd in front of the goal
+    Point scrum_center = field.friendlyDefenseArea().posXPosYCorner() + Vector(0.3, -0.5);
+    physics_world.setBallState(
+        BallState(scrum_center + Vector(1.5, 0.2), Vector(-5.0, -0.6)));
+
+    // Two tightly packed rings of robots crowding the scrum center, all driving
+    // towards it
+    std::vector<RobotStateWithId> yellow_robots;
+    std::vector<RobotStateWithId> blue_robots;
+    const unsigned int num_robots_per_ring = 6;
+    for (unsigned int i = 0; i < num_robots_per_ring * 2; i++)
+    {
+        double radius = ROBOT_MAX_RADIUS_METERS * 4.4;
+        Angle angle   = Angle::full() * (static_cast<double>(i % num_robots_per_ring) /
+                                       num_robots_per_ring);
+        if (i < num_robots_per_ring)
+        {
+            radius = ROBOT_MAX_RADIUS_METERS * 2.2;
+        }
+        else
+        {
+            // Offset the outer ring so its robots fill the gaps of the inner ring
+            angle += Angle::fromDegrees(30);
+        }
+        Point position  = scrum_center + Vector::createFromAngle(angle).normalize(radius);
+        Vector velocity = (scrum_center - position).normalize(1.0);
+        RobotStateWithId robot{
+            .id          = static_cast<RobotId>(i / 2),
+            .robot_state = RobotState(position, velocity, angle + Angle::half(),
+                                      AngularVelocity::zero())};
+        if (i % 2 == 0)
+        {
+            yellow_robots.emplace_back(robot);
+        }
+        else
+        {
+            blue_robots.emplace_back(robot);
+        }
+    }
+    physics_world.addYellowRobots(yellow_robots);
+    physics_world.addBlueRobots(blue_robots);
+
+    ScrumSimulationResult result;
+    for (unsigned int i = 1; i <= num_steps; i++)
+    {
+        physics_world.stepSimulation(time_step);
+        if (i % record_every_n_steps == 0)
+        {
+            result.ball_positions.emplace_back(physics_world.getBallState()->position());
+            result.ball_touching_robot.emplace_back(
+                physics_world.getPhysicsBall().lock()->isTouchingRobot());
+        }
+    }
+    result.step_stats = physics_world.getStepStats();
+
+    return result;
+}
+
+// This test is disabled to speed up CI, it can be enabled by removing "DISABLED_" from
+// the test name
+TEST(PhysicsWorldPerformanceTest, DISABLED_scrum_adaptive_sub_stepping_performance)
+{
+    const Duration time_step                  = Duration::fromSeconds(1.0 / 200.0);
+    const unsigned int num_steps              = 400;
+    const unsigned int reference_steps_factor = 16;
+    const unsigned int max_sub_steps          = 4;
+
+    auto fixed_config = std::make_shared<SimulatorConfig>();
+    fixed_config->getMutableEnableAdaptiveSubStepping()->setValue(false);
+
+    auto adaptive_config = std::make_shared<SimulatorConfig>();
+    adaptive_config->getMutableEnableAdaptiveSubStepping()->setValue(true);
+    adaptive_config->getMutableMaxPhysicsSubSteps()->setValue(max_sub_steps);
+
+    // The reference is simulated with a much smaller fixed time step, which we treat
+    // as the "ground truth" for the ball contacts
+    ScrumSimulationResult reference = simulateScrum(
+        fixed_config,
+        Duration::fromSeconds(time_step.toSeconds() / reference_steps_factor),
+        num_steps * reference_steps_factor, reference_steps_factor);
+
+    std::vector<std::pair<std::string, std::shared_ptr<SimulatorConfig>>> configs = {
+        {"Fixed single step", fixed_config},
+        {"Adaptive sub-stepping (max " + std::to_string(max_sub_steps) + " sub-steps)",
+         adaptive_config},
+    };
+
+    for (const auto& [name, config] : configs)
+    {
+        ScrumSimulationResult result = simulateScrum(config, time_step, num_steps, 1);
+
+        double total_position_error         = 0.0;
+        double max_position_error           = 0.0;
+        unsigned int num_contact_mismatches = 0;
+        for (unsigned int i = 0; i < result.ball_positions.size(); i++)
+        {
+            double error =
+                (result.ball_positions[i] - reference.ball_positions[i]).length();
+            total_position_error += error;
+            max_position_error = std::max(max_position_error, error);
+            if (result.ball_touching_robot[i] != reference.ball_touching_robot[i])
+            {
+                num_contact_mismatches++;
+            }
+        }
+
+        const PhysicsWorldStepStats& stats = result.step_stats;
+        double total_step_time_s           = stats.total_step_time.toSeconds();
+
+        std::cout << std::endl << name << ":" << std::endl;
+        std::cout << "# steps = " << stats.num_steps
+                  << " | # Box2D steps = " << stats.num_sub_steps
+                  << " | # sub-stepped steps = " << stats.num_sub_stepped_steps
+                  << std::endl;
+        std::cout << "Steps per second = " << stats.num_steps / total_step_time_s
+                  << " | Average step time = "
+                  << stats.total_step_time.toMilliseconds() / stats.num_steps
+                  << "ms | Max step time = " << stats.max_step_time.toMilliseconds()
+                  << "ms" << std::endl;
+        std::cout << "Ball position error vs reference: average = "
+                  << total_position_error / result.ball_positions.size()
+                  << "m | max = " << max_position_error << "m" << std::endl;
+        std::cout << "Ball-robot contact mismatches vs reference = "
+                  << num_contact_mismatches << " / " << result.ball_positions.size()
+                  << std::endl
+                  << std::endl;
+    }
+}
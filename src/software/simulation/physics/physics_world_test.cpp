@@ -520,3 +520,128 @@ TEST(PhysicsWorldTest, test_get_robot_at_position_near_edge_of_robot)
     EXPECT_TRUE(
         ::TestUtil::equalWithinTolerance(physics_robot->position(), Point(1, 2), 1e-3));
 }
+
+TEST(PhysicsWorldTest, test_step_stats_count_steps_without_sub_stepping)
+{
+    PhysicsWorld physics_world(Field::createSSLDivisionBField());
+    physics_world.setBallState(BallState(Point(0, 0), Vector(5, 0)));
+
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        physics_world.stepSimulation(Duration::fromSeconds(0.01));
+    }
+
+    EXPECT_EQ(3, physics_world.getStepStats().num_steps);
+    EXPECT_EQ(3, physics_world.getStepStats().num_sub_steps);
+    EXPECT_EQ(0, physics_world.getStepStats().num_sub_stepped_steps);
+
+    physics_world.resetStepStats();
+    EXPECT_EQ(0, physics_world.getStepStats().num_steps);
+    EXPECT_EQ(0, physics_world.getStepStats().num_sub_steps);
+}
+
+TEST(PhysicsWorldTest, test_adaptive_sub_stepping_with_fast_ball)
+{
+    auto simulator_config = std::make_shared<SimulatorConfig>();
+    simulator_config->getMutableEnableAdaptiveSubStepping()->setValue(true);
+    simulator_config->getMutableMaxPhysicsSubSteps()->setValue(4);
+    simulator_config->getMutableSubSteppingBallSpeedThreshold()->setValue(4.0);
+    PhysicsWorld physics_world(Field::createSSLDivisionBField(), simulator_config);
+    physics_world.setBallState(BallState(Point(0, 0), Vector(5, 0)));
+
+    physics_world.stepSimulation(Duration::fromSeconds(0.01));
+
+    EXPECT_EQ(1, physics_world.getStepStats().num_steps);
+    EXPECT_EQ(4, physics_world.getStepStats().num_sub_steps);
+    EXPECT_EQ(1, physics_world.getStepStats().num_sub_stepped_steps);
+    EXPECT_EQ(Timestamp::fromSeconds(0.01), physics_world.getTimestamp());
+    ASSERT_TRUE(physics_world.getBallState());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(0.05, 0), physics_world.getBallState()->position(), 1e-3));
+}
+
+TEST(PhysicsWorldTest, test_adaptive_sub_stepping_with_slow_ball)
+{
+    auto simulator_config = std::make_shared<SimulatorConfig>();
+    simulator_config->getMutableEnableAdaptiveSubStepping()->setValue(true);
+    simulator_config->getMutableMaxPhysicsSubSteps()->setValue(4);
+    simulator_config->getMutableSubSteppingBallSpeedThreshold()->setValue(4.0);
+    PhysicsWorld physics_world(Field::createSSLDivisionBField(), simulator_config);
+    physics_world.setBallState(BallState(Point(0, 0), Vector(1, 0)));
+
+    physics_world.stepSimulation(Duration::fromSeconds(0.01));
+
+    EXPECT_EQ(1, physics_world.getStepStats().num_sub_steps);
+    EXPECT_EQ(0, physics_world.getStepStats().num_sub_stepped_steps);
+}
+
+TEST(PhysicsWorldTest, test_adaptive_sub_stepping_applies_wheel_forces_for_whole_step)
+{
+    auto sub_stepping_config = std::make_shared<SimulatorConfig>();
+    sub_stepping_config->getMutableEnableAdaptiveSubStepping()->setValue(true);
+    sub_stepping_config->getMutableMaxPhysicsSubSteps()->setValue(4);
+    sub_stepping_config->getMutableSubSteppingBallSpeedThreshold()->setValue(4.0);
+
+    PhysicsWorld sub_stepped_world(Field::createSSLDivisionBField(), sub_stepping_config);
+    PhysicsWorld single_stepped_world(Field::createSSLDivisionBField(),
+                                      std::make_shared<SimulatorConfig>());
+
+    RobotState robot_state(Point(-2, 0), Vector(0, 0), Angle::zero(),
+                           AngularVelocity::zero());
+    for (auto* physics_world : {&sub_stepped_world, &single_stepped_world})
+    {
+        // A fast ball far away from the robot forces the step to be sub-stepped
+        physics_world->setBallState(BallState(Point(2, 0), Vector(5, 0)));
+        physics_world->addYellowRobots(
+            {RobotStateWithId{.id = 0, .robot_state = robot_state}});
+        auto robot = physics_world->getYellowPhysicsRobots().at(0).lock();
+        ASSERT_TRUE(robot);
+        robot->applyWheelForceFrontLeft(2.0);
+        robot->applyWheelForceBackLeft(2.0);
+        robot->applyWheelForceBackRight(2.0);
+        robot->applyWheelForceFrontRight(2.0);
+        physics_world->stepSimulation(Duration::fromSeconds(0.01));
+    }
+
+    ASSERT_EQ(4, sub_stepped_world.getStepStats().num_sub_steps);
+    ASSERT_EQ(1, single_stepped_world.getStepStats().num_sub_steps);
+
+    auto sub_stepped_robot_state    = sub_stepped_world.getYellowRobotStates().at(0);
+    auto single_stepped_robot_state = single_stepped_world.getYellowRobotStates().at(0);
+    // The wheel forces should have been applied for every sub-step, so the robot should
+    // have sped up by about the same amount as in the world that was not sub-stepped.
+    // The results are not identical because damping is integrated differently
+    double single_stepped_angular_velocity =
+        single_stepped_robot_state.robot_state.angularVelocity().toRadians();
+    double sub_stepped_angular_velocity =
+        sub_stepped_robot_state.robot_state.angularVelocity().toRadians();
+    EXPECT_GT(single_stepped_angular_velocity, 0.0);
+    EXPECT_NEAR(single_stepped_angular_velocity, sub_stepped_angular_velocity,
+                0.05 * single_stepped_angular_velocity);
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        single_stepped_robot_state.robot_state.velocity(),
+        sub_stepped_robot_state.robot_state.velocity(), 1e-3));
+}
+
+TEST(PhysicsWorldTest, test_adaptive_sub_stepping_sets_sub_step_fraction_of_robots)
+{
+    auto simulator_config = std::make_shared<SimulatorConfig>();
+    simulator_config->getMutableEnableAdaptiveSubStepping()->setValue(true);
+    simulator_config->getMutableMaxPhysicsSubSteps()->setValue(4);
+    simulator_config->getMutableSubSteppingBallSpeedThreshold()->setValue(4.0);
+    PhysicsWorld physics_world(Field::createSSLDivisionBField(), simulator_config);
+    physics_world.addYellowRobots({RobotStateWithId{
+        .id = 0, .robot_state = RobotState(Point(-2, 0), Vector(0, 0), Angle::zero(),
+                                           AngularVelocity::zero())}});
+    auto robot = physics_world.getYellowPhysicsRobots().at(0).lock();
+    ASSERT_TRUE(robot);
+    EXPECT_DOUBLE_EQ(1.0, robot->getSubStepFraction());
+
+    physics_world.setBallState(BallState(Point(2, 0), Vector(5, 0)));
+    physics_world.stepSimulation(Duration::fromSeconds(0.01));
+    EXPECT_DOUBLE_EQ(0.25, robot->getSubStepFraction());
+
+    physics_world.setBallState(BallState(Point(2, 0), Vector(1, 0)));
+    physics_world.stepSimulation(Duration::fromSeconds(0.01));
+    EXPECT_DOUBLE_EQ(1.0, robot->getSubStepFraction());
+}
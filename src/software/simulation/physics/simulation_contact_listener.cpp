@@ -12,16 +12,21 @@ void SimulationContactListener::BeginContact(b2Contact *contact)
         PhysicsObjectUserData *user_data_b =
             static_cast<PhysicsObjectUserData *>(fixture_b->GetUserData());
 
-        if (auto ball = isBallContact(user_data_a, user_data_b))
+        // All of our custom contact behaviour involves the ball, so contacts between
+        // any other objects (ex. robots pushing each other) are left entirely to Box2D
+        PhysicsBall *ball = isBallContact(user_data_a, user_data_b);
+        if (!ball)
         {
-            // Disable collisions with the ball if it is in flight. This is how we
-            // simulate the ball being chipped any flying over other objects
-            // in a 2D simulation
-            if (ball->isInFlight())
-            {
-                contact->SetEnabled(false);
-                return;
-            }
+            return;
+        }
+
+        // Disable collisions with the ball if it is in flight. This is how we
+        // simulate the ball being chipped any flying over other objects
+        // in a 2D simulation
+        if (ball->isInFlight())
+        {
+            contact->SetEnabled(false);
+            return;
         }
 
         if (auto ball_dribbler_pair = isDribblerBallContact(user_data_a, user_data_b))
@@ -49,16 +54,21 @@ void SimulationContactListener::PreSolve(b2Contact *contact,
         PhysicsObjectUserData *user_data_b =
             static_cast<PhysicsObjectUserData *>(fixture_b->GetUserData());
 
-        if (auto ball = isBallContact(user_data_a, user_data_b))
+        // All of our custom contact behaviour involves the ball, so contacts between
+        // any other objects (ex. robots pushing each other) are left entirely to Box2D
+        PhysicsBall *ball = isBallContact(user_data_a, user_data_b);
+        if (!ball)
         {
-            // Disable collisions with the ball if it is in flight. This is how we
-            // simulate the ball being chipped any flying over other objects
-            // in a 2D simulation
-            if (ball->isInFlight())
-            {
-                contact->SetEnabled(false);
-                return;
-            }
+            return;
+        }
+
+        // Disable collisions with the ball if it is in flight. This is how we
+        // simulate the ball being chipped any flying over other objects
+        // in a 2D simulation
+        if (ball->isInFlight())
+        {
+            contact->SetEnabled(false);
+            return;
         }
 
         if (auto ball_dribbler_pair = isDribblerBallContact(user_data_a, user_data_b))
@@ -95,16 +105,21 @@ void SimulationContactListener::EndContact(b2Contact *contact)
     PhysicsObjectUserData *user_data_b =
         static_cast<PhysicsObjectUserData *>(fixture_b->GetUserData());
 
-    if (auto ball = isBallContact(user_data_a, user_data_b))
+    // All of our custom contact behaviour involves the ball, so contacts between
+    // any other objects (ex. robots pushing each other) are left entirely to Box2D
+    PhysicsBall *ball = isBallContact(user_data_a, user_data_b);
+    if (!ball)
     {
-        // Disable collisions with the ball if it is in flight. This is how we
-        // simulate the ball being chipped any flying over other objects
-        // in a 2D simulation
-        if (ball->isInFlight())
-        {
-            contact->SetEnabled(false);
-            return;
-        }
+        return;
+    }
+
+    // Disable collisions with the ball if it is in flight. This is how we
+    // simulate the ball being chipped any flying over other objects
+    // in a 2D simulation
+    if (ball->isInFlight())
+    {
+        contact->SetEnabled(false);
+        return;
     }
 
     if (auto ball_dribbler_pair = isDribblerBallContact(user_data_a, user_data_b))
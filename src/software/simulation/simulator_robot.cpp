@@ -434,9 +434,15 @@ void SimulatorRobot::applyDribblerForce(PhysicsRobot *physics_robot,
     Vector robot_facing_vector = Vector::createFromAngle(physics_robot->orientation());
     Vector robot_perp_vector   = robot_facing_vector.perpendicular();
 
+    // This is called for every Box2D step the ball is touching the dribbler, so when
+    // the physics step is split into sub-steps the damping is spread over them, such
+    // that the ball is damped by DRIBBLER_PERPENDICULAR_DAMPING over the whole physics
+    // step no matter how many sub-steps there are
+    double perp_damping           = 1.0 - std::pow(1.0 - DRIBBLER_PERPENDICULAR_DAMPING,
+                                         physics_robot->getSubStepFraction());
     Vector ball_momentum          = physics_ball->momentum();
     Vector dribbler_perp_momentum = ball_momentum.project(robot_perp_vector);
-    physics_ball->applyImpulse(-dribbler_perp_momentum * DRIBBLER_PERPENDICULAR_DAMPING);
+    physics_ball->applyImpulse(-dribbler_perp_momentum * perp_damping);
 
     // To dribble, we apply a force towards the center and back of the dribbling area,
     // closest to the chicker. We vary the magnitude of the force by how far the ball
@@ -0,0 +1,34 @@
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
+
+std::atomic<std::size_t> CoroutineStackAllocator::num_stacks_in_use(0);
+std::atomic<std::size_t> CoroutineStackAllocator::num_bytes_in_use(0);
+
+CoroutineStackAllocator::CoroutineStackAllocator(std::size_t stack_size_bytes)
+    : stack_allocator(stack_size_bytes)
+{
+}
+
+boost::context::stack_context CoroutineStackAllocator::allocate()
+{
+    boost::context::stack_context stack = stack_allocator.allocate();
+    num_stacks_in_use++;
+    num_bytes_in_use += stack.size;
+    return stack;
+}
+
+void CoroutineStackAllocator::deallocate(boost::context::stack_context& stack) noexcept
+{
+    num_stacks_in_use--;
+    num_bytes_in_use -= stack.size;
+    stack_allocator.deallocate(stack);
+}
+
+std::size_t CoroutineStackAllocator::getNumStacksInUse()
+{
+    return num_stacks_in_use;
+}
+
+std::size_t CoroutineStackAllocator::getNumBytesInUse()
+{
+    return num_bytes_in_use;
+}
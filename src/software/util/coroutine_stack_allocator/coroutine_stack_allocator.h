@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <boost/coroutine2/all.hpp>
+#include <cstddef>
+
+/**
+ * A stack allocator for boost coroutines that allocates stacks the same way as the
+ * default fixedsize_stack, but keeps track of how many stacks and bytes of stack are in
+ * use by all the coroutines created with it. This lets us measure how much memory the
+ * coroutines of Plays, Tactics and Actions use.
+ */
+class CoroutineStackAllocator
+{
+   public:
+    /**
+     * Creates a new CoroutineStackAllocator
+     *
+     * @param stack_size_bytes The size of each stack allocated, in bytes
+     */
+    explicit CoroutineStackAllocator(
+        std::size_t stack_size_bytes = boost::context::stack_traits::default_size());
+
+    /**
+     * Allocates a new stack. This is called by boost when a coroutine is created
+     *
+     * @return the context of the new stack
+     */
+    boost::context::stack_context allocate();
+
+    /**
+     * Deallocates the given stack. This is called by boost when a coroutine is
+     * destroyed
+     *
+     * @param stack The context of the stack to deallocate
+     */
+    void deallocate(boost::context::stack_context& stack) noexcept;
+
+    /**
+     * Returns the number of stacks allocated by any CoroutineStackAllocator that have
+     * not been deallocated yet
+     *
+     * @return the number of stacks in use
+     */
+    static std::size_t getNumStacksInUse();
+
+    /**
+     * Returns the total size of the stacks allocated by any CoroutineStackAllocator that
+     * have not been deallocated yet
+     *
+     * @return the number of bytes of stack in use
+     */
+    static std::size_t getNumBytesInUse();
+
+   private:
+    boost::context::fixedsize_stack stack_allocator;
+
+    static std::atomic<std::size_t> num_stacks_in_use;
+    static std::atomic<std::size_t> num_bytes_in_use;
+};
@@ -0,0 +1,46 @@
+#include "software/util/coroutine_stack_allocator/coroutine_stack_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+typedef boost::coroutines2::coroutine<int> IntCoroutine;
+
+TEST(CoroutineStackAllocatorTest, counts_stacks_of_coroutines_in_use)
+{
+    const std::size_t stack_size_bytes = 64 * 1024;
+    std::size_t initial_num_stacks     = CoroutineStackAllocator::getNumStacksInUse();
+    std::size_t initial_num_bytes      = CoroutineStackAllocator::getNumBytesInUse();
+
+    {
+        IntCoroutine::pull_type coroutine(CoroutineStackAllocator(stack_size_bytes),
+                                          [](IntCoroutine::push_type& yield) {
+                                              yield(1);
+                                              yield(2);
+                                          });
+        EXPECT_EQ(1, coroutine.get());
+        coroutine();
+        EXPECT_EQ(2, coroutine.get());
+
+        EXPECT_EQ(initial_num_stacks + 1, CoroutineStackAllocator::getNumStacksInUse());
+        EXPECT_EQ(initial_num_bytes + stack_size_bytes,
+                  CoroutineStackAllocator::getNumBytesInUse());
+    }
+
+    EXPECT_EQ(initial_num_stacks, CoroutineStackAllocator::getNumStacksInUse());
+    EXPECT_EQ(initial_num_bytes, CoroutineStackAllocator::getNumBytesInUse());
+}
+
+TEST(CoroutineStackAllocatorTest, finished_coroutines_use_stacks_until_destroyed)
+{
+    std::size_t initial_num_stacks = CoroutineStackAllocator::getNumStacksInUse();
+
+    auto coroutine = std::make_unique<IntCoroutine::pull_type>(
+        CoroutineStackAllocator(), [](IntCoroutine::push_type& yield) { yield(1); });
+    (*coroutine)();
+    EXPECT_FALSE(*coroutine);
+    EXPECT_EQ(initial_num_stacks + 1, CoroutineStackAllocator::getNumStacksInUse());
+
+    coroutine.reset();
+    EXPECT_EQ(initial_num_stacks, CoroutineStackAllocator::getNumStacksInUse());
+}
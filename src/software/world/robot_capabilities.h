@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <bitset>
 #include <set>
 
 #include "software/util/make_enum/make_enum.h"
@@ -17,6 +18,28 @@ inline std::set<RobotCapability> allRobotCapabilities()
             RobotCapability::Move};
 }
 
+// A set of RobotCapabilities stored as one bit per capability, which is much cheaper to
+// create and compare than a std::set. The bit for a capability is at the index of its
+// underlying value, so this can hold at most MAX_NUM_ROBOT_CAPABILITIES capabilities
+static constexpr size_t MAX_NUM_ROBOT_CAPABILITIES = 8;
+using RobotCapabilityFlags = std::bitset<MAX_NUM_ROBOT_CAPABILITIES>;
+
+/**
+ * Converts a set of capabilities to flags
+ * @param capabilities the set of capabilities
+ * @return flags with the bits of the given capabilities set
+ */
+inline RobotCapabilityFlags toRobotCapabilityFlags(
+    const std::set<RobotCapability>& capabilities)
+{
+    RobotCapabilityFlags flags;
+    for (RobotCapability capability : capabilities)
+    {
+        flags.set(static_cast<size_t>(capability));
+    }
+    return flags;
+}
+
 // utility operators below for comparing capabilities
 
 /**
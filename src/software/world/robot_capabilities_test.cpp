@@ -39,3 +39,26 @@ TEST(RobotCapabilitiesTest, test_all_capabilities)
         (all == std::set<RobotCapability>{RobotCapability::Dribble, RobotCapability::Move,
                                           RobotCapability::Chip, RobotCapability::Kick}));
 }
+
+TEST(RobotCapabilitiesTest, test_capability_flags_empty)
+{
+    EXPECT_TRUE(toRobotCapabilityFlags({}).none());
+}
+
+TEST(RobotCapabilitiesTest, test_capability_flags_have_a_bit_per_capability)
+{
+    RobotCapabilityFlags kick = toRobotCapabilityFlags({RobotCapability::Kick});
+    RobotCapabilityFlags chip = toRobotCapabilityFlags({RobotCapability::Chip});
+    RobotCapabilityFlags both =
+        toRobotCapabilityFlags({RobotCapability::Kick, RobotCapability::Chip});
+    EXPECT_EQ(1, kick.count());
+    EXPECT_EQ(1, chip.count());
+    EXPECT_NE(kick, chip);
+    EXPECT_EQ(kick | chip, both);
+}
+
+TEST(RobotCapabilitiesTest, test_capability_flags_all_capabilities)
+{
+    EXPECT_EQ(allRobotCapabilities().size(),
+              toRobotCapabilityFlags(allRobotCapabilities()).count());
+}